@@ -38,7 +38,7 @@ echo Training Linear Regression model...
 cd src
 if not exist "linear_regression.exe" (
     echo Compiling...
-    gcc linear_regression.c -o linear_regression.exe -lm -Wall
+    gcc linear_regression.c ttt_rng.c -o linear_regression.exe -lm -Wall
 )
 echo.
 echo Training (this takes 2-3 minutes)...
@@ -56,7 +56,7 @@ echo Training Naive Bayes model...
 cd src
 if not exist "naive_bayes.exe" (
     echo Compiling...
-    gcc naive_bayes.c -o naive_bayes.exe -Wall
+    gcc naive_bayes.c ttt_rng.c -o naive_bayes.exe -Wall
 )
 echo.
 echo Training (this takes 1-2 minutes)...
@@ -101,7 +101,7 @@ echo Running AI vs AI Testing...
 cd src
 if not exist "ai_vs_ai.exe" (
     echo Compiling...
-    gcc ai_vs_ai_test.c -o ai_vs_ai.exe -lm -Wall
+    gcc -O2 ai_vs_ai_test.c ttt_board.c ttt_symmetry.c ttt_thread.c ttt_rng.c ttt_batch.c ttt_exact.c ttt_latency.c ttt_rating.c ttt_gamelog.c ttt_mmap.c ttt_mcts.c ttt_search.c ttt_tt.c ttt_zobrist.c ttt_model.c ttt_policy.c ttt_perfect_table.c -pthread -o ai_vs_ai.exe -lm -Wall
     if errorlevel 1 (
         echo.
         echo ERROR: Compilation failed!
@@ -0,0 +1,29 @@
+@echo off
+REM ==============================================
+REM Minimax Dataset Generator
+REM Compiles and runs dataset-gen.c
+REM Output: tic-tac-toe-minimax-*.data (the training scripts' input)
+REM ==============================================
+
+echo [1/3] Checking for GCC...
+where gcc >nul 2>nul
+if errorlevel 1 (
+    echo Error: GCC compiler not found.
+    echo Please install MinGW or MSYS2 and ensure gcc.exe is in your PATH.
+    pause
+    exit /b 1
+)
+
+echo [2/3] Compiling dataset-gen.c...
+gcc dataset-gen.c ..\src\ttt_board.c ..\src\ttt_symmetry.c ..\src\ttt_tt.c ..\src\ttt_zobrist.c ..\src\ttt_sink.c ..\src\ttt_dataset_bin.c ..\src\ttt_mmap.c -o dataset-gen.exe
+if errorlevel 1 (
+    echo ERROR: Failed to compile dataset-gen.c
+    pause
+    exit /b 1
+)
+
+echo [3/3] Running dataset-gen.exe (run it once per dataset type)...
+dataset-gen.exe %*
+
+echo Done.
+pause
@@ -40,14 +40,14 @@ if exist "tic-tac-toe-minimax-non-terminal.data" (
     echo    ✓ Found: tic-tac-toe-minimax-non-terminal.data
 ) else (
     echo    ✗ NOT FOUND: tic-tac-toe-minimax-non-terminal.data
-    echo      Generate it with: dataset-gen.exe
+    echo      Generate it with: build_dataset_gen.bat
 )
 
 if exist "tic-tac-toe-minimax-complete.data" (
     echo    ✓ Found: tic-tac-toe-minimax-complete.data
 ) else (
     echo    ✗ NOT FOUND: tic-tac-toe-minimax-complete.data
-    echo      Generate it with: dataset-gen.exe
+    echo      Generate it with: build_dataset_gen.bat
 )
 echo.
 
@@ -110,7 +110,7 @@ echo If you see any ✗ errors above, fix them before running training scripts.
 echo.
 echo Recommended actions:
 echo   1. Make sure you're in the src-haris directory
-echo   2. Generate datasets with dataset-gen.exe if missing
+echo   2. Generate datasets with build_dataset_gen.bat if missing
 echo   3. Ensure gcc is installed and in your PATH
 echo.
 echo Ready to train? Run one of these:
@@ -2,6 +2,11 @@
 #include <stdlib.h>
 #include <string.h>
 #include <time.h>
+#include "../src/ttt_board.h"
+#include "../src/ttt_symmetry.h"
+#include "../src/ttt_tt.h"
+#include "../src/ttt_zobrist.h"
+#include "../src/ttt_sink.h"
 
 #define BOARD_SIZE 9
 #define MAX_STATES 20000
@@ -18,6 +23,7 @@ typedef enum {
 typedef struct {
     char board[BOARD_SIZE];  // 'x', 'o', or 'b'
     char outcome[5];         // "win", "lose", "draw"
+    int weight;              // boards this state stands for (1 unless canonical)
 } BoardState;
 
 // Structure for dataset
@@ -30,39 +36,26 @@ typedef struct {
     int draws;
     int terminal;
     int non_terminal;
+    int canonical_only;      // keep one state per symmetry class
+    int represented;         // sum of weights
 } Dataset;
 
-// Hash table for memoization (simple implementation)
-#define MEMO_SIZE 100003
-typedef struct MemoNode {
-    char board[BOARD_SIZE];
-    char is_maximizing;
-    int score;
-    struct MemoNode *next;
-} MemoNode;
-
-typedef struct {
-    MemoNode *table[MEMO_SIZE];
-    int hits;
-    int misses;
-} MemoTable;
+// Transposition table size (2^16 slots, far more than the ~1k
+// canonical positions the search visits, so nothing is ever evicted)
+#define TT_LOG2_SLOTS 16
 
 // Function prototypes
 void init_dataset(Dataset *dataset);
 void free_dataset(Dataset *dataset);
-void add_to_dataset(Dataset *dataset, char board[BOARD_SIZE], const char *outcome);
-int check_winner(char board[BOARD_SIZE]);
-int is_valid_state(char board[BOARD_SIZE]);
-int minimax(char board[BOARD_SIZE], int is_maximizing, int alpha, int beta, MemoTable *memo);
-void generate_all_states(Dataset *dataset, int include_terminal, int include_non_terminal, MemoTable *memo);
-void save_dataset(const char *filename, Dataset *dataset);
+void add_to_dataset(Dataset *dataset, char board[BOARD_SIZE], const char *outcome, int weight);
+int check_winner(Bitboard board);
+int is_valid_state(Bitboard board);
+int minimax(Bitboard board, ZobristSym *z, int is_maximizing, int alpha, int beta, TransTable *tt);
+void generate_all_states(Dataset *dataset, int include_terminal, int include_non_terminal, TransTable *tt);
+int save_dataset(TTTSinkSet *sinks, Dataset *dataset);
 void print_statistics(Dataset *dataset);
 void display_board(char board[BOARD_SIZE]);
-unsigned long hash_board(char board[BOARD_SIZE], int is_maximizing);
-int memo_lookup(MemoTable *memo, char board[BOARD_SIZE], int is_maximizing, int *score);
-void memo_insert(MemoTable *memo, char board[BOARD_SIZE], int is_maximizing, int score);
-void init_memo_table(MemoTable *memo);
-void free_memo_table(MemoTable *memo);
+uint64_t position_key(const ZobristSym *z);
 
 // Initialize dataset
 void init_dataset(Dataset *dataset) {
@@ -74,6 +67,8 @@ void init_dataset(Dataset *dataset) {
     dataset->draws = 0;
     dataset->terminal = 0;
     dataset->non_terminal = 0;
+    dataset->canonical_only = 0;
+    dataset->represented = 0;
 }
 
 // Free dataset memory
@@ -85,7 +80,7 @@ void free_dataset(Dataset *dataset) {
 }
 
 // Add board state to dataset
-void add_to_dataset(Dataset *dataset, char board[BOARD_SIZE], const char *outcome) {
+void add_to_dataset(Dataset *dataset, char board[BOARD_SIZE], const char *outcome, int weight) {
     if (dataset->count >= dataset->capacity) {
         dataset->capacity *= 2;
         dataset->states = (BoardState *)realloc(dataset->states, 
@@ -94,7 +89,9 @@ void add_to_dataset(Dataset *dataset, char board[BOARD_SIZE], const char *outcom
     
     memcpy(dataset->states[dataset->count].board, board, BOARD_SIZE);
     strcpy(dataset->states[dataset->count].outcome, outcome);
+    dataset->states[dataset->count].weight = weight;
     dataset->count++;
+    dataset->represented += weight;
     
     // Update statistics
     if (strcmp(outcome, "win") == 0) {
@@ -107,69 +104,27 @@ void add_to_dataset(Dataset *dataset, char board[BOARD_SIZE], const char *outcom
 }
 
 // Check winner: returns WIN(1), LOSE(-1), DRAW(0), or CONTINUE(-99)
-int check_winner(char board[BOARD_SIZE]) {
-    // Win patterns: rows, columns, diagonals
-    int patterns[8][3] = {
-        {0, 1, 2}, {3, 4, 5}, {6, 7, 8},  // Rows
-        {0, 3, 6}, {1, 4, 7}, {2, 5, 8},  // Columns
-        {0, 4, 8}, {2, 4, 6}              // Diagonals
-    };
-    
-    // Check for winner
-    for (int i = 0; i < 8; i++) {
-        if (board[patterns[i][0]] == board[patterns[i][1]] && 
-            board[patterns[i][1]] == board[patterns[i][2]] && 
-            board[patterns[i][0]] != 'b') {
-            
-            if (board[patterns[i][0]] == 'x') {
-                return WIN;
-            } else {
-                return LOSE;
-            }
-        }
-    }
-    
-    // Check for draw (board full)
-    for (int i = 0; i < BOARD_SIZE; i++) {
-        if (board[i] == 'b') {
-            return CONTINUE;
-        }
+int check_winner(Bitboard board) {
+    switch (bb_status(board)) {
+        case TTT_X_WINS: return WIN;
+        case TTT_O_WINS: return LOSE;
+        case TTT_DRAW:   return DRAW;
+        default:         return CONTINUE;
     }
-    
-    return DRAW;
 }
 
 // Check if board state is valid (reachable through legal play)
-int is_valid_state(char board[BOARD_SIZE]) {
-    int x_count = 0, o_count = 0;
-    
-    // Count X's and O's
-    for (int i = 0; i < BOARD_SIZE; i++) {
-        if (board[i] == 'x') x_count++;
-        else if (board[i] == 'o') o_count++;
-    }
+int is_valid_state(Bitboard board) {
+    int x_count = bb_popcount(board.x);
+    int o_count = bb_popcount(board.o);
     
     // X goes first: x_count == o_count or x_count == o_count + 1
     if (!(x_count == o_count || x_count == o_count + 1)) {
         return 0;
     }
     
-    // Check if both players won (impossible)
-    int x_wins = 0, o_wins = 0;
-    int patterns[8][3] = {
-        {0, 1, 2}, {3, 4, 5}, {6, 7, 8},
-        {0, 3, 6}, {1, 4, 7}, {2, 5, 8},
-        {0, 4, 8}, {2, 4, 6}
-    };
-    
-    for (int i = 0; i < 8; i++) {
-        if (board[patterns[i][0]] == board[patterns[i][1]] && 
-            board[patterns[i][1]] == board[patterns[i][2]]) {
-            
-            if (board[patterns[i][0]] == 'x') x_wins = 1;
-            else if (board[patterns[i][0]] == 'o') o_wins = 1;
-        }
-    }
+    int x_wins = bb_has_line(board.x);
+    int o_wins = bb_has_line(board.o);
     
     // Both can't win
     if (x_wins && o_wins) {
@@ -189,129 +144,85 @@ int is_valid_state(char board[BOARD_SIZE]) {
     return 1;
 }
 
-// Initialize memoization table
-void init_memo_table(MemoTable *memo) {
-    for (int i = 0; i < MEMO_SIZE; i++) {
-        memo->table[i] = NULL;
-    }
-    memo->hits = 0;
-    memo->misses = 0;
+// Transposition table key: the symmetry-invariant Zobrist hash, so
+// rotations/reflections share an entry (the minimax value is invariant).
+// 0 marks empty slots, so it is folded onto 1.
+uint64_t position_key(const ZobristSym *z) {
+    uint64_t key = ttt_zobrist_sym_key(z);
+    return key ? key : 1;
 }
 
-// Free memoization table
-void free_memo_table(MemoTable *memo) {
-    for (int i = 0; i < MEMO_SIZE; i++) {
-        MemoNode *node = memo->table[i];
-        while (node != NULL) {
-            MemoNode *temp = node;
-            node = node->next;
-            free(temp);
-        }
-    }
-}
-
-// Hash function for board
-unsigned long hash_board(char board[BOARD_SIZE], int is_maximizing) {
-    unsigned long hash = is_maximizing ? 5381 : 7919;
-    
-    for (int i = 0; i < BOARD_SIZE; i++) {
-        hash = ((hash << 5) + hash) + board[i];
-    }
-    
-    return hash % MEMO_SIZE;
-}
-
-// Lookup in memoization table
-int memo_lookup(MemoTable *memo, char board[BOARD_SIZE], int is_maximizing, int *score) {
-    unsigned long hash = hash_board(board, is_maximizing);
-    MemoNode *node = memo->table[hash];
-    
-    while (node != NULL) {
-        if (node->is_maximizing == is_maximizing && 
-            memcmp(node->board, board, BOARD_SIZE) == 0) {
-            *score = node->score;
-            memo->hits++;
-            return 1;
-        }
-        node = node->next;
-    }
-    
-    memo->misses++;
-    return 0;
-}
-
-// Insert into memoization table
-void memo_insert(MemoTable *memo, char board[BOARD_SIZE], int is_maximizing, int score) {
-    unsigned long hash = hash_board(board, is_maximizing);
-    
-    MemoNode *new_node = (MemoNode *)malloc(sizeof(MemoNode));
-    memcpy(new_node->board, board, BOARD_SIZE);
-    new_node->is_maximizing = is_maximizing;
-    new_node->score = score;
-    new_node->next = memo->table[hash];
-    memo->table[hash] = new_node;
-}
-
-// Minimax algorithm with alpha-beta pruning and memoization
-int minimax(char board[BOARD_SIZE], int is_maximizing, int alpha, int beta, MemoTable *memo) {
-    // Check memoization
-    int cached_score;
-    if (memo_lookup(memo, board, is_maximizing, &cached_score)) {
-        return cached_score;
-    }
-    
+// Minimax algorithm with alpha-beta pruning and a transposition table.
+// Scores from a cut-off search are only bounds, so entries carry a flag
+// and are reused only when they settle the current window.
+// z holds the hashes of board and is updated in place on make/unmake.
+int minimax(Bitboard board, ZobristSym *z, int is_maximizing, int alpha, int beta, TransTable *tt) {
     // Check terminal state
     int winner = check_winner(board);
     if (winner != CONTINUE) {
         return winner;
     }
     
+    // Check transposition table (the search always runs to the end of
+    // the game, so the remaining depth is the number of empty cells)
+    uint64_t key = position_key(z);
+    int depth = bb_count_empty(board);
+    int cached_score;
+    if (tt_apply_bounds(tt, tt_probe(tt, key), depth, &alpha, &beta, &cached_score)) {
+        return cached_score;
+    }
+    
+    int alpha_orig = alpha;
+    int beta_orig = beta;
     int best_score;
     
     if (is_maximizing) {
         best_score = -1000;
         
-        for (int i = 0; i < BOARD_SIZE; i++) {
-            if (board[i] == 'b') {
-                board[i] = 'x';
-                int score = minimax(board, 0, alpha, beta, memo);
-                board[i] = 'b';
-                
-                if (score > best_score) {
-                    best_score = score;
-                }
-                if (score > alpha) {
-                    alpha = score;
-                }
-                if (beta <= alpha) {
-                    break;  // Beta cutoff
-                }
+        for (uint16_t m = bb_empty_cells(board); m; m &= m - 1) {
+            int pos = bb_ctz(m);
+            Bitboard child = board;
+            child.x |= (uint16_t)(m & -m);
+            ttt_zobrist_sym_toggle(z, pos, TTT_SIDE_X);
+            int score = minimax(child, z, 0, alpha, beta, tt);
+            ttt_zobrist_sym_toggle(z, pos, TTT_SIDE_X);
+            
+            if (score > best_score) {
+                best_score = score;
+            }
+            if (score > alpha) {
+                alpha = score;
+            }
+            if (beta <= alpha) {
+                break;  // Beta cutoff
             }
         }
     } else {
         best_score = 1000;
         
-        for (int i = 0; i < BOARD_SIZE; i++) {
-            if (board[i] == 'b') {
-                board[i] = 'o';
-                int score = minimax(board, 1, alpha, beta, memo);
-                board[i] = 'b';
-                
-                if (score < best_score) {
-                    best_score = score;
-                }
-                if (score < beta) {
-                    beta = score;
-                }
-                if (beta <= alpha) {
-                    break;  // Alpha cutoff
-                }
+        for (uint16_t m = bb_empty_cells(board); m; m &= m - 1) {
+            int pos = bb_ctz(m);
+            Bitboard child = board;
+            child.o |= (uint16_t)(m & -m);
+            ttt_zobrist_sym_toggle(z, pos, TTT_SIDE_O);
+            int score = minimax(child, z, 1, alpha, beta, tt);
+            ttt_zobrist_sym_toggle(z, pos, TTT_SIDE_O);
+            
+            if (score < best_score) {
+                best_score = score;
+            }
+            if (score < beta) {
+                beta = score;
+            }
+            if (beta <= alpha) {
+                break;  // Alpha cutoff
             }
         }
     }
     
-    // Store in memoization table
-    memo_insert(memo, board, is_maximizing, best_score);
+    // Store with the bound type implied by the window we searched
+    tt_store(tt, key, best_score, depth, 
+             tt_flag_for(best_score, alpha_orig, beta_orig), -1);
     
     return best_score;
 }
@@ -319,15 +230,24 @@ int minimax(char board[BOARD_SIZE], int is_maximizing, int alpha, int beta, Memo
 // Generate all possible board states recursively
 void generate_state_recursive(char board[BOARD_SIZE], int pos, Dataset *dataset, 
                               int include_terminal, int include_non_terminal, 
-                              MemoTable *memo) {
+                              TransTable *tt) {
     if (pos == BOARD_SIZE) {
+        Bitboard bb = bb_from_chars(board, 'x', 'o');
+        
         // Check if valid state
-        if (!is_valid_state(board)) {
+        if (!is_valid_state(bb)) {
             return;
         }
         
+        // In canonical mode keep only the representative of each symmetry class
+        int code = bb_to_code(bb);
+        if (dataset->canonical_only && !ttt_sym_is_canonical(code)) {
+            return;
+        }
+        int weight = dataset->canonical_only ? ttt_sym_weight[code] : 1;
+        
         // Check if terminal or non-terminal
-        int winner = check_winner(board);
+        int winner = check_winner(bb);
         int is_terminal = (winner != CONTINUE);
         
         // Filter based on preferences
@@ -358,14 +278,10 @@ void generate_state_recursive(char board[BOARD_SIZE], int pos, Dataset *dataset,
             }
         } else {
             // Use minimax evaluation for non-terminal states
-            int x_count = 0, o_count = 0;
-            for (int i = 0; i < BOARD_SIZE; i++) {
-                if (board[i] == 'x') x_count++;
-                else if (board[i] == 'o') o_count++;
-            }
-            
-            int is_x_turn = (x_count == o_count);
-            int minimax_score = minimax(board, is_x_turn, -1000, 1000, memo);
+            int is_x_turn = (bb_side_to_move(bb) == TTT_SIDE_X);
+            ZobristSym z;
+            ttt_zobrist_sym_init(&z, bb);
+            int minimax_score = minimax(bb, &z, is_x_turn, -1000, 1000, tt);
             
             if (minimax_score > 0) {
                 outcome = "win";
@@ -377,7 +293,7 @@ void generate_state_recursive(char board[BOARD_SIZE], int pos, Dataset *dataset,
         }
         
         // Add to dataset
-        add_to_dataset(dataset, board, outcome);
+        add_to_dataset(dataset, board, outcome, weight);
         return;
     }
     
@@ -386,19 +302,19 @@ void generate_state_recursive(char board[BOARD_SIZE], int pos, Dataset *dataset,
     for (int i = 0; i < 3; i++) {
         board[pos] = values[i];
         generate_state_recursive(board, pos + 1, dataset, include_terminal, 
-                                include_non_terminal, memo);
+                                include_non_terminal, tt);
     }
 }
 
 // Generate all states
 void generate_all_states(Dataset *dataset, int include_terminal, 
-                        int include_non_terminal, MemoTable *memo) {
+                        int include_non_terminal, TransTable *tt) {
     char board[BOARD_SIZE];
     printf("Generating all valid board states...\n");
     printf("This may take 30-60 seconds...\n\n");
     
     generate_state_recursive(board, 0, dataset, include_terminal, 
-                            include_non_terminal, memo);
+                            include_non_terminal, tt);
     
     printf("\n✓ Generation complete!\n");
     printf("✓ Generated %d valid game states\n", dataset->count);
@@ -427,6 +343,10 @@ void print_statistics(Dataset *dataset) {
     printf("DATASET STATISTICS\n");
     printf("========================================\n");
     printf("\nTotal states: %d\n", dataset->count);
+    if (dataset->canonical_only) {
+        printf("Symmetry-canonical: each state weighted by its class size\n");
+        printf("Boards represented: %d\n", dataset->represented);
+    }
     
     printf("\nState types:\n");
     printf("  Terminal states:     %5d (%5.2f%%)\n", 
@@ -455,27 +375,31 @@ void print_statistics(Dataset *dataset) {
 }
 
 // Save dataset to file
-void save_dataset(const char *filename, Dataset *dataset) {
-    FILE *fp = fopen(filename, "w");
-    if (fp == NULL) {
-        printf("Error: Could not create file %s\n", filename);
-        return;
-    }
-    
+// Write the dataset to every output sink in one pass
+int save_dataset(TTTSinkSet *sinks, Dataset *dataset) {
     for (int i = 0; i < dataset->count; i++) {
-        // Write board
-        for (int j = 0; j < BOARD_SIZE; j++) {
-            fprintf(fp, "%c", dataset->states[i].board[j]);
-            if (j < BOARD_SIZE - 1) {
-                fprintf(fp, ",");
-            }
-        }
-        // Write outcome
-        fprintf(fp, ",%s\n", dataset->states[i].outcome);
+        BoardState *state = &dataset->states[i];
+        TTTRow row;
+        
+        // Outcomes here are X's; sinks take them for the side to move
+        int x_outcome = strcmp(state->outcome, "win") == 0 ? 1 : 
+                        (strcmp(state->outcome, "lose") == 0 ? -1 : 0);
+        row.board = bb_from_chars(state->board, 'x', 'o');
+        row.side = bb_side_to_move(row.board);
+        row.outcome = (row.side == TTT_SIDE_X) ? x_outcome : -x_outcome;
+        row.best_move = -1;
+        row.weight = state->weight;
+        ttt_sinks_emit(sinks, &row);
     }
     
-    fclose(fp);
-    printf("\n✓ Dataset saved to: %s\n", filename);
+    if (!ttt_sinks_close(sinks)) {
+        return 0;
+    }
+    for (int i = 0; i < sinks->count; i++) {
+        printf("\n✓ Dataset saved to: %s (%s)\n", sinks->sinks[i].path, 
+               ttt_sink_format_name(sinks->sinks[i].format));
+    }
+    return 1;
 }
 
 // Show example states
@@ -489,7 +413,7 @@ void show_examples(Dataset *dataset) {
     
     for (int i = 0; i < dataset->count && !(shown_win && shown_draw && shown_lose); i++) {
         BoardState *state = &dataset->states[i];
-        int winner = check_winner(state->board);
+        int winner = check_winner(bb_from_chars(state->board, 'x', 'o'));
         
         // Only show non-terminal examples
         if (winner != CONTINUE) {
@@ -520,7 +444,30 @@ void show_examples(Dataset *dataset) {
     printf("========================================\n");
 }
 
-int main() {
+int main(int argc, char *argv[]) {
+    int canonical_only = 0;
+    TTTSinkSet sinks;
+    ttt_sinks_init(&sinks);
+    
+    // --out [data|csv|bin:]path (repeatable) writes every format in one run;
+    // without it the dataset goes to the usual .data file
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--canonical") == 0) {
+            canonical_only = 1;
+        } else if (strcmp(argv[i], "--out") == 0 && i + 1 < argc) {
+            if (!ttt_sinks_add(&sinks, argv[++i], TTT_SINK_DATA)) {
+                return 1;
+            }
+        }
+    }
+    
+    // Open now so a stdout sink takes over stdout before anything is printed
+    int explicit_outputs = sinks.count;
+    if (explicit_outputs && !ttt_sinks_open(&sinks, canonical_only)) {
+        ttt_sinks_close(&sinks);
+        return 1;
+    }
+    
     printf("========================================\n");
     printf("OPTIMAL TIC-TAC-TOE DATASET GENERATOR\n");
     printf("Using Minimax Algorithm (C Implementation)\n");
@@ -562,23 +509,33 @@ int main() {
         strcpy(filename, "tic-tac-toe-minimax-complete.data");
     }
     
+    if (canonical_only) {
+        // e.g. tic-tac-toe-minimax-complete-canonical.data
+        strcpy(strrchr(filename, '.'), "-canonical.data");
+        printf("\n🔁 Canonical mode: one state per rotation/reflection class\n");
+    }
+    
     // Initialize
     Dataset dataset;
-    MemoTable memo;
+    TransTable tt;
     init_dataset(&dataset);
-    init_memo_table(&memo);
+    ttt_sym_init();
+    ttt_zobrist_init();
+    if (!tt_init(&tt, TT_LOG2_SLOTS)) {
+        fprintf(stderr, "Error: Memory allocation failed for transposition table\n");
+        exit(1);
+    }
+    dataset.canonical_only = canonical_only;
     
     // Generate dataset
     clock_t start = clock();
-    generate_all_states(&dataset, include_terminal, include_non_terminal, &memo);
+    generate_all_states(&dataset, include_terminal, include_non_terminal, &tt);
     clock_t end = clock();
     
     double time_taken = ((double)(end - start)) / CLOCKS_PER_SEC;
     
     printf("\n⏱️  Generation time: %.2f seconds\n", time_taken);
-    printf("📊 Memoization hits: %d, misses: %d (hit rate: %.2f%%)\n",
-           memo.hits, memo.misses, 
-           (memo.hits * 100.0) / (memo.hits + memo.misses));
+    tt_print_stats(&tt);
     
     // Print statistics
     print_statistics(&dataset);
@@ -588,12 +545,25 @@ int main() {
     
     // Save dataset
     printf("\n💾 Saving dataset...\n");
-    save_dataset(filename, &dataset);
+    if (!explicit_outputs) {
+        if (!ttt_sinks_add(&sinks, filename, TTT_SINK_DATA) || 
+            !ttt_sinks_open(&sinks, canonical_only)) {
+            ttt_sinks_close(&sinks);
+            return 1;
+        }
+    }
+    if (!save_dataset(&sinks, &dataset)) {
+        return 1;
+    }
     
     printf("\n========================================\n");
     printf("✓ GENERATION COMPLETE!\n");
     printf("========================================\n");
-    printf("\nGenerated file: %s\n", filename);
+    printf("\nGenerated file%s:", sinks.count > 1 ? "s" : "");
+    for (int i = 0; i < sinks.count; i++) {
+        printf(" %s", sinks.sinks[i].path);
+    }
+    printf("\n");
     printf("Total samples: %d\n", dataset.count);
     
     printf("\n🎯 USAGE RECOMMENDATIONS:\n");
@@ -611,7 +581,7 @@ int main() {
     
     // Cleanup
     free_dataset(&dataset);
-    free_memo_table(&memo);
+    tt_free(&tt);
     
     return 0;
 }
\ No newline at end of file
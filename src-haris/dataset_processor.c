@@ -1,7 +1,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <time.h>
+#include "../src/ttt_dataset_bin.h"
+#include "../src/ttt_rng.h"
 
 #define FEATURES 9
 #define INITIAL_CAPACITY 1000  // Start with 1000, will expand as needed
@@ -10,6 +11,7 @@
 typedef struct {
     char features[FEATURES];  // 'x', 'o', or 'b' for each square
     char outcome;             // 'w' for win, 'l' for lose, 'd' for draw
+    int weight;               // boards represented (symmetry-canonical input), else 1
 } Sample;
 
 // Structure to hold the dataset
@@ -17,6 +19,7 @@ typedef struct {
     Sample *data;
     int size;
     int capacity;
+    int weighted;             // input carried a weight column; keep it on save
 } Dataset;
 
 // Function prototypes
@@ -24,6 +27,7 @@ void initDataset(Dataset *dataset);
 void expandDataset(Dataset *dataset);
 void freeDataset(Dataset *dataset);
 int readDataset(const char *filename, Dataset *dataset);
+int readDatasetBinary(const char *filename, Dataset *dataset);
 void shuffleDataset(Dataset *dataset);
 void splitDataset(Dataset *full, Dataset *train, Dataset *test, double train_ratio);
 int saveDataset(const char *filename, Dataset *dataset);
@@ -40,6 +44,7 @@ void initDataset(Dataset *dataset) {
         exit(1);
     }
     dataset->size = 0;
+    dataset->weighted = 0;
 }
 
 // Expand dataset capacity when needed
@@ -65,12 +70,13 @@ void freeDataset(Dataset *dataset) {
     }
 }
 
+// Seeded in main (--seed N repeats a run)
+static TTTRng g_rng;
+
 // Function to shuffle the dataset using Fisher-Yates algorithm
 void shuffleDataset(Dataset *dataset) {
-    srand(time(NULL));
-    
     for (int i = dataset->size - 1; i > 0; i--) {
-        int j = rand() % (i + 1);
+        int j = (int)ttt_rng_below(&g_rng, (uint32_t)i + 1);
         
         // Swap dataset->data[i] and dataset->data[j]
         Sample temp = dataset->data[i];
@@ -81,8 +87,40 @@ void shuffleDataset(Dataset *dataset) {
     printf("Dataset shuffled randomly\n");
 }
 
+// Read a binary dataset (.ttds from ttt_stategen --bin) through mmap
+int readDatasetBinary(const char *filename, Dataset *dataset) {
+    TTDSFile file;
+    if (!ttt_ds_open(&file, filename)) {
+        return 0;
+    }
+    
+    dataset->weighted = (file.header->flags & TTT_DS_CANONICAL) != 0;
+    for (uint32_t r = 0; r < file.count; r++) {
+        if (dataset->size >= dataset->capacity) {
+            expandDataset(dataset);
+        }
+        
+        TTDSRecord rec = file.records[r];
+        Sample *s = &dataset->data[dataset->size++];
+        bb_to_chars(ttt_ds_board(rec), s->features, 'x', 'o', 'b');
+        
+        // Outcomes are stored for the side to move; .data labels are X's
+        int outcome = ttt_ds_x_outcome(rec);
+        s->outcome = outcome > 0 ? 'w' : (outcome < 0 ? 'l' : 'd');
+        s->weight = ttt_ds_weight(&file, rec);
+    }
+    
+    ttt_ds_close(&file);
+    printf("Successfully loaded %d samples from %s (binary)\n", dataset->size, filename);
+    return 1;
+}
+
 // Function to open and read the dataset file (DYNAMIC SIZE)
 int readDataset(const char *filename, Dataset *dataset) {
+    if (ttt_ds_is_binary(filename)) {
+        return readDatasetBinary(filename, dataset);
+    }
+    
     FILE *fp = fopen(filename, "r");
     if (fp == NULL) {
         fprintf(stderr, "Error: Could not open file %s\n", filename);
@@ -155,6 +193,19 @@ int readDataset(const char *filename, Dataset *dataset) {
                         token, line_num);
                 continue;
             }
+            // Canonical datasets append a numeric weight after the outcome
+            dataset->data[dataset->size].weight = 1;
+            token = strtok(NULL, ",");
+            if (token != NULL) {
+                int weight = atoi(token);
+                if (weight < 1) {
+                    fprintf(stderr, "Warning: Invalid weight '%s' at line %d, skipping\n", 
+                            token, line_num);
+                    continue;
+                }
+                dataset->data[dataset->size].weight = weight;
+                dataset->weighted = 1;
+            }
             dataset->size++;
         } else {
             fprintf(stderr, "Warning: Missing outcome at line %d, skipping\n", line_num);
@@ -175,6 +226,8 @@ void splitDataset(Dataset *full, Dataset *train, Dataset *test, double train_rat
     // Initialize train and test datasets
     initDataset(train);
     initDataset(test);
+    train->weighted = full->weighted;
+    test->weighted = full->weighted;
     
     // Ensure capacity
     if (train_size > train->capacity) {
@@ -246,9 +299,13 @@ int saveDataset(const char *filename, Dataset *dataset) {
             if (j < FEATURES - 1) fprintf(fp, ",");
         }
         // Write outcome
-        fprintf(fp, ",%s\n", 
+        fprintf(fp, ",%s", 
                 dataset->data[i].outcome == 'w' ? "win" : 
                 (dataset->data[i].outcome == 'l' ? "lose" : "draw"));
+        if (dataset->weighted) {
+            fprintf(fp, ",%d", dataset->data[i].weight);
+        }
+        fprintf(fp, "\n");
     }
     
     fclose(fp);
@@ -332,6 +389,12 @@ int saveReport(const char *filename, Dataset *full, Dataset *train, Dataset *tes
             (train->size * 100.0) / full->size, 
             (test->size * 100.0) / full->size);
     fprintf(fp, "Features per sample: %d\n", FEATURES);
+    if (full->weighted) {
+        int represented = 0;
+        for (int i = 0; i < full->size; i++) represented += full->data[i].weight;
+        fprintf(fp, "Sample weights: YES (symmetry-canonical, %d boards represented)\n", 
+                represented);
+    }
     fprintf(fp, "Feature encoding: x (X player), o (O player), b (blank)\n");
     fprintf(fp, "Target variable: win, lose, draw (3 classes)\n");
     fprintf(fp, "Shuffling: YES (Random seed based on system time)\n");
@@ -353,6 +416,9 @@ int saveReport(const char *filename, Dataset *full, Dataset *train, Dataset *tes
 }
 
 int main(int argc, char *argv[]) {
+    uint64_t seed = ttt_rng_take_seed(&argc, argv);
+    ttt_rng_seed(&g_rng, seed);
+    
     Dataset fullDataset, trainSet, testSet;
     char input_filename[256];
     char train_filename[256];
@@ -365,6 +431,7 @@ int main(int argc, char *argv[]) {
     printf("TIC-TAC-TOE DATASET PROCESSOR\n");
     printf("Dynamic Size - Works with dataset-gen.c\n");
     printf("========================================\n\n");
+    printf("Random seed: %llu\n\n", (unsigned long long)seed);
     
     // Get input filename
     if (argc > 1) {
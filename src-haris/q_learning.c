@@ -1,11 +1,15 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <time.h>
 #include <math.h>
+#include "../src/ttt_board.h"
+#include "../src/ttt_index.h"
+#include "../src/ttt_symmetry.h"
+#include "../src/ttt_dataset_bin.h"
+#include "../src/ttt_rng.h"
+#include "../src/ttt_gamelog.h"
 
 #define BOARD_SIZE 9
-#define Q_TABLE_SIZE 20000
 #define MAX_EPISODES 50000
 #define EMPTY 'b'
 #define PLAYER_X 'x'
@@ -22,24 +26,23 @@
 #define REWARD_LOSE -1.0
 #define REWARD_INVALID -2.0
 
-// Structure for Q-table entry
-typedef struct QEntry {
-    char board[BOARD_SIZE];
-    int action;              // 0-8 position
-    double q_value;
-    int visits;
-    struct QEntry *next;     // For hash collision chaining
-} QEntry;
-
-// Hash table for Q-values
+// Flat Q-table: one row of BOARD_SIZE actions per legal position,
+// addressed by the dense position index from ttt_index.h.
+// An entry exists once it has been visited at least once.
 typedef struct {
-    QEntry *table[Q_TABLE_SIZE];
+    double (*q_value)[BOARD_SIZE];
+    int (*visits)[BOARD_SIZE];
     int total_entries;
 } QTable;
 
-// Game state
+// Exploration and the test opponent draw from here (seeded in main)
+static TTTRng g_rng;
+
+// Game state; code is the board's base-3 code, updated move by move
+// and used directly as the Q-table key
 typedef struct {
-    char board[BOARD_SIZE];
+    Bitboard board;
+    int code;
     int game_over;
     char winner;
 } GameState;
@@ -47,163 +50,129 @@ typedef struct {
 // Function prototypes
 void init_qtable(QTable *qt);
 void free_qtable(QTable *qt);
-unsigned long hash_board(char board[BOARD_SIZE]);
-double get_q_value(QTable *qt, char board[BOARD_SIZE], int action);
-void update_q_value(QTable *qt, char board[BOARD_SIZE], int action, double value);
+const double *q_row(QTable *qt, int code);
+double get_q_value(QTable *qt, int code, int action);
+void update_q_value(QTable *qt, int code, int action, double value);
 void init_board(GameState *game);
-char check_winner(char board[BOARD_SIZE]);
-int is_valid_move(char board[BOARD_SIZE], int pos);
-int get_valid_moves(char board[BOARD_SIZE], int moves[BOARD_SIZE]);
-int choose_action(QTable *qt, char board[BOARD_SIZE], double epsilon);
-int choose_best_action(QTable *qt, char board[BOARD_SIZE]);
-double get_max_q_value(QTable *qt, char board[BOARD_SIZE]);
-void train_q_learning(QTable *qt, int episodes);
+void play_move(GameState *game, int pos, int side);
+char check_winner(Bitboard board);
+int is_valid_move(Bitboard board, int pos);
+int get_valid_moves(Bitboard board, int moves[BOARD_SIZE]);
+int choose_action(QTable *qt, Bitboard board, int code, double epsilon);
+int choose_best_action(QTable *qt, Bitboard board, int code);
+double get_max_q_value(QTable *qt, Bitboard board, int code);
+void train_q_learning(QTable *qt, int episodes, TTGLWriter *log);
 void save_qtable(const char *filename, QTable *qt);
 void load_minimax_dataset(const char *filename, QTable *qt);
+void load_minimax_dataset_binary(const char *filename, QTable *qt);
+void seed_q_values(QTable *qt, Bitboard bb, double init_value, int expand_symmetries);
 void test_q_learning(QTable *qt, int test_games);
-void print_board(char board[BOARD_SIZE]);
+void print_board(Bitboard board);
 
 // Initialize Q-table
 void init_qtable(QTable *qt) {
-    for (int i = 0; i < Q_TABLE_SIZE; i++) {
-        qt->table[i] = NULL;
+    ttt_index_init();
+    ttt_sym_init();
+    qt->q_value = calloc(TTT_NUM_POSITIONS, sizeof(*qt->q_value));
+    qt->visits = calloc(TTT_NUM_POSITIONS, sizeof(*qt->visits));
+    if (qt->q_value == NULL || qt->visits == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for Q-table\n");
+        exit(1);
     }
     qt->total_entries = 0;
 }
 
 // Free Q-table memory
 void free_qtable(QTable *qt) {
-    for (int i = 0; i < Q_TABLE_SIZE; i++) {
-        QEntry *entry = qt->table[i];
-        while (entry != NULL) {
-            QEntry *temp = entry;
-            entry = entry->next;
-            free(temp);
-        }
-    }
+    free(qt->q_value);
+    free(qt->visits);
+    qt->q_value = NULL;
+    qt->visits = NULL;
 }
 
-// Hash function for board state
-unsigned long hash_board(char board[BOARD_SIZE]) {
-    unsigned long hash = 5381;
-    for (int i = 0; i < BOARD_SIZE; i++) {
-        hash = ((hash << 5) + hash) + board[i];
-    }
-    return hash % Q_TABLE_SIZE;
+// Q-values of every action of a state (NULL for an illegal position).
+// Callers scanning several actions look the row up once.
+const double *q_row(QTable *qt, int code) {
+    int idx = ttt_index_of_code(code);
+    return idx < 0 ? NULL : qt->q_value[idx];
 }
 
 // Get Q-value for state-action pair
-double get_q_value(QTable *qt, char board[BOARD_SIZE], int action) {
-    unsigned long hash = hash_board(board);
-    QEntry *entry = qt->table[hash];
-    
-    while (entry != NULL) {
-        if (entry->action == action && 
-            memcmp(entry->board, board, BOARD_SIZE) == 0) {
-            return entry->q_value;
-        }
-        entry = entry->next;
-    }
-    
-    return 0.0; // Default Q-value for unseen state-action
+double get_q_value(QTable *qt, int code, int action) {
+    const double *row = q_row(qt, code);
+    return row ? row[action] : 0.0; // Unseen state-actions stay at 0.0
 }
 
 // Update Q-value for state-action pair
-void update_q_value(QTable *qt, char board[BOARD_SIZE], int action, double value) {
-    unsigned long hash = hash_board(board);
-    QEntry *entry = qt->table[hash];
-    
-    // Search for existing entry
-    while (entry != NULL) {
-        if (entry->action == action && 
-            memcmp(entry->board, board, BOARD_SIZE) == 0) {
-            entry->q_value = value;
-            entry->visits++;
-            return;
-        }
-        entry = entry->next;
-    }
+void update_q_value(QTable *qt, int code, int action, double value) {
+    int idx = ttt_index_of_code(code);
+    if (idx < 0) return;
     
-    // Create new entry
-    QEntry *new_entry = (QEntry *)malloc(sizeof(QEntry));
-    memcpy(new_entry->board, board, BOARD_SIZE);
-    new_entry->action = action;
-    new_entry->q_value = value;
-    new_entry->visits = 1;
-    new_entry->next = qt->table[hash];
-    qt->table[hash] = new_entry;
-    qt->total_entries++;
+    if (qt->visits[idx][action] == 0) {
+        qt->total_entries++;
+    }
+    qt->q_value[idx][action] = value;
+    qt->visits[idx][action]++;
 }
 
 // Initialize board
 void init_board(GameState *game) {
-    for (int i = 0; i < BOARD_SIZE; i++) {
-        game->board[i] = EMPTY;
-    }
+    game->board = bb_empty_board();
+    game->code = 0;
     game->game_over = 0;
     game->winner = ' ';
 }
 
+// Make a move, keeping the board and its code in step
+void play_move(GameState *game, int pos, int side) {
+    bb_toggle(&game->board, pos, side);
+    game->code = bb_code_play(game->code, pos, side);
+}
+
 // Check winner
-char check_winner(char board[BOARD_SIZE]) {
-    int wins[8][3] = {
-        {0, 1, 2}, {3, 4, 5}, {6, 7, 8},  // Rows
-        {0, 3, 6}, {1, 4, 7}, {2, 5, 8},  // Columns
-        {0, 4, 8}, {2, 4, 6}              // Diagonals
-    };
-    
-    for (int i = 0; i < 8; i++) {
-        if (board[wins[i][0]] == board[wins[i][1]] && 
-            board[wins[i][1]] == board[wins[i][2]] && 
-            board[wins[i][0]] != EMPTY) {
-            return board[wins[i][0]];
-        }
-    }
-    
-    // Check for draw
-    for (int i = 0; i < BOARD_SIZE; i++) {
-        if (board[i] == EMPTY) {
-            return ' '; // Game continues
-        }
+char check_winner(Bitboard board) {
+    switch (bb_status(board)) {
+        case TTT_X_WINS: return PLAYER_X;
+        case TTT_O_WINS: return PLAYER_O;
+        case TTT_DRAW:   return 'd'; // Draw
+        default:         return ' '; // Game continues
     }
-    
-    return 'd'; // Draw
 }
 
 // Check if move is valid
-int is_valid_move(char board[BOARD_SIZE], int pos) {
-    return (pos >= 0 && pos < BOARD_SIZE && board[pos] == EMPTY);
+int is_valid_move(Bitboard board, int pos) {
+    return bb_is_empty_cell(board, pos);
 }
 
 // Get all valid moves
-int get_valid_moves(char board[BOARD_SIZE], int moves[BOARD_SIZE]) {
+int get_valid_moves(Bitboard board, int moves[BOARD_SIZE]) {
     int count = 0;
-    for (int i = 0; i < BOARD_SIZE; i++) {
-        if (board[i] == EMPTY) {
-            moves[count++] = i;
-        }
+    for (uint16_t m = bb_empty_cells(board); m; m &= m - 1) {
+        moves[count++] = bb_ctz(m);
     }
     return count;
 }
 
 // Choose action using epsilon-greedy policy
-int choose_action(QTable *qt, char board[BOARD_SIZE], double epsilon) {
+int choose_action(QTable *qt, Bitboard board, int code, double epsilon) {
     int valid_moves[BOARD_SIZE];
     int num_moves = get_valid_moves(board, valid_moves);
     
     if (num_moves == 0) return -1;
     
     // Exploration: random move
-    if ((double)rand() / RAND_MAX < epsilon) {
-        return valid_moves[rand() % num_moves];
+    if (ttt_rng_double(&g_rng) < epsilon) {
+        return valid_moves[ttt_rng_below(&g_rng, num_moves)];
     }
     
     // Exploitation: choose best move
+    const double *row = q_row(qt, code);
     int best_action = valid_moves[0];
-    double best_q = get_q_value(qt, board, best_action);
+    if (row == NULL) return best_action;
+    double best_q = row[best_action];
     
     for (int i = 1; i < num_moves; i++) {
-        double q = get_q_value(qt, board, valid_moves[i]);
+        double q = row[valid_moves[i]];
         if (q > best_q) {
             best_q = q;
             best_action = valid_moves[i];
@@ -214,28 +183,30 @@ int choose_action(QTable *qt, char board[BOARD_SIZE], double epsilon) {
 }
 
 // Choose best action (for testing/playing)
-int choose_best_action(QTable *qt, char board[BOARD_SIZE]) {
-    return choose_action(qt, board, 0.0); // No exploration
+int choose_best_action(QTable *qt, Bitboard board, int code) {
+    return choose_action(qt, board, code, 0.0); // No exploration
 }
 
 // Get maximum Q-value for a state
-double get_max_q_value(QTable *qt, char board[BOARD_SIZE]) {
+double get_max_q_value(QTable *qt, Bitboard board, int code) {
     int valid_moves[BOARD_SIZE];
     int num_moves = get_valid_moves(board, valid_moves);
     
-    if (num_moves == 0) return 0.0;
+    const double *row = q_row(qt, code);
+    if (num_moves == 0 || row == NULL) return 0.0;
     
-    double max_q = get_q_value(qt, board, valid_moves[0]);
+    double max_q = row[valid_moves[0]];
     for (int i = 1; i < num_moves; i++) {
-        double q = get_q_value(qt, board, valid_moves[i]);
+        double q = row[valid_moves[i]];
         if (q > max_q) max_q = q;
     }
     
     return max_q;
 }
 
-// Train Q-learning agent through self-play
-void train_q_learning(QTable *qt, int episodes) {
+// Train Q-learning agent through self-play; every episode is appended
+// to log (stream = episode number) unless it is NULL
+void train_q_learning(QTable *qt, int episodes, TTGLWriter *log) {
     printf("\n========================================\n");
     printf("TRAINING Q-LEARNING AGENT\n");
     printf("========================================\n");
@@ -255,28 +226,32 @@ void train_q_learning(QTable *qt, int episodes) {
         
         // Store state-action pairs for updating
         typedef struct {
-            char board[BOARD_SIZE];
+            Bitboard board;
+            int code;
             int action;
         } Transition;
         
         Transition transitions[BOARD_SIZE * 2];
         int num_transitions = 0;
+        TTGLRecord record = ttt_gl_record((uint64_t)episode, 0, 0);
         
         // Play one episode
         while (!game.game_over) {
-            int action = choose_action(qt, game.board, EPSILON);
+            int action = choose_action(qt, game.board, game.code, EPSILON);
             
             if (action == -1) break;
             
             // Store transition for X player only (we're training X)
             if (player == PLAYER_X) {
-                memcpy(transitions[num_transitions].board, game.board, BOARD_SIZE);
+                transitions[num_transitions].board = game.board;
+                transitions[num_transitions].code = game.code;
                 transitions[num_transitions].action = action;
                 num_transitions++;
             }
             
             // Make move
-            game.board[action] = player;
+            play_move(&game, action, player == PLAYER_X ? TTT_SIDE_X : TTT_SIDE_O);
+            ttt_gl_push_move(&record, action);
             
             // Check game state
             char winner = check_winner(game.board);
@@ -294,12 +269,17 @@ void train_q_learning(QTable *qt, int episodes) {
             player = (player == PLAYER_X) ? PLAYER_O : PLAYER_X;
         }
         
+        if (log) {
+            ttt_gl_set_result(&record, bb_status(game.board));
+            ttt_gl_writer_add(log, &record);
+        }
+        
         // Backward Q-value update (from final state to initial)
         double reward = (game.winner == PLAYER_X) ? REWARD_WIN :
                        (game.winner == PLAYER_O) ? REWARD_LOSE : REWARD_DRAW;
         
         for (int i = num_transitions - 1; i >= 0; i--) {
-            double old_q = get_q_value(qt, transitions[i].board, transitions[i].action);
+            double old_q = get_q_value(qt, transitions[i].code, transitions[i].action);
             
             // Q-learning update rule
             double new_q;
@@ -308,15 +288,15 @@ void train_q_learning(QTable *qt, int episodes) {
                 new_q = old_q + ALPHA * (reward - old_q);
             } else {
                 // Non-terminal state
-                char next_board[BOARD_SIZE];
-                memcpy(next_board, transitions[i].board, BOARD_SIZE);
-                next_board[transitions[i].action] = PLAYER_X;
+                Bitboard next_board = transitions[i].board;
+                bb_toggle(&next_board, transitions[i].action, TTT_SIDE_X);
+                int next_code = bb_code_play(transitions[i].code, transitions[i].action, TTT_SIDE_X);
                 
-                double max_next_q = get_max_q_value(qt, next_board);
+                double max_next_q = get_max_q_value(qt, next_board, next_code);
                 new_q = old_q + ALPHA * (0.0 + GAMMA * max_next_q - old_q);
             }
             
-            update_q_value(qt, transitions[i].board, transitions[i].action, new_q);
+            update_q_value(qt, transitions[i].code, transitions[i].action, new_q);
         }
         
         // Progress report
@@ -333,8 +313,54 @@ void train_q_learning(QTable *qt, int episodes) {
     printf("Total Q-table entries: %d\n", qt->total_entries);
 }
 
+// Seed every action of a board (and of its distinct symmetric images)
+void seed_q_values(QTable *qt, Bitboard bb, double init_value, int expand_symmetries) {
+    int num_images = expand_symmetries ? TTT_NUM_SYMMETRIES : 1;
+    int seeded[TTT_NUM_SYMMETRIES];
+    
+    for (int t = 0; t < num_images; t++) {
+        Bitboard image = ttt_sym_apply(t, bb);
+        
+        // Symmetric boards can coincide; seed each distinct one once
+        int code = bb_to_code(image), duplicate = 0;
+        for (int u = 0; u < t && !duplicate; u++) duplicate = (seeded[u] == code);
+        seeded[t] = code;
+        if (duplicate) continue;
+        
+        for (uint16_t m = bb_empty_cells(image); m; m &= m - 1) {
+            update_q_value(qt, code, bb_ctz(m), init_value);
+        }
+    }
+}
+
+// Binary datasets (.ttds from ttt_stategen --bin) are mapped, not parsed
+void load_minimax_dataset_binary(const char *filename, QTable *qt) {
+    TTDSFile file;
+    if (!ttt_ds_open(&file, filename)) {
+        printf("Starting with zero-initialized Q-values.\n");
+        return;
+    }
+    
+    printf("Loading binary minimax dataset for Q-value initialization...\n");
+    int expand_symmetries = (file.header->flags & TTT_DS_CANONICAL) != 0;
+    
+    for (uint32_t r = 0; r < file.count; r++) {
+        TTDSRecord rec = file.records[r];
+        seed_q_values(qt, ttt_ds_board(rec), 0.8 * ttt_ds_x_outcome(rec), expand_symmetries);
+    }
+    
+    printf("✓ Initialized Q-values from %u board states\n", file.count);
+    printf("✓ Total Q-entries: %d\n", qt->total_entries);
+    ttt_ds_close(&file);
+}
+
 // Load minimax dataset to bootstrap Q-values
 void load_minimax_dataset(const char *filename, QTable *qt) {
+    if (ttt_ds_is_binary(filename)) {
+        load_minimax_dataset_binary(filename, qt);
+        return;
+    }
+    
     FILE *fp = fopen(filename, "r");
     if (!fp) {
         printf("Warning: Could not load minimax dataset from %s\n", filename);
@@ -365,6 +391,10 @@ void load_minimax_dataset(const char *filename, QTable *qt) {
         if (token != NULL) {
             strcpy(outcome, token);
             
+            // Canonical datasets append a weight: the row stands for every
+            // rotation/reflection of the board, so seed all of them
+            int expand_symmetries = (strtok(NULL, ",") != NULL);
+            
             // Initialize Q-values based on minimax evaluation
             double init_value = 0.0;
             if (strcmp(outcome, "win") == 0) init_value = 0.8;
@@ -372,12 +402,8 @@ void load_minimax_dataset(const char *filename, QTable *qt) {
             else init_value = 0.0;
             
             // Set Q-value for all possible actions from this state
-            for (int j = 0; j < BOARD_SIZE; j++) {
-                if (board[j] == EMPTY) {
-                    update_q_value(qt, board, j, init_value);
-                }
-            }
-            
+            seed_q_values(qt, bb_from_chars(board, PLAYER_X, PLAYER_O), 
+                          init_value, expand_symmetries);
             count++;
         }
     }
@@ -388,11 +414,14 @@ void load_minimax_dataset(const char *filename, QTable *qt) {
 }
 
 // Print board
-void print_board(char board[BOARD_SIZE]) {
+void print_board(Bitboard board) {
+    char cells[BOARD_SIZE];
+    bb_to_chars(board, cells, PLAYER_X, PLAYER_O, EMPTY);
+    
     printf("\n");
     for (int i = 0; i < 9; i += 3) {
         for (int j = 0; j < 3; j++) {
-            char c = board[i + j];
+            char c = cells[i + j];
             printf(" %c ", c == 'b' ? ' ' : c);
             if (j < 2) printf("|");
         }
@@ -422,17 +451,17 @@ void test_q_learning(QTable *qt, int test_games) {
             
             if (player == PLAYER_X) {
                 // Q-learning agent (no exploration)
-                action = choose_best_action(qt, game.board);
+                action = choose_best_action(qt, game.board, game.code);
             } else {
                 // Random opponent
                 int valid_moves[BOARD_SIZE];
                 int num_moves = get_valid_moves(game.board, valid_moves);
-                action = valid_moves[rand() % num_moves];
+                action = valid_moves[ttt_rng_below(&g_rng, num_moves)];
             }
             
             if (action == -1) break;
             
-            game.board[action] = player;
+            play_move(&game, action, player == PLAYER_X ? TTT_SIDE_X : TTT_SIDE_O);
             
             char winner = check_winner(game.board);
             if (winner != ' ') {
@@ -467,16 +496,20 @@ void save_qtable(const char *filename, QTable *qt) {
     fprintf(fp, "# Format: board_state,action,q_value,visits\n");
     fprintf(fp, "# Total entries: %d\n\n", qt->total_entries);
     
-    for (int i = 0; i < Q_TABLE_SIZE; i++) {
-        QEntry *entry = qt->table[i];
-        while (entry != NULL) {
+    for (int idx = 0; idx < TTT_NUM_POSITIONS; idx++) {
+        char cells[BOARD_SIZE];
+        bb_to_chars(ttt_index_board(idx), cells, PLAYER_X, PLAYER_O, EMPTY);
+        
+        for (int action = 0; action < BOARD_SIZE; action++) {
+            if (qt->visits[idx][action] == 0) continue;
+            
             // Write board
             for (int j = 0; j < BOARD_SIZE; j++) {
-                fprintf(fp, "%c", entry->board[j]);
+                fprintf(fp, "%c", cells[j]);
                 if (j < BOARD_SIZE - 1) fprintf(fp, ",");
             }
-            fprintf(fp, ",%d,%.6f,%d\n", entry->action, entry->q_value, entry->visits);
-            entry = entry->next;
+            fprintf(fp, ",%d,%.6f,%d\n", action, qt->q_value[idx][action],
+                    qt->visits[idx][action]);
         }
     }
     
@@ -485,11 +518,23 @@ void save_qtable(const char *filename, QTable *qt) {
 }
 
 int main(int argc, char *argv[]) {
-    srand(time(NULL));
+    uint64_t seed = ttt_rng_take_seed(&argc, argv);
+    ttt_rng_seed(&g_rng, seed);
     
     printf("========================================\n");
     printf("Q-LEARNING FOR TIC-TAC-TOE\n");
-    printf("========================================\n\n");
+    printf("========================================\n");
+    printf("Seed: %llu\n\n", (unsigned long long)seed);
+    
+    // Optional: --log file.ttgl records every self-play game
+    const char *log_name = NULL;
+    for (int a = 1; a + 1 < argc; a++) {
+        if (strcmp(argv[a], "--log") != 0) continue;
+        log_name = argv[a + 1];
+        for (int b = a + 2; b <= argc; b++) argv[b - 2] = argv[b];
+        argc -= 2;
+        break;
+    }
     
     QTable qtable;
     init_qtable(&qtable);
@@ -522,7 +567,21 @@ int main(int argc, char *argv[]) {
     }
     
     // Train Q-learning agent
-    train_q_learning(&qtable, MAX_EPISODES);
+    TTGLWriter log;
+    const char *players[] = {"Q-learning"};
+    if (log_name && !ttt_gl_writer_open(&log, log_name, seed, players, 1)) {
+        fprintf(stderr, "Error: Could not write %s\n", log_name);
+        free_qtable(&qtable);
+        return 1;
+    }
+    train_q_learning(&qtable, MAX_EPISODES, log_name ? &log : NULL);
+    if (log_name) {
+        if (ttt_gl_writer_close(&log)) {
+            printf("Self-play games logged to: %s\n", log_name);
+        } else {
+            fprintf(stderr, "Error: Could not write %s\n", log_name);
+        }
+    }
     
     // Test the agent
     test_q_learning(&qtable, 1000);
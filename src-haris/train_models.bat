@@ -13,7 +13,7 @@ echo.
 REM Check if dataset processor exists
 if not exist "dataset_processor.exe" (
     echo Compiling dataset processor...
-    gcc dataset_processor.c -o dataset_processor.exe
+    gcc dataset_processor.c ..\src\ttt_rng.c ..\src\ttt_dataset_bin.c ..\src\ttt_mmap.c ..\src\ttt_board.c ..\src\ttt_symmetry.c -o dataset_processor.exe
     if errorlevel 1 (
         echo ERROR: Failed to compile dataset_processor.c
         pause
@@ -26,7 +26,7 @@ if not exist "dataset_processor.exe" (
 REM Check if dataset file exists
 if not exist "tic-tac-toe-minimax-complete.data" (
     echo ERROR: Dataset file not found!
-    echo Please run dataset-gen.exe first to generate the dataset.
+    echo Please run build_dataset_gen.bat first to generate the dataset.
     pause
     exit /b 1
 )
@@ -67,7 +67,7 @@ echo.
 
 REM Compile Naive Bayes
 echo Compiling Naive Bayes trainer...
-gcc ..\src\naive_bayes.c -o naive_bayes.exe -lm
+gcc ..\src\naive_bayes.c ..\src\ttt_rng.c -o naive_bayes.exe -lm
 if errorlevel 1 (
     echo ERROR: Failed to compile naive_bayes.c
     pause
@@ -77,7 +77,7 @@ echo Done!
 
 REM Compile Linear Regression
 echo Compiling Linear Regression trainer...
-gcc ..\src\linear_regression.c -o linear_regression.exe -lm
+gcc ..\src\linear_regression.c ..\src\ttt_rng.c -o linear_regression.exe -lm
 if errorlevel 1 (
     echo ERROR: Failed to compile linear_regression.c
     pause
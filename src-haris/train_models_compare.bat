@@ -36,7 +36,7 @@ echo Checking prerequisites...
 
 if not exist "dataset_processor.exe" (
     echo Compiling dataset processor...
-    gcc dataset_processor.c -o dataset_processor.exe
+    gcc dataset_processor.c ..\src\ttt_rng.c ..\src\ttt_dataset_bin.c ..\src\ttt_mmap.c ..\src\ttt_board.c ..\src\ttt_symmetry.c -o dataset_processor.exe
     if errorlevel 1 (
         echo ERROR: Failed to compile dataset_processor.c
         pause
@@ -46,12 +46,12 @@ if not exist "dataset_processor.exe" (
 
 if not exist "tic-tac-toe-minimax-non-terminal.data" (
     echo WARNING: tic-tac-toe-minimax-non-terminal.data not found!
-    echo Please generate it first using dataset-gen.exe
+    echo Please generate it first using build_dataset_gen.bat
 )
 
 if not exist "tic-tac-toe-minimax-complete.data" (
     echo WARNING: tic-tac-toe-minimax-complete.data not found!
-    echo Please generate it first using dataset-gen.exe
+    echo Please generate it first using build_dataset_gen.bat
 )
 
 echo.
@@ -66,7 +66,7 @@ echo.
 
 echo Compiling Naive Bayes...
 if exist "..\src\naive_bayes.c" (
-    gcc ..\src\naive_bayes.c -o naive_bayes.exe -lm
+    gcc ..\src\naive_bayes.c ..\src\ttt_rng.c -o naive_bayes.exe -lm
     if errorlevel 1 (
         echo ERROR: Failed to compile naive_bayes.c
         echo Make sure gcc is in your PATH
@@ -83,7 +83,7 @@ if exist "..\src\naive_bayes.c" (
 
 echo Compiling Linear Regression...
 if exist "..\src\linear_regression.c" (
-    gcc ..\src\linear_regression.c -o linear_regression.exe -lm
+    gcc ..\src\linear_regression.c ..\src\ttt_rng.c -o linear_regression.exe -lm
     if errorlevel 1 (
         echo ERROR: Failed to compile linear_regression.c
         echo Make sure gcc is in your PATH
@@ -114,7 +114,7 @@ echo.
 
 echo Compiling Q-Learning (optional)...
 if exist "q_learning.c" (
-    gcc q_learning.c -o q_learning.exe -lm
+    gcc q_learning.c ..\src\ttt_rng.c ..\src\ttt_board.c ..\src\ttt_index.c ..\src\ttt_symmetry.c ..\src\ttt_dataset_bin.c ..\src\ttt_gamelog.c ..\src\ttt_mmap.c -o q_learning.exe -lm
     if errorlevel 1 (
         echo WARNING: Failed to compile q_learning.c
         echo Q-Learning training will be skipped
@@ -16,7 +16,7 @@ pause
 REM Check if Q-learning program is compiled
 if not exist "q_learning.exe" (
     echo Compiling Q-learning trainer...
-    gcc q_learning.c -o q_learning.exe -lm
+    gcc q_learning.c ..\src\ttt_rng.c ..\src\ttt_board.c ..\src\ttt_index.c ..\src\ttt_symmetry.c ..\src\ttt_dataset_bin.c ..\src\ttt_gamelog.c ..\src\ttt_mmap.c -o q_learning.exe -lm
     if errorlevel 1 (
         echo ERROR: Failed to compile q_learning.c
         pause
@@ -51,7 +51,7 @@ if "%choice%"=="1" (
         )
     ) else (
         echo ERROR: tic-tac-toe-minimax-non-terminal.data not found!
-        echo Please generate it first using dataset-gen.exe
+        echo Please generate it first using build_dataset_gen.bat
         pause
         exit /b 1
     )
@@ -69,7 +69,7 @@ if "%choice%"=="1" (
         )
     ) else (
         echo ERROR: tic-tac-toe-minimax-complete.data not found!
-        echo Please generate it first using dataset-gen.exe
+        echo Please generate it first using build_dataset_gen.bat
         pause
         exit /b 1
     )
@@ -3,19 +3,39 @@
 #include <string.h>
 #include <time.h>
 #include <math.h>
+#include <stdint.h>
+#include <pthread.h>
+#include "ttt_board.h"
+#include "ttt_symmetry.h"
+#include "ttt_thread.h"
+#include "ttt_rng.h"
+#include "ttt_batch.h"
+#include "ttt_exact.h"
+#include "ttt_clock.h"
+#include "ttt_latency.h"
+#include "ttt_rating.h"
+#include "ttt_gamelog.h"
+#include "ttt_mcts.h"
+#include "ttt_search.h"
+#include "ttt_zobrist.h"
+#include "ttt_model.h"
+#include "ttt_policy.h"
+#include "ttt_perfect_table.h"  // generated: gen_perfect_table
 
 #define BOARD_SIZE 9
 #define NUM_FEATURES 10
 #define EMPTY 'b'
 #define PLAYER_X 'x'
 #define PLAYER_O 'o'
+#define LR_RANDOM_PERCENT 10  // Linear Regression plays a random move this often
 
 // ============================================
 // Data Structures
 // ============================================
 
 typedef struct {
-    char board[BOARD_SIZE];
+    char board[BOARD_SIZE];  // char view handed to AIFunction
+    Bitboard bb;             // authoritative position
     int game_over;
     char winner; // 'x', 'o', or 'd' for draw
 } GameState;
@@ -26,10 +46,16 @@ typedef struct {
 
 typedef int (*AIFunction)(char*, char);
 
+// Probability of each move AIFunction could return (0 for occupied cells)
+typedef void (*AIDistribution)(char*, char, double*);
+
 typedef struct {
     const char *name;
     AIFunction function;
+    AIDistribution distribution;   // used by --exact instead of sampling; NULL if unknown
     int has_randomness;
+    int batch_policy;   // TTT_BATCH_* if ttt_batch can play it, else -1
+    const TTTMovePolicy *policy;   // what TTT_BATCH_POLICY plays
 } AIPlayer;
 
 typedef struct {
@@ -37,7 +63,7 @@ typedef struct {
     int ai1_wins;
     int ai2_wins;
     int draws;
-    int total_moves;
+    long long total_moves;
     int fastest_game;
     int longest_game;
 } MatchupStats;
@@ -47,8 +73,28 @@ typedef struct {
 // ============================================
 
 LinearModel g_linear_model;
+TTTModel g_linear_eval;  // g_linear_model as per-cell tables
+const TTTMovePolicy g_linear_policy = {TTT_POLICY_MODEL, &g_linear_eval, NULL, NULL, NULL,
+                                       LR_RANDOM_PERCENT};
+const TTTMovePolicy g_perfect_policy = {TTT_POLICY_TABLE, NULL, ttt_perfect_index, NULL,
+                                        ttt_perfect_best, 0};
 int g_model_loaded = 0;
 
+// Each thread has its own generator; the tournament reseeds it for
+// every game, so results depend only on the seed, not on the thread count
+static _Thread_local TTTRng g_rng;
+
+// Games this thread has started; players that keep state between moves
+// (MCTS) start over when it changes
+static _Thread_local uint64_t g_game_number;
+
+#ifdef TTT_LATENCY
+// Build with -DTTT_LATENCY to time every move decision. While set, the
+// current game's X and O moves are recorded here, one histogram per move
+// number (indexed by TTT_SIDE_*; per thread, NULL = not collecting).
+static _Thread_local TTTLatency *g_latency[3];
+#endif
+
 // ============================================
 // Board Functions
 // ============================================
@@ -57,6 +103,7 @@ void init_board(GameState *game) {
     for (int i = 0; i < BOARD_SIZE; i++) {
         game->board[i] = EMPTY;
     }
+    game->bb = bb_empty_board();
     game->game_over = 0;
     game->winner = ' ';
 }
@@ -80,32 +127,22 @@ void print_board(char *board) {
     printf("\n");
 }
 
-char check_winner(char *board) {
-    // Winning combinations
-    int wins[8][3] = {
-        {0, 1, 2}, {3, 4, 5}, {6, 7, 8}, // Rows
-        {0, 3, 6}, {1, 4, 7}, {2, 5, 8}, // Columns
-        {0, 4, 8}, {2, 4, 6}              // Diagonals
-    };
-    
-    for (int i = 0; i < 8; i++) {
-        char a = board[wins[i][0]];
-        char b = board[wins[i][1]];
-        char c = board[wins[i][2]];
-        
-        if (a != EMPTY && a == b && b == c) {
-            return a;
-        }
-    }
-    
-    // Check for draw
-    int filled = 0;
-    for (int i = 0; i < BOARD_SIZE; i++) {
-        if (board[i] != EMPTY) filled++;
+static inline Bitboard to_bitboard(const char *board) {
+    return bb_from_chars(board, PLAYER_X, PLAYER_O);
+}
+
+static inline int side_of(char player) {
+    return (player == PLAYER_X) ? TTT_SIDE_X : TTT_SIDE_O;
+}
+
+// Returns 'x', 'o', 'd' for draw, or ' ' if the game continues
+char check_winner_bb(Bitboard b) {
+    switch (bb_status(b)) {
+        case TTT_X_WINS: return PLAYER_X;
+        case TTT_O_WINS: return PLAYER_O;
+        case TTT_DRAW:   return 'd';
+        default:         return ' ';
     }
-    if (filled == BOARD_SIZE) return 'd';
-    
-    return ' '; // Game continues
 }
 
 int is_valid_move(char *board, int pos) {
@@ -126,219 +163,475 @@ int load_linear_model(const char *filename) {
     
     fread(&g_linear_model, sizeof(LinearModel), 1, fp);
     fclose(fp);
+    ttt_model_linear(&g_linear_eval, g_linear_model.weights);
     g_model_loaded = 1;
     return 1;
 }
 
-double predict_linear(char *board, char player) {
-    if (!g_model_loaded) return 0.0;
-    
-    double features[NUM_FEATURES];
-    features[0] = 1.0; // Bias
-    
-    for (int i = 0; i < 9; i++) {
-        if (board[i] == PLAYER_X) {
-            features[i + 1] = 1.0;
-        } else if (board[i] == PLAYER_O) {
-            features[i + 1] = -1.0;
-        } else {
-            features[i + 1] = 0.0;
-        }
-    }
-    
-    double result = 0.0;
-    for (int i = 0; i < NUM_FEATURES; i++) {
-        result += g_linear_model.weights[i] * features[i];
-    }
-    
-    return result;
-}
-
+// The model plays the child it rates best (each child's score is the
+// position's plus the weight of one cell), or a random move 10% of the
+// time; ttt_policy does both, for one board here and for whole batches
+// in --batch
 int linear_regression_move(char *board, char player) {
-    // 10% chance of random move for variety
-    if (g_model_loaded && rand() % 100 < 10) {
-        int valid_moves[BOARD_SIZE];
-        int count = 0;
-        for (int i = 0; i < BOARD_SIZE; i++) {
-            if (board[i] == EMPTY) {
-                valid_moves[count++] = i;
-            }
-        }
-        if (count > 0) return valid_moves[rand() % count];
-    }
-    
+    Bitboard b = to_bitboard(board);
     if (!g_model_loaded) {
         // Fallback to random if model not loaded
-        int valid_moves[BOARD_SIZE];
-        int count = 0;
-        for (int i = 0; i < BOARD_SIZE; i++) {
-            if (board[i] == EMPTY) {
-                valid_moves[count++] = i;
-            }
-        }
-        return (count > 0) ? valid_moves[rand() % count] : -1;
+        uint16_t empty = bb_empty_cells(b);
+        int count = bb_popcount(empty);
+        return (count > 0) ? bb_select(empty, ttt_rng_below(&g_rng, count)) : -1;
     }
     
-    // Try each empty cell and find best move
-    double best_score = (player == PLAYER_O) ? 999999.0 : -999999.0;
-    int best_move = -1;
-    
-    for (int i = 0; i < BOARD_SIZE; i++) {
-        if (board[i] == EMPTY) {
-            // Simulate move
-            char temp_board[BOARD_SIZE];
-            memcpy(temp_board, board, BOARD_SIZE);
-            temp_board[i] = player;
-            
-            double score = predict_linear(temp_board, player);
-            
-            // O wants to minimize score (X losing), X wants to maximize
-            if (player == PLAYER_O) {
-                if (score < best_score) {
-                    best_score = score;
-                    best_move = i;
-                }
-            } else {
-                if (score > best_score) {
-                    best_score = score;
-                    best_move = i;
-                }
-            }
-        }
+    int8_t move;
+    ttt_policy_moves(&g_linear_policy, &b.x, &b.o, 1, &g_rng, &move);
+    return move;
+}
+
+// Spreads weight evenly over the empty cells
+static void add_uniform(char *board, double weight, double *probs) {
+    uint16_t empty = bb_empty_cells(to_bitboard(board));
+    int count = bb_popcount(empty);
+    for (uint16_t m = empty; m; m &= m - 1) probs[bb_ctz(m)] += weight / count;
+}
+
+void linear_regression_distribution(char *board, char player, double *probs) {
+    if (!g_model_loaded) {
+        add_uniform(board, 1.0, probs);
+        return;
     }
-    
-    return best_move;
+    Bitboard b = to_bitboard(board);
+    ttt_policy_distributions(&g_linear_policy, &b.x, &b.o, 1, probs);
 }
 
 // ============================================
 // Simple Minimax AI (for comparison)
 // ============================================
 
-int minimax(char *board, char player, int depth, int is_maximizing) {
-    char result = check_winner(board);
+int minimax(Bitboard b, int depth, int is_maximizing) {
+    int result = bb_status(b);
     
-    if (result == PLAYER_X) return 10 - depth;
-    if (result == PLAYER_O) return depth - 10;
-    if (result == 'd') return 0;
+    if (result == TTT_X_WINS) return 10 - depth;
+    if (result == TTT_O_WINS) return depth - 10;
+    if (result == TTT_DRAW) return 0;
     
     if (depth >= 6) return 0; // Limit depth for medium difficulty
     
+    uint16_t empty = bb_empty_cells(b);
+    
     if (is_maximizing) {
         int best = -999999;
-        for (int i = 0; i < BOARD_SIZE; i++) {
-            if (board[i] == EMPTY) {
-                board[i] = PLAYER_X;
-                int score = minimax(board, PLAYER_X, depth + 1, 0);
-                board[i] = EMPTY;
-                if (score > best) best = score;
-            }
+        for (uint16_t m = empty; m; m &= m - 1) {
+            Bitboard child = b;
+            child.x |= (uint16_t)(m & -m);
+            int score = minimax(child, depth + 1, 0);
+            if (score > best) best = score;
         }
         return best;
     } else {
         int best = 999999;
-        for (int i = 0; i < BOARD_SIZE; i++) {
-            if (board[i] == EMPTY) {
-                board[i] = PLAYER_O;
-                int score = minimax(board, PLAYER_O, depth + 1, 1);
-                board[i] = EMPTY;
-                if (score < best) best = score;
-            }
+        for (uint16_t m = empty; m; m &= m - 1) {
+            Bitboard child = b;
+            child.o |= (uint16_t)(m & -m);
+            int score = minimax(child, depth + 1, 1);
+            if (score < best) best = score;
         }
         return best;
     }
 }
 
+// The search is deterministic, so each position's move is computed once
+// and then looked up (0 = not searched yet, else move + 1). Per thread,
+// so tournament workers never write to a shared table.
+static _Thread_local int8_t minimax_memo[2][TTT_NUM_CODES];
+
 int minimax_move(char *board, char player) {
+    Bitboard b = to_bitboard(board);
+    int8_t *memo = &minimax_memo[player == PLAYER_O][bb_to_code(b)];
+    if (*memo) return *memo - 1;
+    
     int best_move = -1;
     int best_score = (player == PLAYER_X) ? -999999 : 999999;
     
-    for (int i = 0; i < BOARD_SIZE; i++) {
-        if (board[i] == EMPTY) {
-            char temp_board[BOARD_SIZE];
-            memcpy(temp_board, board, BOARD_SIZE);
-            temp_board[i] = player;
-            
-            int score = minimax(temp_board, player, 0, player == PLAYER_O);
-            
-            if (player == PLAYER_X) {
-                if (score > best_score) {
-                    best_score = score;
-                    best_move = i;
-                }
-            } else {
-                if (score < best_score) {
-                    best_score = score;
-                    best_move = i;
-                }
+    for (uint16_t m = bb_empty_cells(b); m; m &= m - 1) {
+        int i = bb_ctz(m);
+        Bitboard child = b;
+        bb_toggle(&child, i, side_of(player));
+        
+        int score = minimax(child, 0, player == PLAYER_O);
+        
+        if (player == PLAYER_X) {
+            if (score > best_score) {
+                best_score = score;
+                best_move = i;
+            }
+        } else {
+            if (score < best_score) {
+                best_score = score;
+                best_move = i;
             }
         }
     }
     
+    *memo = (int8_t)(best_move + 1);
     return best_move;
 }
 
+void minimax_distribution(char *board, char player, double *probs) {
+    probs[minimax_move(board, player)] = 1.0;
+}
+
+// ============================================
+// Perfect AI (precomputed table, no search)
+// ============================================
+
+int perfect_move(char *board, char player) {
+    (void)player; // the side to move follows from the board
+    return ttt_perfect_move(to_bitboard(board));
+}
+
+void perfect_distribution(char *board, char player, double *probs) {
+    probs[perfect_move(board, player)] = 1.0;
+}
+
 // ============================================
 // Random AI
 // ============================================
 
 int random_move(char *board, char player) {
-    int valid_moves[BOARD_SIZE];
-    int count = 0;
+    uint16_t empty = bb_empty_cells(to_bitboard(board));
+    int count = bb_popcount(empty);
     
-    for (int i = 0; i < BOARD_SIZE; i++) {
-        if (board[i] == EMPTY) {
-            valid_moves[count++] = i;
-        }
-    }
-    
-    return (count > 0) ? valid_moves[rand() % count] : -1;
+    return (count > 0) ? bb_select(empty, ttt_rng_below(&g_rng, count)) : -1;
+}
+
+void random_distribution(char *board, char player, double *probs) {
+    (void)player;
+    add_uniform(board, 1.0, probs);
 }
 
 // ============================================
 // Smart Random AI (blocks/wins when possible)
 // ============================================
 
-int smart_random_move(char *board, char player) {
-    char opponent = (player == PLAYER_X) ? PLAYER_O : PLAYER_X;
+// The winning cell, else the cell blocking the opponent, else -1
+static int smart_forced_move(Bitboard b, char player) {
+    int side = side_of(player);
+    int opponent = (side == TTT_SIDE_X) ? TTT_SIDE_O : TTT_SIDE_X;
     
     // First, check if we can win
-    for (int i = 0; i < BOARD_SIZE; i++) {
-        if (board[i] == EMPTY) {
-            char temp_board[BOARD_SIZE];
-            memcpy(temp_board, board, BOARD_SIZE);
-            temp_board[i] = player;
-            if (check_winner(temp_board) == player) {
-                return i; // Winning move!
-            }
+    uint16_t wins = bb_winning_cells(b, side);
+    if (wins) return bb_ctz(wins); // Winning move!
+    
+    // Second, check if we need to block opponent
+    uint16_t blocks = bb_winning_cells(b, opponent);
+    if (blocks) return bb_ctz(blocks); // Block opponent!
+    
+    return -1;
+}
+
+int smart_random_move(char *board, char player) {
+    Bitboard b = to_bitboard(board);
+    int forced = smart_forced_move(b, player);
+    if (forced >= 0) return forced;
+    
+    // Otherwise, random move
+    uint16_t empty = bb_empty_cells(b);
+    int count = bb_popcount(empty);
+    return (count > 0) ? bb_select(empty, ttt_rng_below(&g_rng, count)) : -1;
+}
+
+void smart_random_distribution(char *board, char player, double *probs) {
+    int forced = smart_forced_move(to_bitboard(board), player);
+    if (forced >= 0) probs[forced] = 1.0;
+    else add_uniform(board, 1.0, probs);
+}
+
+// ============================================
+// Naive Bayes AI
+// ============================================
+
+// naive_bayes.c's text model compiled into per-cell log-probabilities;
+// the player moves to the child with the best expected result under
+// the label posterior (deterministic)
+TTTModel g_nb_eval;
+int g_nb_loaded = 0;
+const TTTMovePolicy g_nb_policy = {TTT_POLICY_MODEL, &g_nb_eval, NULL, NULL, NULL, 0};
+static const char *g_nb_path = "../models/naive bayes/model.txt";
+
+int load_naive_bayes_model(const char *filename) {
+    if (!ttt_model_load_naive_bayes(&g_nb_eval, filename)) {
+        printf("Warning: Could not load Naive Bayes model from %s\n", filename);
+        printf("Naive Bayes AI will use random moves.\n");
+        return 0;
+    }
+    g_nb_loaded = 1;
+    return 1;
+}
+
+int naive_bayes_move(char *board, char player) {
+    if (!g_nb_loaded) return random_move(board, player);
+    Bitboard b = to_bitboard(board);
+    int8_t move;
+    ttt_policy_moves(&g_nb_policy, &b.x, &b.o, 1, NULL, &move);
+    return move;
+}
+
+void naive_bayes_distribution(char *board, char player, double *probs) {
+    if (!g_nb_loaded) {
+        random_distribution(board, player, probs);
+        return;
+    }
+    Bitboard b = to_bitboard(board);
+    ttt_policy_distributions(&g_nb_policy, &b.x, &b.o, 1, probs);
+}
+
+// ============================================
+// Q-Learning AI
+// ============================================
+
+// The table saved by q_learning.c as a dense [position][action] array
+// (positions by the perfect table's index). Actions missing from the
+// file stay 0, as unvisited ones do in training. The table holds X's
+// values only: as X the player takes the highest value, as O the move
+// after which X's best value is lowest, ties to the lower cell
+// (deterministic).
+static double g_q_values[TTT_PERFECT_POSITIONS][TTT_CELLS];
+int g_q_loaded = 0;
+const TTTMovePolicy g_q_policy = {TTT_POLICY_Q, NULL, ttt_perfect_index,
+                                  (const double (*)[TTT_CELLS])g_q_values, NULL, 0};
+static const char *g_q_path = "../src-haris/q_learning_model.txt";
+
+int load_q_table(const char *filename) {
+    FILE *fp = fopen(filename, "r");
+    if (!fp) {
+        printf("Warning: Could not load Q-table from %s\n", filename);
+        printf("Q-Learning AI will use random moves.\n");
+        return 0;
+    }
+    
+    // Lines are "cell,...,cell,action,q_value,visits"; '#' lines are comments
+    char line[256];
+    int entries = 0;
+    while (fgets(line, sizeof(line), fp)) {
+        char c[BOARD_SIZE];
+        int action;
+        double q;
+        if (sscanf(line, "%c,%c,%c,%c,%c,%c,%c,%c,%c,%d,%lf", &c[0], &c[1], &c[2], &c[3],
+                   &c[4], &c[5], &c[6], &c[7], &c[8], &action, &q) != 11) {
+            continue;
         }
+        int idx = ttt_perfect_index_of(to_bitboard(c));
+        if (idx < 0 || action < 0 || action >= BOARD_SIZE) continue;
+        g_q_values[idx][action] = q;
+        entries++;
     }
+    fclose(fp);
     
-    // Second, check if we need to block opponent
-    for (int i = 0; i < BOARD_SIZE; i++) {
-        if (board[i] == EMPTY) {
-            char temp_board[BOARD_SIZE];
-            memcpy(temp_board, board, BOARD_SIZE);
-            temp_board[i] = opponent;
-            if (check_winner(temp_board) == opponent) {
-                return i; // Block opponent!
-            }
+    if (entries == 0) {
+        printf("Warning: No Q-values in %s\n", filename);
+        printf("Q-Learning AI will use random moves.\n");
+        return 0;
+    }
+    g_q_loaded = 1;
+    return 1;
+}
+
+int q_learning_move(char *board, char player) {
+    if (!g_q_loaded) return random_move(board, player);
+    Bitboard b = to_bitboard(board);
+    int8_t move;
+    ttt_policy_moves(&g_q_policy, &b.x, &b.o, 1, NULL, &move);
+    return move;
+}
+
+void q_learning_distribution(char *board, char player, double *probs) {
+    if (!g_q_loaded) {
+        random_distribution(board, player, probs);
+        return;
+    }
+    Bitboard b = to_bitboard(board);
+    ttt_policy_distributions(&g_q_policy, &b.x, &b.o, 1, probs);
+}
+
+// ============================================
+// MCTS AI (Monte Carlo Tree Search)
+// ============================================
+
+// Set from the --mcts-* flags before any game is played. Each thread
+// builds its own engine from it on first use and keeps the search tree
+// from move to move within a game.
+static TTTMctsRules g_mcts_rules;
+static TTTMctsConfig g_mcts_config;
+static _Thread_local TTTMcts *g_mcts;
+static _Thread_local uint64_t g_mcts_game;
+
+int mcts_move(char *board, char player) {
+    (void)player; // the side to move follows from the board
+    if (!g_mcts) {
+        g_mcts = malloc(sizeof(TTTMcts));
+        if (!g_mcts || !ttt_mcts_init(g_mcts, &g_mcts_rules, &g_mcts_config)) {
+            fprintf(stderr, "Error: Memory allocation failed for MCTS search tree\n");
+            exit(1);
+        }
+    }
+    // A tree from an earlier game would make this game's moves depend
+    // on which games the thread happened to play before
+    if (g_mcts_game != g_game_number) {
+        ttt_mcts_clear(g_mcts);
+        g_mcts_game = g_game_number;
+    }
+    Bitboard b = to_bitboard(board);
+    return ttt_mcts_search(g_mcts, b.x, b.o, ttt_rng_next(&g_rng));
+}
+
+// "MCTS 1000", "MCTS 50ms", "MCTS 4x1000" (4 root-parallel trees)
+static const char *mcts_name(void) {
+    static char name[48];
+    char budget[24];
+    if (g_mcts_config.ms > 0) snprintf(budget, sizeof(budget), "%gms", g_mcts_config.ms);
+    else snprintf(budget, sizeof(budget), "%d", g_mcts_config.playouts);
+    if (g_mcts_config.trees > 1) snprintf(name, sizeof(name), "MCTS %dx%s", g_mcts_config.trees, budget);
+    else snprintf(name, sizeof(name), "MCTS %s", budget);
+    return name;
+}
+
+// ============================================
+// Alpha-Beta AI (iterative deepening)
+// ============================================
+
+// Unlike Minimax's fixed depth cutoff, the search deepens until the game
+// is solved or the --move-ms budget runs out, then plays the best move of
+// the last depth it finished (ttt_search.c). --move-depth caps the depth,
+// which makes the player independent of the machine's speed.
+#define SEARCH_TT_LOG2 12  // 4096 entries; the game has 5,478 positions
+
+static double g_move_ms = 1.0;
+static int g_move_depth = 0;
+static _Thread_local TTTSearch *g_search;
+static _Thread_local uint64_t g_search_game;
+
+int alphabeta_move(char *board, char player) {
+    (void)player; // the side to move follows from the board
+    if (!g_search) {
+        g_search = malloc(sizeof(TTTSearch));
+        if (!g_search || !ttt_search_init(g_search, SEARCH_TT_LOG2)) {
+            fprintf(stderr, "Error: Memory allocation failed for alpha-beta search table\n");
+            exit(1);
         }
     }
+    // Table entries from earlier games could change which of two equal
+    // moves is found first
+    if (g_search_game != g_game_number) {
+        ttt_search_clear(g_search);
+        g_search_game = g_game_number;
+    }
+    return ttt_search_best(g_search, to_bitboard(board), g_move_ms, g_move_depth, NULL);
+}
+
+// The move the search picks on this machine, taken as certain
+void alphabeta_distribution(char *board, char player, double *probs) {
+    probs[alphabeta_move(board, player)] = 1.0;
+}
+
+// "Alpha-Beta 1ms", "Alpha-Beta d4", "Alpha-Beta d4 1ms"
+static const char *alphabeta_name(void) {
+    static char name[48];
+    int n = snprintf(name, sizeof(name), "Alpha-Beta");
+    if (g_move_depth > 0) n += snprintf(name + n, sizeof(name) - n, " d%d", g_move_depth);
+    if (g_move_ms > 0) snprintf(name + n, sizeof(name) - n, " %gms", g_move_ms);
+    return name;
+}
+
+// ============================================
+// Player Options
+// ============================================
+
+// Frees the calling thread's search engines (tournament workers, before
+// exiting)
+static void release_players(void) {
+    if (g_mcts) {
+        ttt_mcts_free(g_mcts);
+        free(g_mcts);
+        g_mcts = NULL;
+    }
+    if (g_search) {
+        ttt_search_free(g_search);
+        free(g_search);
+        g_search = NULL;
+    }
+}
+
+// Removes the --mcts-* and --move-* flags from argv (updating *argc)
+// into the player settings. Returns 0 if a value is invalid.
+static int take_player_options(int *argc, char **argv) {
+    ttt_mcts_rules(&g_mcts_rules, 3, 3, 3);
+    ttt_mcts_default_config(&g_mcts_config);
+    int out = 1, playouts_given = 0;
+    for (int a = 1; a < *argc; a++) {
+        const char *flag = argv[a];
+        const char *value = a + 1 < *argc ? argv[a + 1] : NULL;
+        int used = 2;
+        if (strcmp(flag, "--mcts-no-reuse") == 0) { g_mcts_config.reuse = 0; used = 1; }
+        else if (!value) used = 0;
+        else if (strcmp(flag, "--mcts-playouts") == 0) {
+            g_mcts_config.playouts = atoi(value);
+            playouts_given = 1;
+        }
+        else if (strcmp(flag, "--mcts-ms") == 0) g_mcts_config.ms = atof(value);
+        else if (strcmp(flag, "--mcts-trees") == 0) g_mcts_config.trees = atoi(value);
+        else if (strcmp(flag, "--mcts-threads") == 0) g_mcts_config.threads = atoi(value);
+        else if (strcmp(flag, "--mcts-c") == 0) g_mcts_config.exploration = atof(value);
+        else if (strcmp(flag, "--mcts-nodes") == 0) g_mcts_config.nodes = atoi(value);
+        else if (strcmp(flag, "--move-ms") == 0) g_move_ms = atof(value);
+        else if (strcmp(flag, "--move-depth") == 0) g_move_depth = atoi(value);
+        else if (strcmp(flag, "--nb-model") == 0) g_nb_path = value;
+        else if (strcmp(flag, "--q-model") == 0) g_q_path = value;
+        else used = 0;
+        if (used == 0) {
+            argv[out++] = argv[a];
+            continue;
+        }
+        a += used - 1;
+    }
+    argv[out] = NULL;
+    *argc = out;
     
-    // Otherwise, random move
-    return random_move(board, player);
+    // A time budget alone means no playout limit
+    if (g_mcts_config.ms > 0 && !playouts_given) g_mcts_config.playouts = 0;
+    ttt_zobrist_init();  // before any thread searches
+    return g_mcts_config.playouts >= 0 && g_mcts_config.ms >= 0 && g_mcts_config.trees >= 1 &&
+           g_mcts_config.nodes > g_mcts_rules.cells && g_mcts_config.exploration >= 0 &&
+           (g_mcts_config.playouts > 0 || g_mcts_config.ms > 0) &&
+           g_move_ms >= 0 && g_move_depth >= 0;
 }
 
 // ============================================
 // Game Simulation
 // ============================================
 
-void play_game(AIPlayer ai1, AIPlayer ai2, int visualize, MatchupStats *stats) {
+// Plays a game from start (an opening, or the empty board) and returns
+// the winner ('x', 'o' or 'd'). Moves count from the empty board. If
+// record is given, the moves and result are written into it; an
+// opening's stones go first, X and O alternating in cell order.
+char play_game_from(AIPlayer ai1, AIPlayer ai2, Bitboard start, int visualize,
+                    MatchupStats *stats, TTGLRecord *record) {
     GameState game;
     init_board(&game);
+    g_game_number++;
+    game.bb = start;
+    bb_to_chars(start, game.board, PLAYER_X, PLAYER_O, EMPTY);
+    if (record) {
+        for (uint16_t xs = start.x, os = start.o; xs | os; ) {
+            ttt_gl_push_move(record, bb_ctz(xs));
+            xs &= xs - 1;
+            if (os) {
+                ttt_gl_push_move(record, bb_ctz(os));
+                os &= os - 1;
+            }
+        }
+    }
     
-    char current_player = PLAYER_X; // X always starts
-    int move_count = 0;
+    char current_player = bb_side_to_move(start) == TTT_SIDE_X ? PLAYER_X : PLAYER_O;
+    int move_count = TTT_CELLS - bb_count_empty(start);
     
     if (visualize) {
         printf("\n========================================\n");
@@ -351,16 +644,27 @@ void play_game(AIPlayer ai1, AIPlayer ai2, int visualize, MatchupStats *stats) {
         AIPlayer current_ai = (current_player == PLAYER_X) ? ai1 : ai2;
         
         // Get AI move
+#ifdef TTT_LATENCY
+        uint64_t move_start = ttt_clock_ns();
+#endif
         int move = current_ai.function(game.board, current_player);
+#ifdef TTT_LATENCY
+        TTTLatency *latency = g_latency[side_of(current_player)];
+        if (latency && move_count < BOARD_SIZE) {
+            ttt_latency_record(&latency[move_count], ttt_clock_ns() - move_start);
+        }
+#endif
         
-        if (move < 0 || move >= BOARD_SIZE || game.board[move] != EMPTY) {
+        if (!bb_is_empty_cell(game.bb, move)) {
             printf("ERROR: Invalid move %d by %s\n", move, current_ai.name);
             break;
         }
         
         // Make move
         game.board[move] = current_player;
+        bb_toggle(&game.bb, move, side_of(current_player));
         move_count++;
+        if (record) ttt_gl_push_move(record, move);
         
         if (visualize) {
             printf("Move %d: %s (%c) plays position %d\n", 
@@ -370,7 +674,7 @@ void play_game(AIPlayer ai1, AIPlayer ai2, int visualize, MatchupStats *stats) {
         }
         
         // Check for winner
-        char result = check_winner(game.board);
+        char result = check_winner_bb(game.bb);
         if (result != ' ') {
             game.game_over = 1;
             game.winner = result;
@@ -402,6 +706,1048 @@ void play_game(AIPlayer ai1, AIPlayer ai2, int visualize, MatchupStats *stats) {
     if (game.winner == PLAYER_X) stats->ai1_wins++;
     else if (game.winner == PLAYER_O) stats->ai2_wins++;
     else if (game.winner == 'd') stats->draws++;
+    if (record && game.game_over) ttt_gl_set_result(record, bb_status(game.bb));
+    return game.winner;
+}
+
+void play_game(AIPlayer ai1, AIPlayer ai2, int visualize, MatchupStats *stats) {
+    play_game_from(ai1, ai2, bb_empty_board(), visualize, stats, NULL);  // X always starts
+}
+
+#ifdef TTT_LATENCY
+// Latency table of one player: all its moves, then each move number
+void print_latency(const char *name, const TTTLatency *per_move) {
+    TTTLatency all;
+    memset(&all, 0, sizeof(all));
+    for (int m = 0; m < BOARD_SIZE; m++) ttt_latency_merge(&all, &per_move[m]);
+    if (all.count == 0) return;
+    
+    printf("\n⏱️  Move latency: %s\n", name);
+    printf("  %-5s %12s %9s %9s %9s %9s %9s\n", "Move", "Calls", "Mean", "p50", "p90", "p99", "Max");
+    for (int m = -1; m < BOARD_SIZE; m++) {
+        const TTTLatency *h = (m < 0) ? &all : &per_move[m];
+        if (h->count == 0) continue;
+        
+        uint64_t values[5] = {
+            h->total_ns / h->count,
+            ttt_latency_quantile(h, 0.50),
+            ttt_latency_quantile(h, 0.90),
+            ttt_latency_quantile(h, 0.99),
+            h->max_ns
+        };
+        char label[8];
+        if (m < 0) snprintf(label, sizeof(label), "all");
+        else snprintf(label, sizeof(label), "%d", m + 1);
+        printf("  %-5s %12llu", label, (unsigned long long)h->count);
+        for (int v = 0; v < 5; v++) {
+            char text[16];
+            ttt_latency_format(values[v], text, sizeof(text));
+            printf(" %9s", text);
+        }
+        printf("\n");
+    }
+}
+#endif
+
+void merge_stats(MatchupStats *into, const MatchupStats *from) {
+    into->total_games += from->total_games;
+    into->ai1_wins += from->ai1_wins;
+    into->ai2_wins += from->ai2_wins;
+    into->draws += from->draws;
+    into->total_moves += from->total_moves;
+    if (from->fastest_game > 0 &&
+        (into->fastest_game == 0 || from->fastest_game < into->fastest_game)) {
+        into->fastest_game = from->fastest_game;
+    }
+    if (from->longest_game > into->longest_game) {
+        into->longest_game = from->longest_game;
+    }
+}
+
+// ============================================
+// Tournament Mode (non-interactive, multi-threaded)
+// ============================================
+// Every ordered pair (i, j), i != j, of the registry plays N games with
+// i as X, so each pair meets in both colors. Game g of pair p uses RNG
+// stream p * N + g of the seed and thread ranges are contiguous runs of
+// games; threads keep private stats and merge them once.
+//
+// With --batch, pairs of policies that ttt_batch implements are played
+// by the vectorized engine instead, in chunks of BATCH_CHUNK_GAMES with
+// a stream per chunk, so their results are also thread-count independent.
+//
+// With --sprt, each unordered pair {a, b} instead alternates colors game
+// by game (a as X first) and stops once the SPRT is decided; N becomes
+// the cap per color. Its k-th game with a given X is game k of that
+// ordered pair, so the games played are a prefix of the full tournament's.
+//
+// With --openings D, games start from the canonical positions D plies
+// deep, game g of a pair from opening g mod (number of openings). Both
+// colors of game g start from the same opening on the same RNG stream
+// (common random numbers): the luck of the draw is shared, so the pair's
+// score difference mostly measures skill and converges in fewer games.
+
+#define MAX_AIS 16
+#define BATCH_CHUNK_GAMES (16 * TTT_BATCH_SIZE)
+#define BATCH_STREAM (1ULL << 62)  // keeps batch streams apart from game streams
+#define PAIRED_STREAM (1ULL << 61)  // both colors of a paired game share one
+#define MAX_OPENINGS 64            // 38 canonical positions at depth 3
+#define LOG_BATCH 1024             // games a thread collects before writing them
+
+typedef struct {
+    const AIPlayer *ais;
+    int num_ais;
+    int games_per_pair;
+    uint64_t seed;
+    int batch;
+    int scalar_pairs[MAX_AIS * MAX_AIS];    // pair numbers played game by game
+    int num_scalar_pairs;
+    int batch_pairs[MAX_AIS * MAX_AIS];     // pair numbers played by ttt_batch
+    int num_batch_pairs;
+    int failed;
+    int sprt;                               // stop pairs early (--sprt)
+    int openings;                           // opening depth (--openings), 0 = empty board
+    Bitboard opening[MAX_OPENINGS];
+    int num_openings;
+    double paired_points[MAX_AIS * MAX_AIS];  // [a * num_ais + b], a < b: a's points
+    double paired_squares[MAX_AIS * MAX_AIS]; // per game pair (0-2), and their squares
+    int paired_games[MAX_AIS * MAX_AIS];      // game pairs played
+    TTGLWriter *log;                          // every game goes here (--log), or NULL
+    TTTSprt test;
+    double sprt_llr[MAX_AIS * MAX_AIS];     // [a * num_ais + b], a < b, a's view
+    int sprt_status[MAX_AIS * MAX_AIS];     // TTT_SPRT_*
+    MatchupStats stats[MAX_AIS * MAX_AIS];  // [x * num_ais + o]
+#ifdef TTT_LATENCY
+    TTTLatency *latency;                    // [ai * BOARD_SIZE + move number]
+#endif
+    pthread_mutex_t lock;
+} Tournament;
+
+typedef struct {
+    int threads;
+    double seconds;
+    double games_per_second;
+} ScalingPoint;
+
+// A thread's games waiting to be written to the log
+typedef struct {
+    TTGLRecord rec[LOG_BATCH];
+    int n;
+} LogBuffer;
+
+static double wall_seconds(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int tournament_pairs(const Tournament *t) {
+    return t->num_ais * (t->num_ais - 1);
+}
+
+// Ordered pair number p -> (x, o) with x != o
+static void pair_players(const Tournament *t, int p, int *x, int *o) {
+    *x = p / (t->num_ais - 1);
+    *o = p % (t->num_ais - 1);
+    if (*o >= *x) (*o)++;
+}
+
+// Games actually played (fewer than the pairs x N once SPRT stops pairs)
+static long long tournament_games(const Tournament *t) {
+    long long games = 0;
+    for (int i = 0; i < t->num_ais * t->num_ais; i++) games += t->stats[i].total_games;
+    return games;
+}
+
+static void flush_log(Tournament *t, LogBuffer *buf) {
+    if (!buf || buf->n == 0) return;
+    pthread_mutex_lock(&t->lock);
+    for (int i = 0; i < buf->n; i++) ttt_gl_writer_add(t->log, &buf->rec[i]);
+    pthread_mutex_unlock(&t->lock);
+    buf->n = 0;
+}
+
+// Record for the next game of the thread, NULL when not logging
+static TTGLRecord *log_slot(Tournament *t, LogBuffer *buf, uint64_t stream, int x, int o) {
+    if (!buf) return NULL;
+    if (buf->n == LOG_BATCH) flush_log(t, buf);
+    TTGLRecord *rec = &buf->rec[buf->n++];
+    *rec = ttt_gl_record(stream, x, o);
+    return rec;
+}
+
+// The thread's log buffer; without memory the games run unlogged and
+// the tournament reports the failure
+static LogBuffer *log_buffer(Tournament *t) {
+    if (!t->log) return NULL;
+    LogBuffer *buf = malloc(sizeof(LogBuffer));
+    if (!buf) t->failed = 1;
+    else buf->n = 0;
+    return buf;
+}
+
+static int batch_chunks_per_pair(const Tournament *t) {
+    return (t->games_per_pair + BATCH_CHUNK_GAMES - 1) / BATCH_CHUNK_GAMES;
+}
+
+static void merge_into_tournament(Tournament *t, const MatchupStats *local) {
+    pthread_mutex_lock(&t->lock);
+    for (int i = 0; i < t->num_ais * t->num_ais; i++) {
+        merge_stats(&t->stats[i], &local[i]);
+    }
+    pthread_mutex_unlock(&t->lock);
+}
+
+static void play_tournament_range(size_t begin, size_t end, void *ctx) {
+    Tournament *t = (Tournament *)ctx;
+    MatchupStats local[MAX_AIS * MAX_AIS];
+    memset(local, 0, sizeof(local));
+    LogBuffer *log = log_buffer(t);
+#ifdef TTT_LATENCY
+    // Without memory the games still run, just untimed
+    TTTLatency *local_latency = calloc((size_t)t->num_ais * BOARD_SIZE, sizeof(TTTLatency));
+#endif
+    
+    for (size_t g = begin; g < end; g++) {
+        int p = t->scalar_pairs[g / (size_t)t->games_per_pair], x, o;
+        pair_players(t, p, &x, &o);
+        MatchupStats *stats = &local[x * t->num_ais + o];
+#ifdef TTT_LATENCY
+        if (local_latency) {
+            g_latency[TTT_SIDE_X] = &local_latency[x * BOARD_SIZE];
+            g_latency[TTT_SIDE_O] = &local_latency[o * BOARD_SIZE];
+        }
+#endif
+        
+        uint64_t stream = (uint64_t)p * t->games_per_pair + g % (size_t)t->games_per_pair;
+        ttt_rng_seed_stream(&g_rng, t->seed, stream);
+        stats->total_games++;
+        play_game_from(t->ais[x], t->ais[o], bb_empty_board(), 0, stats, log_slot(t, log, stream, x, o));
+    }
+    
+    merge_into_tournament(t, local);
+    flush_log(t, log);
+    free(log);
+    release_players();
+#ifdef TTT_LATENCY
+    g_latency[TTT_SIDE_X] = g_latency[TTT_SIDE_O] = NULL;
+    if (local_latency) {
+        pthread_mutex_lock(&t->lock);
+        for (int i = 0; i < t->num_ais * BOARD_SIZE; i++) {
+            ttt_latency_merge(&t->latency[i], &local_latency[i]);
+        }
+        pthread_mutex_unlock(&t->lock);
+        free(local_latency);
+    }
+#endif
+}
+
+static void play_batch_range(size_t begin, size_t end, void *ctx) {
+    Tournament *t = (Tournament *)ctx;
+    MatchupStats local[MAX_AIS * MAX_AIS];
+    memset(local, 0, sizeof(local));
+    int chunks = batch_chunks_per_pair(t);
+    
+    for (size_t c = begin; c < end; c++) {
+        int p = t->batch_pairs[c / (size_t)chunks], chunk = (int)(c % (size_t)chunks), x, o;
+        pair_players(t, p, &x, &o);
+        int games = t->games_per_pair - chunk * BATCH_CHUNK_GAMES;
+        if (games > BATCH_CHUNK_GAMES) games = BATCH_CHUNK_GAMES;
+        
+        TTTRng rng;
+        ttt_rng_seed_stream(&rng, t->seed, BATCH_STREAM | ((uint64_t)p << 32) | (uint64_t)chunk);
+        TTTBatchStats bs = {0};
+        if (!ttt_batch_play_policies(t->ais[x].batch_policy, t->ais[x].policy,
+                                     t->ais[o].batch_policy, t->ais[o].policy,
+                                     (uint64_t)games, &rng, &bs)) {
+            t->failed = 1;
+            continue;
+        }
+        
+        MatchupStats st = {(int)bs.games, (int)bs.x_wins, (int)bs.o_wins, (int)bs.draws,
+                           (long long)bs.total_moves, bs.fastest, bs.longest};
+        merge_stats(&local[x * t->num_ais + o], &st);
+    }
+    
+    merge_into_tournament(t, local);
+}
+
+// a's wins, draws and losses against b over both colors
+static void pair_results(const Tournament *t, const MatchupStats *stats, int a, int b,
+                         double *wins, double *draws, double *losses) {
+    const MatchupStats *ab = &stats[a * t->num_ais + b];  // a as X
+    const MatchupStats *ba = &stats[b * t->num_ais + a];  // a as O
+    *wins = ab->ai1_wins + ba->ai2_wins;
+    *draws = ab->draws + ba->draws;
+    *losses = ab->ai2_wins + ba->ai1_wins;
+}
+
+// Canonical positions (smallest code of their symmetry class) with
+// depth stones and the game still on, in code order
+static int find_openings(int depth, Bitboard *out) {
+    ttt_sym_init();
+    int n = 0;
+    for (int code = 0; code < TTT_NUM_CODES && n < MAX_OPENINGS; code++) {
+        Bitboard b = bb_from_code(code);
+        int xs = bb_popcount(b.x), os = bb_popcount(b.o);
+        if (xs + os != depth || (xs != os && xs != os + 1)) continue;
+        if (bb_status(b) != TTT_ONGOING || !ttt_sym_is_canonical(code)) continue;
+        out[n++] = b;
+    }
+    return n;
+}
+
+// Game g of unordered pair {a, b} in both colors, a as X first, from
+// the same start with the same random numbers; adds the results to
+// local and returns a's points (0-2)
+static double play_game_pair(Tournament *t, int a, int b, int g, MatchupStats *local,
+                             LogBuffer *log) {
+    double points = 0.0;
+    for (int swap = 0; swap < 2; swap++) {
+        int x = swap ? b : a, o = swap ? a : b;
+        MatchupStats *stats = &local[x * t->num_ais + o];
+        Bitboard start = t->openings ? t->opening[g % t->num_openings] : bb_empty_board();
+        uint64_t stream = PAIRED_STREAM | ((uint64_t)(a * t->num_ais + b) << 32) | (uint64_t)g;
+        ttt_rng_seed_stream(&g_rng, t->seed, stream);
+        stats->total_games++;
+        char winner = play_game_from(t->ais[x], t->ais[o], start, 0, stats,
+                                     log_slot(t, log, stream, x, o));
+        if (winner == 'd') points += 0.5;
+        else if (winner == (swap ? PLAYER_O : PLAYER_X)) points += 1.0;
+    }
+    return points;
+}
+
+static void merge_paired(Tournament *t, const double *points, const double *squares,
+                         const int *games) {
+    pthread_mutex_lock(&t->lock);
+    for (int i = 0; i < t->num_ais * t->num_ais; i++) {
+        t->paired_points[i] += points[i];
+        t->paired_squares[i] += squares[i];
+        t->paired_games[i] += games[i];
+    }
+    pthread_mutex_unlock(&t->lock);
+}
+
+// Each unordered pair plays one game per color, then checks the test
+static void play_sprt_range(size_t begin, size_t end, void *ctx) {
+    Tournament *t = (Tournament *)ctx;
+    MatchupStats local[MAX_AIS * MAX_AIS];
+    memset(local, 0, sizeof(local));
+    LogBuffer *log = log_buffer(t);
+    
+    for (size_t u = begin; u < end; u++) {
+        int a = t->scalar_pairs[u] / t->num_ais, b = t->scalar_pairs[u] % t->num_ais;
+        int status = TTT_SPRT_CONTINUE;
+        double llr = 0.0;
+        // Two deterministic AIs replay the same game from each start
+        int cap = t->games_per_pair;
+        if (!t->ais[a].has_randomness && !t->ais[b].has_randomness) {
+            int starts = t->openings ? t->num_openings : 1;
+            if (starts < cap) cap = starts;
+        }
+        for (int g = 0; g < cap && status == TTT_SPRT_CONTINUE; g++) {
+            double points = play_game_pair(t, a, b, g, local, log);
+            t->paired_points[t->scalar_pairs[u]] += points;  // one thread per pair
+            t->paired_squares[t->scalar_pairs[u]] += points * points;
+            t->paired_games[t->scalar_pairs[u]]++;
+            double w, d, l;
+            pair_results(t, local, a, b, &w, &d, &l);
+            llr = ttt_sprt_llr(&t->test, w, d, l);
+            status = ttt_sprt_status(&t->test, llr);
+        }
+        // Each pair is handled by exactly one thread
+        t->sprt_llr[t->scalar_pairs[u]] = llr;
+        t->sprt_status[t->scalar_pairs[u]] = status;
+    }
+    
+    merge_into_tournament(t, local);
+    flush_log(t, log);
+    free(log);
+    release_players();
+}
+
+// Paired games without early stopping: item i is game i mod N of
+// unordered pair i / N
+static void play_paired_range(size_t begin, size_t end, void *ctx) {
+    Tournament *t = (Tournament *)ctx;
+    MatchupStats local[MAX_AIS * MAX_AIS];
+    double points[MAX_AIS * MAX_AIS], squares[MAX_AIS * MAX_AIS];
+    int games[MAX_AIS * MAX_AIS];
+    memset(local, 0, sizeof(local));
+    memset(points, 0, sizeof(points));
+    memset(squares, 0, sizeof(squares));
+    memset(games, 0, sizeof(games));
+    LogBuffer *log = log_buffer(t);
+    
+    for (size_t i = begin; i < end; i++) {
+        int pair = t->scalar_pairs[i / (size_t)t->games_per_pair];
+        int g = (int)(i % (size_t)t->games_per_pair);
+        double p = play_game_pair(t, pair / t->num_ais, pair % t->num_ais, g, local, log);
+        points[pair] += p;
+        squares[pair] += p * p;
+        games[pair]++;
+    }
+    
+    merge_into_tournament(t, local);
+    merge_paired(t, points, squares, games);
+    flush_log(t, log);
+    free(log);
+    release_players();
+}
+
+// Plays the whole tournament; returns the wall time in seconds
+static double run_tournament(Tournament *t, int threads) {
+    memset(t->stats, 0, sizeof(t->stats));
+#ifdef TTT_LATENCY
+    memset(t->latency, 0, (size_t)t->num_ais * BOARD_SIZE * sizeof(TTTLatency));
+#endif
+    memset(t->paired_points, 0, sizeof(t->paired_points));
+    memset(t->paired_squares, 0, sizeof(t->paired_squares));
+    memset(t->paired_games, 0, sizeof(t->paired_games));
+    t->num_scalar_pairs = t->num_batch_pairs = 0;
+    if (t->sprt || t->openings) {
+        // scalar_pairs holds a * num_ais + b for every a < b
+        for (int a = 0; a < t->num_ais; a++) {
+            for (int b = a + 1; b < t->num_ais; b++) {
+                t->scalar_pairs[t->num_scalar_pairs++] = a * t->num_ais + b;
+            }
+        }
+        double start = wall_seconds();
+        if (t->sprt) {
+            ttt_parallel_for((size_t)t->num_scalar_pairs, threads, play_sprt_range, t);
+        } else {
+            ttt_parallel_for((size_t)t->num_scalar_pairs * (size_t)t->games_per_pair, threads,
+                             play_paired_range, t);
+        }
+        return wall_seconds() - start;
+    }
+    for (int p = 0; p < tournament_pairs(t); p++) {
+        int x, o;
+        pair_players(t, p, &x, &o);
+        if (t->batch && t->ais[x].batch_policy >= 0 && t->ais[o].batch_policy >= 0) {
+            t->batch_pairs[t->num_batch_pairs++] = p;
+        } else {
+            t->scalar_pairs[t->num_scalar_pairs++] = p;
+        }
+    }
+    
+    double start = wall_seconds();
+    ttt_parallel_for((size_t)t->num_scalar_pairs * (size_t)t->games_per_pair, threads,
+                     play_tournament_range, t);
+    ttt_parallel_for((size_t)t->num_batch_pairs * (size_t)batch_chunks_per_pair(t), threads,
+                     play_batch_range, t);
+    return wall_seconds() - start;
+}
+
+static void print_tournament(const Tournament *t) {
+    printf("\n%-20s %-20s %8s %8s %8s %8s %9s\n",
+           "X", "O", "Games", "X wins", "O wins", "Draws", "Avg moves");
+    for (int p = 0; p < tournament_pairs(t); p++) {
+        int x, o;
+        pair_players(t, p, &x, &o);
+        const MatchupStats *st = &t->stats[x * t->num_ais + o];
+        printf("%-20s %-20s %8d %8d %8d %8d %9.2f\n",
+               t->ais[x].name, t->ais[o].name, st->total_games,
+               st->ai1_wins, st->ai2_wins, st->draws,
+               (double)st->total_moves / st->total_games);
+    }
+}
+
+// Each pair's score with its 95% margin from the paired games, next to
+// the margin the same number of independent games would give
+static void print_paired(const Tournament *t) {
+    printf("\nPaired games (both colors per %s, common random numbers):\n",
+           t->openings ? "opening" : "game");
+    printf("%-20s %-20s %8s %9s %10s %11s %8s\n",
+           "A", "B", "Pairs", "A score", "Paired", "Unpaired", "Saving");
+    for (int u = 0; u < t->num_scalar_pairs; u++) {
+        int pair = t->scalar_pairs[u], a = pair / t->num_ais, b = pair % t->num_ais;
+        int n = t->paired_games[pair];
+        if (n == 0) continue;
+        double mean = t->paired_points[pair] / n;
+        double var = t->paired_squares[pair] / n - mean * mean;
+        double paired = 1.96 * sqrt(var / n) / 2;  // per-game score is points / 2
+        
+        double w, d, l, s, game_var;
+        pair_results(t, t->stats, a, b, &w, &d, &l);
+        s = (w + d / 2) / (w + d + l);
+        game_var = (w * (1 - s) * (1 - s) + d * (0.5 - s) * (0.5 - s) + l * s * s) / (w + d + l);
+        double unpaired = 1.96 * sqrt(game_var / (w + d + l));
+        
+        char paired_text[16], unpaired_text[16], saving[16] = "-";
+        snprintf(paired_text, sizeof(paired_text), "+/-%.2f%%", paired * 100);
+        snprintf(unpaired_text, sizeof(unpaired_text), "+/-%.2f%%", unpaired * 100);
+        if (paired > 0) snprintf(saving, sizeof(saving), "%.1fx", (unpaired * unpaired) / (paired * paired));
+        printf("%-20s %-20s %8d %8.2f%% %10s %11s %8s\n", t->ais[a].name, t->ais[b].name,
+               n, s * 100, paired_text, unpaired_text, saving);
+    }
+    printf("Saving = games independent sampling would need for the same margin.\n");
+}
+
+static void print_sprt(const Tournament *t) {
+    double lower, upper;
+    ttt_sprt_bounds(&t->test, &lower, &upper);
+    printf("\nSPRT per pair: H0 = %+.0f Elo, H1 = %+.0f Elo (alpha %.3g, beta %.3g, "
+           "LLR bounds %.2f / %.2f)\n",
+           t->test.elo0, t->test.elo1, t->test.alpha, t->test.beta, lower, upper);
+    printf("%-20s %-20s %8s %8s %8s %8s %8s  %s\n",
+           "A", "B", "Games", "A wins", "Draws", "B wins", "LLR", "Verdict");
+    for (int u = 0; u < t->num_scalar_pairs; u++) {
+        int a = t->scalar_pairs[u] / t->num_ais, b = t->scalar_pairs[u] % t->num_ais;
+        double w, d, l;
+        pair_results(t, t->stats, a, b, &w, &d, &l);
+        int status = t->sprt_status[t->scalar_pairs[u]];
+        printf("%-20s %-20s %8.0f %8.0f %8.0f %8.0f %8.2f  %s\n",
+               t->ais[a].name, t->ais[b].name, w + d + l, w, d, l,
+               t->sprt_llr[t->scalar_pairs[u]],
+               status == TTT_SPRT_H1 ? "H1 (A stronger)" :
+               status == TTT_SPRT_H0 ? "H0 (A not stronger)" :
+               t->ais[a].has_randomness || t->ais[b].has_randomness ? "inconclusive (cap reached)" :
+               "deterministic (every start once)");
+    }
+}
+
+// Games and points of every AI against every other, for ttt_rating
+static void rating_matrices(const Tournament *t, double *games, double *score) {
+    int n = t->num_ais;
+    memset(games, 0, (size_t)n * n * sizeof(double));
+    memset(score, 0, (size_t)n * n * sizeof(double));
+    for (int a = 0; a < n; a++) {
+        for (int b = 0; b < n; b++) {
+            if (a == b) continue;
+            double w, d, l;
+            pair_results(t, t->stats, a, b, &w, &d, &l);
+            games[a * n + b] = w + d + l;
+            score[a * n + b] = w + d / 2;
+        }
+    }
+}
+
+// Glicko state from a previous run: "name,rating,rd" lines. Players not
+// listed keep their values; a missing file is not an error (first run),
+// a malformed one returns 0.
+static int load_glicko(const char *filename, const Tournament *t, TTTGlicko *players) {
+    FILE *fp = fopen(filename, "r");
+    if (!fp) return 1;
+    
+    char line[256];
+    int ok = 1;
+    while (fgets(line, sizeof(line), fp)) {
+        char *comma = strrchr(line, ',');
+        if (!comma || comma == line) continue;
+        *comma = '\0';
+        char *comma2 = strrchr(line, ',');
+        if (!comma2) { ok = 0; break; }
+        *comma2 = '\0';
+        for (int k = 0; k < t->num_ais; k++) {
+            if (strcmp(line, t->ais[k].name) == 0) {
+                players[k].rating = atof(comma2 + 1);
+                players[k].rd = atof(comma + 1);
+            }
+        }
+    }
+    fclose(fp);
+    return ok;
+}
+
+static int save_glicko(const char *filename, const Tournament *t, const TTTGlicko *players) {
+    FILE *fp = fopen(filename, "w");
+    if (!fp) return 0;
+    for (int k = 0; k < t->num_ais; k++) {
+        fprintf(fp, "%s,%.3f,%.3f\n", t->ais[k].name, players[k].rating, players[k].rd);
+    }
+    int ok = !ferror(fp);
+    if (fclose(fp) != 0) ok = 0;
+    return ok;
+}
+
+// Elo fitted to this tournament, plus Glicko updated with it as one
+// rating period (carried over from ratings_file when given)
+static int print_ratings(const Tournament *t, const char *ratings_file) {
+    int n = t->num_ais;
+    double games[MAX_AIS * MAX_AIS], score[MAX_AIS * MAX_AIS];
+    double elo[MAX_AIS], ci[MAX_AIS];
+    TTTGlicko glicko[MAX_AIS];
+    rating_matrices(t, games, score);
+    if (!ttt_elo_fit(n, games, score, elo, ci)) {
+        fprintf(stderr, "Error: Memory allocation failed for ratings\n");
+        return 0;
+    }
+    // Unrated players enter at this tournament's Elo (a neutral 1500
+    // would be dragged around by whoever they happened to play most)
+    for (int k = 0; k < n; k++) {
+        glicko[k].rating = elo[k];
+        glicko[k].rd = TTT_GLICKO_INITIAL_RD;
+    }
+    if (ratings_file && !load_glicko(ratings_file, t, glicko)) {
+        fprintf(stderr, "Error: Could not parse %s\n", ratings_file);
+        return 0;
+    }
+    ttt_glicko_update(glicko, n, games, score);
+    
+    int order[MAX_AIS];
+    for (int k = 0; k < n; k++) order[k] = k;
+    for (int i = 1; i < n; i++) {
+        for (int j = i; j > 0 && elo[order[j]] > elo[order[j - 1]]; j--) {
+            int tmp = order[j]; order[j] = order[j - 1]; order[j - 1] = tmp;
+        }
+    }
+    
+    printf("\n%-4s %-20s %8s %8s %9s %7s\n", "Rank", "AI", "Elo", "95%", "Glicko", "RD");
+    for (int r = 0; r < n; r++) {
+        int k = order[r];
+        char margin[16];
+        snprintf(margin, sizeof(margin), "+/-%.0f", ci[k]);
+        printf("%-4d %-20s %8.0f %8s %9.0f %7.1f\n", r + 1, t->ais[k].name, elo[k],
+               margin, glicko[k].rating, glicko[k].rd);
+    }
+    
+    if (ratings_file) {
+        if (!save_glicko(ratings_file, t, glicko)) {
+            fprintf(stderr, "Error: Could not write %s\n", ratings_file);
+            return 0;
+        }
+        printf("Glicko ratings saved to %s\n", ratings_file);
+    }
+    return 1;
+}
+
+static int write_tournament_csv(const Tournament *t, const char *filename) {
+    FILE *fp = fopen(filename, "w");
+    if (!fp) return 0;
+    
+    fprintf(fp, "x_ai,o_ai,games,x_wins,o_wins,draws,avg_moves,fastest,longest\n");
+    for (int p = 0; p < tournament_pairs(t); p++) {
+        int x, o;
+        pair_players(t, p, &x, &o);
+        const MatchupStats *st = &t->stats[x * t->num_ais + o];
+        fprintf(fp, "%s,%s,%d,%d,%d,%d,%.4f,%d,%d\n",
+                t->ais[x].name, t->ais[o].name, st->total_games,
+                st->ai1_wins, st->ai2_wins, st->draws,
+                (double)st->total_moves / st->total_games,
+                st->fastest_game, st->longest_game);
+    }
+    
+    int ok = !ferror(fp);
+    if (fclose(fp) != 0) ok = 0;
+    return ok;
+}
+
+static int write_tournament_json(const Tournament *t, int threads, double seconds,
+                                 const ScalingPoint *scaling, int num_scaling,
+                                 const char *filename) {
+    FILE *fp = fopen(filename, "w");
+    if (!fp) return 0;
+    
+    long long total = tournament_games(t);
+    fprintf(fp, "{\n  \"games_per_pair\": %d,\n  \"seed\": %llu,\n  \"threads\": %d,\n",
+            t->games_per_pair, (unsigned long long)t->seed, threads);
+    fprintf(fp, "  \"total_games\": %lld,\n  \"seconds\": %.6f,\n  \"games_per_second\": %.1f,\n",
+            total, seconds, total / seconds);
+    
+    fprintf(fp, "  \"matchups\": [\n");
+    for (int p = 0; p < tournament_pairs(t); p++) {
+        int x, o;
+        pair_players(t, p, &x, &o);
+        const MatchupStats *st = &t->stats[x * t->num_ais + o];
+        fprintf(fp, "    {\"x\": \"%s\", \"o\": \"%s\", \"games\": %d, \"x_wins\": %d, "
+                    "\"o_wins\": %d, \"draws\": %d, \"avg_moves\": %.4f, "
+                    "\"fastest\": %d, \"longest\": %d}%s\n",
+                t->ais[x].name, t->ais[o].name, st->total_games,
+                st->ai1_wins, st->ai2_wins, st->draws,
+                (double)st->total_moves / st->total_games,
+                st->fastest_game, st->longest_game,
+                p < tournament_pairs(t) - 1 ? "," : "");
+    }
+    fprintf(fp, "  ],\n  \"scaling\": [");
+    for (int i = 0; i < num_scaling; i++) {
+        fprintf(fp, "%s\n    {\"threads\": %d, \"seconds\": %.6f, \"games_per_second\": %.1f}",
+                i ? "," : "", scaling[i].threads, scaling[i].seconds, scaling[i].games_per_second);
+    }
+    fprintf(fp, "%s]\n}\n", num_scaling ? "\n  " : "");
+    
+    int ok = !ferror(fp);
+    if (fclose(fp) != 0) ok = 0;
+    return ok;
+}
+
+static void usage(const char *prog) {
+    fprintf(stderr, "Usage: %s [--seed S]                 (interactive single matchup)\n"
+                    "       %s --tournament [--games N] [--threads N] [--seed S] [--ais i,j,...]\n"
+                    "                 [--batch] [--no-simd] [--scaling] [--csv file] [--json file]\n"
+                    "                 [--sprt] [--elo0 E] [--elo1 E] [--alpha A] [--beta B]\n"
+                    "                 [--openings D] [--ratings file] [--log file.ttgl]\n"
+                    "       %s --exact [--ais i,j,...] [--csv file]\n"
+                    "       %s --exploit [--ais i,j,...] [--top N]\n"
+                    "MCTS player, any mode: [--mcts-playouts N] [--mcts-ms T] [--mcts-trees N]\n"
+                    "                 [--mcts-threads N] [--mcts-c C] [--mcts-nodes N] [--mcts-no-reuse]\n"
+                    "Alpha-Beta player, any mode: [--move-ms T] [--move-depth D]\n"
+                    "Model files, any mode: [--nb-model file.txt] [--q-model file.txt]\n",
+            prog, prog, prog, prog);
+}
+
+// Parses "0,2,3" into registry entries; returns the count, 0 if invalid
+static int select_ais(const char *list, const AIPlayer *ais, int num_ais, AIPlayer *out) {
+    int n = 0;
+    for (const char *p = list; *p; ) {
+        char *end;
+        long i = strtol(p, &end, 10);
+        if (end == p || i < 0 || i >= num_ais || n >= MAX_AIS) return 0;
+        out[n++] = ais[i];
+        p = (*end == ',') ? end + 1 : end;
+        if (*end != ',' && *end != '\0') return 0;
+    }
+    return n;
+}
+
+int run_tournament_mode(int argc, char *argv[], const AIPlayer *ais, int num_ais, uint64_t seed) {
+    Tournament t;
+    memset(&t, 0, sizeof(t));
+    t.ais = ais;
+    t.num_ais = num_ais;
+    t.games_per_pair = 1000;
+    t.seed = seed;
+    pthread_mutex_init(&t.lock, NULL);
+    
+    AIPlayer chosen[MAX_AIS];
+    int threads = 0, scaling = 0, simd = 1;
+    const char *csv_name = NULL, *json_name = NULL, *ratings_name = NULL, *log_name = NULL;
+    t.test.elo0 = -10;
+    t.test.elo1 = 10;
+    t.test.alpha = t.test.beta = 0.05;
+    for (int a = 1; a < argc; a++) {
+        if (strcmp(argv[a], "--tournament") == 0) continue;
+        else if (strcmp(argv[a], "--ais") == 0 && a + 1 < argc) {
+            t.num_ais = select_ais(argv[++a], ais, num_ais, chosen);
+            t.ais = chosen;
+            if (t.num_ais < 2) {
+                printf("--ais needs at least two valid AI numbers (0-%d)\n", num_ais - 1);
+                return 1;
+            }
+        }
+        else if (strcmp(argv[a], "--batch") == 0) t.batch = 1;
+        else if (strcmp(argv[a], "--no-simd") == 0) simd = 0;
+        else if (strcmp(argv[a], "--games") == 0 && a + 1 < argc) t.games_per_pair = atoi(argv[++a]);
+        else if (strcmp(argv[a], "--threads") == 0 && a + 1 < argc) threads = atoi(argv[++a]);
+        else if (strcmp(argv[a], "--scaling") == 0) scaling = 1;
+        else if (strcmp(argv[a], "--sprt") == 0) t.sprt = 1;
+        else if (strcmp(argv[a], "--openings") == 0 && a + 1 < argc) {
+            t.openings = atoi(argv[++a]);
+            if (t.openings < 1 || t.openings > 3) {
+                printf("--openings takes a depth of 1, 2 or 3\n");
+                return 1;
+            }
+        }
+        else if (strcmp(argv[a], "--elo0") == 0 && a + 1 < argc) t.test.elo0 = atof(argv[++a]);
+        else if (strcmp(argv[a], "--elo1") == 0 && a + 1 < argc) t.test.elo1 = atof(argv[++a]);
+        else if (strcmp(argv[a], "--alpha") == 0 && a + 1 < argc) t.test.alpha = atof(argv[++a]);
+        else if (strcmp(argv[a], "--beta") == 0 && a + 1 < argc) t.test.beta = atof(argv[++a]);
+        else if (strcmp(argv[a], "--ratings") == 0 && a + 1 < argc) ratings_name = argv[++a];
+        else if (strcmp(argv[a], "--log") == 0 && a + 1 < argc) log_name = argv[++a];
+        else if (strcmp(argv[a], "--csv") == 0 && a + 1 < argc) csv_name = argv[++a];
+        else if (strcmp(argv[a], "--json") == 0 && a + 1 < argc) json_name = argv[++a];
+        else { usage(argv[0]); return 1; }
+    }
+    if (t.games_per_pair < 1) {
+        printf("Invalid number of games!\n");
+        return 1;
+    }
+    if ((t.sprt || t.openings || log_name) && t.batch) {
+        printf("--sprt, --openings and --log play games one by one and cannot be combined with --batch\n");
+        return 1;
+    }
+    if (log_name && scaling) {
+        printf("--log records a single run and cannot be combined with --scaling\n");
+        return 1;
+    }
+    if (t.openings) t.num_openings = find_openings(t.openings, t.opening);
+    if (t.sprt && !(t.test.elo0 < t.test.elo1 && t.test.alpha > 0 && t.test.alpha < 1 &&
+                    t.test.beta > 0 && t.test.beta < 1)) {
+        printf("Invalid SPRT parameters (need elo0 < elo1, 0 < alpha, beta < 1)\n");
+        return 1;
+    }
+    if (threads <= 0) threads = ttt_cpu_count();
+    int use_simd = ttt_batch_set_simd(simd);
+#ifdef TTT_LATENCY
+    t.latency = calloc((size_t)t.num_ais * BOARD_SIZE, sizeof(TTTLatency));
+    if (!t.latency) {
+        fprintf(stderr, "Error: Memory allocation failed for latency histograms\n");
+        return 1;
+    }
+#endif
+    
+    size_t total = (size_t)tournament_pairs(&t) * (size_t)t.games_per_pair;
+    printf("========================================\n");
+    printf("🏆 Round-robin tournament\n");
+    printf("========================================\n");
+    printf("%d AIs, %d ordered pairs x %s%d games = %zu games, seed %llu\n",
+           t.num_ais, tournament_pairs(&t), t.sprt ? "up to " : "", t.games_per_pair, total,
+           (unsigned long long)t.seed);
+    if (t.batch) {
+        printf("Pairs of Random, Smart Random and the table/model AIs use the batch "
+               "engine (%s)\n", use_simd ? "AVX2" : "scalar");
+    }
+    if (t.openings) {
+        printf("Games start from the %d canonical openings %d plies deep, "
+               "each played in both colors\n", t.num_openings, t.openings);
+    }
+    
+    // Scaling sweep: 1, 2, 4, ... threads, always ending at the
+    // requested count; the final run's results are the ones reported
+    ScalingPoint points[32];
+    int num_points = 0;
+    if (scaling) {
+        printf("\n%8s %10s %14s %8s\n", "Threads", "Seconds", "Games/sec", "Speedup");
+        for (int n = 1; num_points < 32; n = (n * 2 < threads) ? n * 2 : threads) {
+            ScalingPoint *pt = &points[num_points++];
+            pt->threads = n;
+            pt->seconds = run_tournament(&t, n);
+            pt->games_per_second = tournament_games(&t) / pt->seconds;
+            printf("%8d %10.3f %14.1f %7.2fx\n", n, pt->seconds, pt->games_per_second,
+                   pt->games_per_second / points[0].games_per_second);
+            if (n == threads) break;
+        }
+    }
+    
+    TTGLWriter log;
+    if (log_name) {
+        const char *names[MAX_AIS];
+        for (int k = 0; k < t.num_ais; k++) names[k] = t.ais[k].name;
+        if (!ttt_gl_writer_open(&log, log_name, t.seed, names, t.num_ais)) {
+            fprintf(stderr, "Error: Could not write %s\n", log_name);
+            return 1;
+        }
+        t.log = &log;
+    }
+    
+    double seconds = scaling ? points[num_points - 1].seconds : run_tournament(&t, threads);
+    print_tournament(&t);
+    long long played = tournament_games(&t);
+    printf("\n%lld games in %.3f s on %d threads (%.1f games/sec)\n",
+           played, seconds, threads, played / seconds);
+    if (t.sprt || t.openings) print_paired(&t);
+    if (t.sprt) {
+        print_sprt(&t);
+        printf("SPRT stopped after %lld of %zu games (%.1f%%)\n",
+               played, total, 100.0 * played / total);
+    }
+    
+    int ok = print_ratings(&t, ratings_name);
+#ifdef TTT_LATENCY
+    // Batch-engine games make no per-move calls, so they are not timed
+    for (int k = 0; k < t.num_ais; k++) print_latency(t.ais[k].name, &t.latency[k * BOARD_SIZE]);
+    free(t.latency);
+#endif
+    
+    if (t.failed) {
+        fprintf(stderr, "Error: Memory allocation failed during the tournament\n");
+        ok = 0;
+    }
+    if (t.log) {
+        uint64_t logged = log.header.count;
+        if (ttt_gl_writer_close(&log)) {
+            printf("%llu games logged to %s\n", (unsigned long long)logged, log_name);
+        } else {
+            fprintf(stderr, "Error: Could not write %s\n", log_name);
+            ok = 0;
+        }
+    }
+    if (csv_name) {
+        if (write_tournament_csv(&t, csv_name)) printf("Results written to %s\n", csv_name);
+        else { fprintf(stderr, "Error: Could not write %s\n", csv_name); ok = 0; }
+    }
+    if (json_name) {
+        if (write_tournament_json(&t, threads, seconds, points, num_points, json_name)) {
+            printf("Results written to %s\n", json_name);
+        } else {
+            fprintf(stderr, "Error: Could not write %s\n", json_name);
+            ok = 0;
+        }
+    }
+    
+    pthread_mutex_destroy(&t.lock);
+    return ok ? 0 : 1;
+}
+
+// ============================================
+// Exact Analysis (no sampling)
+// ============================================
+//
+// Every AI describes its move choice as a probability per cell, so the
+// outcome distribution of a matchup is computed exactly by ttt_exact
+// rather than estimated from games.
+
+// Keeps the AIs whose move probabilities are known (not MCTS, whose
+// choice depends on its random playouts)
+static int exact_ais(const AIPlayer *ais, int num_ais, AIPlayer *out) {
+    int n = 0;
+    for (int i = 0; i < num_ais; i++) {
+        if (ais[i].distribution) out[n++] = ais[i];
+        else printf("Skipping %s: its move probabilities are not known exactly\n", ais[i].name);
+    }
+    return n;
+}
+
+static void ai_policy(Bitboard b, double probs[TTT_CELLS], void *ctx) {
+    const AIPlayer *ai = ctx;
+    char board[BOARD_SIZE];
+    bb_to_chars(b, board, PLAYER_X, PLAYER_O, EMPTY);
+    ai->distribution(board, bb_side_to_move(b) == TTT_SIDE_X ? PLAYER_X : PLAYER_O, probs);
+}
+
+int run_exact_mode(int argc, char *argv[], const AIPlayer *ais, int num_ais) {
+    AIPlayer chosen[MAX_AIS];
+    const char *csv_name = NULL;
+    for (int a = 1; a < argc; a++) {
+        if (strcmp(argv[a], "--exact") == 0) continue;
+        else if (strcmp(argv[a], "--ais") == 0 && a + 1 < argc) {
+            num_ais = select_ais(argv[++a], ais, num_ais, chosen);
+            ais = chosen;
+            if (num_ais < 1) {
+                printf("--ais needs at least one valid AI number\n");
+                return 1;
+            }
+        }
+        else if (strcmp(argv[a], "--csv") == 0 && a + 1 < argc) csv_name = argv[++a];
+        else { usage(argv[0]); return 1; }
+    }
+    AIPlayer exact[MAX_AIS];
+    num_ais = exact_ais(ais, num_ais, exact);
+    ais = exact;
+    if (num_ais < 1) {
+        printf("No AI left to analyze\n");
+        return 1;
+    }
+    
+    FILE *csv = NULL;
+    if (csv_name) {
+        csv = fopen(csv_name, "w");
+        if (!csv) {
+            fprintf(stderr, "Error: Could not write %s\n", csv_name);
+            return 1;
+        }
+        fprintf(csv, "x_ai,o_ai,x_win,o_win,draw,avg_moves\n");
+    }
+    
+    printf("========================================\n");
+    printf("🎯 Exact outcome distributions (X vs O)\n");
+    printf("========================================\n");
+    printf("%-20s %-20s %9s %9s %9s %9s\n", "X", "O", "X wins", "O wins", "Draws", "Avg moves");
+    
+    // Every ordered pair, mirror matches included
+    double start = wall_seconds();
+    for (int x = 0; x < num_ais; x++) {
+        for (int o = 0; o < num_ais; o++) {
+            TTTPolicy xp = {ai_policy, (void *)&ais[x]};
+            TTTPolicy op = {ai_policy, (void *)&ais[o]};
+            TTTOutcome r;
+            if (!ttt_exact_outcome(xp, op, &r)) {
+                fprintf(stderr, "Error: Memory allocation failed for exact analysis\n");
+                if (csv) fclose(csv);
+                return 1;
+            }
+            printf("%-20s %-20s %8.4f%% %8.4f%% %8.4f%% %9.3f\n", ais[x].name, ais[o].name,
+                   r.x_win * 100, r.o_win * 100, r.draw * 100, r.plies);
+            if (csv) {
+                fprintf(csv, "%s,%s,%.17g,%.17g,%.17g,%.17g\n", ais[x].name, ais[o].name,
+                        r.x_win, r.o_win, r.draw, r.plies);
+            }
+        }
+    }
+    double seconds = wall_seconds() - start;
+    printf("\n%d matchups solved exactly in %.3f ms\n", num_ais * num_ais, seconds * 1000);
+    
+    if (csv) {
+        int ok = !ferror(csv);
+        if (fclose(csv) != 0) ok = 0;
+        if (!ok) {
+            fprintf(stderr, "Error: Could not write %s\n", csv_name);
+            return 1;
+        }
+        printf("Results written to %s\n", csv_name);
+    }
+    return 0;
+}
+
+// Prints the leaks of one side, with the policy's likeliest move and
+// the perfect move for comparison
+static void print_leaks(const AIPlayer *ai, const TTTExploit *e, int top) {
+    printf("  %d leaking positions", e->num_leaks);
+    if (e->num_leaks == 0) {
+        printf("\n");
+        return;
+    }
+    printf(", costliest first:\n");
+    printf("    %-13s %9s %7s %6s %8s\n", "Board", "Reach", "Lost", "Plays", "Perfect");
+    for (int k = 0; k < e->num_leaks && k < top; k++) {
+        const TTTLeak *leak = &e->leaks[k];
+        Bitboard b = bb_from_code(leak->code);
+        char board[BOARD_SIZE];
+        bb_to_chars(b, board, PLAYER_X, PLAYER_O, '.');
+        
+        double probs[TTT_CELLS] = {0};
+        ai_policy(b, probs, (void *)ai);
+        int likeliest = bb_ctz(bb_empty_cells(b));
+        for (int i = 0; i < TTT_CELLS; i++) {
+            if (probs[i] > probs[likeliest]) likeliest = i;
+        }
+        
+        printf("    %.3s/%.3s/%.3s %8.4f%% %7.4f %6d %8d\n", board, board + 3, board + 6,
+               leak->reach * 100, leak->loss, likeliest, ttt_perfect_move(b));
+    }
+}
+
+int run_exploit_mode(int argc, char *argv[], const AIPlayer *ais, int num_ais) {
+    AIPlayer chosen[MAX_AIS];
+    int top = 5;
+    for (int a = 1; a < argc; a++) {
+        if (strcmp(argv[a], "--exploit") == 0) continue;
+        else if (strcmp(argv[a], "--ais") == 0 && a + 1 < argc) {
+            num_ais = select_ais(argv[++a], ais, num_ais, chosen);
+            ais = chosen;
+            if (num_ais < 1) {
+                printf("--ais needs at least one valid AI number\n");
+                return 1;
+            }
+        }
+        else if (strcmp(argv[a], "--top") == 0 && a + 1 < argc) top = atoi(argv[++a]);
+        else { usage(argv[0]); return 1; }
+    }
+    AIPlayer exact[MAX_AIS];
+    num_ais = exact_ais(ais, num_ais, exact);
+    ais = exact;
+    if (num_ais < 1) {
+        printf("No AI left to analyze\n");
+        return 1;
+    }
+    
+    printf("========================================\n");
+    printf("🕵️  Exploitability (best-response adversary)\n");
+    printf("========================================\n");
+    printf("Adversary's expected score: +1 = always wins, 0 = cannot beat the AI.\n");
+    
+    double start = wall_seconds();
+    for (int k = 0; k < num_ais; k++) {
+        printf("\n%s\n", ais[k].name);
+        for (int side = TTT_SIDE_X; side <= TTT_SIDE_O; side++) {
+            TTTPolicy policy = {ai_policy, (void *)&ais[k]};
+            TTTExploit e;
+            if (!ttt_exact_best_response(policy, side, &e)) {
+                fprintf(stderr, "Error: Memory allocation failed for exploitability analysis\n");
+                return 1;
+            }
+            const TTTOutcome *r = &e.outcome;
+            double ai_win = (side == TTT_SIDE_X) ? r->x_win : r->o_win;
+            printf(" as %c: adversary scores %+.4f (adversary wins %.4f%%, draws %.4f%%, loses %.4f%%)\n",
+                   side == TTT_SIDE_X ? 'X' : 'O', e.value,
+                   (1.0 - ai_win - r->draw) * 100, r->draw * 100, ai_win * 100);
+            print_leaks(&ais[k], &e, top);
+            ttt_exact_free_exploit(&e);
+        }
+    }
+    printf("\nSolved in %.3f ms\n", (wall_seconds() - start) * 1000);
+    return 0;
 }
 
 // ============================================
@@ -409,21 +1755,52 @@ void play_game(AIPlayer ai1, AIPlayer ai2, int visualize, MatchupStats *stats) {
 // ============================================
 
 int main(int argc, char *argv[]) {
-    srand(time(NULL));
+    uint64_t seed = ttt_rng_take_seed(&argc, argv);
+    ttt_rng_seed(&g_rng, seed);
+    if (!take_player_options(&argc, argv)) {
+        printf("Invalid --mcts-* or --move-* option (budgets and counts must be positive)\n");
+        return 1;
+    }
     
     // Try to load Linear Regression model
     printf("Loading Linear Regression model...\n");
     load_linear_model("../models/linear regression/model.bin");
+    printf("Loading Naive Bayes model...\n");
+    load_naive_bayes_model(g_nb_path);
+    printf("Loading Q-Learning table...\n");
+    load_q_table(g_q_path);
     printf("\n");
     
     // Define available AIs
     AIPlayer ais[] = {
-        {"Random", random_move, 1},
-        {"Smart Random", smart_random_move, 1},
-        {"Linear Regression", linear_regression_move, 1},
-        {"Minimax", minimax_move, 0}
+        {"Random", random_move, random_distribution, 1, TTT_BATCH_RANDOM, NULL},
+        {"Smart Random", smart_random_move, smart_random_distribution, 1, TTT_BATCH_SMART, NULL},
+        {"Linear Regression", linear_regression_move, linear_regression_distribution, 1,
+         g_model_loaded ? TTT_BATCH_POLICY : TTT_BATCH_RANDOM, &g_linear_policy},
+        {"Minimax", minimax_move, minimax_distribution, 0, -1, NULL},
+        {"Perfect", perfect_move, perfect_distribution, 0, TTT_BATCH_POLICY, &g_perfect_policy},
+        {mcts_name(), mcts_move, NULL, 1, -1, NULL},
+        {alphabeta_name(), alphabeta_move, alphabeta_distribution, 0, -1, NULL},
+        {"Naive Bayes", naive_bayes_move, naive_bayes_distribution, !g_nb_loaded,
+         g_nb_loaded ? TTT_BATCH_POLICY : TTT_BATCH_RANDOM, &g_nb_policy},
+        {"Q-Learning", q_learning_move, q_learning_distribution, !g_q_loaded,
+         g_q_loaded ? TTT_BATCH_POLICY : TTT_BATCH_RANDOM, &g_q_policy}
     };
-    int num_ais = 4;
+    int num_ais = 9;
+    
+    if (argc > 1) {
+        if (strcmp(argv[1], "--tournament") == 0) {
+            return run_tournament_mode(argc, argv, ais, num_ais, seed);
+        }
+        if (strcmp(argv[1], "--exact") == 0) {
+            return run_exact_mode(argc, argv, ais, num_ais);
+        }
+        if (strcmp(argv[1], "--exploit") == 0) {
+            return run_exploit_mode(argc, argv, ais, num_ais);
+        }
+        usage(argv[0]);
+        return 1;
+    }
     
     printf("========================================\n");
     printf("🎮 AI vs AI Testing Suite\n");
@@ -472,6 +1849,8 @@ int main(int argc, char *argv[]) {
     
     printf("\n========================================\n");
     printf("🏁 Running %d games: %s vs %s\n", num_games, ai1.name, ai2.name);
+    printf("Seed: %llu (pass --seed %llu to repeat this run)\n",
+           (unsigned long long)seed, (unsigned long long)seed);
     printf("========================================\n");
     
     if (!ai1.has_randomness && !ai2.has_randomness) {
@@ -484,6 +1863,11 @@ int main(int argc, char *argv[]) {
     stats.total_games = num_games;
     
     // Play games
+#ifdef TTT_LATENCY
+    static TTTLatency latency_x[BOARD_SIZE], latency_o[BOARD_SIZE];
+    g_latency[TTT_SIDE_X] = latency_x;
+    g_latency[TTT_SIDE_O] = latency_o;
+#endif
     clock_t start_time = clock();
     
     for (int i = 0; i < num_games; i++) {
@@ -515,17 +1899,27 @@ int main(int argc, char *argv[]) {
     printf("Longest game:           %d moves\n", stats.longest_game);
     printf("Total time:             %.2f seconds\n", elapsed);
     printf("Games per second:       %.1f\n", num_games / elapsed);
+#ifdef TTT_LATENCY
+    print_latency(ai1.name, latency_x);  // as X
+    print_latency(ai2.name, latency_o);  // as O
+#endif
     
     printf("\n========================================\n");
     printf("📈 ANALYSIS\n");
     printf("========================================\n\n");
     
-    if (stats.ai1_wins > stats.ai2_wins * 1.2) {
+    // Significant when the 95% interval of X's score excludes 1/2
+    // (X's first-move advantage is part of the difference)
+    double elo, margin;
+    ttt_elo_from_wdl(stats.ai1_wins, stats.draws, stats.ai2_wins, &elo, &margin);
+    printf("Elo difference (X - O): %+.0f +/- %.0f (95%%)\n", elo, margin);
+    int significance = ttt_score_significance(stats.ai1_wins, stats.draws, stats.ai2_wins);
+    if (significance > 0) {
         printf("✅ %s is significantly stronger!\n", ai1.name);
-    } else if (stats.ai2_wins > stats.ai1_wins * 1.2) {
+    } else if (significance < 0) {
         printf("✅ %s is significantly stronger!\n", ai2.name);
     } else {
-        printf("⚖️  AIs are evenly matched.\n");
+        printf("⚖️  No significant difference - play more games or use --tournament --sprt.\n");
     }
     
     if (stats.draws > num_games * 0.3) {
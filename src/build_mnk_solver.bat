@@ -0,0 +1,37 @@
+@echo off
+REM ==============================================
+REM Generalized m,n,k Solver (default 4x4, 4 in a row)
+REM Compiles and runs mnk_solver.c
+REM Usage: build_mnk_solver.bat [W H K]
+REM Output: mnk_WxH_K.outcomes (2-bit packed outcome table)
+REM ==============================================
+
+set W=%1
+set H=%2
+set K=%3
+if "%W%"=="" set W=4
+if "%H%"=="" set H=4
+if "%K%"=="" set K=4
+
+echo [1/3] Checking for GCC...
+where gcc >nul 2>nul
+if errorlevel 1 (
+    echo Error: GCC compiler not found.
+    echo Please install MinGW or MSYS2 and ensure gcc.exe is in your PATH.
+    pause
+    exit /b
+)
+
+echo [2/3] Compiling solver for %W%x%H%, %K% in a row...
+gcc -O2 -std=c17 -DMNK_W=%W% -DMNK_H=%H% -DMNK_K=%K% mnk_solver.c ttt_thread.c -pthread -lpsapi -o mnk_solver
+if errorlevel 1 (
+    echo Compilation failed. Please check your C code for errors.
+    pause
+    exit /b
+)
+
+echo [3/3] Solving...
+mnk_solver --out mnk_%W%x%H%_%K%.outcomes
+
+echo Done.
+pause
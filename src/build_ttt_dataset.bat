@@ -15,7 +15,7 @@ if errorlevel 1 (
 )
 
 echo [2/3] Compiling program...
-gcc -O2 -std=c17 ttt_minimax_dataset.c -o ttt_stategen
+gcc -O2 -std=c17 ttt_minimax_dataset.c ttt_movetable.c ttt_sink.c ttt_dataset_bin.c ttt_mmap.c ttt_index.c ttt_symmetry.c ttt_board.c ttt_thread.c -pthread -o ttt_stategen
 if errorlevel 1 (
     echo Compilation failed. Please check your C code for errors.
     pause
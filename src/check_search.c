@@ -0,0 +1,71 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "ttt_board.h"
+#include "ttt_index.h"
+#include "ttt_movetable.h"
+#include "ttt_search.h"
+
+// ============================================
+// Alpha-Beta Search Check
+// ============================================
+//
+// Searches every legal position with one shared transposition table,
+// as the arena does within a game, and compares the result with the
+// move table's exact solution: the score must be the position's value
+// and distance to the end, and the move must keep both. Sharing the
+// table is the point: entries stored by earlier searches must never
+// make a later one stop early with a slower win.
+//
+//   gcc -O2 check_search.c ttt_search.c ttt_tt.c ttt_zobrist.c ttt_symmetry.c ttt_movetable.c ttt_index.c ttt_board.c -o check_search
+//   check_search            (exit status 0 = all positions agree)
+
+#define CHECK_TT_LOG2 12  // as the arena's player
+
+// The search score of a move-table entry (same perspective)
+static int expected_score(uint8_t entry) {
+    int plies = ttt_mt_entry_plies(entry);
+    switch (ttt_mt_entry_value(entry)) {
+        case TTT_MV_WIN:  return TTT_SEARCH_WIN - plies;
+        case TTT_MV_LOSS: return -(TTT_SEARCH_WIN - plies);
+        default:          return 0;
+    }
+}
+
+int main(void) {
+    ttt_index_init();
+    MoveTable mt;
+    if (!ttt_mt_build(&mt)) {
+        fprintf(stderr, "Error: Memory allocation failed for move table\n");
+        return 1;
+    }
+    TTTSearch s;
+    if (!ttt_search_init(&s, CHECK_TT_LOG2)) {
+        fprintf(stderr, "Error: Memory allocation failed for search table\n");
+        ttt_mt_free(&mt);
+        return 1;
+    }
+
+    int checked = 0, wrong = 0;
+    for (int idx = 0; idx < TTT_NUM_POSITIONS; idx++) {
+        Bitboard b = ttt_index_board(idx);
+        if (bb_status(b) != TTT_ONGOING) continue;
+        checked++;
+
+        TTTSearchResult r;
+        ttt_search_best(&s, b, 0, 0, &r);
+        uint8_t want = ttt_mt_position_entry(&mt, idx);
+        if (r.score != expected_score(want) || r.move < 0 ||
+            ttt_mt_move_entry(&mt, idx, r.move) != want) {
+            if (wrong < 10) {
+                printf("Position %d: move %d score %d (depth %d), expected score %d\n",
+                       idx, r.move, r.score, r.depth, expected_score(want));
+            }
+            wrong++;
+        }
+    }
+
+    printf("%d positions searched with a shared table, %d wrong\n", checked, wrong);
+    ttt_search_free(&s);
+    ttt_mt_free(&mt);
+    return wrong ? 1 : 0;
+}
@@ -0,0 +1,145 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "ttt_board.h"
+#include "ttt_index.h"
+#include "ttt_movetable.h"
+
+// ============================================
+// Perfect-Play Table Generator
+// ============================================
+//
+// Solves every position with the move table and writes the results as
+// const arrays: ttt_perfect_table.c defines them once, and
+// ttt_perfect_table.h declares them (extern) for every program that
+// links the .c file, so a program can play perfectly with a table
+// lookup and no solver or file at runtime.
+//
+// The output depends only on the game, never on the time, machine or
+// run: rebuilding produces byte-identical files.
+//
+//   gcc -O2 gen_perfect_table.c ttt_movetable.c ttt_index.c ttt_board.c -o gen_perfect_table
+//   gen_perfect_table [ttt_perfect_table.h [ttt_perfect_table.c]]
+
+#define DEFAULT_HEADER "ttt_perfect_table.h"
+#define DEFAULT_SOURCE "ttt_perfect_table.c"
+#define VALUES_PER_LINE 16
+
+// Writes n integers as a brace-enclosed initializer body
+static void write_values(FILE *fp, const int *values, int n) {
+    for (int i = 0; i < n; i++) {
+        if (i % VALUES_PER_LINE == 0) fputs("    ", fp);
+        fprintf(fp, "%d,", values[i]);
+        putc((i % VALUES_PER_LINE == VALUES_PER_LINE - 1 || i == n - 1) ? '\n' : ' ', fp);
+    }
+}
+
+static int finish(FILE *fp) {
+    int ok = !ferror(fp);
+    if (fclose(fp) != 0) ok = 0;
+    return ok;
+}
+
+static int write_header(const char *filename) {
+    FILE *fp = fopen(filename, "w");
+    if (!fp) return 0;
+
+    fputs("// Generated by gen_perfect_table.c -- do not edit.\n"
+          "// Perfect-play tables for every legal tic-tac-toe position,\n"
+          "// defined in ttt_perfect_table.c.\n"
+          "#ifndef TTT_PERFECT_TABLE_H\n"
+          "#define TTT_PERFECT_TABLE_H\n"
+          "\n"
+          "#include <stdint.h>\n"
+          "#include \"ttt_board.h\"\n"
+          "\n", fp);
+    fprintf(fp, "#define TTT_PERFECT_POSITIONS %d\n"
+                "#define TTT_PERFECT_NONE 0xFFFF\n\n", TTT_NUM_POSITIONS);
+    fprintf(fp, "// Dense index of each base-3 code; TTT_PERFECT_NONE if unreachable\n"
+                "extern const uint16_t ttt_perfect_index[%d];\n\n", TTT_NUM_CODES);
+    fprintf(fp, "// Outcome for the side to move under perfect play: -1 / 0 / +1\n"
+                "extern const int8_t ttt_perfect_outcome[%d];\n\n", TTT_NUM_POSITIONS);
+    fprintf(fp, "// Best move (fastest win, slowest loss, lowest cell); -1 once the game is over\n"
+                "extern const int8_t ttt_perfect_best[%d];\n\n", TTT_NUM_POSITIONS);
+    fprintf(fp, "// Value (bits 0-1) and plies to the end (bits 2-5) of each move,\n"
+                "// as in ttt_movetable.h; 0 for illegal moves\n"
+                "extern const uint8_t ttt_perfect_moves[%d][%d];\n\n", TTT_NUM_POSITIONS, TTT_CELLS);
+
+    fputs("// Dense index of a board, or -1 if it is unreachable\n"
+          "static inline int ttt_perfect_index_of(Bitboard b) {\n"
+          "    uint16_t idx = ttt_perfect_index[bb_to_code(b)];\n"
+          "    return idx == TTT_PERFECT_NONE ? -1 : idx;\n"
+          "}\n"
+          "\n"
+          "// Perfect move for the side to move in b; -1 if there is none\n"
+          "static inline int ttt_perfect_move(Bitboard b) {\n"
+          "    int idx = ttt_perfect_index_of(b);\n"
+          "    return idx < 0 ? -1 : ttt_perfect_best[idx];\n"
+          "}\n"
+          "\n"
+          "#endif\n", fp);
+    return finish(fp);
+}
+
+static int write_source(const MoveTable *mt, const char *filename) {
+    FILE *fp = fopen(filename, "w");
+    if (!fp) return 0;
+
+    static int values[TTT_NUM_CODES];
+
+    fputs("// Generated by gen_perfect_table.c -- do not edit.\n"
+          "#include \"ttt_perfect_table.h\"\n"
+          "\n", fp);
+
+    // Code -> dense index, so lookups need no ttt_index_init()
+    for (int code = 0; code < TTT_NUM_CODES; code++) {
+        int idx = ttt_index_of_code(code);
+        values[code] = idx < 0 ? 0xFFFF : idx;
+    }
+    fprintf(fp, "const uint16_t ttt_perfect_index[%d] = {\n", TTT_NUM_CODES);
+    write_values(fp, values, TTT_NUM_CODES);
+    fputs("};\n\n", fp);
+
+    for (int idx = 0; idx < TTT_NUM_POSITIONS; idx++) {
+        values[idx] = ttt_mt_score(ttt_mt_entry_value(ttt_mt_position_entry(mt, idx)));
+    }
+    fprintf(fp, "const int8_t ttt_perfect_outcome[%d] = {\n", TTT_NUM_POSITIONS);
+    write_values(fp, values, TTT_NUM_POSITIONS);
+    fputs("};\n\n", fp);
+
+    for (int idx = 0; idx < TTT_NUM_POSITIONS; idx++) {
+        values[idx] = ttt_mt_best_move(mt, ttt_index_board(idx));
+    }
+    fprintf(fp, "const int8_t ttt_perfect_best[%d] = {\n", TTT_NUM_POSITIONS);
+    write_values(fp, values, TTT_NUM_POSITIONS);
+    fputs("};\n\n", fp);
+
+    fprintf(fp, "const uint8_t ttt_perfect_moves[%d][%d] = {\n", TTT_NUM_POSITIONS, TTT_CELLS);
+    for (int idx = 0; idx < TTT_NUM_POSITIONS; idx++) {
+        fputs("    {", fp);
+        for (int i = 0; i < TTT_CELLS; i++) {
+            fprintf(fp, "%d%s", ttt_mt_move_entry(mt, idx, i), i < TTT_CELLS - 1 ? ", " : "},\n");
+        }
+    }
+    fputs("};\n", fp);
+    return finish(fp);
+}
+
+int main(int argc, char *argv[]) {
+    const char *header = argc > 1 ? argv[1] : DEFAULT_HEADER;
+    const char *source = argc > 2 ? argv[2] : DEFAULT_SOURCE;
+
+    MoveTable mt;
+    if (!ttt_mt_build(&mt)) {
+        fprintf(stderr, "Error: Memory allocation failed for move table\n");
+        return 1;
+    }
+    const char *failed = !write_header(header) ? header : !write_source(&mt, source) ? source : NULL;
+    ttt_mt_free(&mt);
+    if (failed) {
+        fprintf(stderr, "Error: Could not write %s\n", failed);
+        return 1;
+    }
+
+    printf("Wrote %s and %s (%d positions)\n", header, source, TTT_NUM_POSITIONS);
+    return 0;
+}
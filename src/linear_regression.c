@@ -2,7 +2,7 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
-#include <time.h>
+#include "ttt_rng.h"
 
 #define MAX_INSTANCES 1000
 #define NUM_FEATURES 10  // 9 board positions + 1 bias term
@@ -12,6 +12,7 @@
 typedef struct {
     double features[NUM_FEATURES];  // features[0] = bias (1.0), features[1-9] = board state
     double label;  // 1.0 for win, -1.0 for lose, 0.0 for draw
+    double weight; // multiplicity (symmetry-canonical datasets), else 1.0
 } Instance;
 
 // Model structure
@@ -66,10 +67,21 @@ int load_data(const char *filename, Instance *data) {
         if (last_comma) {
             *last_comma = '\0';
             char *label_str = last_comma + 1;
+            double weight = 1.0;
+            
+            // Canonical datasets append a numeric weight after the label
+            if (label_str[0] >= '0' && label_str[0] <= '9') {
+                weight = atof(label_str);
+                last_comma = strrchr(line, ',');
+                if (!last_comma) continue;
+                *last_comma = '\0';
+                label_str = last_comma + 1;
+            }
             
             // Encode features and label
             encode_features(line, data[count].features);
             data[count].label = encode_label(label_str);
+            data[count].weight = weight;
             count++;
         }
     }
@@ -87,37 +99,45 @@ double predict(const LinearModel *model, const double *features) {
     return result;
 }
 
+// Seeded in main (--seed N repeats a run)
+static TTTRng g_rng;
+
 // Train using gradient descent
 void train_model(LinearModel *model, Instance *train_data, int train_size, 
                  int epochs, double learning_rate) {
     // Initialize weights to small random values
-    srand(time(NULL));
     for (int i = 0; i < NUM_FEATURES; i++) {
-        model->weights[i] = ((double)rand() / RAND_MAX - 0.5) * 0.1;
+        model->weights[i] = (ttt_rng_double(&g_rng) - 0.5) * 0.1;
     }
     
     printf("Training linear regression model...\n");
     printf("Epochs: %d, Learning rate: %.4f\n\n", epochs, learning_rate);
     
+    double total_weight = 0.0;
+    for (int i = 0; i < train_size; i++) {
+        total_weight += train_data[i].weight;
+    }
+    
     for (int epoch = 0; epoch < epochs; epoch++) {
         double total_loss = 0.0;
         
-        // Stochastic gradient descent
+        // Stochastic gradient descent (each instance counts `weight` times)
         for (int i = 0; i < train_size; i++) {
             // Forward pass
             double prediction = predict(model, train_data[i].features);
             double error = train_data[i].label - prediction;
+            double step = learning_rate * train_data[i].weight * error;
             
             // Backward pass (update weights)
             for (int j = 0; j < NUM_FEATURES; j++) {
-                model->weights[j] += learning_rate * error * train_data[i].features[j];
+                model->weights[j] += step * train_data[i].features[j];
             }
             
-            // Accumulate loss (MSE)
-            total_loss += error * error;
+            // Accumulate loss (weighted MSE)
+            total_loss += train_data[i].weight * error * error;
         }
         
-        double mse = total_loss / train_size;
+        double mse = total_loss / total_weight;
         
         // Print progress every 100 epochs
         if ((epoch + 1) % 100 == 0 || epoch == 0) {
@@ -237,7 +257,11 @@ void save_model_binary(const char *filename, const LinearModel *model) {
     printf("Model saved to %s (binary format)\n", filename);
 }
 
-int main() {
+int main(int argc, char *argv[]) {
+    uint64_t seed = ttt_rng_take_seed(&argc, argv);
+    ttt_rng_seed(&g_rng, seed);
+    printf("Random seed: %llu\n\n", (unsigned long long)seed);
+    
     Instance train_data[MAX_INSTANCES];
     Instance test_data[MAX_INSTANCES];
     
@@ -2,7 +2,8 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
-#include <time.h>
+#include "ttt_dataset_bin.h"
+#include "ttt_rng.h"
 
 #define MAX_INSTANCES 5000
 #define NUM_FEATURES 10  // 9 board positions + 1 bias term
@@ -12,6 +13,7 @@
 typedef struct {
     double features[NUM_FEATURES];  // features[0] = bias (1.0), features[1-9] = board state
     double label;  // 1.0 for win, -1.0 for lose, 0.0 for draw
+    double weight; // multiplicity (symmetry-canonical datasets), else 1.0
 } Instance;
 
 // Model structure
@@ -91,19 +93,21 @@ int load_data_csv(const char *filename, Instance *data) {
         // Skip empty lines
         if (strlen(line) == 0) continue;
         
-        // Parse CSV: x1,x2,x3,x4,x5,x6,x7,x8,x9,y
+        // Parse CSV: x1,x2,x3,x4,x5,x6,x7,x8,x9,y[,w]
         int positions[9];
         double label;
+        double weight = 1.0;
         
-        int parsed = sscanf(line, "%d,%d,%d,%d,%d,%d,%d,%d,%d,%lf",
+        int parsed = sscanf(line, "%d,%d,%d,%d,%d,%d,%d,%d,%d,%lf,%lf",
                            &positions[0], &positions[1], &positions[2],
                            &positions[3], &positions[4], &positions[5],
                            &positions[6], &positions[7], &positions[8],
-                           &label);
+                           &label, &weight);
         
-        if (parsed == 10) {
+        if (parsed >= 10) {
             encode_features_from_numbers(positions, data[count].features);
             data[count].label = label;
+            data[count].weight = weight;
             count++;
         }
     }
@@ -131,10 +135,21 @@ int load_data_text(const char *filename, Instance *data) {
         if (last_comma) {
             *last_comma = '\0';
             char *label_str = last_comma + 1;
+            double weight = 1.0;
+            
+            // Canonical datasets append a numeric weight after the label
+            if (label_str[0] >= '0' && label_str[0] <= '9') {
+                weight = atof(label_str);
+                last_comma = strrchr(line, ',');
+                if (!last_comma) continue;
+                *last_comma = '\0';
+                label_str = last_comma + 1;
+            }
             
             // Encode features and label
             encode_features_from_text(line, data[count].features);
             data[count].label = encode_label_from_text(label_str);
+            data[count].weight = weight;
             count++;
         }
     }
@@ -143,12 +158,41 @@ int load_data_text(const char *filename, Instance *data) {
     return count;
 }
 
+// Load data from binary dataset (.ttds, see ttt_dataset_bin.h)
+int load_data_binary(const char *filename, Instance *data) {
+    TTDSFile file;
+    if (!ttt_ds_open(&file, filename)) {
+        return 0;
+    }
+    
+    int count = 0;
+    for (uint32_t r = 0; r < file.count && count < MAX_INSTANCES; r++) {
+        TTDSRecord rec = file.records[r];
+        Bitboard board = ttt_ds_board(rec);
+        double *features = data[count].features;
+        
+        features[0] = 1.0;  // Bias term
+        for (int i = 0; i < 9; i++) {
+            features[i + 1] = (board.x >> i) & 1 ? 1.0 : ((board.o >> i) & 1 ? -1.0 : 0.0);
+        }
+        data[count].label = ttt_ds_x_outcome(rec);
+        data[count].weight = ttt_ds_weight(&file, rec);
+        count++;
+    }
+    
+    ttt_ds_close(&file);
+    return count;
+}
+
 // NEW: Auto-detect format and load data
 int load_data(const char *filename, Instance *data) {
     // Check file extension
     const char *ext = strrchr(filename, '.');
     
-    if (ext && strcmp(ext, ".csv") == 0) {
+    if (ttt_ds_is_binary(filename)) {
+        printf("Detected binary format, loading...\n");
+        return load_data_binary(filename, data);
+    } else if (ext && strcmp(ext, ".csv") == 0) {
         printf("Detected CSV format, loading...\n");
         return load_data_csv(filename, data);
     } else {
@@ -169,36 +213,44 @@ double predict(const LinearModel *model, const double *features) {
     return result;
 }
 
+// Seeded in main (--seed N repeats a run)
+static TTTRng g_rng;
+
 void train_model(LinearModel *model, Instance *train_data, int train_size, 
                  int epochs, double learning_rate) {
     // Initialize weights to small random values
-    srand(time(NULL));
     for (int i = 0; i < NUM_FEATURES; i++) {
-        model->weights[i] = ((double)rand() / RAND_MAX - 0.5) * 0.1;
+        model->weights[i] = (ttt_rng_double(&g_rng) - 0.5) * 0.1;
     }
     
     printf("Training linear regression model...\n");
     printf("Epochs: %d, Learning rate: %.4f\n\n", epochs, learning_rate);
     
+    double total_weight = 0.0;
+    for (int i = 0; i < train_size; i++) {
+        total_weight += train_data[i].weight;
+    }
+    
     for (int epoch = 0; epoch < epochs; epoch++) {
         double total_loss = 0.0;
         
-        // Stochastic gradient descent
+        // Stochastic gradient descent (each instance counts `weight` times)
         for (int i = 0; i < train_size; i++) {
             // Forward pass
             double prediction = predict(model, train_data[i].features);
             double error = train_data[i].label - prediction;
+            double step = learning_rate * train_data[i].weight * error;
             
             // Backward pass (update weights)
             for (int j = 0; j < NUM_FEATURES; j++) {
-                model->weights[j] += learning_rate * error * train_data[i].features[j];
+                model->weights[j] += step * train_data[i].features[j];
             }
             
-            // Accumulate loss (MSE)
-            total_loss += error * error;
+            // Accumulate loss (weighted MSE)
+            total_loss += train_data[i].weight * error * error;
         }
         
-        double mse = total_loss / train_size;
+        double mse = total_loss / total_weight;
         
         // Print progress every 100 epochs
         if ((epoch + 1) % 100 == 0 || epoch == 0) {
@@ -320,6 +372,9 @@ void save_model_binary(const char *filename, const LinearModel *model) {
 // ============================================
 
 int main(int argc, char *argv[]) {
+    uint64_t seed = ttt_rng_take_seed(&argc, argv);
+    ttt_rng_seed(&g_rng, seed);
+    
     Instance train_data[MAX_INSTANCES];
     Instance test_data[MAX_INSTANCES];
     
@@ -331,6 +386,7 @@ int main(int argc, char *argv[]) {
     printf("========================================\n");
     printf("LINEAR REGRESSION - CSV/TEXT COMPATIBLE\n");
     printf("========================================\n\n");
+    printf("Random seed: %llu\n\n", (unsigned long long)seed);
     
     printf("Loading training data from: %s\n", train_file);
     int train_size = load_data(train_file, train_data);
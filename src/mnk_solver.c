@@ -0,0 +1,339 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <time.h>
+#include "ttt_thread.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#include <psapi.h>
+#else
+#include <sys/resource.h>
+#endif
+
+// ============================================
+// Generalized m,n,k Solver
+// ============================================
+//
+// Strong solution of the W x H game where K in a row wins, by the same
+// layer-by-layer retrograde scheme as ttt_stategen --engine retro. The
+// dimensions are compile-time constants so every loop bound folds:
+//
+//   gcc -O2 -std=c17 -DMNK_W=4 -DMNK_H=4 -DMNK_K=4 mnk_solver.c ttt_thread.c -pthread
+//
+// (add -lpsapi on Windows for the peak memory report)
+//
+// Outcomes are stored 2 bits per base-3 code (3^16 codes = 10.8 MB).
+
+#ifndef MNK_W
+#define MNK_W 4
+#endif
+#ifndef MNK_H
+#define MNK_H 4
+#endif
+#ifndef MNK_K
+#define MNK_K (MNK_W < MNK_H ? MNK_W : MNK_H)
+#endif
+
+#define MNK_CELLS (MNK_W * MNK_H)
+#define MNK_MASKS (1u << MNK_CELLS)
+
+#if MNK_CELLS > 20 || (MNK_K > MNK_W && MNK_K > MNK_H)
+#error "unsupported board: need W*H <= 20 and K <= max(W, H)"
+#endif
+
+// 2-bit outcome from the side to move's perspective
+#define MNK_UNKNOWN 0  // not solved (or count-illegal)
+#define MNK_LOSS    1
+#define MNK_DRAW    2
+#define MNK_WIN     3
+
+#define MNK_FILE_MAGIC "MNK1"
+
+typedef uint32_t mnk_mask;
+
+static uint64_t pow3[MNK_CELLS + 1];
+static uint64_t bin_to_ter[MNK_MASKS];   // binary cell mask -> base-3 code with digit 1
+static uint8_t has_line[MNK_MASKS];      // mask contains K in a row
+static mnk_mask lines[2 * MNK_CELLS * 2];
+static int num_lines;
+
+static uint64_t *outcomes;               // 32 positions per word
+static size_t outcome_words;
+
+// ============================================
+// Tables
+// ============================================
+
+static void add_lines(int dx, int dy) {
+    for (int y = 0; y < MNK_H; y++) {
+        for (int x = 0; x < MNK_W; x++) {
+            int ex = x + dx * (MNK_K - 1), ey = y + dy * (MNK_K - 1);
+            if (ex < 0 || ex >= MNK_W || ey >= MNK_H) continue;
+            mnk_mask m = 0;
+            for (int i = 0; i < MNK_K; i++) {
+                m |= (mnk_mask)1 << ((y + dy * i) * MNK_W + (x + dx * i));
+            }
+            lines[num_lines++] = m;
+        }
+    }
+}
+
+static void init_tables(void) {
+    pow3[0] = 1;
+    for (int i = 1; i <= MNK_CELLS; i++) pow3[i] = pow3[i - 1] * 3;
+
+    add_lines(1, 0);   // rows
+    add_lines(0, 1);   // columns
+    add_lines(1, 1);   // diagonals
+    add_lines(-1, 1);  // anti-diagonals
+
+    for (uint32_t m = 0; m < MNK_MASKS; m++) {
+        uint64_t code = 0;
+        for (int i = 0; i < MNK_CELLS; i++) {
+            if (m & (1u << i)) code += pow3[i];
+        }
+        bin_to_ter[m] = code;
+
+        has_line[m] = 0;
+        for (int l = 0; l < num_lines; l++) {
+            if ((m & lines[l]) == lines[l]) {
+                has_line[m] = 1;
+                break;
+            }
+        }
+    }
+
+    outcome_words = (size_t)((pow3[MNK_CELLS] + 31) / 32);
+    outcomes = (uint64_t *)calloc(outcome_words, sizeof(uint64_t));
+    if (outcomes == NULL) {
+        fprintf(stderr, "Error: Memory allocation failed for outcome table (%zu bytes)\n",
+                outcome_words * sizeof(uint64_t));
+        exit(1);
+    }
+}
+
+static inline int popcount32(mnk_mask m) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcount(m);
+#else
+    int c = 0;
+    for (; m; m &= m - 1) c++;
+    return c;
+#endif
+}
+
+static inline int ctz32(mnk_mask m) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(m);
+#else
+    int i = 0;
+    while (!(m & 1u)) { m >>= 1; i++; }
+    return i;
+#endif
+}
+
+// ============================================
+// 2-bit Packed Outcome Table
+// ============================================
+// Each entry is written exactly once, but neighbouring entries in the
+// same word belong to other threads' positions, so writes are atomic ORs.
+
+static inline int get_outcome(uint64_t code) {
+#if defined(__GNUC__) || defined(__clang__)
+    uint64_t w = __atomic_load_n(&outcomes[code >> 5], __ATOMIC_RELAXED);
+#else
+    uint64_t w = outcomes[code >> 5];
+#endif
+    return (int)((w >> ((code & 31) * 2)) & 3);
+}
+
+static inline void set_outcome(uint64_t code, int v) {
+    uint64_t bits = (uint64_t)v << ((code & 31) * 2);
+#if defined(__GNUC__) || defined(__clang__)
+    __atomic_fetch_or(&outcomes[code >> 5], bits, __ATOMIC_RELAXED);
+#else
+    outcomes[code >> 5] |= bits;
+#endif
+}
+
+// ============================================
+// Retrograde Solve
+// ============================================
+
+typedef struct {
+    int layer;                  // pieces on the board
+    uint64_t count[4];          // positions per outcome, summed over threads
+} LayerJob;
+
+// Value of the position with X stones on xm and O stones on om,
+// X to move when both counts are equal
+static inline int solve_position(mnk_mask xm, mnk_mask om, int x_to_move) {
+    mnk_mask mover = x_to_move ? xm : om;
+    mnk_mask last = x_to_move ? om : xm;
+    if (has_line[last]) return MNK_LOSS;
+    if (has_line[mover]) return MNK_WIN;    // unreachable, kept consistent
+    mnk_mask empty = (mnk_mask)(MNK_MASKS - 1) & ~(xm | om);
+    if (empty == 0) return MNK_DRAW;
+
+    uint64_t code = bin_to_ter[xm] + 2 * bin_to_ter[om];
+    uint64_t digit = x_to_move ? 1 : 2;
+    int best = MNK_LOSS;
+    for (mnk_mask m = empty; m; m &= m - 1) {
+        int v = 4 - get_outcome(code + digit * pow3[ctz32(m)]);  // negate
+        if (v > best) {
+            best = v;
+            if (best == MNK_WIN) break;
+        }
+    }
+    return best;
+}
+
+// All positions whose occupied-cell mask lies in [begin, end)
+static void solve_layer_range(size_t begin, size_t end, void *ctx) {
+    LayerJob *job = (LayerJob *)ctx;
+    int layer = job->layer;
+    int nx = (layer + 1) / 2;
+    int x_to_move = (layer % 2 == 0);
+    uint64_t count[4] = {0, 0, 0, 0};
+
+    for (size_t occ_i = begin; occ_i < end; occ_i++) {
+        mnk_mask occ = (mnk_mask)occ_i;
+        if (popcount32(occ) != layer) continue;
+
+        // Every subset of occ with nx stones is X's, the rest O's
+        mnk_mask xm = 0;
+        do {
+            if (popcount32(xm) == nx) {
+                mnk_mask om = occ & ~xm;
+                int v = solve_position(xm, om, x_to_move);
+                set_outcome(bin_to_ter[xm] + 2 * bin_to_ter[om], v);
+                count[v]++;
+            }
+            xm = (xm - occ) & occ;
+        } while (xm != 0);
+    }
+
+    for (int v = 0; v < 4; v++) {
+#if defined(__GNUC__) || defined(__clang__)
+        __atomic_fetch_add(&job->count[v], count[v], __ATOMIC_RELAXED);
+#else
+        job->count[v] += count[v];
+#endif
+    }
+}
+
+// ============================================
+// Timing / Memory
+// ============================================
+
+static double wall_seconds(void) {
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static double peak_rss_mb(void) {
+#ifdef _WIN32
+    PROCESS_MEMORY_COUNTERS pmc;
+    if (!GetProcessMemoryInfo(GetCurrentProcess(), &pmc, sizeof(pmc))) return 0.0;
+    return pmc.PeakWorkingSetSize / (1024.0 * 1024.0);
+#else
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+#ifdef __APPLE__
+    return ru.ru_maxrss / (1024.0 * 1024.0);   // bytes
+#else
+    return ru.ru_maxrss / 1024.0;              // kilobytes
+#endif
+#endif
+}
+
+// ============================================
+// Output
+// ============================================
+
+// Header + packed table; code c is bits 2*(c%32) of word c/32
+static int save_outcomes(const char *filename) {
+    FILE *fp = fopen(filename, "wb");
+    if (!fp) {
+        fprintf(stderr, "Error: cannot open output file '%s'\n", filename);
+        return 0;
+    }
+    uint8_t dims[4] = {MNK_W, MNK_H, MNK_K, 0};
+    uint64_t ncodes = pow3[MNK_CELLS];
+    fwrite(MNK_FILE_MAGIC, 1, 4, fp);
+    fwrite(dims, 1, sizeof(dims), fp);
+    fwrite(&ncodes, sizeof(ncodes), 1, fp);
+    size_t written = fwrite(outcomes, sizeof(uint64_t), outcome_words, fp);
+    fclose(fp);
+    return written == outcome_words;
+}
+
+static const char *outcome_name(int v) {
+    switch (v) {
+        case MNK_WIN:  return "first player wins";
+        case MNK_LOSS: return "second player wins";
+        case MNK_DRAW: return "draw";
+        default:       return "unknown";
+    }
+}
+
+int main(int argc, char *argv[]) {
+    int nthreads = 0;
+    const char *outname = NULL;
+
+    for (int a = 1; a < argc; a++) {
+        if (strcmp(argv[a], "--threads") == 0 && a + 1 < argc) {
+            nthreads = atoi(argv[++a]);
+        } else if (strcmp(argv[a], "--out") == 0 && a + 1 < argc) {
+            outname = argv[++a];
+        } else {
+            fprintf(stderr, "Usage: %s [--threads N] [--out file]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (nthreads <= 0) nthreads = ttt_cpu_count();
+
+    printf("========================================\n");
+    printf("  m,n,k SOLVER: %dx%d, %d in a row\n", MNK_W, MNK_H, MNK_K);
+    printf("========================================\n\n");
+
+    double start = wall_seconds();
+    init_tables();
+    printf("Lines: %d, codes: %llu, outcome table: %.1f MB, threads: %d\n\n",
+           num_lines, (unsigned long long)pow3[MNK_CELLS],
+           outcome_words * sizeof(uint64_t) / (1024.0 * 1024.0), nthreads);
+
+    printf("%5s %12s %12s %12s %12s %9s\n", "Layer", "Positions", "Win", "Draw", "Loss", "Time(s)");
+    uint64_t total = 0;
+    for (int layer = MNK_CELLS; layer >= 0; layer--) {
+        LayerJob job = {layer, {0, 0, 0, 0}};
+        double t0 = wall_seconds();
+        ttt_parallel_for(MNK_MASKS, nthreads, solve_layer_range, &job);
+        uint64_t n = job.count[MNK_WIN] + job.count[MNK_DRAW] + job.count[MNK_LOSS];
+        total += n;
+        printf("%5d %12llu %12llu %12llu %12llu %9.2f\n", layer, (unsigned long long)n,
+               (unsigned long long)job.count[MNK_WIN], (unsigned long long)job.count[MNK_DRAW],
+               (unsigned long long)job.count[MNK_LOSS], wall_seconds() - t0);
+    }
+    double elapsed = wall_seconds() - start;
+
+    printf("\n✓ Solved %llu positions\n", (unsigned long long)total);
+    printf("✓ Empty board: %s\n", outcome_name(get_outcome(0)));
+    printf("\n⏱️  Wall time: %.2f seconds\n", elapsed);
+    printf("📊 Peak RSS: %.1f MB\n", peak_rss_mb());
+
+    if (outname != NULL) {
+        if (!save_outcomes(outname)) {
+            fprintf(stderr, "Error: failed to write '%s'\n", outname);
+            free(outcomes);
+            return 1;
+        }
+        printf("💾 Outcome table saved to %s\n", outname);
+    }
+
+    free(outcomes);
+    return 0;
+}
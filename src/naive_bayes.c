@@ -1,7 +1,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <time.h>
+#include "ttt_rng.h"
 
 #define MAX_FEATURES 9
 #define MAX_STATES 10
@@ -13,6 +13,7 @@
 typedef struct {
     char features[MAX_FEATURES][MAX_FEATURE_LENGTH];
     char label[MAX_FEATURE_LENGTH];
+    double weight;  // multiplicity (symmetry-canonical datasets), else 1.0
 } Instance;
 
 typedef struct {
@@ -33,10 +34,13 @@ typedef struct {
     int label_count;
 } Model;
 
+// Seeded in main (--seed N repeats a run)
+static TTTRng g_rng;
+
 // Function to shuffle data
 void shuffle_data(Instance *data, int n) {
     for (int i = n - 1; i > 0; i--) {
-        int j = rand() % (i + 1);
+        int j = (int)ttt_rng_below(&g_rng, (uint32_t)i + 1);
         Instance temp = data[i];
         data[i] = data[j];
         data[j] = temp;
@@ -77,14 +81,16 @@ void learn(Instance *data, int data_size, Model *model) {
         model->feature_count[i] = 0;
     }
     
-    // Count occurrences
+    // Count occurrences (weighted)
+    double total_weight = 0.0;
     for (int i = 0; i < data_size; i++) {
         int label_idx = find_label_index(model, data[i].label);
-        model->label_probs[label_idx].probability += 1.0;
+        model->label_probs[label_idx].probability += data[i].weight;
+        total_weight += data[i].weight;
         
         for (int j = 0; j < MAX_FEATURES; j++) {
             int feat_idx = find_feature_prob_index(model, j, data[i].features[j], data[i].label);
-            model->feature_probs[j][feat_idx].probability += 1.0;
+            model->feature_probs[j][feat_idx].probability += data[i].weight;
         }
     }
     
@@ -103,7 +109,7 @@ void learn(Instance *data, int data_size, Model *model) {
     
     // Normalize label probabilities
     for (int i = 0; i < model->label_count; i++) {
-        model->label_probs[i].probability /= data_size;
+        model->label_probs[i].probability /= total_weight;
     }
 }
 
@@ -328,8 +334,15 @@ int load_data(const char *filename, Instance *data) {
             feature_idx++;
         }
         
+        data[count].weight = 1.0;
         if (token != NULL) {
             strcpy(data[count].label, token);
+            
+            // Canonical datasets append a numeric weight after the label
+            token = strtok(NULL, ",");
+            if (token != NULL) {
+                data[count].weight = atof(token);
+            }
         }
         
         count++;
@@ -339,8 +352,10 @@ int load_data(const char *filename, Instance *data) {
     return count;
 }
 
-int main() {
-    srand(time(NULL));
+int main(int argc, char *argv[]) {
+    uint64_t seed = ttt_rng_take_seed(&argc, argv);
+    ttt_rng_seed(&g_rng, seed);
+    printf("Random seed: %llu\n\n", (unsigned long long)seed);
     
     Instance train_data[MAX_INSTANCES];
     Instance test_data[MAX_INSTANCES];
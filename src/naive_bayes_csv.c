@@ -1,7 +1,8 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <time.h>
+#include "ttt_dataset_bin.h"
+#include "ttt_rng.h"
 
 #define MAX_FEATURES 9
 #define MAX_STATES 10
@@ -13,6 +14,7 @@
 typedef struct {
     char features[MAX_FEATURES][MAX_FEATURE_LENGTH];
     char label[MAX_FEATURE_LENGTH];
+    double weight;  // multiplicity (symmetry-canonical datasets), else 1.0
 } Instance;
 
 typedef struct {
@@ -33,10 +35,13 @@ typedef struct {
     int label_count;
 } Model;
 
+// Seeded in main (--seed N repeats a run)
+static TTTRng g_rng;
+
 // Function to shuffle data
 void shuffle_data(Instance *data, int n) {
     for (int i = n - 1; i > 0; i--) {
-        int j = rand() % (i + 1);
+        int j = (int)ttt_rng_below(&g_rng, (uint32_t)i + 1);
         Instance temp = data[i];
         data[i] = data[j];
         data[j] = temp;
@@ -77,14 +82,16 @@ void learn(Instance *data, int data_size, Model *model) {
         model->feature_count[i] = 0;
     }
     
-    // Count occurrences
+    // Count occurrences (weighted)
+    double total_weight = 0.0;
     for (int i = 0; i < data_size; i++) {
         int label_idx = find_label_index(model, data[i].label);
-        model->label_probs[label_idx].probability += 1.0;
+        model->label_probs[label_idx].probability += data[i].weight;
+        total_weight += data[i].weight;
         
         for (int j = 0; j < MAX_FEATURES; j++) {
             int feat_idx = find_feature_prob_index(model, j, data[i].features[j], data[i].label);
-            model->feature_probs[j][feat_idx].probability += 1.0;
+            model->feature_probs[j][feat_idx].probability += data[i].weight;
         }
     }
     
@@ -103,7 +110,7 @@ void learn(Instance *data, int data_size, Model *model) {
     
     // Normalize label probabilities
     for (int i = 0; i < model->label_count; i++) {
-        model->label_probs[i].probability /= data_size;
+        model->label_probs[i].probability /= total_weight;
     }
 }
 
@@ -305,8 +312,38 @@ void cross_validate(Instance *data, int data_size, double *accuracy) {
     }
 }
 
+// Load data from binary dataset (.ttds, see ttt_dataset_bin.h)
+// Features and labels use the CSV encoding: 0/1/2 cells, -1/0/1 outcome for X
+int load_data_binary(const char *filename, Instance *data) {
+    TTDSFile file;
+    if (!ttt_ds_open(&file, filename)) {
+        return 0;
+    }
+    
+    int count = 0;
+    for (uint32_t r = 0; r < file.count && count < MAX_INSTANCES; r++) {
+        TTDSRecord rec = file.records[r];
+        Bitboard board = ttt_ds_board(rec);
+        
+        for (int i = 0; i < MAX_FEATURES; i++) {
+            int cell = (board.x >> i) & 1 ? 1 : ((board.o >> i) & 1 ? 2 : 0);
+            snprintf(data[count].features[i], MAX_FEATURE_LENGTH, "%d", cell);
+        }
+        snprintf(data[count].label, MAX_FEATURE_LENGTH, "%d", ttt_ds_x_outcome(rec));
+        data[count].weight = ttt_ds_weight(&file, rec);
+        count++;
+    }
+    
+    ttt_ds_close(&file);
+    return count;
+}
+
 // Load data from file
 int load_data(const char *filename, Instance *data) {
+    if (ttt_ds_is_binary(filename)) {
+        return load_data_binary(filename, data);
+    }
+    
     FILE *file = fopen(filename, "r");
     if (!file) {
         printf("Error opening file: %s\n", filename);
@@ -328,8 +365,15 @@ int load_data(const char *filename, Instance *data) {
             feature_idx++;
         }
         
+        data[count].weight = 1.0;
         if (token != NULL) {
             strcpy(data[count].label, token);
+            
+            // Canonical datasets append a numeric weight after the label
+            token = strtok(NULL, ",");
+            if (token != NULL) {
+                data[count].weight = atof(token);
+            }
         }
         
         count++;
@@ -339,14 +383,18 @@ int load_data(const char *filename, Instance *data) {
     return count;
 }
 
-int main() {
-    srand(time(NULL));
+int main(int argc, char *argv[]) {
+    uint64_t seed = ttt_rng_take_seed(&argc, argv);
+    ttt_rng_seed(&g_rng, seed);
+    printf("Random seed: %llu\n\n", (unsigned long long)seed);
     
     Instance train_data[MAX_INSTANCES];
     Instance test_data[MAX_INSTANCES];
     
-    int train_size = load_data("train_dataset.csv", train_data);
-    int test_size = load_data("test_dataset.csv", test_data);
+    const char *train_file = (argc > 1) ? argv[1] : "train_dataset.csv";
+    const char *test_file = (argc > 2) ? argv[2] : "test_dataset.csv";
+    int train_size = load_data(train_file, train_data);
+    int test_size = load_data(test_file, test_data);
     
     if (train_size == 0) {
         printf("No training data loaded.\n");
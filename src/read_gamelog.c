@@ -0,0 +1,106 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ttt_gamelog.h"
+
+// ============================================
+// Game Log Reader
+// ============================================
+//
+// Summarizes a .ttgl game log (ai_vs_ai --log, q_learning --log) straight
+// from the mapped file, or replays single games move by move.
+//
+//   gcc -O2 read_gamelog.c ttt_gamelog.c ttt_mmap.c ttt_board.c -o read_gamelog
+//   read_gamelog games.ttgl [--replay N]
+
+static void print_board(Bitboard b) {
+    char cells[TTT_CELLS];
+    bb_to_chars(b, cells, 'X', 'O', '.');
+    for (int r = 0; r < 3; r++) printf("   %c %c %c\n", cells[r * 3], cells[r * 3 + 1], cells[r * 3 + 2]);
+}
+
+static const char *result_name(int result) {
+    switch (result) {
+    case TTT_X_WINS: return "X wins";
+    case TTT_O_WINS: return "O wins";
+    case TTT_DRAW:   return "draw";
+    }
+    return "unfinished";
+}
+
+static void replay(const TTGLFile *f, uint64_t n) {
+    const TTGLRecord *rec = &f->games[n];
+    printf("Game %llu: %s (X) vs %s (O), stream %llu, %s\n", (unsigned long long)n,
+           ttt_gl_player(f, rec->x), ttt_gl_player(f, rec->o),
+           (unsigned long long)rec->stream, result_name(ttt_gl_result(rec)));
+    for (int i = 0; i < ttt_gl_num_moves(rec); i++) {
+        printf("\nMove %d: %c plays %d\n", i + 1, (i & 1) ? 'O' : 'X', ttt_gl_move(rec, i));
+        print_board(ttt_gl_board(rec, i + 1));
+    }
+}
+
+static void summarize(const TTGLFile *f) {
+    int players = (int)f->header->num_players;
+    static uint64_t results[TTT_GL_MAX_PLAYERS][TTT_GL_MAX_PLAYERS][4];
+    static uint64_t moves[TTT_GL_MAX_PLAYERS][TTT_GL_MAX_PLAYERS];
+    uint64_t first_move[TTT_CELLS] = {0}, total_moves = 0;
+
+    for (uint64_t g = 0; g < f->count; g++) {
+        const TTGLRecord *rec = &f->games[g];
+        if (rec->x >= TTT_GL_MAX_PLAYERS || rec->o >= TTT_GL_MAX_PLAYERS) continue;
+        int n = ttt_gl_num_moves(rec);
+        results[rec->x][rec->o][ttt_gl_result(rec)]++;
+        moves[rec->x][rec->o] += n;
+        total_moves += n;
+        if (n > 0) first_move[ttt_gl_move(rec, 0)]++;
+    }
+
+    printf("Seed %llu, %llu games, %llu moves\n\n", (unsigned long long)f->header->seed,
+           (unsigned long long)f->count, (unsigned long long)total_moves);
+    printf("%-20s %-20s %10s %8s %8s %8s %9s\n",
+           "X", "O", "Games", "X wins", "O wins", "Draws", "Avg moves");
+    for (int x = 0; x < players; x++) {
+        for (int o = 0; o < players; o++) {
+            uint64_t *r = results[x][o];
+            uint64_t games = r[0] + r[1] + r[2] + r[3];
+            if (games == 0) continue;
+            printf("%-20s %-20s %10llu %7.2f%% %7.2f%% %7.2f%% %9.2f\n",
+                   ttt_gl_player(f, x), ttt_gl_player(f, o), (unsigned long long)games,
+                   100.0 * r[TTT_X_WINS] / games, 100.0 * r[TTT_O_WINS] / games,
+                   100.0 * r[TTT_DRAW] / games, (double)moves[x][o] / games);
+        }
+    }
+
+    printf("\nFirst move played:\n");
+    for (int r = 0; r < 3; r++) {
+        for (int c = 0; c < 3; c++) {
+            printf(" %6.2f%%", f->count ? 100.0 * first_move[r * 3 + c] / f->count : 0.0);
+        }
+        printf("\n");
+    }
+}
+
+int main(int argc, char *argv[]) {
+    if (argc < 2) {
+        fprintf(stderr, "Usage: %s games.ttgl [--replay N]\n", argv[0]);
+        return 1;
+    }
+
+    TTGLFile f;
+    if (!ttt_gl_open(&f, argv[1])) return 1;
+
+    if (argc >= 4 && strcmp(argv[2], "--replay") == 0) {
+        uint64_t n = strtoull(argv[3], NULL, 10);
+        if (n >= f.count) {
+            fprintf(stderr, "Error: The log has %llu games\n", (unsigned long long)f.count);
+            ttt_gl_close(&f);
+            return 1;
+        }
+        replay(&f, n);
+    } else {
+        summarize(&f);
+    }
+
+    ttt_gl_close(&f);
+    return 0;
+}
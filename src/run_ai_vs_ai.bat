@@ -4,7 +4,23 @@ echo Compiling AI vs AI Test Program
 echo ========================================
 echo.
 
-gcc ai_vs_ai_test.c -o ai_vs_ai.exe -lm -Wall
+gcc -O2 gen_perfect_table.c ttt_movetable.c ttt_index.c ttt_board.c -o gen_perfect_table.exe
+if errorlevel 1 (
+    echo.
+    echo ❌ Compilation of the table generator failed!
+    pause
+    exit /b 1
+)
+
+gen_perfect_table.exe ttt_perfect_table.h ttt_perfect_table.c
+if errorlevel 1 (
+    echo.
+    echo ❌ Generating ttt_perfect_table.h/.c failed!
+    pause
+    exit /b 1
+)
+
+gcc -O2 ai_vs_ai_test.c ttt_board.c ttt_symmetry.c ttt_thread.c ttt_rng.c ttt_batch.c ttt_exact.c ttt_latency.c ttt_rating.c ttt_gamelog.c ttt_mmap.c ttt_mcts.c ttt_search.c ttt_tt.c ttt_zobrist.c ttt_model.c ttt_policy.c ttt_perfect_table.c -pthread -o ai_vs_ai.exe -lm -Wall
 
 if errorlevel 1 (
     echo.
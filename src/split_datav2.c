@@ -1,7 +1,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-#include <time.h>
+#include "ttt_rng.h"
 
 #define TOTAL_SAMPLES 958
 #define FEATURES 9
@@ -20,12 +20,13 @@ typedef struct {
     int size;
 } Dataset;
 
+// Seeded in main (--seed N repeats a run)
+static TTTRng g_rng;
+
 // Function to shuffle the dataset using Fisher-Yates algorithm
 void shuffleDataset(Dataset *dataset) {
-    srand(time(NULL));
-    
     for (int i = dataset->size - 1; i > 0; i--) {
-        int j = rand() % (i + 1);
+        int j = (int)ttt_rng_below(&g_rng, (uint32_t)i + 1);
         
         // Swap dataset->data[i] and dataset->data[j]
         Sample temp = dataset->data[i];
@@ -261,13 +262,17 @@ void freeDataset(Dataset *dataset) {
     }
 }
 
-int main() {
+int main(int argc, char *argv[]) {
+    uint64_t seed = ttt_rng_take_seed(&argc, argv);
+    ttt_rng_seed(&g_rng, seed);
+    
     Dataset fullDataset, trainSet, testSet;
     
     // a) Read the dataset file
     printf("========================================\n");
     printf("TIC-TAC-TOE DATASET PROCESSOR (3-CLASS)\n");
     printf("========================================\n\n");
+    printf("Random seed: %llu\n\n", (unsigned long long)seed);
     
     printf("Reading dataset from tic-tac-toe-3class.data...\n");
     if (!readDataset("tic-tac-toe-3class.data", &fullDataset)) {
@@ -6,7 +6,7 @@ echo.
 
 REM Compile the CSV-compatible version
 echo Compiling CSV-compatible linear regression...
-gcc linear_regression_csv.c -o linear_regression_csv.exe -lm -Wall
+gcc linear_regression_csv.c ttt_rng.c ttt_dataset_bin.c ttt_mmap.c ttt_board.c ttt_symmetry.c -o linear_regression_csv.exe -lm -Wall
 
 if errorlevel 1 (
     echo.
@@ -0,0 +1,356 @@
+#include <stdlib.h>
+#include <string.h>
+#include "ttt_batch.h"
+#include "ttt_board.h"
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#define TTT_BATCH_X86 1
+#include <immintrin.h>
+#endif
+
+#define LANES 16  // 16-bit boards per 256-bit vector
+
+typedef struct {
+    uint16_t x[TTT_BATCH_SIZE];
+    uint16_t o[TTT_BATCH_SIZE];
+    uint16_t active[TTT_BATCH_SIZE];  // 0xFFFF while the game runs, else 0
+    uint16_t plies[TTT_BATCH_SIZE];
+    uint16_t result[TTT_BATCH_SIZE];  // TTT_X_WINS / TTT_O_WINS / TTT_DRAW
+    uint32_t rng[4][8];               // xoshiro128** state of 8 32-bit lanes
+    int8_t moves[TTT_BATCH_SIZE];     // TTT_BATCH_POLICY moves of the current ply
+} Batch;
+
+// 2^16 mod n for n empty cells. A 16-bit draw r picks cell (r * n) >> 16;
+// draws whose low half (r * n) & 0xFFFF falls below this are redrawn so
+// every cell is exactly equally likely (Lemire's method).
+static const uint8_t reject_below[16] = {0, 0, 0, 1, 0, 1, 4, 2, 0, 7};
+
+static int g_simd_allowed = 1;
+
+static int simd_supported(void) {
+#ifdef TTT_BATCH_X86
+    return __builtin_cpu_supports("avx2");
+#else
+    return 0;
+#endif
+}
+
+int ttt_batch_set_simd(int enabled) {
+    g_simd_allowed = enabled;
+    return enabled && simd_supported();
+}
+
+// ============================================
+// Scalar Kernels (reference and fallback)
+// ============================================
+
+static inline uint32_t rotl32(uint32_t x, int k) {
+    return (x << k) | (x >> (32 - k));
+}
+
+// One xoshiro128** step of all 8 lanes, split into 16 16-bit values
+// (lane j gives values 2j and 2j+1, matching the vector register layout)
+static void next_random16(uint32_t s[4][8], uint16_t out[LANES]) {
+    for (int j = 0; j < 8; j++) {
+        uint32_t r = rotl32(s[1][j] * 5, 7) * 9;
+        uint32_t t = s[1][j] << 9;
+        s[2][j] ^= s[0][j];
+        s[3][j] ^= s[1][j];
+        s[1][j] ^= s[2][j];
+        s[0][j] ^= s[3][j];
+        s[2][j] ^= t;
+        s[3][j] = rotl32(s[3][j], 11);
+        out[2 * j] = (uint16_t)r;
+        out[2 * j + 1] = (uint16_t)(r >> 16);
+    }
+}
+
+static inline uint16_t winning_cells(uint16_t own, uint16_t empty) {
+    uint16_t cells = 0;
+    for (int i = 0; i < TTT_NUM_LINES; i++) {
+        uint16_t gap = ttt_win_masks[i] & ~own;
+        if ((gap & (gap - 1)) == 0 && (gap & empty)) cells |= gap;
+    }
+    return cells;
+}
+
+// Game i's mover (stones in own[]) plays the cell mask move; the game
+// ends on a line or a full board
+static inline void play_lane(Batch *b, uint16_t *own, int i, int ply, uint16_t move) {
+    own[i] |= move;
+    b->plies[i] = (uint16_t)(ply + 1);
+    if (bb_has_line(own[i])) {
+        b->result[i] = (uint16_t)((ply & 1) ? TTT_O_WINS : TTT_X_WINS);
+        b->active[i] = 0;
+    } else if (ply == TTT_CELLS - 1) {
+        b->result[i] = TTT_DRAW;
+        b->active[i] = 0;
+    }
+}
+
+static void step_block_scalar(Batch *b, int base, int ply, int policy) {
+    uint16_t *active = b->active + base;
+    int any_active = 0;
+    for (int l = 0; l < LANES; l++) any_active |= active[l];
+    if (!any_active) return;
+
+    uint16_t *own = (ply & 1 ? b->o : b->x) + base;
+    uint16_t *opp = (ply & 1 ? b->x : b->o) + base;
+    uint16_t empty[LANES], count[LANES], r[LANES];
+    for (int l = 0; l < LANES; l++) {
+        empty[l] = (uint16_t)(~(own[l] | opp[l]) & TTT_FULL_MASK);
+        count[l] = (uint16_t)bb_popcount(empty[l]);
+    }
+
+    next_random16(b->rng, r);
+    for (;;) {
+        int redraw[LANES], any = 0;
+        for (int l = 0; l < LANES; l++) {
+            uint16_t low = (uint16_t)(r[l] * count[l]);
+            redraw[l] = active[l] && low < reject_below[count[l]];
+            any |= redraw[l];
+        }
+        if (!any) break;
+
+        uint16_t fresh[LANES];
+        next_random16(b->rng, fresh);
+        for (int l = 0; l < LANES; l++) {
+            if (redraw[l]) r[l] = fresh[l];
+        }
+    }
+
+    for (int l = 0; l < LANES; l++) {
+        if (!active[l]) continue;
+
+        // The k-th empty cell, counting from cell 0
+        uint16_t k = (uint16_t)(((uint32_t)r[l] * count[l]) >> 16), move = 0;
+        for (int i = 0; i < TTT_CELLS; i++) {
+            uint16_t has = (empty[l] >> i) & 1;
+            if (has && k == 0) move = (uint16_t)(1u << i);
+            k -= has;
+        }
+
+        if (policy == TTT_BATCH_SMART) {
+            uint16_t wins = winning_cells(own[l], empty[l]);
+            uint16_t blocks = winning_cells(opp[l], empty[l]);
+            if (wins) move = wins & (uint16_t)-wins;
+            else if (blocks) move = blocks & (uint16_t)-blocks;
+        }
+
+        play_lane(b, (ply & 1) ? b->o : b->x, base + l, ply, move);
+    }
+}
+
+// ============================================
+// AVX2 Kernels
+// ============================================
+
+#ifdef TTT_BATCH_X86
+
+#define AVX2 __attribute__((target("avx2")))
+
+typedef struct {
+    __m256i s0, s1, s2, s3;
+} RngVec;
+
+AVX2 static inline __m256i rotl32_vec(__m256i x, int k) {
+    return _mm256_or_si256(_mm256_slli_epi32(x, k), _mm256_srli_epi32(x, 32 - k));
+}
+
+// Same sequence as next_random16, returned as one register
+AVX2 static inline __m256i next_random16_vec(RngVec *s) {
+    __m256i x5 = _mm256_add_epi32(s->s1, _mm256_slli_epi32(s->s1, 2));
+    __m256i rot = rotl32_vec(x5, 7);
+    __m256i r = _mm256_add_epi32(rot, _mm256_slli_epi32(rot, 3));
+    __m256i t = _mm256_slli_epi32(s->s1, 9);
+    s->s2 = _mm256_xor_si256(s->s2, s->s0);
+    s->s3 = _mm256_xor_si256(s->s3, s->s1);
+    s->s1 = _mm256_xor_si256(s->s1, s->s2);
+    s->s0 = _mm256_xor_si256(s->s0, s->s3);
+    s->s2 = _mm256_xor_si256(s->s2, t);
+    s->s3 = rotl32_vec(s->s3, 11);
+    return r;
+}
+
+AVX2 static inline __m256i lowest_bit_vec(__m256i m) {
+    return _mm256_and_si256(m, _mm256_sub_epi16(_mm256_setzero_si256(), m));
+}
+
+AVX2 static inline __m256i winning_cells_vec(__m256i own, __m256i empty) {
+    __m256i zero = _mm256_setzero_si256(), one = _mm256_set1_epi16(1);
+    __m256i cells = zero;
+    for (int i = 0; i < TTT_NUM_LINES; i++) {
+        __m256i gap = _mm256_andnot_si256(own, _mm256_set1_epi16((short)ttt_win_masks[i]));
+        __m256i single = _mm256_cmpeq_epi16(_mm256_and_si256(gap, _mm256_sub_epi16(gap, one)), zero);
+        __m256i closed = _mm256_cmpeq_epi16(_mm256_and_si256(gap, empty), zero);
+        cells = _mm256_or_si256(cells, _mm256_andnot_si256(closed, _mm256_and_si256(single, gap)));
+    }
+    return cells;
+}
+
+AVX2 static void step_block_avx2(Batch *b, int base, int ply, int policy) {
+    __m256i active = _mm256_loadu_si256((const __m256i *)(b->active + base));
+    if (_mm256_testz_si256(active, active)) return;
+
+    const __m256i zero = _mm256_setzero_si256();
+    uint16_t *own_p = (ply & 1 ? b->o : b->x) + base;
+    uint16_t *opp_p = (ply & 1 ? b->x : b->o) + base;
+    __m256i own = _mm256_loadu_si256((const __m256i *)own_p);
+    __m256i opp = _mm256_loadu_si256((const __m256i *)opp_p);
+    __m256i empty = _mm256_andnot_si256(_mm256_or_si256(own, opp), _mm256_set1_epi16(TTT_FULL_MASK));
+
+    // Popcount of each 16-bit lane through a nibble lookup
+    const __m256i nibble_bits = _mm256_setr_epi8(0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4,
+                                                 0, 1, 1, 2, 1, 2, 2, 3, 1, 2, 2, 3, 2, 3, 3, 4);
+    const __m256i low_nibble = _mm256_set1_epi8(0x0F);
+    __m256i bytes = _mm256_add_epi8(
+        _mm256_shuffle_epi8(nibble_bits, _mm256_and_si256(empty, low_nibble)),
+        _mm256_shuffle_epi8(nibble_bits, _mm256_and_si256(_mm256_srli_epi16(empty, 4), low_nibble)));
+    __m256i count = _mm256_add_epi16(_mm256_and_si256(bytes, _mm256_set1_epi16(0xFF)),
+                                     _mm256_srli_epi16(bytes, 8));
+
+    const __m256i reject_lut = _mm256_setr_epi8(0, 0, 0, 1, 0, 1, 4, 2, 0, 7, 0, 0, 0, 0, 0, 0,
+                                                0, 0, 0, 1, 0, 1, 4, 2, 0, 7, 0, 0, 0, 0, 0, 0);
+    __m256i threshold = _mm256_shuffle_epi8(reject_lut, count);  // high bytes index entry 0
+
+    RngVec s;
+    s.s0 = _mm256_loadu_si256((const __m256i *)b->rng[0]);
+    s.s1 = _mm256_loadu_si256((const __m256i *)b->rng[1]);
+    s.s2 = _mm256_loadu_si256((const __m256i *)b->rng[2]);
+    s.s3 = _mm256_loadu_si256((const __m256i *)b->rng[3]);
+
+    __m256i r = next_random16_vec(&s);
+    for (;;) {
+        __m256i low = _mm256_mullo_epi16(r, count);
+        __m256i ok = _mm256_cmpeq_epi16(_mm256_subs_epu16(threshold, low), zero);
+        __m256i redraw = _mm256_andnot_si256(ok, active);
+        if (_mm256_testz_si256(redraw, redraw)) break;
+        r = _mm256_blendv_epi8(r, next_random16_vec(&s), redraw);
+    }
+
+    // The k-th empty cell: walk the cells, counting k down on each empty one
+    __m256i k = _mm256_mulhi_epu16(r, count), move = zero;
+    for (int i = 0; i < TTT_CELLS; i++) {
+        __m256i cell = _mm256_set1_epi16((short)(1 << i));
+        __m256i has = _mm256_cmpeq_epi16(_mm256_and_si256(empty, cell), cell);
+        __m256i hit = _mm256_and_si256(has, _mm256_cmpeq_epi16(k, zero));
+        move = _mm256_or_si256(move, _mm256_and_si256(hit, cell));
+        k = _mm256_add_epi16(k, has);  // has is -1 on empty cells
+    }
+
+    if (policy == TTT_BATCH_SMART) {
+        __m256i wins = winning_cells_vec(own, empty);
+        __m256i blocks = winning_cells_vec(opp, empty);
+        __m256i no_win = _mm256_cmpeq_epi16(wins, zero);
+        __m256i no_block = _mm256_cmpeq_epi16(blocks, zero);
+        move = _mm256_or_si256(lowest_bit_vec(wins),
+                               _mm256_and_si256(no_win, _mm256_or_si256(lowest_bit_vec(blocks),
+                                                                        _mm256_and_si256(no_block, move))));
+    }
+
+    own = _mm256_or_si256(own, _mm256_and_si256(move, active));
+    __m256i won = zero;
+    for (int i = 0; i < TTT_NUM_LINES; i++) {
+        __m256i line = _mm256_set1_epi16((short)ttt_win_masks[i]);
+        won = _mm256_or_si256(won, _mm256_cmpeq_epi16(_mm256_and_si256(own, line), line));
+    }
+    won = _mm256_and_si256(won, active);
+
+    __m256i *plies_p = (__m256i *)(b->plies + base);
+    __m256i *result_p = (__m256i *)(b->result + base);
+    __m256i plies = _mm256_blendv_epi8(_mm256_loadu_si256(plies_p), _mm256_set1_epi16((short)(ply + 1)), active);
+    __m256i result = _mm256_or_si256(_mm256_loadu_si256(result_p),
+                                     _mm256_and_si256(won, _mm256_set1_epi16((ply & 1) ? TTT_O_WINS : TTT_X_WINS)));
+    active = _mm256_andnot_si256(won, active);
+    if (ply == TTT_CELLS - 1) {
+        result = _mm256_or_si256(result, _mm256_and_si256(active, _mm256_set1_epi16(TTT_DRAW)));
+        active = zero;
+    }
+
+    _mm256_storeu_si256((__m256i *)own_p, own);
+    _mm256_storeu_si256(plies_p, plies);
+    _mm256_storeu_si256(result_p, result);
+    _mm256_storeu_si256((__m256i *)(b->active + base), active);
+    _mm256_storeu_si256((__m256i *)b->rng[0], s.s0);
+    _mm256_storeu_si256((__m256i *)b->rng[1], s.s1);
+    _mm256_storeu_si256((__m256i *)b->rng[2], s.s2);
+    _mm256_storeu_si256((__m256i *)b->rng[3], s.s3);
+}
+
+#endif
+
+// ============================================
+// Driver
+// ============================================
+
+// Every live game's move from a TTTMovePolicy, one call for the whole batch
+static void step_policy(Batch *b, int n, int ply, const TTTMovePolicy *policy, TTTRng *rng) {
+    ttt_policy_moves(policy, b->x, b->o, n, rng, b->moves);
+    uint16_t *own = (ply & 1) ? b->o : b->x;
+    for (int i = 0; i < n; i++) {
+        if (b->active[i]) play_lane(b, own, i, ply, (uint16_t)(1u << b->moves[i]));
+    }
+}
+
+int ttt_batch_play(int x_policy, int o_policy, uint64_t games, TTTRng *rng,
+                   TTTBatchStats *stats) {
+    return ttt_batch_play_policies(x_policy, NULL, o_policy, NULL, games, rng, stats);
+}
+
+int ttt_batch_play_policies(int x_policy, const TTTMovePolicy *x_table, int o_policy,
+                            const TTTMovePolicy *o_table, uint64_t games, TTTRng *rng,
+                            TTTBatchStats *stats) {
+    if ((x_policy == TTT_BATCH_POLICY && x_table == NULL) ||
+        (o_policy == TTT_BATCH_POLICY && o_table == NULL)) {
+        return 0;
+    }
+    Batch *b = (Batch *)malloc(sizeof(Batch));
+    if (b == NULL) return 0;
+
+    for (int i = 0; i < 4; i++) {
+        for (int j = 0; j < 8; j++) b->rng[i][j] = (uint32_t)(ttt_rng_next(rng) >> 32);
+    }
+    // Random moves of the policies (one stream, in game order)
+    TTTRng policy_rng;
+    ttt_rng_seed(&policy_rng, ttt_rng_next(rng));
+
+    void (*step)(Batch *, int, int, int) = step_block_scalar;
+#ifdef TTT_BATCH_X86
+    if (g_simd_allowed && simd_supported()) step = step_block_avx2;
+#endif
+
+    while (games > 0) {
+        int n = games < TTT_BATCH_SIZE ? (int)games : TTT_BATCH_SIZE;
+        int blocks = (n + LANES - 1) / LANES;
+        memset(b->x, 0, sizeof(b->x));
+        memset(b->o, 0, sizeof(b->o));
+        memset(b->plies, 0, sizeof(b->plies));
+        memset(b->result, 0, sizeof(b->result));
+        for (int i = 0; i < TTT_BATCH_SIZE; i++) b->active[i] = i < n ? 0xFFFF : 0;
+
+        // One ply of every game before the next ply of any
+        for (int ply = 0; ply < TTT_CELLS; ply++) {
+            int policy = (ply & 1) ? o_policy : x_policy;
+            if (policy == TTT_BATCH_POLICY) {
+                step_policy(b, n, ply, (ply & 1) ? o_table : x_table, &policy_rng);
+                continue;
+            }
+            for (int blk = 0; blk < blocks; blk++) step(b, blk * LANES, ply, policy);
+        }
+
+        for (int i = 0; i < n; i++) {
+            int plies = b->plies[i];
+            if (b->result[i] == TTT_X_WINS) stats->x_wins++;
+            else if (b->result[i] == TTT_O_WINS) stats->o_wins++;
+            else stats->draws++;
+            stats->total_moves += (uint64_t)plies;
+            if (stats->fastest == 0 || plies < stats->fastest) stats->fastest = plies;
+            if (plies > stats->longest) stats->longest = plies;
+        }
+        stats->games += (uint64_t)n;
+        games -= (uint64_t)n;
+    }
+
+    free(b);
+    return 1;
+}
@@ -0,0 +1,57 @@
+#ifndef TTT_BATCH_H
+#define TTT_BATCH_H
+
+#include <stdint.h>
+#include "ttt_rng.h"
+#include "ttt_policy.h"
+
+// ============================================
+// Batched Game Simulator
+// ============================================
+//
+// Plays thousands of games of the Random / Smart Random policies at
+// once. Boards are kept as structure-of-arrays bitboards, and all games
+// advance one ply at a time, 16 games per 256-bit vector. The AVX2
+// kernels are picked at runtime when the CPU has them. The scalar
+// fallback consumes random numbers identically, so a seed gives the
+// same results on every machine.
+//
+// A side can also be a TTTMovePolicy (the model and table players): it is
+// asked for the moves of the whole batch in one call per ply.
+//
+// Every game starts from the empty board, so all live games of a batch
+// have the same side to move; finished games are masked out.
+
+#define TTT_BATCH_RANDOM 0   // uniform over empty cells (random_move)
+#define TTT_BATCH_SMART  1   // win, else block, else random (smart_random_move)
+#define TTT_BATCH_POLICY 2   // a TTTMovePolicy (ttt_policy.h)
+
+#define TTT_BATCH_SIZE 4096  // games in flight per batch (multiple of 16)
+
+typedef struct {
+    uint64_t games;
+    uint64_t x_wins;
+    uint64_t o_wins;
+    uint64_t draws;
+    uint64_t total_moves;
+    int fastest;             // plies of the shortest game (0 = none yet)
+    int longest;
+} TTTBatchStats;
+
+// Plays `games` games, x_policy as X against o_policy as O, and adds
+// the results to stats. The lanes' generators are seeded from rng.
+// Returns 0 on allocation failure.
+int ttt_batch_play(int x_policy, int o_policy, uint64_t games, TTTRng *rng,
+                   TTTBatchStats *stats);
+
+// The same with TTT_BATCH_POLICY sides: x_table / o_table is the
+// policy of that side (ignored otherwise). Returns 0 if one is missing.
+int ttt_batch_play_policies(int x_policy, const TTTMovePolicy *x_table, int o_policy,
+                            const TTTMovePolicy *o_table, uint64_t games, TTTRng *rng,
+                            TTTBatchStats *stats);
+
+// Allow (default) or forbid the AVX2 kernels; returns 1 if they will
+// be used. Call before starting threads.
+int ttt_batch_set_simd(int enabled);
+
+#endif
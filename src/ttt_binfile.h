@@ -0,0 +1,40 @@
+#ifndef TTT_BINFILE_H
+#define TTT_BINFILE_H
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// ============================================
+// Binary File Helpers
+// ============================================
+//
+// Shared by the one-pass binary formats (.ttds datasets, .ttgl game
+// logs): the writer puts a placeholder header first, checksums each
+// record as it goes, and rewrites the header with the count and
+// checksum on close.
+
+#define TTT_CHECKSUM_INIT 2166136261u  // FNV-1a offset basis
+#define TTT_CHECKSUM_PRIME 16777619u
+
+// FNV-1a of bytes, continuing from h (TTT_CHECKSUM_INIT to start)
+static inline uint32_t ttt_checksum(uint32_t h, const void *bytes, size_t n) {
+    const uint8_t *p = (const uint8_t *)bytes;
+    for (size_t i = 0; i < n; i++) {
+        h ^= p[i];
+        h *= TTT_CHECKSUM_PRIME;
+    }
+    return h;
+}
+
+// Writes the final header over the placeholder and closes fp.
+// Returns 0 if any write so far or the close failed.
+static inline int ttt_binfile_close(FILE *fp, const void *header, size_t size) {
+    int ok = !ferror(fp) &&
+             fseek(fp, 0, SEEK_SET) == 0 &&
+             fwrite(header, size, 1, fp) == 1;
+    if (fclose(fp) != 0) ok = 0;
+    return ok;
+}
+
+#endif
@@ -0,0 +1,162 @@
+#ifndef TTT_BOARD_H
+#define TTT_BOARD_H
+
+#include <stdint.h>
+
+// ============================================
+// Shared Tic-Tac-Toe Bitboard
+// ============================================
+//
+// A position is stored as two 9-bit masks, one per player.
+// Bit i corresponds to cell i (0 = top-left, 8 = bottom-right),
+// the same numbering every tool already uses for char boards.
+
+#define TTT_CELLS 9
+#define TTT_FULL_MASK 0x1FF
+#define TTT_NUM_LINES 8
+#define TTT_NUM_CODES 19683  // 3^9 base-3 codes (digit 0 empty, 1 X, 2 O)
+
+// Side identifiers (match the base-3 cell digits: 1 = X, 2 = O)
+#define TTT_SIDE_X 1
+#define TTT_SIDE_O 2
+
+// Game status returned by bb_status()
+#define TTT_ONGOING 0
+#define TTT_X_WINS  1
+#define TTT_O_WINS  2
+#define TTT_DRAW    3
+
+typedef struct {
+    uint16_t x;  // cells occupied by X
+    uint16_t o;  // cells occupied by O
+} Bitboard;
+
+// Rows, columns and diagonals as cell masks
+extern const uint16_t ttt_win_masks[TTT_NUM_LINES];
+
+// Cell mask -> base-3 number with digit 1 at every set cell
+extern const uint16_t ttt_bin_to_ter[1 << TTT_CELLS];
+
+// ============================================
+// Bit helpers
+// ============================================
+
+static inline int bb_popcount(unsigned int m) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcount(m);
+#else
+    int c = 0;
+    while (m) { m &= m - 1; c++; }
+    return c;
+#endif
+}
+
+// Index of the lowest set bit; m must be non-zero
+static inline int bb_ctz(unsigned int m) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_ctz(m);
+#else
+    int i = 0;
+    while (!(m & 1u)) { m >>= 1; i++; }
+    return i;
+#endif
+}
+
+// Index of the n-th (0-based) set bit of m; n must be < popcount(m)
+static inline int bb_select(unsigned int m, int n) {
+    while (n-- > 0) m &= m - 1;
+    return bb_ctz(m);
+}
+
+// ============================================
+// Board queries
+// ============================================
+
+static inline Bitboard bb_empty_board(void) {
+    Bitboard b = {0, 0};
+    return b;
+}
+
+static inline uint16_t bb_empty_cells(Bitboard b) {
+    return (uint16_t)(~(b.x | b.o) & TTT_FULL_MASK);
+}
+
+static inline int bb_count_empty(Bitboard b) {
+    return TTT_CELLS - bb_popcount(b.x | b.o);
+}
+
+static inline int bb_is_empty_cell(Bitboard b, int pos) {
+    return pos >= 0 && pos < TTT_CELLS && !((b.x | b.o) & (1u << pos));
+}
+
+// 1 if the mask contains a complete line
+static inline int bb_has_line(uint16_t m) {
+    for (int i = 0; i < TTT_NUM_LINES; i++) {
+        if ((m & ttt_win_masks[i]) == ttt_win_masks[i]) return 1;
+    }
+    return 0;
+}
+
+// TTT_X_WINS, TTT_O_WINS, TTT_DRAW or TTT_ONGOING
+static inline int bb_status(Bitboard b) {
+    if (bb_has_line(b.x)) return TTT_X_WINS;
+    if (bb_has_line(b.o)) return TTT_O_WINS;
+    if ((b.x | b.o) == TTT_FULL_MASK) return TTT_DRAW;
+    return TTT_ONGOING;
+}
+
+// Side to move assuming X always starts
+static inline int bb_side_to_move(Bitboard b) {
+    return bb_popcount(b.x) == bb_popcount(b.o) ? TTT_SIDE_X : TTT_SIDE_O;
+}
+
+static inline uint16_t bb_side_mask(Bitboard b, int side) {
+    return side == TTT_SIDE_X ? b.x : b.o;
+}
+
+// Place (or remove, since it is an xor) a stone for side at pos
+static inline void bb_toggle(Bitboard *b, int pos, int side) {
+    if (side == TTT_SIDE_X) b->x ^= (uint16_t)(1u << pos);
+    else b->o ^= (uint16_t)(1u << pos);
+}
+
+// Empty cells where side completes a line with one stone
+static inline uint16_t bb_winning_cells(Bitboard b, int side) {
+    uint16_t own = bb_side_mask(b, side);
+    uint16_t empty = bb_empty_cells(b);
+    uint16_t cells = 0;
+    for (int i = 0; i < TTT_NUM_LINES; i++) {
+        uint16_t gap = ttt_win_masks[i] & ~own;
+        if (bb_popcount(gap) == 1 && (gap & empty)) cells |= gap;
+    }
+    return cells;
+}
+
+// ============================================
+// Base-3 codes (cell i contributes digit * 3^i)
+// ============================================
+
+static inline int bb_to_code(Bitboard b) {
+    return ttt_bin_to_ter[b.x] + 2 * ttt_bin_to_ter[b.o];
+}
+
+// Code after side plays at pos (negate the delta to unmake), so a code
+// kept next to the board never has to be recomputed from scratch
+static inline int bb_code_play(int code, int pos, int side) {
+    return code + side * ttt_bin_to_ter[1u << pos];
+}
+
+Bitboard bb_from_code(int code);
+
+// ============================================
+// Conversion to/from the legacy char boards
+// ============================================
+
+// Build a bitboard from a char board using the given X/O symbols;
+// any other character counts as empty
+Bitboard bb_from_chars(const char *board, char x_char, char o_char);
+
+// Write the bitboard as 9 chars using the given symbols
+void bb_to_chars(Bitboard b, char *board, char x_char, char o_char, char empty_char);
+
+#endif
@@ -0,0 +1,36 @@
+#ifndef TTT_CLOCK_H
+#define TTT_CLOCK_H
+
+#include <stdint.h>
+
+// ============================================
+// Monotonic Nanosecond Clock
+// ============================================
+//
+// For timing short intervals: never jumps with wall-clock changes, and
+// is cheap enough (a few tens of ns) to wrap a single move decision.
+
+#ifdef _WIN32
+#include <windows.h>
+
+static inline uint64_t ttt_clock_ns(void) {
+    static LARGE_INTEGER freq;  // constant after boot, so racing writers agree
+    LARGE_INTEGER now;
+    if (freq.QuadPart == 0) QueryPerformanceFrequency(&freq);
+    QueryPerformanceCounter(&now);
+    // Split the conversion so now * 1e9 cannot overflow
+    uint64_t sec = (uint64_t)(now.QuadPart / freq.QuadPart);
+    uint64_t rem = (uint64_t)(now.QuadPart % freq.QuadPart);
+    return sec * 1000000000ULL + rem * 1000000000ULL / (uint64_t)freq.QuadPart;
+}
+#else
+#include <time.h>
+
+static inline uint64_t ttt_clock_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+#endif
+
+#endif
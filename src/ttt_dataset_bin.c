@@ -0,0 +1,118 @@
+#include <stdlib.h>
+#include <string.h>
+#include "ttt_dataset_bin.h"
+#include "ttt_symmetry.h"
+
+#define WRITER_BUFFER_SIZE (1 << 20)
+
+// ============================================
+// Writer
+// ============================================
+
+int ttt_ds_writer_open(TTDSWriter *w, const char *filename, uint32_t flags) {
+    w->fp = fopen(filename, "wb");
+    if (!w->fp) return 0;
+    setvbuf(w->fp, NULL, _IOFBF, WRITER_BUFFER_SIZE);
+
+    memset(&w->header, 0, sizeof(w->header));
+    memcpy(w->header.magic, TTT_DS_MAGIC, 4);
+    w->header.version = TTT_DS_VERSION;
+    w->header.width = 3;
+    w->header.height = 3;
+    w->header.record_size = sizeof(TTDSRecord);
+    w->header.flags = flags;
+    w->header.checksum = TTT_CHECKSUM_INIT;
+
+    // Placeholder until ttt_binfile_close
+    return fwrite(&w->header, sizeof(w->header), 1, w->fp) == 1;
+}
+
+void ttt_ds_writer_add(TTDSWriter *w, TTDSRecord rec) {
+    fwrite(&rec, sizeof(rec), 1, w->fp);
+    w->header.checksum = ttt_checksum(w->header.checksum, &rec, sizeof(rec));
+    w->header.count++;
+}
+
+int ttt_ds_writer_close(TTDSWriter *w) {
+    int ok = ttt_binfile_close(w->fp, &w->header, sizeof(w->header));
+    w->fp = NULL;
+    return ok;
+}
+
+// ============================================
+// Reader
+// ============================================
+
+// A record the accessors can decode: a base-3 code, a side, an outcome
+// of -1/0/+1 and a cell or no move
+static int valid_record(TTDSRecord rec) {
+    int side = ttt_ds_side(rec), move = rec.info >> 4;
+    return rec.code < TTT_NUM_CODES &&
+           (side == TTT_SIDE_X || side == TTT_SIDE_O) &&
+           ((rec.info >> 2) & 3) != 3 &&
+           (move < TTT_CELLS || move == TTT_DS_NO_MOVE);
+}
+
+int ttt_ds_open(TTDSFile *f, const char *filename) {
+    memset(f, 0, sizeof(*f));
+    if (!ttt_mmap_open(&f->map, filename)) {
+        fprintf(stderr, "Error: Cannot open binary dataset '%s'\n", filename);
+        return 0;
+    }
+
+    const TTDSHeader *h = (const TTDSHeader *)f->map.data;
+    const char *problem = NULL;
+    if (f->map.size < sizeof(TTDSHeader) || memcmp(h->magic, TTT_DS_MAGIC, 4) != 0) {
+        problem = "not a binary dataset";
+    } else if (h->version != TTT_DS_VERSION) {
+        problem = "unsupported version";
+    } else if (h->width != 3 || h->height != 3 || h->record_size != sizeof(TTDSRecord)) {
+        problem = "unsupported board size or record layout";
+    } else if (f->map.size != sizeof(TTDSHeader) + (size_t)h->count * sizeof(TTDSRecord)) {
+        problem = "truncated file";
+    } else if (ttt_checksum(TTT_CHECKSUM_INIT, h + 1, (size_t)h->count * sizeof(TTDSRecord))
+               != h->checksum) {
+        problem = "checksum mismatch";
+    } else {
+        const TTDSRecord *records = (const TTDSRecord *)(h + 1);
+        for (uint32_t i = 0; i < h->count; i++) {
+            if (!valid_record(records[i])) {
+                problem = "invalid record";
+                break;
+            }
+        }
+    }
+
+    if (problem != NULL) {
+        fprintf(stderr, "Error: '%s': %s\n", filename, problem);
+        ttt_mmap_close(&f->map);
+        return 0;
+    }
+
+    f->header = h;
+    f->records = (const TTDSRecord *)(h + 1);
+    f->count = h->count;
+    return 1;
+}
+
+void ttt_ds_close(TTDSFile *f) {
+    ttt_mmap_close(&f->map);
+    f->header = NULL;
+    f->records = NULL;
+    f->count = 0;
+}
+
+int ttt_ds_is_binary(const char *filename) {
+    FILE *fp = fopen(filename, "rb");
+    if (!fp) return 0;
+    char magic[4];
+    int is_binary = fread(magic, 1, 4, fp) == 4 && memcmp(magic, TTT_DS_MAGIC, 4) == 0;
+    fclose(fp);
+    return is_binary;
+}
+
+int ttt_ds_weight(const TTDSFile *f, TTDSRecord rec) {
+    if (!(f->header->flags & TTT_DS_CANONICAL)) return 1;
+    ttt_sym_init();
+    return ttt_sym_weight[rec.code];
+}
@@ -0,0 +1,104 @@
+#ifndef TTT_DATASET_BIN_H
+#define TTT_DATASET_BIN_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include "ttt_board.h"
+#include "ttt_binfile.h"
+#include "ttt_mmap.h"
+
+// ============================================
+// Binary Solved-Position Dataset (.ttds)
+// ============================================
+//
+// A 32-byte header followed by fixed-width 3-byte records:
+//
+//   uint16 code   base-3 board code (digit 0 empty, 1 X, 2 O)
+//   uint8  info   bits 0-1 side to move (TTT_SIDE_X / TTT_SIDE_O)
+//                 bits 2-3 outcome + 1 for the side to move (-1/0/+1)
+//                 bits 4-7 best move 0..8, 15 if none
+//
+// Little-endian, no padding. Files are written in one pass and read
+// through mmap, so a loaded dataset is just a pointer into the mapping.
+
+#define TTT_DS_MAGIC "TTDS"
+#define TTT_DS_VERSION 1
+
+// Header flags
+#define TTT_DS_CANONICAL 0x1  // one record per symmetry class (see ttt_ds_weight)
+
+#define TTT_DS_NO_MOVE 15
+
+typedef struct {
+    char magic[4];
+    uint16_t version;
+    uint8_t width;
+    uint8_t height;
+    uint32_t record_size;
+    uint32_t count;
+    uint32_t flags;
+    uint32_t checksum;     // FNV-1a over all record bytes
+    uint8_t reserved[8];
+} TTDSHeader;
+
+#pragma pack(push, 1)
+typedef struct {
+    uint16_t code;
+    uint8_t info;
+} TTDSRecord;
+#pragma pack(pop)
+
+typedef struct {
+    MappedFile map;
+    const TTDSHeader *header;
+    const TTDSRecord *records;
+    uint32_t count;
+} TTDSFile;
+
+typedef struct {
+    FILE *fp;
+    TTDSHeader header;
+} TTDSWriter;
+
+// Writer: header is patched with count and checksum on close
+int ttt_ds_writer_open(TTDSWriter *w, const char *filename, uint32_t flags);
+void ttt_ds_writer_add(TTDSWriter *w, TTDSRecord rec);
+int ttt_ds_writer_close(TTDSWriter *w);
+
+// Reader: maps the file and validates header, checksum and records.
+// Returns 0 (after printing the reason to stderr) on failure.
+int ttt_ds_open(TTDSFile *f, const char *filename);
+void ttt_ds_close(TTDSFile *f);
+
+// 1 if the file starts with the .ttds magic (lets loaders auto-detect)
+int ttt_ds_is_binary(const char *filename);
+
+// Boards a record stands for: its symmetry class size in canonical files
+int ttt_ds_weight(const TTDSFile *f, TTDSRecord rec);
+
+static inline TTDSRecord ttt_ds_record(int code, int side, int outcome, int best_move) {
+    TTDSRecord rec;
+    rec.code = (uint16_t)code;
+    rec.info = (uint8_t)(side | ((outcome + 1) << 2) |
+                         ((best_move < 0 ? TTT_DS_NO_MOVE : best_move) << 4));
+    return rec;
+}
+
+static inline int ttt_ds_side(TTDSRecord rec) { return rec.info & 3; }
+static inline int ttt_ds_outcome(TTDSRecord rec) { return ((rec.info >> 2) & 3) - 1; }
+
+static inline int ttt_ds_best_move(TTDSRecord rec) {
+    int mv = rec.info >> 4;
+    return mv == TTT_DS_NO_MOVE ? -1 : mv;
+}
+
+// Outcome from X's point of view, the convention of the .data labels
+static inline int ttt_ds_x_outcome(TTDSRecord rec) {
+    return ttt_ds_side(rec) == TTT_SIDE_X ? ttt_ds_outcome(rec) : -ttt_ds_outcome(rec);
+}
+
+static inline Bitboard ttt_ds_board(TTDSRecord rec) {
+    return bb_from_code(rec.code);
+}
+
+#endif
@@ -0,0 +1,206 @@
+#include <stdlib.h>
+#include <string.h>
+#include "ttt_exact.h"
+#include "ttt_movetable.h"
+#include "ttt_perfect_table.h"  // generated: gen_perfect_table
+
+typedef struct {
+    TTTPolicy policy[3];   // indexed by TTT_SIDE_X / TTT_SIDE_O
+    int adversary;         // side played by the best response, 0 if none
+    TTTOutcome *memo;
+    uint8_t *done;
+    int8_t *choice;        // best response's move in each of its positions
+} ExactSearch;
+
+// Expected score of side in r: +1 win, 0 draw, -1 loss
+static double score_for(const TTTOutcome *r, int side) {
+    return side == TTT_SIDE_X ? r->x_win - r->o_win : r->o_win - r->x_win;
+}
+
+static const TTTOutcome *evaluate(ExactSearch *s, Bitboard b, int code) {
+    TTTOutcome *r = &s->memo[code];
+    if (s->done[code]) return r;
+    s->done[code] = 1;
+
+    switch (bb_status(b)) {
+    case TTT_X_WINS: r->x_win = 1.0; return r;
+    case TTT_O_WINS: r->o_win = 1.0; return r;
+    case TTT_DRAW:   r->draw = 1.0;  return r;
+    }
+
+    int side = bb_side_to_move(b);
+    if (side == s->adversary) {
+        // Best child for the adversary; ties go to the lowest cell
+        const TTTOutcome *best = NULL;
+        double best_score = -2.0;
+        for (uint16_t m = bb_empty_cells(b); m; m &= m - 1) {
+            int i = bb_ctz(m);
+            Bitboard child = b;
+            bb_toggle(&child, i, side);
+            const TTTOutcome *c = evaluate(s, child, bb_code_play(code, i, side));
+            double score = score_for(c, side);
+            if (score > best_score + 1e-12) {
+                best_score = score;
+                best = c;
+                s->choice[code] = (int8_t)i;
+            }
+        }
+        *r = *best;
+        r->plies += 1.0;
+        return r;
+    }
+
+    double probs[TTT_CELLS] = {0};
+    s->policy[side].fn(b, probs, s->policy[side].ctx);
+
+    for (uint16_t m = bb_empty_cells(b); m; m &= m - 1) {
+        int i = bb_ctz(m);
+        if (probs[i] <= 0.0) continue;  // branches never taken cost nothing
+
+        Bitboard child = b;
+        bb_toggle(&child, i, side);
+        const TTTOutcome *c = evaluate(s, child, bb_code_play(code, i, side));
+        r->x_win += probs[i] * c->x_win;
+        r->o_win += probs[i] * c->o_win;
+        r->draw  += probs[i] * c->draw;
+        r->plies += probs[i] * (1.0 + c->plies);
+    }
+    return r;
+}
+
+static int search_alloc(ExactSearch *s) {
+    s->memo = calloc(TTT_NUM_CODES, sizeof(TTTOutcome));
+    s->done = calloc(TTT_NUM_CODES, 1);
+    s->choice = calloc(TTT_NUM_CODES, 1);
+    if (s->memo && s->done && s->choice) return 1;
+    free(s->memo);
+    free(s->done);
+    free(s->choice);
+    return 0;
+}
+
+static void search_free(ExactSearch *s) {
+    free(s->memo);
+    free(s->done);
+    free(s->choice);
+}
+
+int ttt_exact_outcome(TTTPolicy x_policy, TTTPolicy o_policy, TTTOutcome *out) {
+    ExactSearch s;
+    s.policy[TTT_SIDE_X] = x_policy;
+    s.policy[TTT_SIDE_O] = o_policy;
+    s.adversary = 0;
+    if (!search_alloc(&s)) return 0;
+
+    *out = *evaluate(&s, bb_empty_board(), 0);
+
+    search_free(&s);
+    return 1;
+}
+
+// ============================================
+// Exploitability
+// ============================================
+
+// Solved value the policy gives away by moving with probs in b
+static double value_lost(Bitboard b, const double *probs) {
+    int idx = ttt_perfect_index_of(b);
+    double after = 0.0;
+    for (uint16_t m = bb_empty_cells(b); m; m &= m - 1) {
+        int i = bb_ctz(m);
+        after += probs[i] * ttt_mt_score(ttt_mt_entry_value(ttt_perfect_moves[idx][i]));
+    }
+    return ttt_perfect_outcome[idx] - after;
+}
+
+static int compare_leaks(const void *a, const void *b) {
+    const TTTLeak *la = a, *lb = b;
+    double ca = la->reach * la->loss, cb = lb->reach * lb->loss;
+    if (ca != cb) return ca > cb ? -1 : 1;
+    if (la->loss != lb->loss) return la->loss > lb->loss ? -1 : 1;
+    return la->code - lb->code;
+}
+
+// Walks the positions in order of stone count (every move adds one, so
+// a breadth-first queue finishes all parents before any child) and
+// collects the leaks, with the chance the best response reaches each.
+static int find_leaks(ExactSearch *s, int policy_side, TTTExploit *out) {
+    double *reach = calloc(TTT_NUM_CODES, sizeof(double));
+    uint8_t *seen = calloc(TTT_NUM_CODES, 1);
+    int *queue = malloc(TTT_NUM_CODES * sizeof(int));
+    out->leaks = malloc(TTT_NUM_CODES * sizeof(TTTLeak));
+    if (!reach || !seen || !queue || !out->leaks) {
+        free(reach);
+        free(seen);
+        free(queue);
+        free(out->leaks);
+        out->leaks = NULL;
+        return 0;
+    }
+
+    int head = 0, tail = 0;
+    queue[tail++] = 0;
+    seen[0] = 1;
+    reach[0] = 1.0;
+    while (head < tail) {
+        int code = queue[head++];
+        Bitboard b = bb_from_code(code);
+        if (bb_status(b) != TTT_ONGOING) continue;
+
+        int side = bb_side_to_move(b);
+        double probs[TTT_CELLS] = {0};
+        if (side == policy_side) {
+            s->policy[side].fn(b, probs, s->policy[side].ctx);
+            double loss = value_lost(b, probs);
+            if (loss > 1e-12) {
+                TTTLeak *leak = &out->leaks[out->num_leaks++];
+                leak->code = code;
+                leak->reach = reach[code];
+                leak->loss = loss;
+            }
+        } else {
+            probs[s->choice[code]] = 1.0;
+        }
+
+        // The adversary could play anything, so all its moves are
+        // reachable, but only its chosen one carries probability
+        for (uint16_t m = bb_empty_cells(b); m; m &= m - 1) {
+            int i = bb_ctz(m);
+            if (side == policy_side && probs[i] <= 0.0) continue;
+            int child = bb_code_play(code, i, side);
+            reach[child] += reach[code] * probs[i];
+            if (!seen[child]) {
+                seen[child] = 1;
+                queue[tail++] = child;
+            }
+        }
+    }
+
+    qsort(out->leaks, out->num_leaks, sizeof(TTTLeak), compare_leaks);
+    free(reach);
+    free(seen);
+    free(queue);
+    return 1;
+}
+
+int ttt_exact_best_response(TTTPolicy policy, int policy_side, TTTExploit *out) {
+    memset(out, 0, sizeof(*out));
+
+    ExactSearch s;
+    s.policy[policy_side] = policy;
+    s.adversary = (policy_side == TTT_SIDE_X) ? TTT_SIDE_O : TTT_SIDE_X;
+    if (!search_alloc(&s)) return 0;
+
+    out->outcome = *evaluate(&s, bb_empty_board(), 0);
+    out->value = score_for(&out->outcome, s.adversary);
+    int ok = find_leaks(&s, policy_side, out);
+
+    search_free(&s);
+    return ok;
+}
+
+void ttt_exact_free_exploit(TTTExploit *e) {
+    free(e->leaks);
+    e->leaks = NULL;
+    e->num_leaks = 0;
+}
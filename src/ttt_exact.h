@@ -0,0 +1,72 @@
+#ifndef TTT_EXACT_H
+#define TTT_EXACT_H
+
+#include "ttt_board.h"
+
+// ============================================
+// Exact Matchup Analysis
+// ============================================
+//
+// Instead of sampling games, walks the game tree once and weights every
+// branch by the probability the mover's policy gives that move. Each
+// position is evaluated once (memoized by its base-3 code), so a whole
+// matchup takes a few thousand policy calls instead of millions of games,
+// and the answer has no sampling error.
+//
+// A policy only has to describe itself: given a position, the
+// probability of each cell. Deterministic players put 1.0 on one cell.
+
+// Fills probs[i] with the chance the side to move in b plays cell i;
+// occupied cells must get 0 and the rest must sum to 1
+typedef void (*TTTPolicyFn)(Bitboard b, double probs[TTT_CELLS], void *ctx);
+
+typedef struct {
+    TTTPolicyFn fn;
+    void *ctx;
+} TTTPolicy;
+
+typedef struct {
+    double x_win;
+    double o_win;
+    double draw;
+    double plies;   // expected game length
+} TTTOutcome;
+
+// Outcome distribution of x_policy as X against o_policy as O from the
+// empty board. Returns 0 on allocation failure.
+int ttt_exact_outcome(TTTPolicy x_policy, TTTPolicy o_policy, TTTOutcome *out);
+
+// ============================================
+// Exploitability (best response)
+// ============================================
+//
+// The same walk with the opponent replaced by an adversary that knows
+// the policy's distribution and maximizes its own expected score
+// (expectimax). Its value is how much a perfect exploiter can take from
+// the policy; a policy that never errs scores 0 from both sides, the
+// game-theoretic value of tic-tac-toe.
+//
+// A leak is a position where the policy's move distribution gives away
+// game value: the solved outcome of the position minus the expected
+// solved outcome after the policy moves (values -1..1, from
+// ttt_perfect_table.h).
+
+typedef struct {
+    int code;        // base-3 code of the position (policy to move)
+    double reach;    // chance the best response steers the game here
+    double loss;     // game value the policy gives away by moving here
+} TTTLeak;
+
+typedef struct {
+    TTTOutcome outcome;  // the games of the best response against the policy
+    double value;        // adversary's expected score: +1 win, 0 draw, -1 loss
+    TTTLeak *leaks;      // every leak reachable against some adversary,
+    int num_leaks;       // highest reach * loss first
+} TTTExploit;
+
+// Best response to policy playing policy_side (TTT_SIDE_X / TTT_SIDE_O).
+// Free out with ttt_exact_free_exploit. Returns 0 on allocation failure.
+int ttt_exact_best_response(TTTPolicy policy, int policy_side, TTTExploit *out);
+void ttt_exact_free_exploit(TTTExploit *e);
+
+#endif
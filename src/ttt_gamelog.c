@@ -0,0 +1,91 @@
+#include <stdlib.h>
+#include <string.h>
+#include "ttt_gamelog.h"
+
+#define WRITER_BUFFER_SIZE (1 << 20)
+
+// ============================================
+// Writer
+// ============================================
+
+int ttt_gl_writer_open(TTGLWriter *w, const char *filename, uint64_t seed,
+                       const char *const *names, int num_players) {
+    if (num_players > TTT_GL_MAX_PLAYERS) return 0;
+    w->fp = fopen(filename, "wb");
+    if (!w->fp) return 0;
+    setvbuf(w->fp, NULL, _IOFBF, WRITER_BUFFER_SIZE);
+
+    memset(&w->header, 0, sizeof(w->header));
+    memcpy(w->header.magic, TTT_GL_MAGIC, 4);
+    w->header.version = TTT_GL_VERSION;
+    w->header.width = 3;
+    w->header.height = 3;
+    w->header.record_size = sizeof(TTGLRecord);
+    w->header.num_players = (uint32_t)num_players;
+    w->header.seed = seed;
+    w->header.checksum = TTT_CHECKSUM_INIT;
+    for (int i = 0; i < num_players; i++) {
+        strncpy(w->header.players[i], names[i], TTT_GL_NAME_LEN - 1);
+    }
+
+    // Placeholder until ttt_binfile_close
+    return fwrite(&w->header, sizeof(w->header), 1, w->fp) == 1;
+}
+
+void ttt_gl_writer_add(TTGLWriter *w, const TTGLRecord *rec) {
+    fwrite(rec, sizeof(*rec), 1, w->fp);
+    w->header.checksum = ttt_checksum(w->header.checksum, rec, sizeof(*rec));
+    w->header.count++;
+}
+
+int ttt_gl_writer_close(TTGLWriter *w) {
+    int ok = ttt_binfile_close(w->fp, &w->header, sizeof(w->header));
+    w->fp = NULL;
+    return ok;
+}
+
+// ============================================
+// Reader
+// ============================================
+
+int ttt_gl_open(TTGLFile *f, const char *filename) {
+    memset(f, 0, sizeof(*f));
+    if (!ttt_mmap_open(&f->map, filename)) {
+        fprintf(stderr, "Error: Cannot open game log '%s'\n", filename);
+        return 0;
+    }
+
+    const TTGLHeader *h = (const TTGLHeader *)f->map.data;
+    const char *problem = NULL;
+    if (f->map.size < sizeof(TTGLHeader) || memcmp(h->magic, TTT_GL_MAGIC, 4) != 0) {
+        problem = "not a game log";
+    } else if (h->version != TTT_GL_VERSION) {
+        problem = "unsupported version";
+    } else if (h->width != 3 || h->height != 3 || h->record_size != sizeof(TTGLRecord) ||
+               h->num_players > TTT_GL_MAX_PLAYERS) {
+        problem = "unsupported board size or record layout";
+    } else if (f->map.size != sizeof(TTGLHeader) + h->count * sizeof(TTGLRecord)) {
+        problem = "truncated file";
+    } else if (ttt_checksum(TTT_CHECKSUM_INIT, h + 1, h->count * sizeof(TTGLRecord))
+               != h->checksum) {
+        problem = "checksum mismatch";
+    }
+
+    if (problem != NULL) {
+        fprintf(stderr, "Error: '%s': %s\n", filename, problem);
+        ttt_mmap_close(&f->map);
+        return 0;
+    }
+
+    f->header = h;
+    f->games = (const TTGLRecord *)(h + 1);
+    f->count = h->count;
+    return 1;
+}
+
+void ttt_gl_close(TTGLFile *f) {
+    ttt_mmap_close(&f->map);
+    f->header = NULL;
+    f->games = NULL;
+    f->count = 0;
+}
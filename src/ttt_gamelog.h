@@ -0,0 +1,120 @@
+#ifndef TTT_GAMELOG_H
+#define TTT_GAMELOG_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include "ttt_board.h"
+#include "ttt_binfile.h"
+#include "ttt_mmap.h"
+
+// ============================================
+// Binary Game Log (.ttgl)
+// ============================================
+//
+// Every game played, in 16 bytes, so billions of games can be kept and
+// re-analyzed without simulating them again. A 576-byte header (magic,
+// run seed, game count, checksum, player names) is followed by
+// fixed-width records:
+//
+//   uint64 stream    RNG stream the game was played on (with the header's
+//                    seed this replays it), or its number within the run
+//   uint8  x, o      players, as indices into the header's name table
+//   uint8  info      bits 0-1 result (TTT_X_WINS / TTT_O_WINS / TTT_DRAW,
+//                    0 if the game was cut short), bits 4-7 move count
+//   uint8  moves[5]  the cells played in order, 4 bits each (low nibble
+//                    first), unused nibbles 0xF
+//
+// Little-endian, no padding. The writer is buffered; the reader maps the
+// file, so the records are used in place like the .ttds datasets.
+
+#define TTT_GL_MAGIC "TTGL"
+#define TTT_GL_VERSION 1
+
+#define TTT_GL_MAX_PLAYERS 16
+#define TTT_GL_NAME_LEN 32
+#define TTT_GL_NO_MOVE 0xF
+
+typedef struct {
+    char magic[4];
+    uint16_t version;
+    uint8_t width;
+    uint8_t height;
+    uint32_t record_size;
+    uint32_t num_players;
+    uint64_t seed;
+    uint64_t count;
+    uint32_t checksum;     // FNV-1a over all record bytes
+    uint8_t reserved[28];
+    char players[TTT_GL_MAX_PLAYERS][TTT_GL_NAME_LEN];
+} TTGLHeader;
+
+typedef struct {
+    uint64_t stream;
+    uint8_t x;
+    uint8_t o;
+    uint8_t info;
+    uint8_t moves[5];
+} TTGLRecord;
+
+typedef struct {
+    MappedFile map;
+    const TTGLHeader *header;
+    const TTGLRecord *games;
+    uint64_t count;
+} TTGLFile;
+
+typedef struct {
+    FILE *fp;
+    TTGLHeader header;
+} TTGLWriter;
+
+// Writer: names[i] is player i (at most TTT_GL_MAX_PLAYERS, truncated to
+// TTT_GL_NAME_LEN - 1 chars); the header gets count and checksum on close
+int ttt_gl_writer_open(TTGLWriter *w, const char *filename, uint64_t seed,
+                       const char *const *names, int num_players);
+void ttt_gl_writer_add(TTGLWriter *w, const TTGLRecord *rec);
+int ttt_gl_writer_close(TTGLWriter *w);
+
+// Reader: maps the file and validates header and checksum.
+// Returns 0 (after printing the reason to stderr) on failure.
+int ttt_gl_open(TTGLFile *f, const char *filename);
+void ttt_gl_close(TTGLFile *f);
+
+// Empty record for a game on stream between players x and o
+static inline TTGLRecord ttt_gl_record(uint64_t stream, int x, int o) {
+    TTGLRecord rec = {stream, (uint8_t)x, (uint8_t)o, 0, {0xFF, 0xFF, 0xFF, 0xFF, 0xFF}};
+    return rec;
+}
+
+static inline int ttt_gl_num_moves(const TTGLRecord *rec) { return rec->info >> 4; }
+static inline int ttt_gl_result(const TTGLRecord *rec) { return rec->info & 3; }
+
+static inline int ttt_gl_move(const TTGLRecord *rec, int i) {
+    return (rec->moves[i >> 1] >> ((i & 1) * 4)) & 0xF;
+}
+
+// Appends a move (at most TTT_CELLS per game)
+static inline void ttt_gl_push_move(TTGLRecord *rec, int cell) {
+    int i = ttt_gl_num_moves(rec);
+    if (i >= TTT_CELLS) return;
+    rec->moves[i >> 1] = (uint8_t)((rec->moves[i >> 1] & ~(0xF << ((i & 1) * 4))) |
+                                   (cell << ((i & 1) * 4)));
+    rec->info = (uint8_t)(((i + 1) << 4) | (rec->info & 3));
+}
+
+static inline void ttt_gl_set_result(TTGLRecord *rec, int result) {
+    rec->info = (uint8_t)((rec->info & 0xF0) | (result & 3));
+}
+
+// Position after the first n moves of a game
+static inline Bitboard ttt_gl_board(const TTGLRecord *rec, int n) {
+    Bitboard b = bb_empty_board();
+    for (int i = 0; i < n; i++) bb_toggle(&b, ttt_gl_move(rec, i), (i & 1) ? TTT_SIDE_O : TTT_SIDE_X);
+    return b;
+}
+
+static inline const char *ttt_gl_player(const TTGLFile *f, int index) {
+    return index < (int)f->header->num_players ? f->header->players[index] : "?";
+}
+
+#endif
@@ -0,0 +1,123 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "ttt_index.h"
+
+RankBitvector ttt_legal_codes;
+uint16_t ttt_index_to_code[TTT_NUM_POSITIONS];
+
+static int g_index_ready = 0;
+
+// ============================================
+// Rank/Select Bitvector
+// ============================================
+
+int rbv_init(RankBitvector *bv, size_t nbits) {
+    bv->nbits = nbits;
+    bv->nwords = (nbits + 63) / 64;
+    bv->nblocks = (bv->nwords + RBV_WORDS_PER_BLOCK - 1) / RBV_WORDS_PER_BLOCK;
+    bv->ones = 0;
+    bv->words = (uint64_t *)calloc(bv->nwords, sizeof(uint64_t));
+    bv->block_rank = (uint32_t *)calloc(bv->nblocks + 1, sizeof(uint32_t));
+    if (bv->words == NULL || bv->block_rank == NULL) {
+        rbv_free(bv);
+        return 0;
+    }
+    return 1;
+}
+
+void rbv_free(RankBitvector *bv) {
+    free(bv->words);
+    free(bv->block_rank);
+    bv->words = NULL;
+    bv->block_rank = NULL;
+}
+
+// Recompute the superblock counts after bits were set
+void rbv_build(RankBitvector *bv) {
+    size_t total = 0;
+    for (size_t b = 0; b < bv->nblocks; b++) {
+        bv->block_rank[b] = (uint32_t)total;
+        for (size_t w = b * RBV_WORDS_PER_BLOCK;
+             w < (b + 1) * RBV_WORDS_PER_BLOCK && w < bv->nwords; w++) {
+            total += rbv_popcount64(bv->words[w]);
+        }
+    }
+    bv->block_rank[bv->nblocks] = (uint32_t)total;
+    bv->ones = total;
+}
+
+// Position of the set bit with the given rank (rank < ones)
+size_t rbv_select(const RankBitvector *bv, size_t rank) {
+    // Last superblock whose starting rank is <= rank
+    size_t lo = 0, hi = bv->nblocks;
+    while (hi - lo > 1) {
+        size_t mid = (lo + hi) / 2;
+        if (bv->block_rank[mid] <= rank) lo = mid;
+        else hi = mid;
+    }
+
+    size_t remaining = rank - bv->block_rank[lo];
+    for (size_t w = lo * RBV_WORDS_PER_BLOCK; w < bv->nwords; w++) {
+        uint64_t word = bv->words[w];
+        size_t c = (size_t)rbv_popcount64(word);
+        if (remaining < c) {
+            while (remaining-- > 0) word &= word - 1;
+#if defined(__GNUC__) || defined(__clang__)
+            return w * 64 + (size_t)__builtin_ctzll(word);
+#else
+            size_t bit = 0;
+            while (!((word >> bit) & 1)) bit++;
+            return w * 64 + bit;
+#endif
+        }
+        remaining -= c;
+    }
+    return bv->nbits;
+}
+
+// ============================================
+// Legal Position Index
+// ============================================
+
+// Mark every position reachable from b, stopping at finished games
+static void mark_reachable(Bitboard b) {
+    int code = bb_to_code(b);
+    if (rbv_get(&ttt_legal_codes, (size_t)code)) return;
+    rbv_set(&ttt_legal_codes, (size_t)code);
+
+    if (bb_status(b) != TTT_ONGOING) return;
+
+    int side = bb_side_to_move(b);
+    for (uint16_t m = bb_empty_cells(b); m; m &= m - 1) {
+        Bitboard child = b;
+        bb_toggle(&child, bb_ctz(m), side);
+        mark_reachable(child);
+    }
+}
+
+void ttt_index_init(void) {
+    if (g_index_ready) return;
+
+    if (!rbv_init(&ttt_legal_codes, TTT_NUM_CODES)) {
+        fprintf(stderr, "Error: Memory allocation failed for position index\n");
+        exit(1);
+    }
+
+    mark_reachable(bb_empty_board());
+    rbv_build(&ttt_legal_codes);
+
+    if (ttt_legal_codes.ones != TTT_NUM_POSITIONS) {
+        fprintf(stderr, "Error: Found %zu legal positions (expected %d)\n",
+                ttt_legal_codes.ones, TTT_NUM_POSITIONS);
+        exit(1);
+    }
+
+    int n = 0;
+    for (int code = 0; code < TTT_NUM_CODES; code++) {
+        if (rbv_get(&ttt_legal_codes, (size_t)code)) {
+            ttt_index_to_code[n++] = (uint16_t)code;
+        }
+    }
+
+    g_index_ready = 1;
+}
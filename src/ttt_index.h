@@ -0,0 +1,96 @@
+#ifndef TTT_INDEX_H
+#define TTT_INDEX_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "ttt_board.h"
+
+// ============================================
+// Rank/Select Bitvector
+// ============================================
+//
+// One bit per base-3 code; a set bit marks a legal position.
+// rank(i) = number of set bits before i, which is the dense index
+// of code i. Cumulative counts are kept per 512-bit superblock so
+// the overhead stays at 1/16 of the bitvector, which is what lets
+// the same structure cover 3^16 codes for 4x4 boards.
+
+#define RBV_WORDS_PER_BLOCK 8
+
+typedef struct {
+    uint64_t *words;
+    uint32_t *block_rank;  // set bits before each superblock
+    size_t nbits;
+    size_t nwords;
+    size_t nblocks;
+    size_t ones;           // total set bits (valid after rbv_build)
+} RankBitvector;
+
+int rbv_init(RankBitvector *bv, size_t nbits);
+void rbv_free(RankBitvector *bv);
+void rbv_build(RankBitvector *bv);
+size_t rbv_select(const RankBitvector *bv, size_t rank);
+
+static inline void rbv_set(RankBitvector *bv, size_t i) {
+    bv->words[i >> 6] |= (uint64_t)1 << (i & 63);
+}
+
+static inline int rbv_get(const RankBitvector *bv, size_t i) {
+    return (int)((bv->words[i >> 6] >> (i & 63)) & 1);
+}
+
+static inline int rbv_popcount64(uint64_t w) {
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_popcountll(w);
+#else
+    int c = 0;
+    while (w) { w &= w - 1; c++; }
+    return c;
+#endif
+}
+
+static inline size_t rbv_rank(const RankBitvector *bv, size_t i) {
+    size_t word = i >> 6;
+    size_t r = bv->block_rank[word / RBV_WORDS_PER_BLOCK];
+    for (size_t w = word & ~(size_t)(RBV_WORDS_PER_BLOCK - 1); w < word; w++) {
+        r += rbv_popcount64(bv->words[w]);
+    }
+    uint64_t below = ((uint64_t)1 << (i & 63)) - 1;
+    return r + rbv_popcount64(bv->words[word] & below);
+}
+
+// ============================================
+// Dense Index of Legal Tic-Tac-Toe Positions
+// ============================================
+//
+// Maps every position reachable from the empty board (terminal
+// positions included) to 0..TTT_NUM_POSITIONS-1 in increasing
+// base-3 code order, so per-position tables can be flat arrays.
+
+#define TTT_NUM_POSITIONS 5478
+
+extern RankBitvector ttt_legal_codes;
+extern uint16_t ttt_index_to_code[TTT_NUM_POSITIONS];
+
+// Builds the tables on first call; later calls return immediately
+void ttt_index_init(void);
+
+// Dense index of a base-3 code, or -1 if the position is unreachable
+static inline int ttt_index_of_code(int code) {
+    if (!rbv_get(&ttt_legal_codes, (size_t)code)) return -1;
+    return (int)rbv_rank(&ttt_legal_codes, (size_t)code);
+}
+
+static inline int ttt_index_of(Bitboard b) {
+    return ttt_index_of_code(bb_to_code(b));
+}
+
+static inline int ttt_index_code(int index) {
+    return ttt_index_to_code[index];
+}
+
+static inline Bitboard ttt_index_board(int index) {
+    return bb_from_code(ttt_index_to_code[index]);
+}
+
+#endif
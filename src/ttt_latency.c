@@ -0,0 +1,41 @@
+#include <stdio.h>
+#include "ttt_latency.h"
+
+void ttt_latency_merge(TTTLatency *into, const TTTLatency *from) {
+    into->count += from->count;
+    into->total_ns += from->total_ns;
+    if (from->max_ns > into->max_ns) into->max_ns = from->max_ns;
+    for (int i = 0; i < TTT_LAT_BUCKETS; i++) into->bucket[i] += from->bucket[i];
+}
+
+// Largest value that falls into bucket i
+static uint64_t bucket_upper(int i) {
+    if (i < TTT_LAT_SUB) return (uint64_t)i;
+    int exp = i / TTT_LAT_SUB + TTT_LAT_SUB_BITS - 1;
+    uint64_t sub = (uint64_t)(i % TTT_LAT_SUB);
+    return ((TTT_LAT_SUB + sub + 1) << (exp - TTT_LAT_SUB_BITS)) - 1;
+}
+
+uint64_t ttt_latency_quantile(const TTTLatency *h, double q) {
+    if (h->count == 0) return 0;
+    uint64_t rank = (uint64_t)(q * h->count + 0.5);
+    if (rank < 1) rank = 1;
+    if (rank > h->count) rank = h->count;
+
+    uint64_t seen = 0;
+    for (int i = 0; i < TTT_LAT_BUCKETS; i++) {
+        seen += h->bucket[i];
+        if (seen >= rank) {
+            uint64_t upper = bucket_upper(i);
+            return upper < h->max_ns ? upper : h->max_ns;
+        }
+    }
+    return h->max_ns;
+}
+
+void ttt_latency_format(uint64_t ns, char *buf, int size) {
+    if (ns < 1000) snprintf(buf, size, "%lluns", (unsigned long long)ns);
+    else if (ns < 1000000) snprintf(buf, size, "%.1fus", ns / 1e3);
+    else if (ns < 1000000000) snprintf(buf, size, "%.2fms", ns / 1e6);
+    else snprintf(buf, size, "%.2fs", ns / 1e9);
+}
@@ -0,0 +1,58 @@
+#ifndef TTT_LATENCY_H
+#define TTT_LATENCY_H
+
+#include <stdint.h>
+
+// ============================================
+// Latency Histogram
+// ============================================
+//
+// Log-linear buckets (as in HdrHistogram): every power of two is split
+// into 8 equal buckets, so any recorded value is known to within 12.5%
+// with a fixed 2.5 KB of counters and no allocation. Recording is a few
+// instructions; histograms from different threads are merged by adding.
+//
+// Exact below 8 ns; values beyond ~18 minutes land in the last bucket.
+
+#define TTT_LAT_SUB_BITS 3
+#define TTT_LAT_SUB (1 << TTT_LAT_SUB_BITS)
+#define TTT_LAT_MAX_EXP 40
+#define TTT_LAT_BUCKETS ((TTT_LAT_MAX_EXP - TTT_LAT_SUB_BITS + 2) * TTT_LAT_SUB)
+
+typedef struct {
+    uint64_t count;
+    uint64_t total_ns;
+    uint64_t max_ns;
+    uint64_t bucket[TTT_LAT_BUCKETS];
+} TTTLatency;
+
+static inline int ttt_latency_bucket(uint64_t ns) {
+    if (ns < TTT_LAT_SUB) return (int)ns;
+#if defined(__GNUC__) || defined(__clang__)
+    int exp = 63 - __builtin_clzll(ns);
+#else
+    int exp = TTT_LAT_SUB_BITS;
+    while (ns >> (exp + 1)) exp++;
+#endif
+    if (exp > TTT_LAT_MAX_EXP) return TTT_LAT_BUCKETS - 1;
+    int sub = (int)(ns >> (exp - TTT_LAT_SUB_BITS)) & (TTT_LAT_SUB - 1);
+    return (exp - TTT_LAT_SUB_BITS + 1) * TTT_LAT_SUB + sub;
+}
+
+static inline void ttt_latency_record(TTTLatency *h, uint64_t ns) {
+    h->count++;
+    h->total_ns += ns;
+    if (ns > h->max_ns) h->max_ns = ns;
+    h->bucket[ttt_latency_bucket(ns)]++;
+}
+
+void ttt_latency_merge(TTTLatency *into, const TTTLatency *from);
+
+// Value at quantile q (0.5 = median): the upper edge of the bucket
+// holding that sample, capped at the largest value recorded; 0 if empty
+uint64_t ttt_latency_quantile(const TTTLatency *h, double q);
+
+// Writes ns as "850ns", "12.3us", "4.56ms" or "1.20s"
+void ttt_latency_format(uint64_t ns, char *buf, int size);
+
+#endif
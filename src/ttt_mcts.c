@@ -0,0 +1,324 @@
+#include <math.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ttt_mcts.h"
+#include "ttt_board.h"
+#include "ttt_clock.h"
+#include "ttt_thread.h"
+
+#define CLOCK_CHECK_EVERY 64  // playouts between deadline checks
+
+// ============================================
+// Rules
+// ============================================
+
+int ttt_mcts_rules(TTTMctsRules *r, int width, int height, int k) {
+    if (width < 1 || height < 1 || width * height > TTT_MCTS_MAX_CELLS) return 0;
+    if (k < 1 || (k > width && k > height)) return 0;
+
+    memset(r, 0, sizeof(*r));
+    r->width = width;
+    r->height = height;
+    r->k = k;
+    r->cells = width * height;
+    r->full = (r->cells == 32) ? 0xFFFFFFFFu : ((1u << r->cells) - 1);
+
+    // Right, down, down-right, down-left
+    r->shift[0] = 1;
+    r->shift[1] = width;
+    r->shift[2] = width + 1;
+    r->shift[3] = width - 1;
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; x < width; x++) {
+            uint32_t bit = 1u << (y * width + x);
+            int fits_right = x + k <= width, fits_left = x - k + 1 >= 0, fits_down = y + k <= height;
+            if (fits_right) r->start[0] |= bit;
+            if (fits_down) r->start[1] |= bit;
+            if (fits_right && fits_down) r->start[2] |= bit;
+            if (fits_left && fits_down) r->start[3] |= bit;
+        }
+    }
+    return 1;
+}
+
+// K in a row within mask: AND the mask with itself shifted along each
+// direction, so a bit survives only where a full line starts
+static inline int has_line(const TTTMctsRules *r, uint32_t mask) {
+    for (int d = 0; d < 4; d++) {
+        uint32_t t = mask & r->start[d];
+        for (int i = 1; i < r->k && t; i++) t &= mask >> (r->shift[d] * i);
+        if (t) return 1;
+    }
+    return 0;
+}
+
+int ttt_mcts_status(const TTTMctsRules *r, uint32_t x, uint32_t o) {
+    if (has_line(r, x)) return TTT_MCTS_X_WINS;
+    if (has_line(r, o)) return TTT_MCTS_O_WINS;
+    if ((x | o) == r->full) return TTT_MCTS_DRAW;
+    return TTT_MCTS_ONGOING;
+}
+
+static inline int x_to_move(uint32_t x, uint32_t o) {
+    return bb_popcount(x) == bb_popcount(o);
+}
+
+// Status after the side that just moved (mover_x) made mask `mover`
+static inline int status_after(const TTTMctsRules *r, uint32_t mover, int mover_x, uint32_t all) {
+    if (has_line(r, mover)) return mover_x ? TTT_MCTS_X_WINS : TTT_MCTS_O_WINS;
+    return all == r->full ? TTT_MCTS_DRAW : TTT_MCTS_ONGOING;
+}
+
+// ============================================
+// Engine
+// ============================================
+
+void ttt_mcts_default_config(TTTMctsConfig *c) {
+    c->playouts = 1000;
+    c->ms = 0;
+    c->exploration = 1.4;
+    c->trees = 1;
+    c->threads = 1;
+    c->nodes = 1 << 16;
+    c->reuse = 1;
+}
+
+int ttt_mcts_init(TTTMcts *m, const TTTMctsRules *rules, const TTTMctsConfig *config) {
+    memset(m, 0, sizeof(*m));
+    if (config->playouts <= 0 && config->ms <= 0) return 0;
+    if (config->trees < 1 || config->nodes < rules->cells + 1) return 0;
+
+    m->rules = *rules;
+    m->config = *config;
+    m->trees = calloc((size_t)config->trees, sizeof(TTTMctsTree));
+    if (!m->trees) return 0;
+    for (int i = 0; i < config->trees; i++) {
+        TTTMctsTree *t = &m->trees[i];
+        t->nodes = malloc((size_t)config->nodes * sizeof(TTTMctsNode));
+        t->spare = malloc((size_t)config->nodes * sizeof(TTTMctsNode));
+        if (!t->nodes || !t->spare) {
+            ttt_mcts_free(m);
+            return 0;
+        }
+    }
+    return 1;
+}
+
+void ttt_mcts_free(TTTMcts *m) {
+    if (m->trees) {
+        for (int i = 0; i < m->config.trees; i++) {
+            free(m->trees[i].nodes);
+            free(m->trees[i].spare);
+        }
+        free(m->trees);
+    }
+    m->trees = NULL;
+}
+
+void ttt_mcts_clear(TTTMcts *m) {
+    for (int i = 0; i < m->config.trees; i++) m->trees[i].used = 0;
+}
+
+static void reset_tree(TTTMctsTree *t, const TTTMctsRules *r, uint32_t x, uint32_t o) {
+    TTTMctsNode *root = &t->nodes[0];
+    memset(root, 0, sizeof(*root));
+    root->first_child = -1;
+    root->status = (uint8_t)ttt_mcts_status(r, x, o);
+    t->used = 1;
+    t->x = x;
+    t->o = o;
+}
+
+// Makes (x, o) the root. If the old tree already holds that position
+// (the stones added since alternate sides, one per ply), its subtree
+// is copied breadth-first to the front of the spare pool, which keeps
+// every child block contiguous; otherwise the tree starts over.
+static void advance_root(TTTMctsTree *t, const TTTMctsRules *r, uint32_t x, uint32_t o, int reuse) {
+    if (!reuse || t->used == 0 || (t->x & ~x) || (t->o & ~o)) {
+        reset_tree(t, r, x, o);
+        return;
+    }
+
+    int idx = 0;
+    uint32_t cx = t->x, co = t->o;
+    while (cx != x || co != o) {
+        int mover_x = x_to_move(cx, co);
+        uint32_t added = mover_x ? (x & ~cx) : (o & ~co);
+        const TTTMctsNode *node = &t->nodes[idx];
+        if (bb_popcount(added) != 1 || node->first_child < 0) {
+            reset_tree(t, r, x, o);
+            return;
+        }
+        idx = node->first_child;
+        while (t->nodes[idx].move != bb_ctz(added)) idx++;  // the cell is empty, so it has a child
+        if (mover_x) cx |= added;
+        else co |= added;
+    }
+    if (idx == 0) return;
+
+    t->spare[0] = t->nodes[idx];
+    int used = 1;
+    for (int i = 0; i < used; i++) {
+        TTTMctsNode *node = &t->spare[i];
+        if (node->first_child < 0) continue;
+        memcpy(&t->spare[used], &t->nodes[node->first_child],
+               node->num_children * sizeof(TTTMctsNode));
+        node->first_child = used;
+        used += node->num_children;
+    }
+
+    TTTMctsNode *swap = t->nodes;
+    t->nodes = t->spare;
+    t->spare = swap;
+    t->used = used;
+    t->x = x;
+    t->o = o;
+}
+
+// Adds a child for every empty cell of the node; 0 if the pool is full
+static int expand(TTTMctsTree *t, const TTTMctsRules *r, int capacity, int idx,
+                  uint32_t x, uint32_t o) {
+    uint32_t empty = r->full & ~(x | o);
+    int n = bb_popcount(empty);
+    if (t->used + n > capacity) return 0;
+
+    int mover_x = x_to_move(x, o);
+    TTTMctsNode *child = &t->nodes[t->used];
+    t->nodes[idx].first_child = t->used;
+    t->nodes[idx].num_children = (uint8_t)n;
+    t->used += n;
+    for (uint32_t m = empty; m; m &= m - 1, child++) {
+        uint32_t bit = m & -m;
+        memset(child, 0, sizeof(*child));
+        child->first_child = -1;
+        child->move = (uint8_t)bb_ctz(bit);
+        child->status = (uint8_t)status_after(r, (mover_x ? x : o) | bit, mover_x, x | o | bit);
+    }
+    return 1;
+}
+
+// Uniformly random moves to the end of the game
+static int playout(TTTMctsTree *t, const TTTMctsRules *r, uint32_t x, uint32_t o) {
+    int mover_x = x_to_move(x, o);
+    for (;;) {
+        uint32_t empty = r->full & ~(x | o);
+        uint32_t bit = 1u << bb_select(empty, (int)ttt_rng_below(&t->rng, (uint32_t)bb_popcount(empty)));
+        if (mover_x) x |= bit;
+        else o |= bit;
+        int status = status_after(r, mover_x ? x : o, mover_x, x | o);
+        if (status != TTT_MCTS_ONGOING) return status;
+        mover_x = !mover_x;
+    }
+}
+
+// Unvisited children first (lowest cell first), then the highest UCT
+// value; ties keep the lower cell
+static int select_child(const TTTMctsTree *t, const TTTMctsNode *node, double exploration) {
+    double log_n = log((double)node->visits);
+    int best = -1;
+    double best_value = -1.0;
+    for (int i = 0; i < node->num_children; i++) {
+        const TTTMctsNode *c = &t->nodes[node->first_child + i];
+        if (c->visits == 0) return node->first_child + i;
+        double value = c->score / (2.0 * c->visits) + exploration * sqrt(log_n / c->visits);
+        if (value > best_value) {
+            best_value = value;
+            best = node->first_child + i;
+        }
+    }
+    return best;
+}
+
+// One selection / expansion / playout / backpropagation step
+static void search_once(TTTMctsTree *t, const TTTMctsRules *r, const TTTMctsConfig *c) {
+    int path[TTT_MCTS_MAX_CELLS + 2];
+    int depth = 0, idx = 0;
+    uint32_t x = t->x, o = t->o;
+    int result;
+
+    path[depth++] = 0;
+    for (;;) {
+        TTTMctsNode *node = &t->nodes[idx];
+        if (node->status != TTT_MCTS_ONGOING) {
+            result = node->status;
+            break;
+        }
+        if (node->first_child < 0) {
+            // A leaf is expanded on its second visit (the root at once)
+            if ((node->visits == 0 && idx != 0) || !expand(t, r, c->nodes, idx, x, o)) {
+                result = playout(t, r, x, o);
+                break;
+            }
+        }
+        idx = select_child(t, node, c->exploration);
+        if (x_to_move(x, o)) x |= 1u << t->nodes[idx].move;
+        else o |= 1u << t->nodes[idx].move;
+        path[depth++] = idx;
+    }
+
+    // A node's score belongs to the side that moved into it
+    int moved_x = !x_to_move(t->x, t->o);
+    for (int i = 0; i < depth; i++, moved_x = !moved_x) {
+        TTTMctsNode *node = &t->nodes[path[i]];
+        node->visits++;
+        if (result == TTT_MCTS_DRAW) node->score += 1;
+        else if ((result == TTT_MCTS_X_WINS) == moved_x) node->score += 2;
+    }
+}
+
+typedef struct {
+    TTTMcts *m;
+    uint32_t x, o;
+    uint64_t seed;
+    uint64_t deadline;  // ttt_clock_ns(); 0 = none
+} SearchJob;
+
+static void search_trees(size_t begin, size_t end, void *ctx) {
+    SearchJob *job = (SearchJob *)ctx;
+    TTTMcts *m = job->m;
+    for (size_t i = begin; i < end; i++) {
+        TTTMctsTree *t = &m->trees[i];
+        advance_root(t, &m->rules, job->x, job->o, m->config.reuse);
+        ttt_rng_seed_stream(&t->rng, job->seed, i);
+        t->playouts = 0;
+        // At least one playout, so the root always has a visited child
+        do {
+            search_once(t, &m->rules, &m->config);
+            t->playouts++;
+            if (job->deadline && t->playouts % CLOCK_CHECK_EVERY == 0 &&
+                ttt_clock_ns() >= job->deadline) break;
+        } while (m->config.playouts <= 0 || t->playouts < (uint64_t)m->config.playouts);
+    }
+}
+
+int ttt_mcts_search(TTTMcts *m, uint32_t x, uint32_t o, uint64_t seed) {
+    if (ttt_mcts_status(&m->rules, x, o) != TTT_MCTS_ONGOING) return -1;
+
+    SearchJob job = {m, x, o, seed, 0};
+    if (m->config.ms > 0) job.deadline = ttt_clock_ns() + (uint64_t)(m->config.ms * 1e6);
+    ttt_parallel_for((size_t)m->config.trees, m->config.threads, search_trees, &job);
+
+    // Deterministic merge: integer sums over the trees in order
+    uint64_t score[TTT_MCTS_MAX_CELLS] = {0};
+    memset(m->visits, 0, sizeof(m->visits));
+    m->playouts = m->reused = 0;
+    for (int i = 0; i < m->config.trees; i++) {
+        const TTTMctsTree *t = &m->trees[i];
+        const TTTMctsNode *root = &t->nodes[0];
+        m->playouts += t->playouts;
+        m->reused += root->visits - t->playouts;  // every playout visits the root once
+        for (int j = 0; j < root->num_children && root->first_child >= 0; j++) {
+            const TTTMctsNode *c = &t->nodes[root->first_child + j];
+            m->visits[c->move] += c->visits;
+            score[c->move] += c->score;
+        }
+    }
+    int best = -1;
+    for (int cell = 0; cell < m->rules.cells; cell++) {
+        if (m->visits[cell] == 0) continue;
+        if (best < 0 || m->visits[cell] > m->visits[best] ||
+            (m->visits[cell] == m->visits[best] && score[cell] > score[best])) best = cell;
+    }
+    m->value = score[best] / (2.0 * m->visits[best]);
+    return best;
+}
@@ -0,0 +1,106 @@
+#ifndef TTT_MCTS_H
+#define TTT_MCTS_H
+
+#include <stdint.h>
+#include "ttt_rng.h"
+
+// ============================================
+// Monte Carlo Tree Search
+// ============================================
+//
+// UCT search with random playouts on a W x H board where K in a row
+// wins (tic-tac-toe is 3, 3, 3; boards up to 32 cells). A position is
+// two cell masks, X and O, with cell i = row * W + column, so a 3x3
+// Bitboard converts directly.
+//
+// Nodes live in a pool allocated once per tree; a node's children are
+// one contiguous block, allocated when the node is expanded. When the
+// pool is full the search goes on without expanding. Between moves the
+// subtree of the new position is kept and copied to the front of a
+// second pool, so earlier playouts count towards the next move.
+//
+// Root parallelism: config.trees independent trees search the same
+// position, each with its own random stream, and their root visit
+// counts are summed. The streams depend on the seed and the tree
+// number only, so a playout budget gives the same move on any thread
+// count. A time budget makes the result depend on the machine.
+
+#define TTT_MCTS_MAX_CELLS 32
+
+typedef struct {
+    int width, height, k;
+    int cells;
+    uint32_t full;         // mask of all cells
+    int shift[4];          // cell step of each line direction
+    uint32_t start[4];     // cells a line of that direction can start on
+} TTTMctsRules;
+
+typedef struct {
+    int playouts;          // per tree and move; 0 = no limit (needs ms)
+    double ms;             // time budget per move; 0 = no limit
+    double exploration;    // UCT constant
+    int trees;             // root-parallel trees
+    int threads;           // threads for the trees; <= 0 = all cores
+    int nodes;             // pool size per tree
+    int reuse;             // keep the subtree between moves
+} TTTMctsConfig;
+
+// 16 bytes; the position is not stored, it follows from the path
+typedef struct {
+    int32_t first_child;   // index of the child block, -1 = not expanded
+    uint32_t visits;
+    uint32_t score;        // 2 per win, 1 per draw for the side that moved here
+    uint8_t num_children;
+    uint8_t move;          // cell played to reach this node
+    uint8_t status;        // TTT_MCTS_* once known to be terminal
+    uint8_t pad;
+} TTTMctsNode;
+
+typedef struct {
+    TTTMctsNode *nodes;    // nodes[0] is the root
+    TTTMctsNode *spare;    // target of the subtree copy
+    int used;
+    uint32_t x, o;         // root position
+    TTTRng rng;
+    uint64_t playouts;     // in the last search
+} TTTMctsTree;
+
+typedef struct {
+    TTTMctsRules rules;
+    TTTMctsConfig config;
+    TTTMctsTree *trees;
+    // Last search
+    uint64_t visits[TTT_MCTS_MAX_CELLS];  // root visits per move, all trees
+    uint64_t playouts;                    // new playouts, all trees
+    uint64_t reused;                      // root visits carried over
+    double value;                         // mover's expected score (0-1)
+} TTTMcts;
+
+#define TTT_MCTS_ONGOING 0
+#define TTT_MCTS_X_WINS  1
+#define TTT_MCTS_O_WINS  2
+#define TTT_MCTS_DRAW    3
+
+// Returns 0 unless 1 <= k <= max(width, height) and the board has at
+// most TTT_MCTS_MAX_CELLS cells
+int ttt_mcts_rules(TTTMctsRules *r, int width, int height, int k);
+
+// 1000 playouts, 1 tree, 1 thread, exploration 1.4, 2^16 nodes, reuse on
+void ttt_mcts_default_config(TTTMctsConfig *c);
+
+// Returns 0 on allocation failure or a config without a budget
+int ttt_mcts_init(TTTMcts *m, const TTTMctsRules *rules, const TTTMctsConfig *config);
+void ttt_mcts_free(TTTMcts *m);
+
+// Forget all trees (the next search starts from scratch)
+void ttt_mcts_clear(TTTMcts *m);
+
+// Move for the side to move in (x, o): the most visited root move over
+// all trees, ties to the higher score, then the lower cell. -1 if the
+// game is over. seed selects the random streams of this search.
+int ttt_mcts_search(TTTMcts *m, uint32_t x, uint32_t o, uint64_t seed);
+
+// TTT_MCTS_* of a position
+int ttt_mcts_status(const TTTMctsRules *r, uint32_t x, uint32_t o);
+
+#endif
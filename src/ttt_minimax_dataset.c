@@ -2,12 +2,28 @@
 #include <stdint.h>
 #include <stdbool.h>
 #include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "ttt_index.h"
+#include "ttt_symmetry.h"
+#include "ttt_thread.h"
+#include "ttt_movetable.h"
+#include "ttt_sink.h"
 
-#define NSTATE 19683  // 3^9
+#define UNKNOWN 2
 
-static int8_t outcome_cache[NSTATE];   // -1,0,+1 outcomes; 2 = unknown
-static int8_t bestmove_cache[NSTATE];  // 0..8 or -1
+// Indexed by dense position index (ttt_index.h), not by base-3 code
+static int8_t outcome_cache[TTT_NUM_POSITIONS];   // -1,0,+1 outcomes; UNKNOWN = not solved
+static int8_t bestmove_cache[TTT_NUM_POSITIONS];  // 0..8 or -1
 static int pow3[10];
+static bool canonical_only = false;  // solve/emit one representative per symmetry class
+static int nthreads = 0;             // retrograde workers; 0 = one per CPU
+
+// Retrograde engine: dense indices grouped by piece count (layer L holds
+// layer_idx[layer_start[L] .. layer_start[L+1]-1])
+static uint16_t layer_idx[TTT_NUM_POSITIONS];
+static int layer_start[TTT_CELLS + 2];
+static int layer_count;              // positions in the layers (fewer with --canonical)
 
 static inline int cell(int s, int i){ return (s / pow3[i]) % 3; }               // 0 empty,1 X,2 O
 static inline int setcell(int s, int i, int v){ return s + (v - cell(s,i)) * pow3[i]; }
@@ -42,28 +58,30 @@ static bool legal_and_turn(int s, int *turn){ // turn: 1=X, 2=O, 0=terminal
   return true;
 }
 
-// Minimax from perspective of current player; memoized
+// Minimax (negamax) from perspective of current player; memoized.
+// With canonical_only, s is canonical and every child is folded onto its
+// canonical form, so only ~765 positions are ever solved and best moves
+// are in the canonical board's frame.
 static int minimax(int s){
-  if(outcome_cache[s] != 2) return outcome_cache[s];
+  int idx = ttt_index_of_code(s);
+  if(idx < 0) return 0;                 // unreachable; never a child of a legal state
+  if(outcome_cache[idx] != UNKNOWN) return outcome_cache[idx];
 
-  int turn;
-  if(!legal_and_turn(s, &turn)){
-    outcome_cache[s]=0; bestmove_cache[s]=-1; return 0; // shouldn't happen if filtered
-  }
+  // A finished game is lost for the player who would move next
+  if(winner(s)!=0){ outcome_cache[idx]=-1; bestmove_cache[idx]=-1; return -1; }
+  if(full(s)){ outcome_cache[idx]=0; bestmove_cache[idx]=-1; return 0; }
 
-  int w = winner(s);
-  if(w==1){ outcome_cache[s]=+1; bestmove_cache[s]=-1; return +1; }
-  if(w==2){ outcome_cache[s]=-1; bestmove_cache[s]=-1; return -1; }
-  if(full(s)){ outcome_cache[s]=0; bestmove_cache[s]=-1; return 0; }
+  int turn;
+  legal_and_turn(s, &turn);
 
-  int bestScore = (turn==1 ? -2 : +2);
+  int bestScore = -2;
   int bestMove  = -1;
 
   for(int i=0;i<9;i++){
     if(cell(s,i)!=0) continue;
     int child = setcell(s,i,turn);
-    int sc = minimax(child);            // child's score from child's current player
-    if(turn==2) sc = -sc;               // flip so it's from *this* current player's perspective
+    if(canonical_only) child = ttt_canon_code[child];
+    int sc = -minimax(child);           // child's score is from the opponent's perspective
 
     if(sc > bestScore){
       bestScore = sc;
@@ -72,52 +90,248 @@ static int minimax(int s){
     }
   }
 
-  outcome_cache[s] = bestScore;
-  bestmove_cache[s] = bestMove;
+  outcome_cache[idx] = bestScore;
+  bestmove_cache[idx] = bestMove;
   return bestScore;
 }
 
-static void board_string(int s, char* out){ // 10 bytes including '\0'
-  for(int i=0;i<9;i++){
-    int v=cell(s,i);
-    out[i] = (v==0?'_': (v==1?'X':'O'));
+// ============================================
+// Retrograde (backward induction) engine
+// ============================================
+// Terminal positions are labeled first, then values are pulled back one
+// piece-count layer at a time: every child of a layer-L position lies in
+// layer L+1, so a layer only reads finished results and its positions are
+// independent of each other. Each layer is split across threads.
+// Moves are scanned in the same order with the same tie-breaking as
+// minimax(), so both engines fill identical caches.
+
+static void build_layers(void){
+  int count[TTT_CELLS + 1] = {0};
+  for(int idx=0;idx<TTT_NUM_POSITIONS;idx++){
+    if(canonical_only && !ttt_sym_is_canonical(ttt_index_code(idx))) continue;
+    Bitboard b = ttt_index_board(idx);
+    count[bb_popcount(b.x | b.o)]++;
+  }
+  layer_start[0] = 0;
+  for(int L=0;L<=TTT_CELLS;L++) layer_start[L+1] = layer_start[L] + count[L];
+  layer_count = layer_start[TTT_CELLS + 1];
+
+  int fill[TTT_CELLS + 1];
+  memcpy(fill, layer_start, sizeof(fill));
+  for(int idx=0;idx<TTT_NUM_POSITIONS;idx++){     // ascending idx within each layer
+    if(canonical_only && !ttt_sym_is_canonical(ttt_index_code(idx))) continue;
+    Bitboard b = ttt_index_board(idx);
+    layer_idx[fill[bb_popcount(b.x | b.o)]++] = (uint16_t)idx;
+  }
+}
+
+static void retro_label_terminals(void){
+  for(int k=0;k<layer_count;k++){
+    int idx = layer_idx[k];
+    int st = bb_status(ttt_index_board(idx));
+    if(st == TTT_ONGOING) continue;
+    outcome_cache[idx]  = (st == TTT_DRAW) ? 0 : -1;   // last mover won, else draw
+    bestmove_cache[idx] = -1;
+  }
+}
+
+// Solve layer_idx[layer_start[L] + begin .. end) from layer L+1
+static void retro_solve_range(size_t begin, size_t end, void *ctx){
+  const uint16_t *ids = layer_idx + layer_start[*(const int *)ctx];
+  for(size_t k=begin;k<end;k++){
+    int idx = ids[k];
+    if(outcome_cache[idx] != UNKNOWN) continue;    // terminal
+
+    Bitboard b = ttt_index_board(idx);
+    int side = bb_side_to_move(b);
+    int bestScore = -2;
+    int bestMove  = -1;
+
+    for(uint16_t m=bb_empty_cells(b); m; m&=m-1){
+      int i = bb_ctz(m);
+      Bitboard child = b;
+      bb_toggle(&child, i, side);
+      int c = bb_to_code(child);
+      if(canonical_only) c = ttt_canon_code[c];
+      int sc = -outcome_cache[ttt_index_of_code(c)];
+
+      if(sc > bestScore){
+        bestScore = sc;
+        bestMove  = i;
+        if(bestScore==+1) break;
+      }
+    }
+
+    outcome_cache[idx] = (int8_t)bestScore;
+    bestmove_cache[idx] = (int8_t)bestMove;
+  }
+}
+
+static void solve_retrograde(void){
+  build_layers();
+  retro_label_terminals();
+  for(int L=TTT_CELLS-1; L>=0; L--){
+    size_t n = (size_t)(layer_start[L+1] - layer_start[L]);
+    ttt_parallel_for(n, nthreads, retro_solve_range, &L);
+  }
+}
+
+static void solve_recursive(void){
+  for(int idx=0;idx<TTT_NUM_POSITIONS;idx++){
+    int s = ttt_index_code(idx), turn;
+    if(canonical_only && !ttt_sym_is_canonical(s)) continue;
+    legal_and_turn(s,&turn);
+    if(turn != 0) minimax(s); // only compute for non-terminal states
   }
-  out[9]='\0';
+}
+
+static void reset_caches(void){
+  for(int i=0;i<TTT_NUM_POSITIONS;i++){ outcome_cache[i]=UNKNOWN; bestmove_cache[i]=-1; }
+}
+
+static double wall_seconds(void){
+  struct timespec ts;
+  timespec_get(&ts, TIME_UTC);
+  return (double)ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+// Time both engines and check they agree entry for entry
+static int run_benchmark(int reps){
+  static int8_t rec_outcome[TTT_NUM_POSITIONS], rec_move[TTT_NUM_POSITIONS];
+  double t0 = wall_seconds();
+  for(int r=0;r<reps;r++){ reset_caches(); solve_recursive(); }
+  double t_rec = (wall_seconds() - t0) / reps;
+  memcpy(rec_outcome, outcome_cache, sizeof(rec_outcome));
+  memcpy(rec_move, bestmove_cache, sizeof(rec_move));
+
+  t0 = wall_seconds();
+  for(int r=0;r<reps;r++){ reset_caches(); solve_retrograde(); }
+  double t_retro = (wall_seconds() - t0) / reps;
+
+  // minimax() never visits terminal children skipped by its win cutoff,
+  // so retrograde labels a superset; every entry both engines have must match
+  bool same = true;
+  int extra = 0;
+  for(int i=0;i<TTT_NUM_POSITIONS;i++){
+    if(rec_outcome[i] == UNKNOWN){ extra += (outcome_cache[i] != UNKNOWN); continue; }
+    if(rec_outcome[i] != outcome_cache[i] || rec_move[i] != bestmove_cache[i]) same = false;
+  }
+
+  printf("3x3%s, %d positions, %d reps\n", canonical_only ? " (canonical)" : "", layer_count, reps);
+  printf("  recursive  : %8.3f ms/solve\n", t_rec * 1e3);
+  printf("  retrograde : %8.3f ms/solve (%d threads)\n", t_retro * 1e3,
+         nthreads > 0 ? nthreads : ttt_cpu_count());
+  printf("  caches %s (%d terminal positions only labeled by retrograde)\n",
+         same ? "identical" : "DIFFER", extra);
+  return same ? 0 : 1;
+}
+
+static void usage(const char *prog){
+  fprintf(stderr, "Usage: %s [--canonical] [--engine recursive|retro] [--threads N] [--bench [reps]] [--movetable file]\n"
+                  "       [--out [data|state|csv|bin:]path]... [--bin] [outfile]\n", prog);
 }
 
 int main(int argc, char** argv){
-  const char* outname = (argc >= 2 ? argv[1] : "ttt_dataset.data");
-  FILE* fp = fopen(outname, "w");
-  if(!fp){
-    fprintf(stderr, "Error: cannot open output file '%s'\n", outname);
-    return 1;
+  const char* outname = NULL;
+  bool binary = false;
+  TTTSinkSet sinks;
+  ttt_sinks_init(&sinks);
+  bool retro = false;
+  int bench_reps = 0;
+  const char* movetable_name = NULL;
+  for(int a=1;a<argc;a++){
+    if(strcmp(argv[a], "--canonical")==0) canonical_only = true;
+    else if(strcmp(argv[a], "--engine")==0 && a+1<argc){
+      a++;
+      if(strcmp(argv[a], "retro")==0) retro = true;
+      else if(strcmp(argv[a], "recursive")==0) retro = false;
+      else { usage(argv[0]); return 1; }
+    }
+    else if(strcmp(argv[a], "--threads")==0 && a+1<argc) nthreads = atoi(argv[++a]);
+    else if(strcmp(argv[a], "--bench")==0){
+      bench_reps = 200;
+      if(a+1<argc && atoi(argv[a+1])>0) bench_reps = atoi(argv[++a]);
+    }
+    else if(strcmp(argv[a], "--movetable")==0 && a+1<argc) movetable_name = argv[++a];
+    else if(strcmp(argv[a], "--bin")==0) binary = true;
+    else if(strcmp(argv[a], "--out")==0 && a+1<argc){
+      if(!ttt_sinks_add(&sinks, argv[++a], TTT_SINK_STATE)) return 1;
+    }
+    else if(argv[a][0]=='-'){ usage(argv[0]); return 1; }
+    else outname = argv[a];
   }
 
-  // init pow3 and caches
+  // init pow3, position index and caches
   pow3[0]=1; for(int i=1;i<10;i++) pow3[i]=pow3[i-1]*3;
-  for(int i=0;i<NSTATE;i++){ outcome_cache[i]=2; bestmove_cache[i]=-1; }
+  ttt_index_init();
+  ttt_sym_init();
+  build_layers();
 
-  // Solve all legal states (memoization makes this fast)
-  for(int s=0;s<NSTATE;s++){
-    int turn;
-    if(!legal_and_turn(s,&turn)) continue;
-    if(turn != 0) minimax(s); // only compute for non-terminal states
+  if(bench_reps > 0) return run_benchmark(bench_reps);
+
+  // The positional outfile (or the default) is one more sink
+  if(outname || sinks.count == 0){
+    if(!outname) outname = binary ? "ttt_dataset.ttds" : "ttt_dataset.data";
+    if(binary){
+      static char spec[512];
+      snprintf(spec, sizeof(spec), "bin:%s", outname);
+      outname = spec;
+    }
+    if(!ttt_sinks_add(&sinks, outname, TTT_SINK_STATE)) return 1;
+  }
+  if(!ttt_sinks_open(&sinks, canonical_only)){
+    ttt_sinks_close(&sinks);
+    return 1;
   }
 
-  // Emit .data (no header): board,player_to_move   ,outcome,best_move
-  for(int s=0;s<NSTATE;s++){
-    int turn;
-    if(!legal_and_turn(s,&turn)) continue;
-    if(turn == 0) continue; // skip terminal states
+  // Solve all legal states
+  reset_caches();
+  if(retro) solve_retrograde();
+  else solve_recursive();
 
-    char board[10]; board_string(s, board);
-    int outc = outcome_cache[s];        // -1/0/+1 from current player's perspective
-    int mv   = bestmove_cache[s];       // 0..8 (at least one exists for non-terminals)
+  // One row per non-terminal state to every sink. The default .data
+  // layout (no header) is board,player_to_move,outcome,best_move;
+  // --canonical appends ,weight = number of boards the row stands for
+  for(int idx=0;idx<TTT_NUM_POSITIONS;idx++){
+    int s = ttt_index_code(idx), turn;
+    if(canonical_only && !ttt_sym_is_canonical(s)) continue;
+    legal_and_turn(s,&turn);
+    if(turn == 0) continue; // skip terminal states
 
-    // One line per state
-    fprintf(fp, "%s,%c,%d,%d\n", board, (turn==1?'X':'O'), outc, mv);
+    TTTRow row;
+    row.board = ttt_index_board(idx);
+    row.side = turn;
+    row.outcome = outcome_cache[idx];   // -1/0/+1 from current player's perspective
+    row.best_move = bestmove_cache[idx];// 0..8 (at least one exists for non-terminals)
+    row.weight = canonical_only ? ttt_sym_weight[s] : 1;
+    ttt_sinks_emit(&sinks, &row);
   }
 
-  fclose(fp);
+  if(!ttt_sinks_close(&sinks)) return 1;
+
+  // Optional: value + plies-to-outcome of every move of every position
+  if(movetable_name){
+    MoveTable mt;
+    if(!ttt_mt_build(&mt)){
+      fprintf(stderr, "Error: Memory allocation failed for move table\n");
+      return 1;
+    }
+    // Its position values must agree with whatever this run solved
+    for(int idx=0;idx<TTT_NUM_POSITIONS;idx++){
+      if(outcome_cache[idx]==UNKNOWN) continue;
+      int v = ttt_mt_score(ttt_mt_entry_value(ttt_mt_position_entry(&mt, idx)));
+      if(v != outcome_cache[idx]){
+        fprintf(stderr, "Error: move table disagrees with solver at code %d\n", ttt_index_code(idx));
+        ttt_mt_free(&mt);
+        return 1;
+      }
+    }
+    if(!ttt_mt_save(&mt, movetable_name)){
+      fprintf(stderr, "Error: cannot write move table '%s'\n", movetable_name);
+      ttt_mt_free(&mt);
+      return 1;
+    }
+    ttt_mt_free(&mt);
+  }
   return 0;
 }
@@ -0,0 +1,91 @@
+#include "ttt_mmap.h"
+
+#ifdef _WIN32
+#include <windows.h>
+
+int ttt_mmap_open(MappedFile *mf, const char *filename) {
+    mf->data = NULL;
+    mf->size = 0;
+    mf->file_handle = NULL;
+    mf->mapping_handle = NULL;
+
+    HANDLE file = CreateFileA(filename, GENERIC_READ, FILE_SHARE_READ, NULL,
+                              OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) return 0;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0) {
+        CloseHandle(file);
+        return 0;
+    }
+
+    HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping == NULL) {
+        CloseHandle(file);
+        return 0;
+    }
+
+    const void *view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (view == NULL) {
+        CloseHandle(mapping);
+        CloseHandle(file);
+        return 0;
+    }
+
+    mf->data = view;
+    mf->size = (size_t)size.QuadPart;
+    mf->file_handle = file;
+    mf->mapping_handle = mapping;
+    return 1;
+}
+
+void ttt_mmap_close(MappedFile *mf) {
+    if (mf->data != NULL) UnmapViewOfFile(mf->data);
+    if (mf->mapping_handle != NULL) CloseHandle((HANDLE)mf->mapping_handle);
+    if (mf->file_handle != NULL) CloseHandle((HANDLE)mf->file_handle);
+    mf->data = NULL;
+    mf->size = 0;
+    mf->file_handle = NULL;
+    mf->mapping_handle = NULL;
+}
+
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+int ttt_mmap_open(MappedFile *mf, const char *filename) {
+    mf->data = NULL;
+    mf->size = 0;
+    mf->fd = open(filename, O_RDONLY);
+    if (mf->fd < 0) return 0;
+
+    struct stat st;
+    if (fstat(mf->fd, &st) != 0 || st.st_size == 0) {
+        close(mf->fd);
+        mf->fd = -1;
+        return 0;
+    }
+
+    void *addr = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, mf->fd, 0);
+    if (addr == MAP_FAILED) {
+        close(mf->fd);
+        mf->fd = -1;
+        return 0;
+    }
+
+    mf->data = addr;
+    mf->size = (size_t)st.st_size;
+    return 1;
+}
+
+void ttt_mmap_close(MappedFile *mf) {
+    if (mf->data != NULL) munmap((void *)mf->data, mf->size);
+    if (mf->fd >= 0) close(mf->fd);
+    mf->data = NULL;
+    mf->size = 0;
+    mf->fd = -1;
+}
+
+#endif
@@ -0,0 +1,28 @@
+#ifndef TTT_MMAP_H
+#define TTT_MMAP_H
+
+#include <stddef.h>
+
+// ============================================
+// Read-Only Memory-Mapped Files
+// ============================================
+//
+// Maps a whole file into memory (mmap on POSIX, MapViewOfFile on
+// Windows) so binary formats can be used in place without copying.
+
+typedef struct {
+    const void *data;
+    size_t size;
+#ifdef _WIN32
+    void *file_handle;
+    void *mapping_handle;
+#else
+    int fd;
+#endif
+} MappedFile;
+
+// Returns 0 if the file cannot be opened, is empty or cannot be mapped
+int ttt_mmap_open(MappedFile *mf, const char *filename);
+void ttt_mmap_close(MappedFile *mf);
+
+#endif
@@ -0,0 +1,156 @@
+#include <math.h>
+#include <stdio.h>
+#include <string.h>
+#include "ttt_model.h"
+
+#define MIN_PROB 1e-12  // floor for zero probabilities, so logs stay finite
+
+static void update_tables(TTTModel *m) {
+    for (int l = 0; l < m->outputs; l++) m->base[l] = m->bias[l];
+    for (int cell = 0; cell < TTT_CELLS; cell++) {
+        for (int l = 0; l < m->outputs; l++) {
+            m->base[l] += m->term[cell][0][l];
+            for (int digit = 0; digit < 3; digit++) {
+                m->delta[cell][digit][l] = m->term[cell][digit][l] - m->term[cell][0][l];
+            }
+        }
+    }
+}
+
+void ttt_model_linear(TTTModel *m, const double weights[TTT_CELLS + 1]) {
+    memset(m, 0, sizeof(*m));
+    m->outputs = 1;
+    m->bias[0] = weights[0];
+    m->value[0] = 1.0;
+    for (int cell = 0; cell < TTT_CELLS; cell++) {
+        m->term[cell][TTT_SIDE_X][0] = weights[cell + 1];
+        m->term[cell][TTT_SIDE_O][0] = -weights[cell + 1];
+    }
+    update_tables(m);
+}
+
+int ttt_model_naive_bayes(TTTModel *m, int labels, const double *priors, const double *values) {
+    if (labels < 1 || labels > TTT_MODEL_MAX_OUTPUTS) return 0;
+    memset(m, 0, sizeof(*m));
+    m->outputs = labels;
+    m->log_probs = 1;
+    for (int l = 0; l < labels; l++) {
+        m->bias[l] = log(priors[l] > MIN_PROB ? priors[l] : MIN_PROB);
+        m->value[l] = values[l];
+    }
+    update_tables(m);
+    return 1;
+}
+
+void ttt_model_set_prob(TTTModel *m, int cell, int digit, int label, double p) {
+    m->term[cell][digit][label] = log(p > MIN_PROB ? p : MIN_PROB);
+    update_tables(m);
+}
+
+// Base-3 digit of a naive Bayes cell state, -1 if unknown
+static int state_digit(const char *state) {
+    if (strcmp(state, "b") == 0) return 0;
+    if (strcmp(state, "x") == 0) return TTT_SIDE_X;
+    if (strcmp(state, "o") == 0) return TTT_SIDE_O;
+    return -1;
+}
+
+// What a label (the game's result for X) is worth to X
+static double label_value(const char *label) {
+    if (strcmp(label, "win") == 0) return 1.0;
+    if (strcmp(label, "lose") == 0) return -1.0;
+    return 0.0;
+}
+
+// Same layout as naive_bayes.c's loadModelText
+int ttt_model_load_naive_bayes(TTTModel *m, const char *filename) {
+    FILE *fp = fopen(filename, "r");
+    if (!fp) return 0;
+
+    char line[256];
+    int labels = 0;
+    while (fgets(line, sizeof(line), fp)) {
+        if (sscanf(line, "Total labels: %d", &labels) == 1) break;
+    }
+
+    char names[TTT_MODEL_MAX_OUTPUTS][32];
+    double priors[TTT_MODEL_MAX_OUTPUTS], values[TTT_MODEL_MAX_OUTPUTS];
+    int found = 0;
+    while (found < labels && found < TTT_MODEL_MAX_OUTPUTS && fgets(line, sizeof(line), fp)) {
+        if (sscanf(line, "Label: %31s P(Label) = %lf", names[found], &priors[found]) == 2) {
+            values[found] = label_value(names[found]);
+            found++;
+        }
+    }
+    if (found != labels || !ttt_model_naive_bayes(m, labels, priors, values)) {
+        fclose(fp);
+        return 0;
+    }
+
+    int cell = -1, ok = 1;
+    while (ok && fgets(line, sizeof(line), fp)) {
+        char state[32], label[32];
+        double p;
+        if (sscanf(line, "Feature %d:", &cell) == 1) {
+            ok = cell >= 0 && cell < TTT_CELLS;
+        } else if (sscanf(line, " State=%31s | Label=%31s | P(State|Label) = %lf",
+                          state, label, &p) == 3) {
+            int digit = state_digit(state), l = 0;
+            while (l < labels && strcmp(names[l], label) != 0) l++;
+            ok = cell >= 0 && digit >= 0 && l < labels;
+            if (ok) ttt_model_set_prob(m, cell, digit, l, p);
+        }
+    }
+    fclose(fp);
+    return ok && cell >= 0;
+}
+
+void ttt_model_eval(const TTTModel *m, Bitboard b, TTTModelScore *out) {
+    int code = bb_to_code(b);
+    for (int l = 0; l < m->outputs; l++) out->sum[l] = m->base[l];
+    for (int cell = 0; cell < TTT_CELLS; cell++, code /= 3) {
+        if (code % 3 == 0) continue;
+        const double *d = m->delta[cell][code % 3];
+        for (int l = 0; l < m->outputs; l++) out->sum[l] += d[l];
+    }
+}
+
+double ttt_model_rating(const TTTModel *m, const TTTModelScore *s) {
+    if (!m->log_probs) return s->sum[0];
+
+    // Posterior by softmax over the log joints, shifted by the largest
+    double top = s->sum[0];
+    for (int l = 1; l < m->outputs; l++) {
+        if (s->sum[l] > top) top = s->sum[l];
+    }
+    double total = 0.0, rating = 0.0;
+    for (int l = 0; l < m->outputs; l++) {
+        double w = exp(s->sum[l] - top);
+        total += w;
+        rating += w * m->value[l];
+    }
+    return rating / total;
+}
+
+int ttt_model_best_move(const TTTModel *m, Bitboard b, int side) {
+    TTTModelScore parent;
+    ttt_model_eval(m, b, &parent);
+    return ttt_model_best_child(m, &parent, bb_empty_cells(b), side);
+}
+
+int ttt_model_best_child(const TTTModel *m, const TTTModelScore *parent, uint16_t empty, int side) {
+    TTTModelScore child;
+    int best_move = -1;
+    double best = 0.0;
+    for (uint16_t e = empty; e; e &= e - 1) {
+        int cell = bb_ctz(e);
+        ttt_model_child(m, parent, cell, side, &child);
+        double r = ttt_model_rating(m, &child);
+        if (side == TTT_SIDE_O) r = -r;
+        if (best_move < 0 || r > best) {
+            best = r;
+            best_move = cell;
+        }
+    }
+    return best_move;
+}
@@ -0,0 +1,79 @@
+#ifndef TTT_MODEL_H
+#define TTT_MODEL_H
+
+#include "ttt_board.h"
+
+// ============================================
+// Incremental Model Evaluation
+// ============================================
+//
+// The trained models score a board as a constant plus one term per
+// cell, picked by the cell's state:
+//
+//   linear regression  w0 + sum w[i+1] * (+1 for X, -1 for O, 0 empty)
+//   naive Bayes        log P(label) + sum log P(state of cell i | label),
+//                      one sum per label
+//
+// Playing a move changes a single cell, so a child's sums are the
+// parent's plus one table entry per output. A player evaluates the
+// position once and then rates each move in O(outputs) instead of
+// rebuilding the features and redoing the whole sum for every child.
+
+#define TTT_MODEL_MAX_OUTPUTS 10  // naive Bayes labels
+
+typedef struct {
+    int outputs;                                          // 1 for linear, labels for naive Bayes
+    int log_probs;                                        // outputs are log joint probabilities
+    double bias[TTT_MODEL_MAX_OUTPUTS];
+    double base[TTT_MODEL_MAX_OUTPUTS];                   // sums of the empty board
+    double term[TTT_CELLS][3][TTT_MODEL_MAX_OUTPUTS];     // [cell][digit: 0 empty, 1 X, 2 O]
+    double delta[TTT_CELLS][3][TTT_MODEL_MAX_OUTPUTS];    // term[cell][side] - term[cell][0]
+    double value[TTT_MODEL_MAX_OUTPUTS];                  // outcome of each label for X
+} TTTModel;
+
+typedef struct {
+    double sum[TTT_MODEL_MAX_OUTPUTS];
+} TTTModelScore;
+
+// weights[0] is the bias, weights[i + 1] the weight of cell i
+void ttt_model_linear(TTTModel *m, const double weights[TTT_CELLS + 1]);
+
+// An empty naive Bayes model: priors[l] = P(label l), values[l] = what
+// the label is worth to X (+1 win, -1 loss, 0 draw). Add the feature
+// probabilities with ttt_model_set_prob; a (state, label) pair that is
+// never set leaves the product unchanged, as naive_bayes.c's predict()
+// does. Returns 0 if labels is out of range.
+int ttt_model_naive_bayes(TTTModel *m, int labels, const double *priors, const double *values);
+
+// P(cell is in state digit | label)
+void ttt_model_set_prob(TTTModel *m, int cell, int digit, int label, double p);
+
+// Reads a model saved by naive_bayes.c in text format (labels win /
+// lose / draw, cell states b / x / o). Returns 0 if the file cannot be
+// read or does not describe a 9-cell board.
+int ttt_model_load_naive_bayes(TTTModel *m, const char *filename);
+
+// Sums of a whole position: the empty board's plus the delta of each
+// stone, added in cell order (batched callers add them in the same
+// order and get the same bits)
+void ttt_model_eval(const TTTModel *m, Bitboard b, TTTModelScore *out);
+
+// Sums after side plays the empty cell, from the parent's
+static inline void ttt_model_child(const TTTModel *m, const TTTModelScore *parent, int cell,
+                                   int side, TTTModelScore *child) {
+    const double *d = m->delta[cell][side];
+    for (int l = 0; l < m->outputs; l++) child->sum[l] = parent->sum[l] + d[l];
+}
+
+// What the position is worth to X: the linear score, or for naive Bayes
+// the label values weighted by the posterior P(label | board)
+double ttt_model_rating(const TTTModel *m, const TTTModelScore *s);
+
+// The empty cell whose child side rates best (X maximizes, O
+// minimizes); ties go to the lower cell. -1 if the board is full.
+int ttt_model_best_move(const TTTModel *m, Bitboard b, int side);
+
+// The same, from the sums of the position and its empty cells
+int ttt_model_best_child(const TTTModel *m, const TTTModelScore *parent, uint16_t empty, int side);
+
+#endif
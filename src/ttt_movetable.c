@@ -0,0 +1,131 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ttt_movetable.h"
+
+static inline uint8_t make_entry(int value, int plies) {
+    return (uint8_t)(value | (plies << 2));
+}
+
+// 1 if entry a is strictly better than b for the player choosing
+static int entry_better(uint8_t a, uint8_t b) {
+    int va = ttt_mt_entry_value(a), vb = ttt_mt_entry_value(b);
+    if (va != vb) return va > vb;
+    if (va == TTT_MV_WIN) return ttt_mt_entry_plies(a) < ttt_mt_entry_plies(b);
+    if (va == TTT_MV_LOSS) return ttt_mt_entry_plies(a) > ttt_mt_entry_plies(b);
+    return 0;
+}
+
+// Fill the record of one position whose children are already solved
+static void solve_record(MoveTable *mt, int idx) {
+    MoveRecord *rec = &mt->records[idx];
+    Bitboard b = ttt_index_board(idx);
+    memset(rec, 0, sizeof(*rec));
+
+    int status = bb_status(b);
+    if (status != TTT_ONGOING) {
+        // The player who just moved won, or the board is full
+        rec->self = make_entry(status == TTT_DRAW ? TTT_MV_DRAW : TTT_MV_LOSS, 0);
+        return;
+    }
+
+    int side = bb_side_to_move(b);
+    int best = -1;
+    for (uint16_t m = bb_empty_cells(b); m; m &= m - 1) {
+        int i = bb_ctz(m);
+        Bitboard child = b;
+        bb_toggle(&child, i, side);
+        uint8_t c = mt->records[ttt_index_of(child)].self;
+
+        // The child's value is from the opponent's point of view
+        rec->move[i] = make_entry(4 - ttt_mt_entry_value(c), ttt_mt_entry_plies(c) + 1);
+        if (best < 0 || entry_better(rec->move[i], rec->move[best])) best = i;
+    }
+    rec->self = rec->move[best];
+}
+
+int ttt_mt_build(MoveTable *mt) {
+    ttt_index_init();
+    mt->records = (MoveRecord *)calloc(TTT_NUM_POSITIONS, sizeof(MoveRecord));
+    if (mt->records == NULL) return 0;
+
+    // Children have one more piece, so solve from full boards down
+    for (int pieces = TTT_CELLS; pieces >= 0; pieces--) {
+        for (int idx = 0; idx < TTT_NUM_POSITIONS; idx++) {
+            Bitboard b = ttt_index_board(idx);
+            if (bb_popcount(b.x | b.o) == pieces) solve_record(mt, idx);
+        }
+    }
+    return 1;
+}
+
+void ttt_mt_free(MoveTable *mt) {
+    free(mt->records);
+    mt->records = NULL;
+}
+
+int ttt_mt_save(const MoveTable *mt, const char *filename) {
+    FILE *fp = fopen(filename, "wb");
+    if (!fp) return 0;
+
+    uint16_t version = TTT_MT_VERSION;
+    uint16_t record_size = (uint16_t)sizeof(MoveRecord);
+    uint32_t count = TTT_NUM_POSITIONS;
+    fwrite(TTT_MT_MAGIC, 1, 4, fp);
+    fwrite(&version, sizeof(version), 1, fp);
+    fwrite(&record_size, sizeof(record_size), 1, fp);
+    fwrite(&count, sizeof(count), 1, fp);
+    size_t written = fwrite(mt->records, sizeof(MoveRecord), count, fp);
+    return fclose(fp) == 0 && written == count;
+}
+
+int ttt_mt_load(MoveTable *mt, const char *filename) {
+    FILE *fp = fopen(filename, "rb");
+    if (!fp) {
+        fprintf(stderr, "Error: Cannot open move table '%s'\n", filename);
+        return 0;
+    }
+
+    char magic[4];
+    uint16_t version = 0, record_size = 0;
+    uint32_t count = 0;
+    if (fread(magic, 1, 4, fp) != 4 || memcmp(magic, TTT_MT_MAGIC, 4) != 0 ||
+        fread(&version, sizeof(version), 1, fp) != 1 ||
+        fread(&record_size, sizeof(record_size), 1, fp) != 1 ||
+        fread(&count, sizeof(count), 1, fp) != 1) {
+        fprintf(stderr, "Error: '%s' is not a move table\n", filename);
+        fclose(fp);
+        return 0;
+    }
+    if (version != TTT_MT_VERSION || record_size != sizeof(MoveRecord) ||
+        count != TTT_NUM_POSITIONS) {
+        fprintf(stderr, "Error: Unsupported move table '%s' (version %u, %u records of %u bytes)\n",
+                filename, version, count, record_size);
+        fclose(fp);
+        return 0;
+    }
+
+    ttt_index_init();
+    mt->records = (MoveRecord *)malloc(count * sizeof(MoveRecord));
+    if (mt->records == NULL || fread(mt->records, sizeof(MoveRecord), count, fp) != count) {
+        fprintf(stderr, "Error: Failed to read move table '%s'\n", filename);
+        ttt_mt_free(mt);
+        fclose(fp);
+        return 0;
+    }
+    fclose(fp);
+    return 1;
+}
+
+int ttt_mt_best_move(const MoveTable *mt, Bitboard b) {
+    int idx = ttt_index_of(b);
+    if (idx < 0) return -1;
+
+    const MoveRecord *rec = &mt->records[idx];
+    int best = -1;
+    for (int i = 0; i < TTT_CELLS; i++) {
+        if (ttt_mt_entry_value(rec->move[i]) == TTT_MV_NONE) continue;
+        if (best < 0 || entry_better(rec->move[i], rec->move[best])) best = i;
+    }
+    return best;
+}
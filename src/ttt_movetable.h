@@ -0,0 +1,65 @@
+#ifndef TTT_MOVETABLE_H
+#define TTT_MOVETABLE_H
+
+#include <stdint.h>
+#include "ttt_board.h"
+#include "ttt_index.h"
+
+// ============================================
+// Per-Move Value and Depth-to-Outcome Table
+// ============================================
+//
+// For every legal position (dense index, ttt_index.h) the exact value of
+// each of the 9 moves and the number of plies until the game ends under
+// optimal play: the winner takes the fastest win, the loser the slowest
+// loss. One byte per entry: value in bits 0-1, plies in bits 2-5.
+//
+// Values are from the perspective of the player to move in the position
+// the record belongs to. Illegal moves (occupied cell, finished game)
+// are TTT_MV_NONE.
+
+#define TTT_MV_NONE 0
+#define TTT_MV_LOSS 1
+#define TTT_MV_DRAW 2
+#define TTT_MV_WIN  3
+
+#define TTT_MT_MAGIC "TTMV"
+#define TTT_MT_VERSION 1
+
+typedef struct {
+    uint8_t move[TTT_CELLS];  // result of playing each cell
+    uint8_t self;             // the position itself (best move's entry)
+} MoveRecord;
+
+typedef struct {
+    MoveRecord *records;      // TTT_NUM_POSITIONS records
+} MoveTable;
+
+// Solve every position retrogradely; returns 0 on allocation failure
+int ttt_mt_build(MoveTable *mt);
+void ttt_mt_free(MoveTable *mt);
+
+// Binary file: magic, version, record size, record count, records.
+// Both return 0 on failure (load prints the reason to stderr).
+int ttt_mt_save(const MoveTable *mt, const char *filename);
+int ttt_mt_load(MoveTable *mt, const char *filename);
+
+static inline int ttt_mt_entry_value(uint8_t e) { return e & 3; }
+static inline int ttt_mt_entry_plies(uint8_t e) { return e >> 2; }
+
+// -1 / 0 / +1 for a TTT_MV_LOSS / DRAW / WIN value
+static inline int ttt_mt_score(int value) { return value - TTT_MV_DRAW; }
+
+static inline uint8_t ttt_mt_move_entry(const MoveTable *mt, int index, int move) {
+    return mt->records[index].move[move];
+}
+
+static inline uint8_t ttt_mt_position_entry(const MoveTable *mt, int index) {
+    return mt->records[index].self;
+}
+
+// Best move for the side to move in b, preferring the fastest win and
+// the slowest loss (lowest cell on ties); -1 if the game is over
+int ttt_mt_best_move(const MoveTable *mt, Bitboard b);
+
+#endif
@@ -0,0 +1,7409 @@
+// Generated by gen_perfect_table.c -- do not edit.
+#include "ttt_perfect_table.h"
+
+const uint16_t ttt_perfect_index[19683] = {
+    0, 1, 65535, 2, 65535, 3, 65535, 4, 65535, 5, 65535, 6, 65535, 65535, 7, 8,
+    9, 65535, 65535, 10, 65535, 11, 12, 65535, 65535, 65535, 65535, 13, 65535, 14, 65535, 65535,
+    15, 16, 17, 65535, 65535, 65535, 18, 65535, 65535, 65535, 19, 65535, 20, 21, 22, 65535,
+    23, 65535, 24, 65535, 25, 65535, 65535, 26, 65535, 27, 28, 65535, 65535, 65535, 65535, 29,
+    30, 65535, 31, 65535, 32, 65535, 33, 65535, 65535, 65535, 65535, 65535, 34, 65535, 65535, 65535,
+    65535, 35, 65535, 36, 65535, 65535, 37, 38, 39, 65535, 65535, 65535, 40, 65535, 65535, 65535,
+    41, 65535, 42, 43, 44, 65535, 45, 65535, 46, 65535, 47, 65535, 65535, 65535, 48, 65535,
+    65535, 65535, 49, 65535, 50, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 51, 52, 65535,
+    53, 65535, 65535, 54, 55, 56, 65535, 57, 58, 65535, 59, 65535, 60, 65535, 61, 65535,
+    62, 65535, 63, 65535, 65535, 64, 65, 66, 65535, 65535, 67, 65535, 68, 69, 65535, 65535,
+    65535, 65535, 65535, 70, 65535, 71, 72, 65535, 65535, 65535, 65535, 73, 74, 65535, 75, 65535,
+    76, 65535, 77, 65535, 65535, 65535, 65535, 65535, 78, 65535, 65535, 65535, 65535, 79, 80, 65535,
+    81, 65535, 82, 65535, 83, 65535, 84, 65535, 85, 65535, 65535, 86, 87, 88, 65535, 65535,
+    89, 65535, 90, 91, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 92, 65535, 65535, 65535,
+    65535, 65535, 93, 65535, 94, 95, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 96, 65535, 97, 65535, 65535, 98, 99, 100, 65535, 65535, 65535, 101, 65535,
+    65535, 65535, 102, 65535, 103, 104, 105, 65535, 106, 65535, 107, 65535, 108, 65535, 65535, 65535,
+    109, 65535, 65535, 65535, 110, 65535, 111, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 112,
+    113, 65535, 114, 65535, 65535, 115, 116, 117, 65535, 118, 119, 65535, 120, 65535, 121, 65535,
+    122, 65535, 123, 65535, 124, 65535, 65535, 125, 126, 127, 65535, 65535, 128, 65535, 129, 130,
+    65535, 65535, 65535, 65535, 65535, 65535, 131, 65535, 65535, 65535, 132, 65535, 133, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 134, 135, 65535, 136, 65535, 65535, 137, 138, 139, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 140, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 141, 65535, 65535, 65535, 142, 65535, 65535, 143, 65535, 144, 65535, 65535, 145,
+    146, 147, 65535, 65535, 65535, 148, 65535, 65535, 65535, 149, 65535, 150, 151, 152, 65535, 153,
+    65535, 154, 65535, 155, 65535, 156, 157, 65535, 158, 65535, 159, 65535, 160, 65535, 161, 65535,
+    162, 65535, 65535, 163, 164, 165, 65535, 65535, 166, 65535, 167, 168, 65535, 65535, 65535, 65535,
+    169, 65535, 170, 65535, 65535, 171, 172, 173, 65535, 65535, 65535, 174, 65535, 65535, 65535, 175,
+    65535, 176, 177, 178, 65535, 179, 65535, 180, 65535, 181, 65535, 65535, 182, 65535, 183, 184,
+    65535, 65535, 65535, 65535, 185, 186, 65535, 187, 65535, 188, 65535, 189, 65535, 65535, 65535, 65535,
+    65535, 190, 65535, 65535, 65535, 65535, 65535, 191, 65535, 192, 193, 65535, 65535, 65535, 65535, 194,
+    195, 65535, 196, 65535, 197, 65535, 198, 65535, 65535, 65535, 65535, 65535, 199, 65535, 65535, 65535,
+    65535, 200, 201, 65535, 202, 65535, 203, 65535, 204, 65535, 205, 65535, 206, 65535, 65535, 207,
+    208, 209, 65535, 65535, 210, 65535, 211, 212, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    213, 65535, 65535, 65535, 65535, 65535, 214, 65535, 215, 216, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 217, 218, 65535, 219, 65535, 220, 65535, 221, 65535,
+    222, 65535, 223, 65535, 65535, 224, 225, 226, 65535, 65535, 227, 65535, 228, 229, 65535, 65535,
+    65535, 65535, 230, 65535, 231, 65535, 65535, 232, 233, 234, 65535, 65535, 65535, 235, 65535, 65535,
+    65535, 236, 65535, 237, 238, 239, 65535, 240, 65535, 241, 65535, 242, 65535, 65535, 243, 65535,
+    244, 245, 65535, 65535, 65535, 65535, 246, 247, 65535, 248, 65535, 249, 65535, 250, 65535, 65535,
+    65535, 65535, 65535, 251, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 252, 65535, 65535, 65535,
+    65535, 65535, 253, 65535, 254, 255, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 256, 65535, 257, 258, 65535, 65535, 65535, 65535, 259, 260, 65535, 261,
+    65535, 262, 65535, 263, 65535, 65535, 65535, 65535, 65535, 264, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 265, 65535, 266, 65535, 65535, 267, 268,
+    269, 65535, 65535, 65535, 270, 65535, 65535, 65535, 271, 65535, 272, 273, 274, 65535, 275, 65535,
+    276, 65535, 277, 65535, 65535, 65535, 278, 65535, 65535, 65535, 279, 65535, 280, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 281, 282, 65535, 283, 65535, 65535, 284, 285, 286, 65535, 287,
+    288, 65535, 289, 65535, 290, 65535, 291, 65535, 292, 65535, 293, 65535, 65535, 294, 295, 296,
+    65535, 65535, 297, 65535, 298, 299, 65535, 65535, 65535, 65535, 65535, 65535, 300, 65535, 65535, 65535,
+    301, 65535, 302, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 303, 304, 65535, 305, 65535,
+    65535, 306, 307, 308, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 309, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 310, 65535, 65535, 65535, 311, 65535, 312,
+    313, 65535, 314, 65535, 65535, 315, 316, 317, 65535, 65535, 65535, 318, 65535, 65535, 65535, 319,
+    65535, 65535, 320, 321, 65535, 322, 65535, 323, 65535, 324, 65535, 325, 326, 65535, 327, 65535,
+    328, 65535, 329, 65535, 330, 65535, 331, 65535, 65535, 332, 333, 334, 65535, 65535, 335, 65535,
+    336, 337, 65535, 65535, 65535, 65535, 338, 65535, 339, 65535, 65535, 340, 341, 342, 65535, 65535,
+    65535, 343, 65535, 65535, 65535, 344, 65535, 345, 346, 347, 65535, 348, 65535, 349, 65535, 65535,
+    65535, 65535, 350, 65535, 351, 352, 65535, 65535, 65535, 65535, 353, 354, 65535, 355, 65535, 356,
+    65535, 357, 65535, 65535, 65535, 65535, 65535, 358, 65535, 65535, 65535, 65535, 65535, 65535, 359, 65535,
+    65535, 65535, 360, 65535, 361, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 362, 363, 65535,
+    364, 65535, 65535, 365, 366, 367, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 368,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 369, 65535, 65535, 65535, 370,
+    65535, 371, 372, 65535, 373, 65535, 65535, 374, 375, 376, 65535, 65535, 65535, 377, 65535, 65535,
+    65535, 378, 65535, 379, 380, 381, 65535, 382, 65535, 383, 65535, 384, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 385, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 386, 65535, 65535, 65535, 387, 65535, 388, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 389, 65535, 65535, 65535, 390, 65535, 391, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 392, 393, 65535, 394, 65535, 65535, 395, 396, 397, 65535, 398, 65535,
+    399, 65535, 65535, 400, 401, 402, 65535, 65535, 65535, 403, 65535, 65535, 65535, 404, 65535, 405,
+    406, 407, 65535, 408, 65535, 409, 65535, 410, 65535, 65535, 65535, 411, 65535, 65535, 65535, 412,
+    65535, 413, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 414, 415, 65535, 416, 65535, 65535,
+    417, 418, 419, 65535, 420, 421, 65535, 422, 65535, 423, 65535, 424, 65535, 425, 65535, 426,
+    65535, 65535, 427, 428, 429, 65535, 65535, 430, 65535, 431, 432, 65535, 65535, 65535, 65535, 433,
+    434, 65535, 435, 65535, 436, 65535, 437, 65535, 438, 65535, 439, 65535, 65535, 440, 441, 442,
+    65535, 65535, 443, 65535, 444, 445, 65535, 65535, 65535, 65535, 446, 65535, 447, 65535, 65535, 448,
+    449, 450, 65535, 65535, 65535, 451, 65535, 65535, 65535, 452, 65535, 453, 454, 455, 65535, 456,
+    65535, 457, 65535, 65535, 65535, 65535, 458, 65535, 459, 460, 65535, 65535, 65535, 65535, 461, 462,
+    65535, 463, 65535, 464, 65535, 465, 65535, 65535, 65535, 65535, 65535, 466, 65535, 65535, 65535, 65535,
+    467, 65535, 468, 65535, 65535, 469, 470, 471, 65535, 65535, 65535, 472, 65535, 65535, 65535, 473,
+    65535, 65535, 474, 475, 65535, 476, 65535, 477, 65535, 478, 65535, 65535, 65535, 479, 65535, 65535,
+    65535, 480, 65535, 481, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 482, 483, 65535, 484,
+    65535, 65535, 485, 486, 487, 65535, 488, 489, 65535, 490, 65535, 491, 65535, 492, 65535, 493,
+    65535, 65535, 65535, 65535, 494, 65535, 495, 65535, 65535, 496, 65535, 497, 498, 65535, 65535, 65535,
+    65535, 65535, 499, 65535, 500, 501, 65535, 65535, 65535, 65535, 502, 503, 65535, 504, 65535, 505,
+    65535, 506, 65535, 65535, 65535, 65535, 65535, 507, 65535, 65535, 65535, 65535, 508, 509, 65535, 510,
+    65535, 511, 65535, 65535, 65535, 512, 65535, 513, 65535, 65535, 514, 515, 516, 65535, 65535, 65535,
+    65535, 517, 518, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 519, 65535, 65535, 65535, 65535,
+    65535, 520, 65535, 521, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 522, 65535, 523, 524, 65535, 65535, 65535, 65535, 525, 526, 65535, 527, 65535,
+    528, 65535, 529, 65535, 65535, 65535, 65535, 65535, 530, 65535, 65535, 65535, 65535, 531, 532, 65535,
+    533, 65535, 534, 65535, 535, 65535, 536, 65535, 537, 65535, 65535, 538, 539, 540, 65535, 65535,
+    541, 65535, 542, 543, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 544, 65535, 65535, 65535,
+    65535, 65535, 545, 65535, 546, 547, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 548, 549, 65535, 550, 65535, 551, 65535, 552, 65535, 553, 65535, 554, 65535,
+    65535, 555, 556, 557, 65535, 65535, 558, 65535, 559, 560, 65535, 65535, 65535, 65535, 561, 65535,
+    562, 65535, 65535, 563, 564, 565, 65535, 65535, 65535, 566, 65535, 65535, 65535, 567, 65535, 568,
+    569, 570, 65535, 571, 65535, 572, 65535, 573, 65535, 65535, 574, 65535, 575, 576, 65535, 65535,
+    65535, 65535, 577, 578, 65535, 579, 65535, 580, 65535, 581, 65535, 65535, 65535, 65535, 65535, 582,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 583, 65535, 65535, 65535, 65535, 65535, 584, 65535,
+    585, 586, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    587, 65535, 588, 589, 65535, 65535, 65535, 65535, 590, 591, 65535, 592, 65535, 593, 65535, 594,
+    65535, 65535, 65535, 65535, 65535, 595, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 596, 597, 65535, 598, 65535, 599, 65535, 600, 65535, 601, 65535,
+    602, 65535, 65535, 603, 604, 605, 65535, 65535, 606, 65535, 607, 608, 65535, 65535, 65535, 65535,
+    609, 65535, 610, 65535, 65535, 611, 612, 613, 65535, 65535, 65535, 614, 65535, 65535, 65535, 615,
+    65535, 616, 617, 618, 65535, 619, 65535, 620, 65535, 621, 65535, 65535, 622, 65535, 623, 624,
+    65535, 65535, 65535, 65535, 625, 626, 65535, 627, 65535, 628, 65535, 629, 65535, 65535, 65535, 65535,
+    65535, 630, 65535, 65535, 65535, 65535, 631, 65535, 632, 65535, 65535, 633, 634, 635, 65535, 65535,
+    65535, 636, 65535, 65535, 65535, 637, 65535, 638, 639, 640, 65535, 641, 65535, 642, 65535, 643,
+    65535, 65535, 65535, 644, 65535, 65535, 65535, 645, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 646, 647, 65535, 65535, 65535, 65535, 648, 65535, 649, 65535, 650, 651, 65535, 652,
+    65535, 653, 65535, 654, 65535, 655, 65535, 656, 65535, 65535, 65535, 657, 658, 65535, 65535, 659,
+    65535, 660, 661, 65535, 65535, 65535, 65535, 65535, 662, 65535, 663, 664, 65535, 65535, 65535, 65535,
+    665, 666, 65535, 667, 65535, 668, 65535, 669, 65535, 65535, 65535, 65535, 65535, 670, 65535, 65535,
+    65535, 65535, 671, 672, 65535, 673, 65535, 674, 65535, 675, 65535, 676, 65535, 677, 65535, 65535,
+    678, 679, 680, 65535, 65535, 681, 65535, 682, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 683, 65535, 65535, 65535, 65535, 65535, 684, 65535, 685, 686, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 687, 65535, 65535, 65535,
+    65535, 65535, 688, 65535, 689, 690, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 691, 65535, 692, 693, 65535, 65535, 65535, 65535, 694, 695, 65535, 696,
+    65535, 697, 65535, 698, 65535, 65535, 65535, 65535, 65535, 699, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 700, 65535, 701, 702, 65535, 65535,
+    65535, 65535, 703, 704, 65535, 705, 65535, 706, 65535, 707, 65535, 65535, 65535, 65535, 65535, 708,
+    65535, 65535, 65535, 65535, 709, 710, 65535, 711, 65535, 712, 65535, 713, 65535, 714, 65535, 715,
+    65535, 65535, 716, 717, 718, 65535, 65535, 719, 65535, 720, 721, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 722, 65535, 65535, 65535, 65535, 65535, 723, 65535, 724, 725, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 726, 65535, 65535, 65535, 65535, 65535, 727,
+    65535, 728, 729, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 730, 65535, 731, 65535, 65535,
+    732, 733, 734, 65535, 65535, 65535, 735, 65535, 65535, 65535, 736, 65535, 737, 738, 739, 65535,
+    740, 65535, 741, 65535, 742, 65535, 65535, 65535, 743, 65535, 65535, 65535, 744, 65535, 745, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 746, 747, 65535, 748, 65535, 65535, 749, 750, 751,
+    65535, 752, 753, 65535, 754, 65535, 755, 65535, 756, 65535, 757, 65535, 758, 65535, 65535, 759,
+    760, 761, 65535, 65535, 762, 65535, 763, 764, 65535, 65535, 65535, 65535, 65535, 65535, 765, 65535,
+    65535, 65535, 766, 65535, 767, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 768, 769, 65535,
+    770, 65535, 65535, 771, 772, 773, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 774,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 775, 65535, 65535, 65535, 776,
+    65535, 777, 778, 65535, 779, 65535, 65535, 780, 781, 782, 65535, 65535, 65535, 783, 65535, 65535,
+    65535, 784, 65535, 785, 786, 787, 65535, 788, 65535, 65535, 65535, 789, 65535, 790, 791, 65535,
+    792, 65535, 793, 65535, 794, 65535, 795, 65535, 796, 65535, 65535, 797, 798, 799, 65535, 65535,
+    800, 65535, 801, 802, 65535, 65535, 65535, 65535, 803, 65535, 804, 65535, 65535, 805, 806, 807,
+    65535, 65535, 65535, 808, 65535, 65535, 65535, 809, 65535, 810, 811, 812, 65535, 813, 65535, 814,
+    65535, 815, 65535, 65535, 816, 65535, 817, 818, 65535, 65535, 65535, 65535, 819, 820, 65535, 821,
+    65535, 822, 65535, 823, 65535, 65535, 65535, 65535, 65535, 824, 65535, 65535, 65535, 65535, 65535, 65535,
+    825, 65535, 65535, 65535, 826, 65535, 827, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 828,
+    829, 65535, 830, 65535, 65535, 831, 832, 833, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 834, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 835, 65535, 65535,
+    65535, 836, 65535, 837, 838, 65535, 839, 65535, 65535, 840, 841, 842, 65535, 65535, 65535, 843,
+    65535, 65535, 65535, 844, 65535, 845, 846, 847, 65535, 848, 65535, 849, 65535, 850, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 851, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 852, 65535, 65535, 65535, 853, 65535, 854, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 855, 65535, 65535, 65535, 856, 65535, 857, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 858, 859, 65535, 860, 65535, 65535, 861, 862, 863, 65535,
+    864, 65535, 865, 65535, 65535, 866, 867, 868, 65535, 65535, 65535, 869, 65535, 65535, 65535, 870,
+    65535, 871, 872, 873, 65535, 874, 65535, 875, 65535, 876, 65535, 65535, 65535, 877, 65535, 65535,
+    65535, 878, 65535, 879, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 880, 881, 65535, 882,
+    65535, 65535, 883, 884, 885, 65535, 886, 887, 65535, 888, 65535, 889, 65535, 890, 65535, 891,
+    65535, 892, 65535, 65535, 893, 894, 895, 65535, 65535, 896, 65535, 897, 898, 65535, 65535, 65535,
+    65535, 899, 900, 65535, 901, 65535, 902, 65535, 903, 65535, 904, 65535, 905, 65535, 65535, 906,
+    907, 908, 65535, 65535, 909, 65535, 910, 911, 65535, 65535, 65535, 65535, 912, 65535, 913, 65535,
+    65535, 914, 915, 916, 65535, 65535, 65535, 917, 65535, 65535, 65535, 918, 65535, 919, 920, 921,
+    65535, 922, 65535, 923, 65535, 924, 65535, 65535, 925, 65535, 926, 927, 65535, 65535, 65535, 65535,
+    928, 929, 65535, 930, 65535, 931, 65535, 932, 65535, 65535, 65535, 65535, 65535, 933, 65535, 65535,
+    65535, 65535, 934, 65535, 935, 65535, 65535, 936, 937, 938, 65535, 65535, 65535, 939, 65535, 65535,
+    65535, 940, 65535, 941, 942, 943, 65535, 944, 65535, 65535, 65535, 945, 65535, 65535, 65535, 946,
+    65535, 65535, 65535, 947, 65535, 948, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 949, 950,
+    65535, 951, 65535, 65535, 952, 953, 954, 65535, 955, 956, 65535, 957, 65535, 65535, 65535, 958,
+    65535, 959, 65535, 960, 65535, 65535, 961, 962, 963, 65535, 65535, 964, 65535, 65535, 965, 65535,
+    65535, 65535, 65535, 65535, 966, 65535, 967, 968, 65535, 65535, 65535, 65535, 969, 970, 65535, 971,
+    65535, 972, 65535, 973, 65535, 65535, 65535, 65535, 65535, 974, 65535, 65535, 65535, 65535, 975, 976,
+    65535, 977, 65535, 978, 65535, 979, 65535, 980, 65535, 981, 65535, 65535, 982, 983, 984, 65535,
+    65535, 985, 65535, 986, 987, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 988, 65535, 65535,
+    65535, 65535, 65535, 989, 65535, 990, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 991, 65535, 65535, 65535, 992, 65535, 993, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 994, 995, 65535, 996, 65535, 65535, 997, 998, 999, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 1000, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 1001, 65535, 65535, 65535, 1002, 65535, 1003, 1004, 65535, 1005, 65535, 65535, 1006,
+    1007, 1008, 65535, 65535, 65535, 1009, 65535, 65535, 65535, 1010, 65535, 1011, 1012, 1013, 65535, 1014,
+    65535, 1015, 65535, 1016, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1017, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1018, 65535, 65535, 65535, 1019, 65535, 1020,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1021, 65535, 65535,
+    65535, 1022, 65535, 1023, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1024, 1025, 65535, 1026,
+    65535, 65535, 1027, 1028, 1029, 65535, 1030, 65535, 1031, 65535, 65535, 1032, 1033, 1034, 65535, 65535,
+    65535, 1035, 65535, 65535, 65535, 1036, 65535, 1037, 1038, 1039, 65535, 1040, 65535, 1041, 65535, 1042,
+    65535, 65535, 65535, 1043, 65535, 65535, 65535, 1044, 65535, 1045, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 1046, 1047, 65535, 1048, 65535, 65535, 1049, 1050, 1051, 65535, 1052, 1053, 65535, 1054,
+    65535, 1055, 65535, 1056, 65535, 1057, 65535, 1058, 65535, 65535, 1059, 1060, 1061, 65535, 65535, 1062,
+    65535, 1063, 1064, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1065,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1066, 65535, 65535, 65535, 1067,
+    65535, 1068, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1069,
+    65535, 65535, 65535, 1070, 65535, 1071, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1072, 1073,
+    65535, 1074, 65535, 65535, 1075, 1076, 1077, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 1078, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 1079, 65535, 65535, 65535, 1080, 65535, 1081, 65535, 65535, 1082, 65535, 65535, 65535, 1083,
+    65535, 1084, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1085, 1086, 65535, 1087, 65535, 65535,
+    1088, 1089, 1090, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1091, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1092, 65535, 65535, 65535, 1093, 65535, 1094, 1095,
+    65535, 1096, 65535, 65535, 1097, 1098, 1099, 65535, 65535, 65535, 1100, 65535, 65535, 65535, 1101, 65535,
+    1102, 1103, 1104, 65535, 1105, 65535, 1106, 65535, 1107, 65535, 1108, 65535, 1109, 65535, 65535, 1110,
+    1111, 1112, 65535, 65535, 65535, 1113, 65535, 65535, 65535, 1114, 65535, 1115, 1116, 1117, 65535, 1118,
+    65535, 1119, 65535, 1120, 65535, 65535, 65535, 1121, 65535, 65535, 65535, 1122, 65535, 1123, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 1124, 1125, 65535, 1126, 65535, 65535, 1127, 1128, 1129, 65535,
+    1130, 1131, 65535, 1132, 65535, 1133, 65535, 1134, 65535, 1135, 65535, 1136, 65535, 65535, 1137, 1138,
+    1139, 65535, 65535, 1140, 65535, 1141, 1142, 65535, 65535, 65535, 65535, 65535, 65535, 1143, 65535, 65535,
+    65535, 1144, 65535, 1145, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1146, 1147, 65535, 1148,
+    65535, 65535, 1149, 1150, 1151, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1152, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1153, 65535, 65535, 65535, 1154, 65535,
+    1155, 1156, 65535, 1157, 65535, 65535, 1158, 1159, 1160, 65535, 65535, 65535, 1161, 65535, 65535, 65535,
+    1162, 65535, 65535, 1163, 1164, 65535, 1165, 65535, 65535, 65535, 1166, 65535, 1167, 1168, 65535, 1169,
+    65535, 1170, 65535, 1171, 65535, 1172, 65535, 1173, 65535, 65535, 1174, 1175, 1176, 65535, 65535, 1177,
+    65535, 1178, 1179, 65535, 65535, 65535, 65535, 1180, 65535, 1181, 65535, 65535, 1182, 1183, 1184, 65535,
+    65535, 65535, 1185, 65535, 65535, 65535, 1186, 65535, 1187, 1188, 1189, 65535, 1190, 65535, 1191, 65535,
+    65535, 65535, 65535, 1192, 65535, 1193, 65535, 65535, 65535, 65535, 65535, 1194, 65535, 65535, 65535, 65535,
+    1195, 65535, 1196, 65535, 65535, 65535, 65535, 65535, 1197, 65535, 65535, 65535, 65535, 1198, 1199, 65535,
+    1200, 65535, 1201, 65535, 1202, 65535, 1203, 65535, 1204, 65535, 65535, 1205, 1206, 1207, 65535, 65535,
+    1208, 65535, 1209, 1210, 65535, 65535, 65535, 65535, 1211, 65535, 1212, 65535, 65535, 1213, 1214, 1215,
+    65535, 65535, 65535, 1216, 65535, 65535, 65535, 1217, 65535, 1218, 1219, 1220, 65535, 1221, 65535, 1222,
+    65535, 1223, 65535, 65535, 1224, 65535, 1225, 1226, 65535, 65535, 65535, 65535, 1227, 1228, 65535, 1229,
+    65535, 1230, 65535, 1231, 65535, 65535, 65535, 65535, 65535, 1232, 65535, 65535, 65535, 65535, 1233, 65535,
+    1234, 65535, 65535, 1235, 1236, 1237, 65535, 65535, 65535, 1238, 65535, 65535, 65535, 1239, 65535, 1240,
+    1241, 1242, 65535, 1243, 65535, 65535, 65535, 1244, 65535, 65535, 65535, 1245, 65535, 65535, 65535, 1246,
+    65535, 1247, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1248, 1249, 65535, 1250, 65535, 65535,
+    1251, 1252, 1253, 65535, 1254, 1255, 65535, 1256, 65535, 65535, 65535, 1257, 65535, 1258, 65535, 1259,
+    65535, 65535, 65535, 1260, 1261, 65535, 65535, 1262, 65535, 65535, 1263, 65535, 65535, 65535, 65535, 65535,
+    1264, 65535, 1265, 1266, 65535, 65535, 65535, 65535, 1267, 1268, 65535, 1269, 65535, 1270, 65535, 1271,
+    65535, 65535, 65535, 65535, 65535, 1272, 65535, 65535, 65535, 65535, 1273, 1274, 65535, 1275, 65535, 1276,
+    65535, 1277, 65535, 1278, 65535, 1279, 65535, 65535, 1280, 1281, 1282, 65535, 65535, 1283, 65535, 1284,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1285, 65535, 65535, 65535, 65535, 65535, 1286,
+    65535, 1287, 1288, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    1289, 65535, 1290, 65535, 65535, 1291, 1292, 1293, 65535, 65535, 65535, 1294, 65535, 65535, 65535, 1295,
+    65535, 1296, 1297, 1298, 65535, 1299, 65535, 1300, 65535, 1301, 65535, 65535, 65535, 1302, 65535, 65535,
+    65535, 1303, 65535, 1304, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1305, 1306, 65535, 1307,
+    65535, 65535, 1308, 1309, 1310, 65535, 1311, 1312, 65535, 1313, 65535, 1314, 65535, 1315, 65535, 1316,
+    65535, 1317, 65535, 65535, 65535, 1318, 1319, 65535, 65535, 1320, 65535, 1321, 1322, 65535, 65535, 65535,
+    65535, 65535, 65535, 1323, 65535, 65535, 65535, 1324, 65535, 1325, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 1326, 1327, 65535, 1328, 65535, 65535, 1329, 1330, 1331, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 1332, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    1333, 65535, 65535, 65535, 1334, 65535, 65535, 1335, 65535, 1336, 65535, 65535, 65535, 1337, 1338, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 1339, 65535, 1340, 1341, 1342, 65535, 1343, 65535, 65535, 65535,
+    1344, 65535, 1345, 1346, 65535, 1347, 65535, 1348, 65535, 1349, 65535, 1350, 65535, 1351, 65535, 65535,
+    1352, 1353, 1354, 65535, 65535, 1355, 65535, 1356, 65535, 65535, 65535, 65535, 65535, 1357, 65535, 1358,
+    65535, 65535, 1359, 1360, 1361, 65535, 65535, 65535, 1362, 65535, 65535, 65535, 1363, 65535, 1364, 1365,
+    65535, 65535, 65535, 65535, 1366, 65535, 1367, 65535, 65535, 1368, 65535, 1369, 1370, 65535, 65535, 65535,
+    65535, 1371, 1372, 65535, 1373, 65535, 1374, 65535, 1375, 65535, 65535, 65535, 65535, 65535, 1376, 65535,
+    65535, 65535, 65535, 65535, 1377, 65535, 1378, 1379, 65535, 65535, 65535, 65535, 1380, 1381, 65535, 1382,
+    65535, 1383, 65535, 1384, 65535, 65535, 65535, 65535, 65535, 1385, 65535, 65535, 65535, 65535, 1386, 1387,
+    65535, 1388, 65535, 1389, 65535, 1390, 65535, 1391, 65535, 1392, 65535, 65535, 1393, 1394, 1395, 65535,
+    65535, 1396, 65535, 1397, 1398, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1399, 65535, 65535,
+    65535, 65535, 65535, 1400, 65535, 1401, 1402, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 1403, 1404, 65535, 1405, 65535, 65535, 65535, 1406, 65535, 1407, 65535, 1408,
+    65535, 65535, 1409, 1410, 1411, 65535, 65535, 1412, 65535, 65535, 1413, 65535, 65535, 65535, 65535, 1414,
+    65535, 1415, 65535, 65535, 1416, 1417, 1418, 65535, 65535, 65535, 1419, 65535, 65535, 65535, 1420, 65535,
+    1421, 1422, 1423, 65535, 1424, 65535, 65535, 65535, 1425, 65535, 65535, 1426, 65535, 65535, 1427, 65535,
+    65535, 65535, 65535, 1428, 1429, 65535, 1430, 65535, 65535, 65535, 1431, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1432, 65535, 65535, 65535, 65535, 65535, 1433,
+    65535, 1434, 1435, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 1436, 65535, 1437, 1438, 65535, 65535, 65535, 65535, 1439, 1440, 65535, 1441, 65535, 1442, 65535,
+    1443, 65535, 65535, 65535, 65535, 65535, 1444, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 1445, 65535, 1446, 1447, 65535, 65535, 65535, 65535, 1448,
+    1449, 65535, 1450, 65535, 1451, 65535, 1452, 65535, 65535, 65535, 65535, 65535, 1453, 65535, 65535, 65535,
+    65535, 1454, 1455, 65535, 1456, 65535, 1457, 65535, 1458, 65535, 1459, 65535, 1460, 65535, 65535, 1461,
+    1462, 1463, 65535, 65535, 1464, 65535, 1465, 1466, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    1467, 65535, 65535, 65535, 65535, 65535, 1468, 65535, 1469, 1470, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 1471, 1472, 65535, 1473, 65535, 1474, 65535, 1475, 65535,
+    1476, 65535, 1477, 65535, 65535, 1478, 1479, 1480, 65535, 65535, 1481, 65535, 1482, 1483, 65535, 65535,
+    65535, 65535, 1484, 65535, 1485, 65535, 65535, 1486, 1487, 1488, 65535, 65535, 65535, 1489, 65535, 65535,
+    65535, 1490, 65535, 1491, 1492, 1493, 65535, 1494, 65535, 1495, 65535, 1496, 65535, 65535, 1497, 65535,
+    1498, 1499, 65535, 65535, 65535, 65535, 1500, 1501, 65535, 1502, 65535, 1503, 65535, 1504, 65535, 65535,
+    65535, 65535, 65535, 1505, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1506, 65535, 65535, 65535,
+    65535, 65535, 1507, 65535, 1508, 1509, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 1510, 65535, 1511, 1512, 65535, 65535, 65535, 65535, 1513, 1514, 65535, 1515,
+    65535, 1516, 65535, 1517, 65535, 65535, 65535, 65535, 65535, 1518, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1519, 1520, 65535, 1521, 65535, 1522, 65535,
+    1523, 65535, 1524, 65535, 1525, 65535, 65535, 1526, 1527, 1528, 65535, 65535, 1529, 65535, 1530, 1531,
+    65535, 65535, 65535, 65535, 1532, 65535, 1533, 65535, 65535, 1534, 1535, 1536, 65535, 65535, 65535, 1537,
+    65535, 65535, 65535, 1538, 65535, 1539, 1540, 1541, 65535, 1542, 65535, 1543, 65535, 1544, 65535, 65535,
+    1545, 65535, 1546, 1547, 65535, 65535, 65535, 65535, 1548, 1549, 65535, 1550, 65535, 1551, 65535, 1552,
+    65535, 65535, 65535, 65535, 65535, 1553, 65535, 65535, 65535, 65535, 1554, 65535, 1555, 65535, 65535, 1556,
+    1557, 1558, 65535, 65535, 65535, 1559, 65535, 65535, 65535, 1560, 65535, 1561, 1562, 1563, 65535, 1564,
+    65535, 1565, 65535, 1566, 65535, 65535, 65535, 1567, 65535, 65535, 65535, 1568, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 1569, 1570, 65535, 65535, 65535, 65535, 1571, 65535, 1572, 65535,
+    1573, 1574, 65535, 1575, 65535, 1576, 65535, 1577, 65535, 1578, 65535, 1579, 65535, 65535, 1580, 1581,
+    1582, 65535, 65535, 1583, 65535, 1584, 1585, 65535, 65535, 65535, 65535, 65535, 1586, 65535, 1587, 1588,
+    65535, 65535, 65535, 65535, 1589, 1590, 65535, 1591, 65535, 1592, 65535, 1593, 65535, 65535, 65535, 65535,
+    65535, 1594, 65535, 65535, 65535, 65535, 1595, 1596, 65535, 1597, 65535, 1598, 65535, 1599, 65535, 1600,
+    65535, 1601, 65535, 65535, 1602, 1603, 65535, 65535, 65535, 1604, 65535, 1605, 1606, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 1607, 65535, 65535, 65535, 65535, 65535, 1608, 65535, 1609, 1610, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    1611, 65535, 65535, 65535, 65535, 65535, 1612, 65535, 1613, 1614, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1615, 65535, 1616, 1617, 65535, 65535, 65535, 65535,
+    1618, 1619, 65535, 1620, 65535, 1621, 65535, 1622, 65535, 65535, 65535, 65535, 65535, 1623, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1624, 65535,
+    1625, 1626, 65535, 65535, 65535, 65535, 1627, 1628, 65535, 1629, 65535, 1630, 65535, 1631, 65535, 65535,
+    65535, 65535, 65535, 1632, 65535, 65535, 65535, 65535, 1633, 1634, 65535, 1635, 65535, 1636, 65535, 1637,
+    65535, 1638, 65535, 1639, 65535, 65535, 1640, 1641, 1642, 65535, 65535, 1643, 65535, 1644, 1645, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 1646, 65535, 65535, 65535, 65535, 65535, 1647, 65535, 1648,
+    1649, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1650, 65535, 65535,
+    65535, 65535, 65535, 1651, 65535, 1652, 1653, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1654,
+    1655, 65535, 1656, 65535, 1657, 65535, 1658, 65535, 1659, 65535, 1660, 65535, 65535, 1661, 1662, 1663,
+    65535, 65535, 1664, 65535, 1665, 1666, 65535, 65535, 65535, 65535, 1667, 65535, 1668, 65535, 65535, 1669,
+    1670, 1671, 65535, 65535, 65535, 1672, 65535, 65535, 65535, 1673, 65535, 1674, 1675, 1676, 65535, 1677,
+    65535, 1678, 65535, 65535, 65535, 65535, 1679, 65535, 1680, 1681, 65535, 65535, 65535, 65535, 1682, 1683,
+    65535, 1684, 65535, 1685, 65535, 1686, 65535, 65535, 65535, 65535, 65535, 1687, 65535, 65535, 65535, 65535,
+    1688, 65535, 1689, 65535, 65535, 1690, 1691, 1692, 65535, 65535, 65535, 1693, 65535, 65535, 65535, 1694,
+    65535, 65535, 1695, 1696, 65535, 1697, 65535, 1698, 65535, 1699, 65535, 65535, 65535, 1700, 65535, 65535,
+    65535, 1701, 65535, 1702, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1703, 1704, 65535, 1705,
+    65535, 65535, 1706, 1707, 1708, 65535, 1709, 1710, 65535, 1711, 65535, 1712, 65535, 1713, 65535, 1714,
+    65535, 65535, 65535, 65535, 1715, 65535, 1716, 65535, 65535, 1717, 65535, 1718, 1719, 65535, 65535, 65535,
+    65535, 65535, 1720, 65535, 1721, 1722, 65535, 65535, 65535, 65535, 1723, 1724, 65535, 1725, 65535, 1726,
+    65535, 1727, 65535, 65535, 65535, 65535, 65535, 1728, 65535, 65535, 65535, 65535, 1729, 1730, 65535, 1731,
+    65535, 1732, 65535, 65535, 65535, 1733, 65535, 1734, 65535, 65535, 1735, 1736, 65535, 65535, 65535, 65535,
+    65535, 1737, 1738, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1739, 65535, 65535, 65535, 65535,
+    65535, 1740, 65535, 1741, 1742, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 1743, 65535, 1744, 65535, 65535, 1745, 1746, 1747, 65535, 65535, 65535, 1748, 65535, 65535,
+    65535, 1749, 65535, 1750, 1751, 1752, 65535, 1753, 65535, 1754, 65535, 1755, 65535, 65535, 65535, 1756,
+    65535, 65535, 65535, 1757, 65535, 1758, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1759, 1760,
+    65535, 1761, 65535, 65535, 1762, 1763, 1764, 65535, 1765, 1766, 65535, 1767, 65535, 1768, 65535, 1769,
+    65535, 1770, 65535, 1771, 65535, 65535, 1772, 1773, 1774, 65535, 65535, 1775, 65535, 1776, 1777, 65535,
+    65535, 65535, 65535, 65535, 65535, 1778, 65535, 65535, 65535, 1779, 65535, 1780, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 1781, 1782, 65535, 1783, 65535, 65535, 1784, 1785, 1786, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 1787, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 1788, 65535, 65535, 65535, 1789, 65535, 65535, 1790, 65535, 1791, 65535, 65535, 1792, 1793,
+    1794, 65535, 65535, 65535, 1795, 65535, 65535, 65535, 1796, 65535, 65535, 1797, 1798, 65535, 1799, 65535,
+    1800, 65535, 1801, 65535, 1802, 1803, 65535, 1804, 65535, 1805, 65535, 1806, 65535, 1807, 65535, 1808,
+    65535, 65535, 1809, 1810, 65535, 65535, 65535, 1811, 65535, 1812, 1813, 65535, 65535, 65535, 65535, 1814,
+    65535, 1815, 65535, 65535, 1816, 1817, 65535, 65535, 65535, 65535, 1818, 65535, 65535, 65535, 65535, 65535,
+    1819, 1820, 1821, 65535, 1822, 65535, 1823, 65535, 65535, 65535, 65535, 1824, 65535, 1825, 1826, 65535,
+    65535, 65535, 65535, 1827, 1828, 65535, 1829, 65535, 1830, 65535, 1831, 65535, 65535, 65535, 65535, 65535,
+    1832, 65535, 65535, 65535, 65535, 65535, 1833, 65535, 1834, 1835, 65535, 65535, 65535, 65535, 1836, 1837,
+    65535, 1838, 65535, 1839, 65535, 1840, 65535, 65535, 65535, 65535, 65535, 1841, 65535, 65535, 65535, 65535,
+    1842, 1843, 65535, 1844, 65535, 1845, 65535, 65535, 65535, 1846, 65535, 1847, 65535, 65535, 1848, 1849,
+    1850, 65535, 65535, 65535, 65535, 1851, 1852, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1853,
+    65535, 65535, 65535, 65535, 65535, 1854, 65535, 1855, 1856, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 1857, 1858, 65535, 1859, 65535, 1860, 65535, 1861, 65535, 1862,
+    65535, 65535, 65535, 65535, 1863, 65535, 1864, 65535, 65535, 1865, 65535, 1866, 1867, 65535, 65535, 65535,
+    65535, 1868, 65535, 1869, 65535, 65535, 1870, 1871, 1872, 65535, 65535, 65535, 1873, 65535, 65535, 65535,
+    1874, 65535, 65535, 1875, 1876, 65535, 1877, 65535, 1878, 65535, 65535, 65535, 65535, 1879, 65535, 1880,
+    1881, 65535, 65535, 65535, 65535, 65535, 1882, 65535, 1883, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 1884, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1885, 65535, 65535, 65535, 65535,
+    65535, 1886, 65535, 1887, 1888, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 1889, 1890, 65535, 65535, 65535, 65535, 1891, 1892, 65535, 1893, 65535,
+    1894, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1895, 65535, 65535, 65535,
+    65535, 65535, 1896, 65535, 1897, 1898, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 1899, 65535, 1900, 1901, 65535, 65535, 65535, 65535, 1902, 1903, 65535, 1904,
+    65535, 1905, 65535, 1906, 65535, 65535, 65535, 65535, 65535, 1907, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1908, 65535, 1909, 1910, 65535, 65535,
+    65535, 65535, 1911, 1912, 65535, 1913, 65535, 1914, 65535, 1915, 65535, 65535, 65535, 65535, 65535, 1916,
+    65535, 65535, 65535, 65535, 1917, 1918, 65535, 1919, 65535, 1920, 65535, 1921, 65535, 1922, 65535, 1923,
+    65535, 65535, 1924, 1925, 1926, 65535, 65535, 1927, 65535, 1928, 1929, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 1930, 65535, 65535, 65535, 65535, 65535, 1931, 65535, 1932, 1933, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1934, 65535, 65535, 65535, 65535, 65535, 1935,
+    65535, 1936, 1937, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1938, 65535, 1939, 1940,
+    65535, 65535, 65535, 65535, 1941, 1942, 65535, 1943, 65535, 1944, 65535, 1945, 65535, 65535, 65535, 65535,
+    65535, 1946, 65535, 65535, 65535, 65535, 1947, 1948, 65535, 1949, 65535, 1950, 65535, 1951, 65535, 1952,
+    65535, 1953, 65535, 65535, 1954, 1955, 1956, 65535, 65535, 1957, 65535, 1958, 1959, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 1960, 65535, 65535, 65535, 65535, 65535, 1961, 65535, 1962, 1963, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1964, 1965, 65535, 1966,
+    65535, 1967, 65535, 1968, 65535, 1969, 65535, 1970, 65535, 65535, 1971, 1972, 1973, 65535, 65535, 1974,
+    65535, 1975, 1976, 65535, 65535, 65535, 65535, 1977, 65535, 65535, 65535, 65535, 1978, 65535, 1979, 65535,
+    65535, 65535, 1980, 65535, 65535, 65535, 1981, 65535, 65535, 65535, 1982, 65535, 1983, 65535, 65535, 65535,
+    65535, 65535, 65535, 1984, 65535, 1985, 1986, 65535, 65535, 65535, 65535, 1987, 1988, 65535, 1989, 65535,
+    1990, 65535, 1991, 65535, 65535, 65535, 65535, 65535, 1992, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 1993, 65535, 65535, 65535, 65535, 65535, 1994, 65535, 1995, 1996, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 1997, 65535, 1998, 1999, 65535, 65535, 65535,
+    65535, 2000, 2001, 65535, 2002, 65535, 2003, 65535, 2004, 65535, 65535, 65535, 65535, 65535, 2005, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2006, 65535, 65535,
+    65535, 65535, 65535, 2007, 65535, 2008, 2009, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 2010, 65535, 65535, 65535, 65535, 65535, 2011, 65535, 2012, 2013, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2014, 65535, 2015, 2016, 65535,
+    65535, 65535, 65535, 2017, 2018, 65535, 2019, 65535, 2020, 65535, 2021, 65535, 65535, 65535, 65535, 65535,
+    2022, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 2023, 65535, 2024, 65535, 65535, 2025, 2026, 2027, 65535, 65535, 65535, 2028, 65535, 65535, 65535,
+    2029, 65535, 2030, 2031, 2032, 65535, 2033, 65535, 2034, 65535, 2035, 65535, 65535, 65535, 2036, 65535,
+    65535, 65535, 2037, 65535, 2038, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2039, 2040, 65535,
+    2041, 65535, 65535, 2042, 2043, 2044, 65535, 2045, 2046, 65535, 2047, 65535, 2048, 65535, 2049, 65535,
+    2050, 65535, 2051, 65535, 65535, 2052, 2053, 2054, 65535, 65535, 2055, 65535, 2056, 2057, 65535, 65535,
+    65535, 65535, 65535, 65535, 2058, 65535, 65535, 65535, 2059, 65535, 2060, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 2061, 2062, 65535, 2063, 65535, 65535, 2064, 2065, 2066, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 2067, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 2068, 65535, 65535, 65535, 2069, 65535, 2070, 2071, 65535, 2072, 65535, 65535, 2073, 2074, 2075,
+    65535, 65535, 65535, 2076, 65535, 65535, 65535, 2077, 65535, 2078, 2079, 2080, 65535, 2081, 65535, 2082,
+    65535, 65535, 65535, 2083, 2084, 65535, 2085, 65535, 2086, 65535, 2087, 65535, 2088, 65535, 2089, 65535,
+    65535, 2090, 2091, 2092, 65535, 65535, 2093, 65535, 2094, 2095, 65535, 65535, 65535, 65535, 2096, 65535,
+    2097, 65535, 65535, 2098, 2099, 2100, 65535, 65535, 65535, 2101, 65535, 65535, 65535, 2102, 65535, 2103,
+    2104, 2105, 65535, 2106, 65535, 2107, 65535, 2108, 65535, 65535, 2109, 65535, 2110, 2111, 65535, 65535,
+    65535, 65535, 2112, 2113, 65535, 2114, 65535, 2115, 65535, 2116, 65535, 65535, 65535, 65535, 65535, 2117,
+    65535, 65535, 65535, 65535, 65535, 65535, 2118, 65535, 65535, 65535, 2119, 65535, 2120, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 2121, 2122, 65535, 2123, 65535, 65535, 2124, 2125, 2126, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 2127, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 2128, 65535, 65535, 65535, 2129, 65535, 2130, 2131, 65535, 2132, 65535, 65535, 2133,
+    2134, 2135, 65535, 65535, 65535, 2136, 65535, 65535, 65535, 2137, 65535, 65535, 2138, 2139, 65535, 2140,
+    65535, 2141, 65535, 2142, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2143, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2144, 65535, 65535, 65535, 2145, 65535, 2146,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2147, 65535, 65535,
+    65535, 2148, 65535, 2149, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2150, 2151, 65535, 2152,
+    65535, 65535, 2153, 2154, 2155, 65535, 2156, 65535, 2157, 65535, 65535, 2158, 2159, 2160, 65535, 65535,
+    65535, 2161, 65535, 65535, 65535, 2162, 65535, 65535, 2163, 2164, 65535, 2165, 65535, 2166, 65535, 2167,
+    65535, 65535, 65535, 2168, 65535, 65535, 65535, 2169, 65535, 2170, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 2171, 2172, 65535, 2173, 65535, 65535, 2174, 2175, 2176, 65535, 2177, 2178, 65535, 2179,
+    65535, 2180, 65535, 2181, 65535, 2182, 65535, 65535, 65535, 65535, 2183, 65535, 2184, 65535, 65535, 2185,
+    65535, 2186, 2187, 65535, 65535, 65535, 65535, 2188, 2189, 65535, 2190, 65535, 2191, 65535, 2192, 65535,
+    2193, 65535, 2194, 65535, 65535, 2195, 2196, 2197, 65535, 65535, 2198, 65535, 2199, 2200, 65535, 65535,
+    65535, 65535, 2201, 65535, 2202, 65535, 65535, 2203, 2204, 2205, 65535, 65535, 65535, 2206, 65535, 65535,
+    65535, 2207, 65535, 2208, 2209, 2210, 65535, 2211, 65535, 2212, 65535, 2213, 65535, 65535, 2214, 65535,
+    2215, 2216, 65535, 65535, 65535, 65535, 2217, 2218, 65535, 2219, 65535, 2220, 65535, 2221, 65535, 65535,
+    65535, 65535, 65535, 2222, 65535, 65535, 65535, 65535, 2223, 65535, 2224, 65535, 65535, 2225, 2226, 2227,
+    65535, 65535, 65535, 2228, 65535, 65535, 65535, 2229, 65535, 2230, 2231, 2232, 65535, 2233, 65535, 2234,
+    65535, 65535, 65535, 65535, 65535, 2235, 65535, 65535, 65535, 2236, 65535, 2237, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 2238, 2239, 65535, 2240, 65535, 65535, 2241, 2242, 2243, 65535, 2244, 2245,
+    65535, 2246, 65535, 2247, 65535, 65535, 65535, 2248, 65535, 2249, 65535, 65535, 2250, 2251, 2252, 65535,
+    65535, 65535, 65535, 2253, 2254, 65535, 65535, 65535, 65535, 65535, 2255, 65535, 2256, 2257, 65535, 65535,
+    65535, 65535, 2258, 2259, 65535, 2260, 65535, 2261, 65535, 2262, 65535, 65535, 65535, 65535, 65535, 2263,
+    65535, 65535, 65535, 65535, 2264, 2265, 65535, 2266, 65535, 2267, 65535, 2268, 65535, 2269, 65535, 2270,
+    65535, 65535, 2271, 2272, 2273, 65535, 65535, 2274, 65535, 2275, 2276, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 2277, 65535, 65535, 65535, 65535, 65535, 2278, 65535, 2279, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2280, 65535, 65535, 65535,
+    2281, 65535, 2282, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2283, 2284, 65535, 2285, 65535,
+    65535, 2286, 2287, 2288, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2289, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2290, 65535, 65535, 65535, 2291, 65535, 2292,
+    2293, 65535, 2294, 65535, 65535, 2295, 2296, 2297, 65535, 65535, 65535, 2298, 65535, 65535, 65535, 2299,
+    65535, 2300, 2301, 2302, 65535, 2303, 65535, 2304, 65535, 2305, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 2306, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2307,
+    65535, 65535, 65535, 2308, 65535, 2309, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 2310, 65535, 65535, 65535, 2311, 65535, 2312, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 2313, 2314, 65535, 2315, 65535, 65535, 2316, 2317, 2318, 65535, 2319, 65535, 2320, 65535,
+    65535, 2321, 2322, 2323, 65535, 65535, 65535, 2324, 65535, 65535, 65535, 2325, 65535, 2326, 2327, 2328,
+    65535, 2329, 65535, 2330, 65535, 2331, 65535, 65535, 65535, 2332, 65535, 65535, 65535, 2333, 65535, 2334,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2335, 2336, 65535, 2337, 65535, 65535, 2338, 2339,
+    2340, 65535, 2341, 2342, 65535, 2343, 65535, 2344, 65535, 2345, 65535, 2346, 65535, 2347, 65535, 65535,
+    2348, 2349, 2350, 65535, 65535, 2351, 65535, 2352, 2353, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 2354, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 2355, 65535, 65535, 65535, 2356, 65535, 2357, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 2358, 65535, 65535, 65535, 2359, 65535, 2360, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 2361, 2362, 65535, 2363, 65535, 65535, 2364, 2365, 2366, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2367, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2368, 65535, 65535, 65535, 2369, 65535, 2370, 65535,
+    65535, 2371, 65535, 65535, 65535, 2372, 65535, 2373, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    2374, 2375, 65535, 2376, 65535, 65535, 2377, 2378, 2379, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 2380, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2381, 65535,
+    65535, 65535, 2382, 65535, 2383, 2384, 65535, 2385, 65535, 65535, 2386, 2387, 2388, 65535, 65535, 65535,
+    2389, 65535, 65535, 65535, 2390, 65535, 65535, 2391, 2392, 65535, 2393, 65535, 2394, 65535, 2395, 65535,
+    2396, 65535, 2397, 65535, 65535, 2398, 2399, 2400, 65535, 65535, 65535, 2401, 65535, 65535, 65535, 2402,
+    65535, 2403, 2404, 2405, 65535, 2406, 65535, 2407, 65535, 2408, 65535, 65535, 65535, 2409, 65535, 65535,
+    65535, 2410, 65535, 2411, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2412, 2413, 65535, 2414,
+    65535, 65535, 2415, 2416, 2417, 65535, 2418, 2419, 65535, 2420, 65535, 2421, 65535, 2422, 65535, 2423,
+    65535, 2424, 65535, 65535, 2425, 2426, 2427, 65535, 65535, 2428, 65535, 2429, 2430, 65535, 65535, 65535,
+    65535, 65535, 65535, 2431, 65535, 65535, 65535, 2432, 65535, 2433, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 2434, 2435, 65535, 2436, 65535, 65535, 2437, 2438, 2439, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 2440, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    2441, 65535, 65535, 65535, 2442, 65535, 2443, 2444, 65535, 2445, 65535, 65535, 2446, 2447, 2448, 65535,
+    65535, 65535, 2449, 65535, 65535, 65535, 2450, 65535, 65535, 2451, 2452, 65535, 2453, 65535, 2454, 65535,
+    65535, 65535, 2455, 2456, 65535, 2457, 65535, 2458, 65535, 2459, 65535, 2460, 65535, 2461, 65535, 65535,
+    2462, 2463, 2464, 65535, 65535, 2465, 65535, 2466, 2467, 65535, 65535, 65535, 65535, 2468, 65535, 2469,
+    65535, 65535, 2470, 2471, 2472, 65535, 65535, 65535, 2473, 65535, 65535, 65535, 2474, 65535, 2475, 2476,
+    2477, 65535, 2478, 65535, 2479, 65535, 65535, 65535, 65535, 2480, 65535, 2481, 65535, 65535, 65535, 65535,
+    65535, 2482, 65535, 65535, 65535, 65535, 2483, 65535, 2484, 65535, 65535, 65535, 65535, 65535, 2485, 65535,
+    65535, 65535, 65535, 2486, 2487, 65535, 2488, 65535, 2489, 65535, 2490, 65535, 2491, 65535, 2492, 65535,
+    65535, 2493, 2494, 2495, 65535, 65535, 2496, 65535, 2497, 2498, 65535, 65535, 65535, 65535, 2499, 65535,
+    2500, 65535, 65535, 2501, 2502, 2503, 65535, 65535, 65535, 2504, 65535, 65535, 65535, 2505, 65535, 2506,
+    2507, 2508, 65535, 2509, 65535, 2510, 65535, 2511, 65535, 65535, 2512, 65535, 2513, 2514, 65535, 65535,
+    65535, 65535, 2515, 2516, 65535, 2517, 65535, 2518, 65535, 2519, 65535, 65535, 65535, 65535, 65535, 2520,
+    65535, 65535, 65535, 65535, 2521, 65535, 2522, 65535, 65535, 2523, 2524, 2525, 65535, 65535, 65535, 2526,
+    65535, 65535, 65535, 2527, 65535, 2528, 2529, 2530, 65535, 2531, 65535, 2532, 65535, 65535, 65535, 65535,
+    65535, 2533, 65535, 65535, 65535, 2534, 65535, 2535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    2536, 2537, 65535, 2538, 65535, 65535, 2539, 2540, 2541, 65535, 2542, 2543, 65535, 2544, 65535, 2545,
+    65535, 65535, 65535, 2546, 65535, 2547, 65535, 65535, 65535, 2548, 2549, 65535, 65535, 65535, 65535, 2550,
+    2551, 65535, 65535, 65535, 65535, 65535, 2552, 65535, 2553, 2554, 65535, 65535, 65535, 65535, 2555, 2556,
+    65535, 2557, 65535, 2558, 65535, 2559, 65535, 65535, 65535, 65535, 65535, 2560, 65535, 65535, 65535, 65535,
+    2561, 2562, 65535, 2563, 65535, 2564, 65535, 2565, 65535, 2566, 65535, 2567, 65535, 65535, 2568, 2569,
+    2570, 65535, 65535, 2571, 65535, 2572, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2573,
+    65535, 65535, 65535, 65535, 65535, 2574, 65535, 2575, 2576, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 2577, 65535, 2578, 65535, 65535, 2579, 2580, 2581, 65535, 65535,
+    65535, 2582, 65535, 65535, 65535, 2583, 65535, 65535, 2584, 2585, 65535, 2586, 65535, 2587, 65535, 2588,
+    65535, 65535, 65535, 2589, 65535, 65535, 65535, 2590, 65535, 2591, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 2592, 2593, 65535, 2594, 65535, 65535, 2595, 2596, 2597, 65535, 2598, 2599, 65535, 2600,
+    65535, 2601, 65535, 2602, 65535, 2603, 65535, 65535, 65535, 65535, 65535, 65535, 2604, 65535, 65535, 2605,
+    65535, 2606, 2607, 65535, 65535, 65535, 65535, 65535, 65535, 2608, 65535, 65535, 65535, 2609, 65535, 2610,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2611, 2612, 65535, 2613, 65535, 65535, 2614, 2615,
+    2616, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2617, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 2618, 65535, 65535, 65535, 2619, 65535, 65535, 2620, 65535, 2621,
+    65535, 65535, 65535, 2622, 2623, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2624, 65535, 65535, 2625,
+    2626, 65535, 2627, 65535, 2628, 65535, 65535, 65535, 2629, 2630, 65535, 2631, 65535, 2632, 65535, 2633,
+    65535, 2634, 65535, 65535, 65535, 65535, 2635, 65535, 2636, 65535, 65535, 2637, 65535, 2638, 65535, 65535,
+    65535, 65535, 65535, 2639, 65535, 2640, 65535, 65535, 2641, 2642, 2643, 65535, 65535, 65535, 2644, 65535,
+    65535, 65535, 2645, 65535, 65535, 2646, 65535, 65535, 65535, 65535, 2647, 65535, 2648, 65535, 65535, 2649,
+    65535, 2650, 2651, 65535, 65535, 65535, 65535, 65535, 2652, 65535, 2653, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 2654, 65535, 65535, 65535, 65535, 65535, 2655, 65535, 2656, 2657, 65535, 65535,
+    65535, 65535, 2658, 2659, 65535, 2660, 65535, 2661, 65535, 2662, 65535, 65535, 65535, 65535, 65535, 2663,
+    65535, 65535, 65535, 65535, 2664, 2665, 65535, 2666, 65535, 2667, 65535, 2668, 65535, 2669, 65535, 2670,
+    65535, 65535, 2671, 2672, 2673, 65535, 65535, 2674, 65535, 2675, 2676, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 2677, 65535, 65535, 65535, 65535, 65535, 2678, 65535, 2679, 2680, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2681, 2682, 65535, 2683, 65535, 2684,
+    65535, 65535, 65535, 2685, 65535, 2686, 65535, 65535, 2687, 2688, 2689, 65535, 65535, 65535, 65535, 2690,
+    2691, 65535, 65535, 65535, 65535, 2692, 65535, 2693, 65535, 65535, 2694, 2695, 2696, 65535, 65535, 65535,
+    2697, 65535, 65535, 65535, 2698, 65535, 2699, 2700, 2701, 65535, 2702, 65535, 2703, 65535, 65535, 65535,
+    65535, 65535, 65535, 2704, 2705, 65535, 65535, 65535, 65535, 2706, 2707, 65535, 2708, 65535, 2709, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2710,
+    65535, 65535, 65535, 65535, 65535, 2711, 65535, 2712, 2713, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 2714, 65535, 2715, 2716, 65535, 65535, 65535, 65535, 2717,
+    2718, 65535, 2719, 65535, 2720, 65535, 2721, 65535, 65535, 65535, 65535, 65535, 2722, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2723, 65535,
+    65535, 65535, 2724, 65535, 2725, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2726, 2727, 65535,
+    2728, 65535, 65535, 2729, 2730, 2731, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2732,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2733, 65535, 65535, 65535, 2734,
+    65535, 2735, 2736, 65535, 2737, 65535, 65535, 2738, 2739, 2740, 65535, 65535, 65535, 2741, 65535, 65535,
+    65535, 2742, 65535, 2743, 2744, 2745, 65535, 2746, 65535, 2747, 65535, 2748, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 2749, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 2750, 65535, 65535, 65535, 2751, 65535, 2752, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 2753, 65535, 65535, 65535, 2754, 65535, 2755, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 2756, 2757, 65535, 2758, 65535, 65535, 2759, 2760, 2761, 65535, 2762, 65535,
+    2763, 65535, 65535, 2764, 2765, 2766, 65535, 65535, 65535, 2767, 65535, 65535, 65535, 2768, 65535, 2769,
+    2770, 2771, 65535, 2772, 65535, 2773, 65535, 2774, 65535, 65535, 65535, 2775, 65535, 65535, 65535, 2776,
+    65535, 2777, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2778, 2779, 65535, 2780, 65535, 65535,
+    2781, 2782, 2783, 65535, 2784, 2785, 65535, 2786, 65535, 2787, 65535, 2788, 65535, 2789, 65535, 2790,
+    65535, 65535, 2791, 2792, 2793, 65535, 65535, 2794, 65535, 2795, 2796, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 2797, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 2798, 65535, 65535, 65535, 2799, 65535, 2800, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 2801, 65535, 65535, 65535, 2802, 65535, 2803, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 2804, 2805, 65535, 2806, 65535, 65535, 2807, 2808, 2809, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2810, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2811, 65535, 65535, 65535, 2812, 65535,
+    2813, 65535, 65535, 2814, 65535, 65535, 65535, 2815, 65535, 2816, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 2817, 2818, 65535, 2819, 65535, 65535, 2820, 2821, 2822, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 2823, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    2824, 65535, 65535, 65535, 2825, 65535, 2826, 2827, 65535, 2828, 65535, 65535, 2829, 2830, 2831, 65535,
+    65535, 65535, 2832, 65535, 65535, 65535, 2833, 65535, 65535, 2834, 2835, 65535, 2836, 65535, 2837, 65535,
+    2838, 65535, 2839, 65535, 2840, 65535, 65535, 2841, 2842, 2843, 65535, 65535, 65535, 2844, 65535, 65535,
+    65535, 2845, 65535, 2846, 2847, 2848, 65535, 2849, 65535, 2850, 65535, 2851, 65535, 65535, 65535, 2852,
+    65535, 65535, 65535, 2853, 65535, 2854, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2855, 2856,
+    65535, 2857, 65535, 65535, 2858, 2859, 2860, 65535, 2861, 2862, 65535, 2863, 65535, 2864, 65535, 2865,
+    65535, 2866, 65535, 2867, 65535, 65535, 2868, 2869, 2870, 65535, 65535, 2871, 65535, 2872, 2873, 65535,
+    65535, 65535, 65535, 65535, 65535, 2874, 65535, 65535, 65535, 2875, 65535, 2876, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 2877, 2878, 65535, 2879, 65535, 65535, 2880, 2881, 2882, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 2883, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 2884, 65535, 65535, 65535, 2885, 65535, 2886, 2887, 65535, 2888, 65535, 65535, 2889, 2890,
+    2891, 65535, 65535, 65535, 2892, 65535, 65535, 65535, 2893, 65535, 2894, 2895, 2896, 65535, 2897, 65535,
+    65535, 65535, 65535, 65535, 2898, 2899, 65535, 2900, 65535, 2901, 65535, 2902, 65535, 2903, 65535, 2904,
+    65535, 65535, 2905, 2906, 2907, 65535, 65535, 2908, 65535, 2909, 2910, 65535, 65535, 65535, 65535, 2911,
+    65535, 2912, 65535, 65535, 2913, 2914, 2915, 65535, 65535, 65535, 2916, 65535, 65535, 65535, 2917, 65535,
+    2918, 2919, 2920, 65535, 2921, 65535, 2922, 65535, 2923, 65535, 65535, 2924, 65535, 2925, 65535, 65535,
+    65535, 65535, 65535, 2926, 65535, 65535, 65535, 65535, 2927, 65535, 2928, 65535, 65535, 65535, 65535, 65535,
+    2929, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2930, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2931, 65535, 65535, 65535, 2932, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2933, 65535, 65535,
+    65535, 2934, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2935, 2936, 65535, 65535,
+    65535, 65535, 2937, 65535, 2938, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 2939, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    2940, 65535, 65535, 65535, 2941, 65535, 65535, 65535, 65535, 2942, 65535, 65535, 65535, 2943, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2944, 2945, 65535, 65535, 65535, 65535, 2946, 65535,
+    2947, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2948, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 2949, 65535, 65535, 65535, 2950, 65535, 65535, 2951, 65535, 65535,
+    65535, 65535, 2952, 65535, 2953, 65535, 65535, 65535, 2954, 65535, 65535, 65535, 2955, 65535, 65535, 65535,
+    2956, 65535, 2957, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 2958, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 2959, 65535, 65535, 65535, 2960, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 2961, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2962, 65535,
+    65535, 65535, 2963, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 2964, 65535, 65535, 65535, 2965, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 2966, 2967, 65535, 65535, 65535, 65535, 2968, 65535, 2969, 65535, 65535, 65535, 2970, 65535, 65535,
+    65535, 2971, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2972, 2973, 65535, 65535,
+    65535, 65535, 2974, 65535, 2975, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2976, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 2977, 65535, 65535, 65535, 2978, 65535,
+    65535, 2979, 65535, 65535, 65535, 65535, 2980, 65535, 2981, 65535, 65535, 65535, 2982, 65535, 65535, 65535,
+    2983, 65535, 65535, 65535, 2984, 65535, 2985, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 2986, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    2987, 65535, 65535, 65535, 2988, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 2989, 65535, 65535, 65535, 2990, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 2991, 2992, 65535, 65535, 65535, 65535, 2993, 65535, 2994, 65535, 2995, 65535, 65535,
+    65535, 65535, 2996, 65535, 2997, 65535, 65535, 65535, 2998, 65535, 65535, 65535, 2999, 65535, 65535, 65535,
+    3000, 65535, 3001, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3002, 65535, 65535, 65535, 3003, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3004, 3005, 65535, 65535, 65535, 65535, 3006,
+    65535, 3007, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3008, 65535,
+    3009, 65535, 65535, 3010, 3011, 3012, 65535, 65535, 65535, 3013, 65535, 65535, 65535, 3014, 65535, 3015,
+    3016, 3017, 65535, 3018, 65535, 3019, 65535, 3020, 65535, 65535, 65535, 3021, 65535, 65535, 65535, 3022,
+    65535, 3023, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3024, 3025, 65535, 3026, 65535, 65535,
+    3027, 3028, 3029, 65535, 3030, 3031, 65535, 3032, 65535, 3033, 65535, 3034, 65535, 3035, 65535, 3036,
+    65535, 65535, 65535, 3037, 3038, 65535, 65535, 3039, 65535, 3040, 3041, 65535, 65535, 65535, 65535, 65535,
+    65535, 3042, 65535, 65535, 65535, 3043, 65535, 3044, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    3045, 3046, 65535, 3047, 65535, 65535, 3048, 3049, 3050, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 3051, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3052, 65535,
+    65535, 65535, 3053, 65535, 3054, 3055, 65535, 3056, 65535, 65535, 65535, 3057, 3058, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 3059, 65535, 3060, 3061, 3062, 65535, 3063, 65535, 65535, 65535, 65535, 65535,
+    3064, 3065, 65535, 3066, 65535, 3067, 65535, 3068, 65535, 3069, 65535, 3070, 65535, 65535, 3071, 3072,
+    3073, 65535, 65535, 3074, 65535, 3075, 65535, 65535, 65535, 65535, 65535, 3076, 65535, 3077, 65535, 65535,
+    3078, 3079, 3080, 65535, 65535, 65535, 3081, 65535, 65535, 65535, 3082, 65535, 3083, 3084, 65535, 65535,
+    65535, 65535, 3085, 65535, 3086, 65535, 65535, 3087, 65535, 3088, 3089, 65535, 65535, 65535, 65535, 3090,
+    3091, 65535, 3092, 65535, 3093, 65535, 3094, 65535, 65535, 65535, 65535, 65535, 3095, 65535, 65535, 65535,
+    65535, 65535, 65535, 3096, 65535, 65535, 65535, 3097, 65535, 3098, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 3099, 3100, 65535, 3101, 65535, 65535, 3102, 3103, 3104, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 3105, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    3106, 65535, 65535, 65535, 3107, 65535, 3108, 3109, 65535, 3110, 65535, 65535, 65535, 3111, 3112, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 3113, 65535, 65535, 3114, 3115, 65535, 3116, 65535, 3117, 65535,
+    3118, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3119, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 3120, 65535, 65535, 65535, 3121, 65535, 3122, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3123, 65535,
+    3124, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3125, 65535, 3126, 65535, 65535, 65535,
+    3127, 3128, 65535, 3129, 65535, 3130, 65535, 65535, 3131, 3132, 3133, 65535, 65535, 65535, 3134, 65535,
+    65535, 65535, 3135, 65535, 65535, 3136, 65535, 65535, 65535, 65535, 3137, 65535, 3138, 65535, 65535, 65535,
+    3139, 65535, 65535, 65535, 3140, 65535, 3141, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3142,
+    65535, 65535, 3143, 65535, 65535, 65535, 3144, 65535, 65535, 3145, 3146, 65535, 3147, 65535, 3148, 65535,
+    3149, 65535, 3150, 65535, 65535, 65535, 65535, 65535, 65535, 3151, 65535, 65535, 3152, 65535, 3153, 65535,
+    65535, 65535, 65535, 65535, 3154, 3155, 65535, 3156, 65535, 3157, 65535, 3158, 65535, 3159, 65535, 3160,
+    65535, 65535, 3161, 3162, 3163, 65535, 65535, 3164, 65535, 3165, 3166, 65535, 65535, 65535, 65535, 3167,
+    65535, 3168, 65535, 65535, 3169, 3170, 3171, 65535, 65535, 65535, 3172, 65535, 65535, 65535, 3173, 65535,
+    3174, 3175, 3176, 65535, 3177, 65535, 3178, 65535, 3179, 65535, 65535, 3180, 65535, 3181, 3182, 65535,
+    65535, 65535, 65535, 3183, 3184, 65535, 3185, 65535, 3186, 65535, 3187, 65535, 65535, 65535, 65535, 65535,
+    3188, 65535, 65535, 65535, 65535, 3189, 65535, 3190, 65535, 65535, 3191, 3192, 3193, 65535, 65535, 65535,
+    3194, 65535, 65535, 65535, 3195, 65535, 3196, 3197, 3198, 65535, 3199, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 3200, 65535, 65535, 65535, 3201, 65535, 3202, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 3203, 3204, 65535, 3205, 65535, 65535, 3206, 3207, 3208, 65535, 3209, 3210, 65535, 3211, 65535,
+    65535, 65535, 65535, 65535, 3212, 65535, 3213, 65535, 65535, 65535, 3214, 3215, 65535, 65535, 65535, 65535,
+    65535, 3216, 65535, 65535, 65535, 65535, 65535, 3217, 65535, 3218, 3219, 65535, 65535, 65535, 65535, 3220,
+    3221, 65535, 3222, 65535, 3223, 65535, 3224, 65535, 65535, 65535, 65535, 65535, 3225, 65535, 65535, 65535,
+    65535, 3226, 3227, 65535, 3228, 65535, 3229, 65535, 3230, 65535, 3231, 65535, 3232, 65535, 65535, 3233,
+    3234, 3235, 65535, 65535, 3236, 65535, 3237, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    3238, 65535, 65535, 65535, 65535, 65535, 3239, 65535, 3240, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 3241, 3242, 65535, 3243, 65535, 3244, 65535, 3245, 65535,
+    3246, 65535, 3247, 65535, 65535, 3248, 3249, 3250, 65535, 65535, 3251, 65535, 3252, 3253, 65535, 65535,
+    65535, 65535, 3254, 65535, 3255, 65535, 65535, 3256, 3257, 3258, 65535, 65535, 65535, 3259, 65535, 65535,
+    65535, 3260, 65535, 3261, 3262, 3263, 65535, 3264, 65535, 3265, 65535, 3266, 65535, 65535, 3267, 65535,
+    3268, 3269, 65535, 65535, 65535, 65535, 3270, 3271, 65535, 3272, 65535, 3273, 65535, 3274, 65535, 65535,
+    65535, 65535, 65535, 3275, 65535, 65535, 65535, 65535, 3276, 65535, 3277, 65535, 65535, 3278, 3279, 3280,
+    65535, 65535, 65535, 3281, 65535, 65535, 65535, 3282, 65535, 3283, 3284, 3285, 65535, 3286, 65535, 3287,
+    65535, 65535, 65535, 65535, 65535, 3288, 65535, 65535, 65535, 3289, 65535, 3290, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 3291, 3292, 65535, 3293, 65535, 65535, 3294, 3295, 3296, 65535, 3297, 3298,
+    65535, 3299, 65535, 3300, 65535, 65535, 65535, 3301, 65535, 3302, 65535, 65535, 3303, 3304, 3305, 65535,
+    65535, 65535, 65535, 3306, 3307, 65535, 65535, 65535, 65535, 65535, 3308, 65535, 3309, 3310, 65535, 65535,
+    65535, 65535, 3311, 3312, 65535, 3313, 65535, 3314, 65535, 3315, 65535, 65535, 65535, 65535, 65535, 3316,
+    65535, 65535, 65535, 65535, 3317, 3318, 65535, 3319, 65535, 3320, 65535, 3321, 65535, 3322, 65535, 3323,
+    65535, 65535, 3324, 3325, 65535, 65535, 65535, 3326, 65535, 3327, 3328, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 3329, 65535, 65535, 65535, 65535, 65535, 3330, 65535, 3331, 3332, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3333, 65535, 3334, 65535, 65535, 3335,
+    3336, 3337, 65535, 65535, 65535, 3338, 65535, 65535, 65535, 3339, 65535, 65535, 3340, 3341, 65535, 3342,
+    65535, 3343, 65535, 3344, 65535, 65535, 65535, 3345, 65535, 65535, 65535, 3346, 65535, 3347, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 3348, 3349, 65535, 3350, 65535, 65535, 3351, 3352, 3353, 65535,
+    3354, 3355, 65535, 3356, 65535, 3357, 65535, 3358, 65535, 3359, 65535, 65535, 65535, 65535, 3360, 65535,
+    3361, 65535, 65535, 3362, 65535, 3363, 3364, 65535, 65535, 65535, 65535, 65535, 65535, 3365, 65535, 65535,
+    65535, 3366, 65535, 3367, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3368, 3369, 65535, 3370,
+    65535, 65535, 3371, 3372, 3373, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3374, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3375, 65535, 65535, 65535, 3376, 65535,
+    65535, 3377, 65535, 3378, 65535, 65535, 3379, 3380, 3381, 65535, 65535, 65535, 3382, 65535, 65535, 65535,
+    3383, 65535, 65535, 3384, 3385, 65535, 3386, 65535, 3387, 65535, 65535, 65535, 3388, 3389, 65535, 3390,
+    65535, 3391, 65535, 3392, 65535, 3393, 65535, 65535, 65535, 65535, 3394, 65535, 65535, 65535, 65535, 3395,
+    65535, 3396, 3397, 65535, 65535, 65535, 65535, 3398, 65535, 3399, 65535, 65535, 3400, 3401, 65535, 65535,
+    65535, 65535, 3402, 65535, 65535, 65535, 65535, 65535, 65535, 3403, 3404, 65535, 3405, 65535, 3406, 65535,
+    3407, 65535, 65535, 3408, 65535, 3409, 3410, 65535, 65535, 65535, 65535, 65535, 3411, 65535, 3412, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3413, 65535, 65535, 65535, 65535, 65535, 3414, 65535,
+    3415, 3416, 65535, 65535, 65535, 65535, 3417, 3418, 65535, 3419, 65535, 3420, 65535, 3421, 65535, 65535,
+    65535, 65535, 65535, 3422, 65535, 65535, 65535, 65535, 3423, 3424, 65535, 3425, 65535, 3426, 65535, 3427,
+    65535, 3428, 65535, 3429, 65535, 65535, 3430, 3431, 3432, 65535, 65535, 3433, 65535, 3434, 3435, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 3436, 65535, 65535, 65535, 65535, 65535, 3437, 65535, 3438,
+    3439, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3440, 3441,
+    65535, 3442, 65535, 3443, 65535, 65535, 65535, 3444, 65535, 3445, 65535, 65535, 3446, 3447, 3448, 65535,
+    65535, 65535, 65535, 3449, 3450, 65535, 65535, 65535, 65535, 3451, 65535, 3452, 65535, 65535, 3453, 3454,
+    3455, 65535, 65535, 65535, 3456, 65535, 65535, 65535, 3457, 65535, 3458, 3459, 3460, 65535, 3461, 65535,
+    3462, 65535, 65535, 65535, 65535, 65535, 65535, 3463, 3464, 65535, 65535, 65535, 65535, 3465, 3466, 65535,
+    3467, 65535, 3468, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 3469, 65535, 65535, 65535, 65535, 65535, 3470, 65535, 3471, 3472, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3473, 65535, 3474, 3475, 65535,
+    65535, 65535, 65535, 3476, 3477, 65535, 3478, 65535, 3479, 65535, 3480, 65535, 65535, 65535, 65535, 65535,
+    3481, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    3482, 65535, 3483, 65535, 65535, 3484, 3485, 3486, 65535, 65535, 65535, 3487, 65535, 65535, 65535, 3488,
+    65535, 3489, 3490, 3491, 65535, 3492, 65535, 3493, 65535, 3494, 65535, 65535, 65535, 3495, 65535, 65535,
+    65535, 3496, 65535, 3497, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3498, 3499, 65535, 3500,
+    65535, 65535, 3501, 3502, 3503, 65535, 3504, 3505, 65535, 3506, 65535, 3507, 65535, 3508, 65535, 3509,
+    65535, 3510, 65535, 65535, 3511, 3512, 3513, 65535, 65535, 3514, 65535, 3515, 3516, 65535, 65535, 65535,
+    65535, 65535, 65535, 3517, 65535, 65535, 65535, 3518, 65535, 3519, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 3520, 3521, 65535, 3522, 65535, 65535, 3523, 3524, 3525, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 3526, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    3527, 65535, 65535, 65535, 3528, 65535, 3529, 3530, 65535, 3531, 65535, 65535, 3532, 3533, 3534, 65535,
+    65535, 65535, 3535, 65535, 65535, 65535, 3536, 65535, 65535, 3537, 3538, 65535, 3539, 65535, 3540, 65535,
+    65535, 65535, 3541, 3542, 65535, 3543, 65535, 3544, 65535, 3545, 65535, 3546, 65535, 3547, 65535, 65535,
+    3548, 3549, 65535, 65535, 65535, 3550, 65535, 3551, 3552, 65535, 65535, 65535, 65535, 3553, 65535, 3554,
+    65535, 65535, 3555, 3556, 65535, 65535, 65535, 65535, 3557, 65535, 65535, 65535, 65535, 65535, 3558, 3559,
+    3560, 65535, 3561, 65535, 3562, 65535, 65535, 65535, 65535, 3563, 65535, 3564, 3565, 65535, 65535, 65535,
+    65535, 3566, 3567, 65535, 3568, 65535, 3569, 65535, 3570, 65535, 65535, 65535, 65535, 65535, 3571, 65535,
+    65535, 65535, 65535, 65535, 65535, 3572, 65535, 65535, 65535, 3573, 65535, 3574, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 3575, 3576, 65535, 3577, 65535, 65535, 3578, 3579, 3580, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 3581, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 3582, 65535, 65535, 65535, 3583, 65535, 3584, 3585, 65535, 3586, 65535, 65535, 3587, 3588,
+    3589, 65535, 65535, 65535, 3590, 65535, 65535, 65535, 3591, 65535, 65535, 3592, 3593, 65535, 3594, 65535,
+    3595, 65535, 3596, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3597, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3598, 65535, 65535, 65535, 3599, 65535, 3600, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3601, 65535, 65535, 65535,
+    3602, 65535, 3603, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3604, 3605, 65535, 3606, 65535,
+    65535, 3607, 3608, 3609, 65535, 3610, 65535, 3611, 65535, 65535, 3612, 3613, 65535, 65535, 65535, 65535,
+    3614, 65535, 65535, 65535, 65535, 65535, 65535, 3615, 3616, 65535, 3617, 65535, 3618, 65535, 3619, 65535,
+    65535, 65535, 3620, 65535, 65535, 65535, 65535, 65535, 3621, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 3622, 65535, 3623, 65535, 65535, 3624, 3625, 65535, 65535, 3626, 3627, 65535, 3628, 65535,
+    3629, 65535, 3630, 65535, 3631, 65535, 65535, 65535, 65535, 3632, 65535, 65535, 65535, 65535, 3633, 65535,
+    3634, 3635, 65535, 65535, 65535, 65535, 3636, 3637, 65535, 3638, 65535, 3639, 65535, 3640, 65535, 3641,
+    65535, 3642, 65535, 65535, 3643, 3644, 3645, 65535, 65535, 3646, 65535, 3647, 3648, 65535, 65535, 65535,
+    65535, 3649, 65535, 3650, 65535, 65535, 3651, 3652, 3653, 65535, 65535, 65535, 3654, 65535, 65535, 65535,
+    3655, 65535, 3656, 3657, 3658, 65535, 3659, 65535, 3660, 65535, 65535, 65535, 65535, 3661, 65535, 3662,
+    3663, 65535, 65535, 65535, 65535, 3664, 3665, 65535, 3666, 65535, 3667, 65535, 3668, 65535, 65535, 65535,
+    65535, 65535, 3669, 65535, 65535, 65535, 65535, 3670, 65535, 3671, 65535, 65535, 3672, 3673, 3674, 65535,
+    65535, 65535, 3675, 65535, 65535, 65535, 3676, 65535, 65535, 3677, 3678, 65535, 3679, 65535, 3680, 65535,
+    65535, 65535, 65535, 65535, 3681, 65535, 65535, 65535, 3682, 65535, 3683, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 3684, 3685, 65535, 3686, 65535, 65535, 3687, 3688, 3689, 65535, 3690, 3691, 65535,
+    3692, 65535, 3693, 65535, 65535, 65535, 3694, 65535, 65535, 65535, 65535, 3695, 65535, 3696, 65535, 65535,
+    65535, 65535, 3697, 3698, 65535, 65535, 65535, 65535, 65535, 3699, 65535, 3700, 3701, 65535, 65535, 65535,
+    65535, 3702, 3703, 65535, 3704, 65535, 3705, 65535, 3706, 65535, 65535, 65535, 65535, 65535, 3707, 65535,
+    65535, 65535, 65535, 3708, 3709, 65535, 3710, 65535, 3711, 65535, 65535, 65535, 3712, 65535, 3713, 65535,
+    65535, 3714, 3715, 65535, 65535, 65535, 65535, 65535, 3716, 3717, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 3718, 65535, 65535, 65535, 65535, 65535, 3719, 65535, 3720, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3721, 65535, 3722, 3723, 65535, 65535,
+    65535, 65535, 3724, 3725, 65535, 3726, 65535, 3727, 65535, 3728, 65535, 65535, 65535, 65535, 65535, 3729,
+    65535, 65535, 65535, 65535, 3730, 3731, 65535, 3732, 65535, 3733, 65535, 3734, 65535, 3735, 65535, 3736,
+    65535, 65535, 3737, 3738, 3739, 65535, 65535, 3740, 65535, 3741, 3742, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 3743, 65535, 65535, 65535, 65535, 65535, 3744, 65535, 3745, 3746, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3747, 3748, 65535, 3749, 65535, 3750,
+    65535, 65535, 65535, 3751, 65535, 3752, 65535, 65535, 3753, 3754, 3755, 65535, 65535, 65535, 65535, 3756,
+    3757, 65535, 65535, 65535, 65535, 3758, 65535, 3759, 65535, 65535, 3760, 3761, 3762, 65535, 65535, 65535,
+    3763, 65535, 65535, 65535, 3764, 65535, 3765, 3766, 3767, 65535, 3768, 65535, 3769, 65535, 65535, 65535,
+    65535, 65535, 65535, 3770, 3771, 65535, 65535, 65535, 65535, 3772, 3773, 65535, 3774, 65535, 3775, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3776,
+    65535, 65535, 65535, 65535, 65535, 3777, 65535, 3778, 3779, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 3780, 65535, 3781, 3782, 65535, 65535, 65535, 65535, 3783,
+    3784, 65535, 3785, 65535, 3786, 65535, 3787, 65535, 65535, 65535, 65535, 65535, 3788, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3789, 3790, 65535, 3791,
+    65535, 3792, 65535, 3793, 65535, 3794, 65535, 65535, 65535, 65535, 3795, 65535, 3796, 65535, 65535, 3797,
+    65535, 3798, 3799, 65535, 65535, 65535, 65535, 3800, 65535, 3801, 65535, 65535, 3802, 3803, 3804, 65535,
+    65535, 65535, 3805, 65535, 65535, 65535, 3806, 65535, 65535, 3807, 3808, 65535, 3809, 65535, 3810, 65535,
+    3811, 65535, 65535, 3812, 65535, 3813, 3814, 65535, 65535, 65535, 65535, 65535, 3815, 65535, 3816, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3817, 65535, 65535, 65535, 65535, 3818, 65535, 3819,
+    65535, 65535, 3820, 3821, 3822, 65535, 65535, 65535, 3823, 65535, 65535, 65535, 3824, 65535, 65535, 3825,
+    3826, 65535, 3827, 65535, 3828, 65535, 65535, 65535, 65535, 65535, 3829, 65535, 65535, 65535, 3830, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3831, 3832, 65535, 65535, 65535, 65535, 3833,
+    65535, 3834, 65535, 3835, 3836, 65535, 3837, 65535, 3838, 65535, 65535, 65535, 3839, 65535, 65535, 65535,
+    65535, 65535, 65535, 3840, 65535, 65535, 65535, 65535, 3841, 3842, 65535, 65535, 65535, 65535, 65535, 3843,
+    65535, 3844, 3845, 65535, 65535, 65535, 65535, 65535, 3846, 65535, 3847, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 3848, 65535, 65535, 65535, 65535, 3849, 3850, 65535, 3851, 65535, 3852, 65535,
+    3853, 65535, 3854, 65535, 65535, 65535, 65535, 3855, 65535, 65535, 65535, 65535, 3856, 65535, 3857, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3858, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 3859, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 3860, 65535, 65535, 65535, 65535, 65535, 3861, 65535, 3862, 3863, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3864, 65535, 3865, 3866, 65535,
+    65535, 65535, 65535, 3867, 3868, 65535, 3869, 65535, 3870, 65535, 3871, 65535, 65535, 65535, 65535, 65535,
+    3872, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 3873, 3874, 65535, 65535, 65535, 65535, 3875, 3876, 65535, 3877, 65535, 3878, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3879, 3880, 65535, 3881, 65535,
+    3882, 65535, 65535, 65535, 3883, 65535, 3884, 65535, 65535, 3885, 3886, 3887, 65535, 65535, 65535, 65535,
+    3888, 3889, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 3890, 3891, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    3892, 65535, 65535, 65535, 65535, 65535, 3893, 65535, 3894, 3895, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 3896, 65535, 3897, 3898, 65535, 65535, 65535, 65535, 3899, 3900, 65535, 3901, 65535,
+    3902, 65535, 3903, 65535, 65535, 65535, 65535, 65535, 3904, 65535, 65535, 65535, 65535, 3905, 3906, 65535,
+    3907, 65535, 3908, 65535, 3909, 65535, 3910, 65535, 3911, 65535, 65535, 3912, 3913, 3914, 65535, 65535,
+    3915, 65535, 3916, 3917, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3918, 65535, 65535, 65535,
+    65535, 65535, 3919, 65535, 3920, 3921, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 3922, 3923, 65535, 3924, 65535, 3925, 65535, 3926, 65535, 3927, 65535, 3928, 65535,
+    65535, 3929, 3930, 3931, 65535, 65535, 3932, 65535, 3933, 3934, 65535, 65535, 65535, 65535, 3935, 65535,
+    3936, 65535, 65535, 3937, 3938, 3939, 65535, 65535, 65535, 3940, 65535, 65535, 65535, 3941, 65535, 3942,
+    3943, 3944, 65535, 3945, 65535, 3946, 65535, 3947, 65535, 65535, 3948, 65535, 3949, 3950, 65535, 65535,
+    65535, 65535, 3951, 3952, 65535, 3953, 65535, 3954, 65535, 3955, 65535, 65535, 65535, 65535, 65535, 3956,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 3957, 65535, 65535, 65535, 65535, 65535, 3958, 65535,
+    3959, 3960, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    3961, 65535, 3962, 3963, 65535, 65535, 65535, 65535, 3964, 3965, 65535, 3966, 65535, 3967, 65535, 3968,
+    65535, 65535, 65535, 65535, 65535, 3969, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 3970, 3971, 65535, 3972, 65535, 3973, 65535, 3974, 65535, 3975, 65535,
+    3976, 65535, 65535, 3977, 3978, 3979, 65535, 65535, 3980, 65535, 3981, 3982, 65535, 65535, 65535, 65535,
+    3983, 65535, 3984, 65535, 65535, 3985, 3986, 3987, 65535, 65535, 65535, 3988, 65535, 65535, 65535, 3989,
+    65535, 3990, 3991, 3992, 65535, 3993, 65535, 3994, 65535, 3995, 65535, 65535, 3996, 65535, 3997, 3998,
+    65535, 65535, 65535, 65535, 3999, 4000, 65535, 4001, 65535, 4002, 65535, 4003, 65535, 65535, 65535, 65535,
+    65535, 4004, 65535, 65535, 65535, 65535, 4005, 65535, 4006, 65535, 65535, 4007, 4008, 4009, 65535, 65535,
+    65535, 4010, 65535, 65535, 65535, 4011, 65535, 4012, 4013, 4014, 65535, 4015, 65535, 4016, 65535, 4017,
+    65535, 65535, 65535, 4018, 65535, 65535, 65535, 4019, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 4020, 4021, 65535, 65535, 65535, 65535, 4022, 65535, 4023, 65535, 4024, 4025, 65535, 4026,
+    65535, 4027, 65535, 4028, 65535, 4029, 65535, 4030, 65535, 65535, 4031, 4032, 4033, 65535, 65535, 4034,
+    65535, 4035, 4036, 65535, 65535, 65535, 65535, 65535, 4037, 65535, 4038, 4039, 65535, 65535, 65535, 65535,
+    4040, 4041, 65535, 4042, 65535, 4043, 65535, 4044, 65535, 65535, 65535, 65535, 65535, 4045, 65535, 65535,
+    65535, 65535, 4046, 4047, 65535, 4048, 65535, 4049, 65535, 4050, 65535, 4051, 65535, 4052, 65535, 65535,
+    65535, 4053, 4054, 65535, 65535, 4055, 65535, 4056, 4057, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 4058, 65535, 65535, 65535, 65535, 65535, 4059, 65535, 4060, 4061, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4062, 65535, 65535, 65535,
+    65535, 65535, 4063, 65535, 4064, 4065, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 4066, 65535, 4067, 4068, 65535, 65535, 65535, 65535, 4069, 4070, 65535, 4071,
+    65535, 4072, 65535, 4073, 65535, 65535, 65535, 65535, 65535, 4074, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4075, 65535, 4076, 4077, 65535, 65535,
+    65535, 65535, 4078, 4079, 65535, 4080, 65535, 4081, 65535, 4082, 65535, 65535, 65535, 65535, 65535, 4083,
+    65535, 65535, 65535, 65535, 4084, 4085, 65535, 4086, 65535, 4087, 65535, 4088, 65535, 4089, 65535, 4090,
+    65535, 65535, 4091, 4092, 4093, 65535, 65535, 4094, 65535, 4095, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 4096, 65535, 65535, 65535, 65535, 65535, 4097, 65535, 4098, 4099, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4100, 65535, 65535, 65535, 65535, 65535, 4101,
+    65535, 4102, 4103, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4104, 4105, 65535, 4106, 65535,
+    4107, 65535, 4108, 65535, 4109, 65535, 4110, 65535, 65535, 4111, 4112, 4113, 65535, 65535, 4114, 65535,
+    4115, 4116, 65535, 65535, 65535, 65535, 4117, 65535, 4118, 65535, 65535, 4119, 4120, 4121, 65535, 65535,
+    65535, 4122, 65535, 65535, 65535, 4123, 65535, 4124, 4125, 4126, 65535, 4127, 65535, 4128, 65535, 65535,
+    65535, 65535, 4129, 65535, 4130, 4131, 65535, 65535, 65535, 65535, 4132, 4133, 65535, 4134, 65535, 4135,
+    65535, 4136, 65535, 65535, 65535, 65535, 65535, 4137, 65535, 65535, 65535, 65535, 4138, 65535, 4139, 65535,
+    65535, 4140, 4141, 4142, 65535, 65535, 65535, 4143, 65535, 65535, 65535, 4144, 65535, 65535, 4145, 4146,
+    65535, 4147, 65535, 4148, 65535, 4149, 65535, 65535, 65535, 4150, 65535, 65535, 65535, 4151, 65535, 4152,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4153, 4154, 65535, 4155, 65535, 65535, 4156, 4157,
+    4158, 65535, 4159, 4160, 65535, 4161, 65535, 4162, 65535, 4163, 65535, 4164, 65535, 65535, 65535, 65535,
+    4165, 65535, 4166, 65535, 65535, 4167, 65535, 4168, 4169, 65535, 65535, 65535, 65535, 65535, 4170, 65535,
+    4171, 4172, 65535, 65535, 65535, 65535, 4173, 4174, 65535, 4175, 65535, 4176, 65535, 4177, 65535, 65535,
+    65535, 65535, 65535, 4178, 65535, 65535, 65535, 65535, 4179, 4180, 65535, 4181, 65535, 4182, 65535, 65535,
+    65535, 4183, 65535, 4184, 65535, 65535, 65535, 4185, 4186, 65535, 65535, 65535, 65535, 4187, 4188, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 4189, 65535, 65535, 65535, 65535, 65535, 4190, 65535, 4191,
+    4192, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4193, 65535,
+    4194, 65535, 65535, 4195, 4196, 4197, 65535, 65535, 65535, 4198, 65535, 65535, 65535, 4199, 65535, 4200,
+    4201, 4202, 65535, 4203, 65535, 4204, 65535, 4205, 65535, 65535, 65535, 4206, 65535, 65535, 65535, 4207,
+    65535, 4208, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4209, 4210, 65535, 4211, 65535, 65535,
+    4212, 4213, 4214, 65535, 4215, 4216, 65535, 4217, 65535, 4218, 65535, 4219, 65535, 4220, 65535, 4221,
+    65535, 65535, 4222, 4223, 4224, 65535, 65535, 4225, 65535, 4226, 4227, 65535, 65535, 65535, 65535, 65535,
+    65535, 4228, 65535, 65535, 65535, 4229, 65535, 4230, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    4231, 4232, 65535, 4233, 65535, 65535, 4234, 4235, 4236, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 4237, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4238, 65535,
+    65535, 65535, 4239, 65535, 65535, 4240, 65535, 4241, 65535, 65535, 4242, 4243, 4244, 65535, 65535, 65535,
+    4245, 65535, 65535, 65535, 4246, 65535, 65535, 4247, 4248, 65535, 4249, 65535, 4250, 65535, 4251, 65535,
+    4252, 4253, 65535, 4254, 65535, 4255, 65535, 4256, 65535, 4257, 65535, 4258, 65535, 65535, 65535, 4259,
+    4260, 65535, 65535, 4261, 65535, 4262, 4263, 65535, 65535, 65535, 65535, 4264, 65535, 4265, 65535, 65535,
+    65535, 4266, 4267, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4268, 65535, 4269, 4270, 4271, 65535,
+    4272, 65535, 4273, 65535, 65535, 65535, 65535, 4274, 65535, 4275, 4276, 65535, 65535, 65535, 65535, 4277,
+    4278, 65535, 4279, 65535, 4280, 65535, 4281, 65535, 65535, 65535, 65535, 65535, 4282, 65535, 65535, 65535,
+    65535, 65535, 4283, 65535, 4284, 4285, 65535, 65535, 65535, 65535, 4286, 4287, 65535, 4288, 65535, 4289,
+    65535, 4290, 65535, 65535, 65535, 65535, 65535, 4291, 65535, 65535, 65535, 65535, 4292, 4293, 65535, 4294,
+    65535, 4295, 65535, 65535, 65535, 4296, 65535, 4297, 65535, 65535, 4298, 4299, 4300, 65535, 65535, 65535,
+    65535, 4301, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4302, 65535, 65535, 65535, 65535,
+    65535, 4303, 65535, 4304, 4305, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 4306, 4307, 65535, 4308, 65535, 4309, 65535, 4310, 65535, 4311, 65535, 65535, 65535, 65535,
+    4312, 65535, 4313, 65535, 65535, 4314, 65535, 4315, 65535, 65535, 65535, 65535, 65535, 4316, 65535, 4317,
+    65535, 65535, 4318, 4319, 4320, 65535, 65535, 65535, 4321, 65535, 65535, 65535, 4322, 65535, 65535, 4323,
+    65535, 65535, 65535, 65535, 4324, 65535, 65535, 65535, 65535, 4325, 65535, 4326, 4327, 65535, 65535, 65535,
+    65535, 65535, 4328, 65535, 4329, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4330, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 4331, 65535, 65535, 65535, 65535, 65535, 4332, 65535, 4333,
+    4334, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 4335, 4336, 65535, 65535, 65535, 65535, 4337, 4338, 65535, 4339, 65535, 4340, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4341, 65535, 65535, 65535, 65535, 65535, 4342, 65535,
+    4343, 4344, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    4345, 65535, 4346, 4347, 65535, 65535, 65535, 65535, 4348, 4349, 65535, 4350, 65535, 4351, 65535, 4352,
+    65535, 65535, 65535, 65535, 65535, 4353, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 4354, 65535, 4355, 4356, 65535, 65535, 65535, 65535, 4357, 4358,
+    65535, 4359, 65535, 4360, 65535, 4361, 65535, 65535, 65535, 65535, 65535, 4362, 65535, 65535, 65535, 65535,
+    4363, 4364, 65535, 4365, 65535, 4366, 65535, 4367, 65535, 4368, 65535, 4369, 65535, 65535, 4370, 4371,
+    4372, 65535, 65535, 4373, 65535, 4374, 4375, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4376,
+    65535, 65535, 65535, 65535, 65535, 4377, 65535, 4378, 4379, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 4380, 65535, 65535, 65535, 65535, 65535, 4381, 65535, 4382, 4383, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4384, 65535, 4385, 4386, 65535, 65535, 65535, 65535,
+    4387, 4388, 65535, 4389, 65535, 4390, 65535, 4391, 65535, 65535, 65535, 65535, 65535, 4392, 65535, 65535,
+    65535, 65535, 4393, 4394, 65535, 4395, 65535, 4396, 65535, 4397, 65535, 4398, 65535, 4399, 65535, 65535,
+    4400, 4401, 4402, 65535, 65535, 4403, 65535, 4404, 4405, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 4406, 65535, 65535, 65535, 65535, 65535, 4407, 65535, 4408, 4409, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4410, 4411, 65535, 4412, 65535, 4413, 65535, 4414,
+    65535, 4415, 65535, 4416, 65535, 65535, 4417, 4418, 4419, 65535, 65535, 4420, 65535, 4421, 4422, 65535,
+    65535, 65535, 65535, 4423, 65535, 65535, 65535, 65535, 4424, 65535, 4425, 65535, 65535, 65535, 4426, 65535,
+    65535, 65535, 4427, 65535, 65535, 65535, 4428, 65535, 4429, 65535, 65535, 65535, 65535, 65535, 65535, 4430,
+    65535, 4431, 4432, 65535, 65535, 65535, 65535, 4433, 4434, 65535, 4435, 65535, 4436, 65535, 4437, 65535,
+    65535, 65535, 65535, 65535, 4438, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4439, 65535, 65535,
+    65535, 65535, 65535, 4440, 65535, 4441, 4442, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 4443, 65535, 4444, 4445, 65535, 65535, 65535, 65535, 4446, 4447, 65535,
+    4448, 65535, 4449, 65535, 4450, 65535, 65535, 65535, 65535, 65535, 4451, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4452, 65535, 65535, 65535, 65535, 65535, 4453,
+    65535, 4454, 4455, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4456,
+    65535, 65535, 65535, 65535, 65535, 4457, 65535, 4458, 4459, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 4460, 65535, 4461, 4462, 65535, 65535, 65535, 65535, 4463,
+    4464, 65535, 4465, 65535, 4466, 65535, 4467, 65535, 65535, 65535, 65535, 65535, 4468, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4469, 4470, 65535,
+    4471, 65535, 4472, 65535, 4473, 65535, 4474, 65535, 4475, 65535, 65535, 4476, 4477, 4478, 65535, 65535,
+    4479, 65535, 4480, 4481, 65535, 65535, 65535, 65535, 4482, 65535, 4483, 65535, 65535, 4484, 4485, 4486,
+    65535, 65535, 65535, 4487, 65535, 65535, 65535, 4488, 65535, 4489, 4490, 4491, 65535, 4492, 65535, 4493,
+    65535, 4494, 65535, 65535, 4495, 65535, 4496, 4497, 65535, 65535, 65535, 65535, 4498, 4499, 65535, 4500,
+    65535, 4501, 65535, 4502, 65535, 65535, 65535, 65535, 65535, 4503, 65535, 65535, 65535, 65535, 4504, 65535,
+    4505, 65535, 65535, 4506, 4507, 4508, 65535, 65535, 65535, 4509, 65535, 65535, 65535, 4510, 65535, 4511,
+    4512, 4513, 65535, 4514, 65535, 65535, 65535, 4515, 65535, 65535, 65535, 4516, 65535, 65535, 65535, 4517,
+    65535, 4518, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4519, 4520, 65535, 4521, 65535, 65535,
+    4522, 4523, 4524, 65535, 4525, 4526, 65535, 4527, 65535, 65535, 65535, 4528, 65535, 4529, 65535, 4530,
+    65535, 65535, 4531, 4532, 4533, 65535, 65535, 4534, 65535, 65535, 4535, 65535, 65535, 65535, 65535, 65535,
+    4536, 65535, 4537, 4538, 65535, 65535, 65535, 65535, 4539, 4540, 65535, 4541, 65535, 4542, 65535, 4543,
+    65535, 65535, 65535, 65535, 65535, 4544, 65535, 65535, 65535, 65535, 4545, 4546, 65535, 4547, 65535, 4548,
+    65535, 4549, 65535, 4550, 65535, 4551, 65535, 65535, 65535, 4552, 4553, 65535, 65535, 4554, 65535, 4555,
+    4556, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4557, 65535, 65535, 65535, 65535, 65535, 4558,
+    65535, 4559, 4560, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    4561, 65535, 4562, 65535, 65535, 4563, 4564, 4565, 65535, 65535, 65535, 4566, 65535, 65535, 65535, 4567,
+    65535, 4568, 4569, 4570, 65535, 4571, 65535, 4572, 65535, 4573, 65535, 65535, 65535, 4574, 65535, 65535,
+    65535, 4575, 65535, 4576, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4577, 4578, 65535, 4579,
+    65535, 65535, 4580, 4581, 4582, 65535, 4583, 4584, 65535, 4585, 65535, 4586, 65535, 4587, 65535, 4588,
+    65535, 4589, 65535, 65535, 4590, 4591, 4592, 65535, 65535, 4593, 65535, 4594, 4595, 65535, 65535, 65535,
+    65535, 65535, 65535, 4596, 65535, 65535, 65535, 4597, 65535, 4598, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 4599, 4600, 65535, 4601, 65535, 65535, 4602, 4603, 4604, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 4605, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    4606, 65535, 65535, 65535, 4607, 65535, 65535, 4608, 65535, 4609, 65535, 65535, 4610, 4611, 4612, 65535,
+    65535, 65535, 4613, 65535, 65535, 65535, 4614, 65535, 4615, 4616, 4617, 65535, 4618, 65535, 65535, 65535,
+    4619, 65535, 4620, 4621, 65535, 4622, 65535, 4623, 65535, 4624, 65535, 4625, 65535, 4626, 65535, 65535,
+    65535, 4627, 4628, 65535, 65535, 4629, 65535, 4630, 4631, 65535, 65535, 65535, 65535, 4632, 65535, 4633,
+    65535, 65535, 65535, 4634, 4635, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4636, 65535, 4637, 4638,
+    4639, 65535, 4640, 65535, 4641, 65535, 4642, 65535, 65535, 4643, 65535, 4644, 4645, 65535, 65535, 65535,
+    65535, 4646, 4647, 65535, 4648, 65535, 4649, 65535, 4650, 65535, 65535, 65535, 65535, 65535, 4651, 65535,
+    65535, 65535, 65535, 65535, 4652, 65535, 4653, 4654, 65535, 65535, 65535, 65535, 4655, 4656, 65535, 4657,
+    65535, 4658, 65535, 4659, 65535, 65535, 65535, 65535, 65535, 4660, 65535, 65535, 65535, 65535, 4661, 4662,
+    65535, 4663, 65535, 4664, 65535, 4665, 65535, 4666, 65535, 4667, 65535, 65535, 4668, 4669, 4670, 65535,
+    65535, 4671, 65535, 4672, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4673, 65535, 65535,
+    65535, 65535, 65535, 4674, 65535, 4675, 4676, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 4677, 4678, 65535, 4679, 65535, 65535, 65535, 4680, 65535, 4681, 65535, 4682,
+    65535, 65535, 4683, 4684, 4685, 65535, 65535, 4686, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4687,
+    65535, 4688, 65535, 65535, 4689, 4690, 4691, 65535, 65535, 65535, 4692, 65535, 65535, 65535, 4693, 65535,
+    4694, 4695, 65535, 65535, 65535, 65535, 65535, 65535, 4696, 65535, 65535, 4697, 65535, 65535, 4698, 65535,
+    65535, 65535, 65535, 4699, 4700, 65535, 4701, 65535, 65535, 65535, 4702, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4703, 65535, 65535, 65535, 65535, 65535, 4704,
+    65535, 4705, 4706, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 4707, 65535, 4708, 4709, 65535, 65535, 65535, 65535, 4710, 4711, 65535, 4712, 65535, 4713, 65535,
+    4714, 65535, 65535, 65535, 65535, 65535, 4715, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 4716, 65535, 4717, 65535, 65535, 4718, 4719, 4720, 65535, 65535,
+    65535, 4721, 65535, 65535, 65535, 4722, 65535, 4723, 4724, 4725, 65535, 4726, 65535, 4727, 65535, 4728,
+    65535, 65535, 65535, 4729, 65535, 65535, 65535, 4730, 65535, 4731, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 4732, 4733, 65535, 4734, 65535, 65535, 4735, 4736, 4737, 65535, 4738, 4739, 65535, 4740,
+    65535, 4741, 65535, 4742, 65535, 4743, 65535, 4744, 65535, 65535, 4745, 4746, 4747, 65535, 65535, 4748,
+    65535, 4749, 4750, 65535, 65535, 65535, 65535, 65535, 65535, 4751, 65535, 65535, 65535, 4752, 65535, 4753,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4754, 4755, 65535, 4756, 65535, 65535, 4757, 4758,
+    4759, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4760, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 4761, 65535, 65535, 65535, 4762, 65535, 4763, 4764, 65535, 4765,
+    65535, 65535, 4766, 4767, 4768, 65535, 65535, 65535, 4769, 65535, 65535, 65535, 4770, 65535, 65535, 4771,
+    4772, 65535, 4773, 65535, 65535, 65535, 4774, 65535, 4775, 4776, 65535, 4777, 65535, 4778, 65535, 4779,
+    65535, 4780, 65535, 4781, 65535, 65535, 65535, 4782, 4783, 65535, 65535, 4784, 65535, 4785, 4786, 65535,
+    65535, 65535, 65535, 4787, 65535, 4788, 65535, 65535, 65535, 4789, 4790, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 4791, 65535, 4792, 4793, 4794, 65535, 4795, 65535, 4796, 65535, 65535, 65535, 65535, 4797,
+    65535, 4798, 4799, 65535, 65535, 65535, 65535, 4800, 4801, 65535, 4802, 65535, 4803, 65535, 4804, 65535,
+    65535, 65535, 65535, 65535, 4805, 65535, 65535, 65535, 65535, 65535, 65535, 4806, 65535, 65535, 65535, 4807,
+    65535, 4808, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4809, 4810, 65535, 4811, 65535, 65535,
+    4812, 4813, 4814, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4815, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4816, 65535, 65535, 65535, 4817, 65535, 4818, 4819,
+    65535, 4820, 65535, 65535, 4821, 4822, 4823, 65535, 65535, 65535, 4824, 65535, 65535, 65535, 4825, 65535,
+    4826, 4827, 4828, 65535, 4829, 65535, 4830, 65535, 4831, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 4832, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4833, 65535,
+    65535, 65535, 4834, 65535, 4835, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 4836, 65535, 65535, 65535, 4837, 65535, 4838, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 4839, 4840, 65535, 4841, 65535, 65535, 4842, 4843, 4844, 65535, 4845, 65535, 4846, 65535, 65535,
+    65535, 4847, 4848, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4849, 65535, 4850, 4851, 4852, 65535,
+    4853, 65535, 4854, 65535, 4855, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4856, 65535, 4857, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4858, 65535, 4859, 65535, 65535, 65535, 4860, 4861,
+    65535, 4862, 4863, 65535, 4864, 65535, 4865, 65535, 4866, 65535, 4867, 65535, 4868, 65535, 65535, 65535,
+    4869, 4870, 65535, 65535, 4871, 65535, 4872, 4873, 65535, 65535, 65535, 65535, 4874, 4875, 65535, 4876,
+    65535, 4877, 65535, 4878, 65535, 4879, 65535, 4880, 65535, 65535, 4881, 4882, 4883, 65535, 65535, 4884,
+    65535, 4885, 65535, 65535, 65535, 65535, 65535, 4886, 65535, 4887, 65535, 65535, 4888, 4889, 4890, 65535,
+    65535, 65535, 4891, 65535, 65535, 65535, 4892, 65535, 4893, 4894, 65535, 65535, 65535, 65535, 4895, 65535,
+    65535, 65535, 65535, 4896, 65535, 4897, 4898, 65535, 65535, 65535, 65535, 4899, 4900, 65535, 4901, 65535,
+    4902, 65535, 4903, 65535, 65535, 65535, 65535, 65535, 4904, 65535, 65535, 65535, 65535, 4905, 65535, 4906,
+    65535, 65535, 4907, 4908, 4909, 65535, 65535, 65535, 4910, 65535, 65535, 65535, 4911, 65535, 65535, 4912,
+    65535, 65535, 65535, 65535, 65535, 65535, 4913, 65535, 65535, 65535, 4914, 65535, 65535, 65535, 4915, 65535,
+    4916, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4917, 65535, 65535, 4918, 65535, 65535, 65535,
+    4919, 65535, 65535, 4920, 4921, 65535, 4922, 65535, 65535, 65535, 4923, 65535, 4924, 65535, 65535, 65535,
+    65535, 4925, 65535, 4926, 65535, 65535, 4927, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4928,
+    65535, 4929, 4930, 65535, 65535, 65535, 65535, 4931, 4932, 65535, 4933, 65535, 4934, 65535, 4935, 65535,
+    65535, 65535, 65535, 65535, 4936, 65535, 65535, 65535, 65535, 4937, 4938, 65535, 4939, 65535, 4940, 65535,
+    65535, 65535, 4941, 65535, 4942, 65535, 65535, 65535, 4943, 4944, 65535, 65535, 65535, 65535, 4945, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4946, 65535, 65535, 65535, 65535, 65535, 4947, 65535,
+    4948, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    4949, 65535, 4950, 4951, 65535, 65535, 65535, 65535, 4952, 4953, 65535, 4954, 65535, 4955, 65535, 4956,
+    65535, 65535, 65535, 65535, 65535, 4957, 65535, 65535, 65535, 65535, 4958, 4959, 65535, 4960, 65535, 4961,
+    65535, 4962, 65535, 4963, 65535, 4964, 65535, 65535, 4965, 4966, 4967, 65535, 65535, 4968, 65535, 4969,
+    4970, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 4971, 65535, 65535, 65535, 65535, 65535, 4972,
+    65535, 4973, 4974, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    4975, 4976, 65535, 4977, 65535, 65535, 65535, 4978, 65535, 4979, 65535, 4980, 65535, 65535, 4981, 4982,
+    4983, 65535, 65535, 4984, 65535, 65535, 4985, 65535, 65535, 65535, 65535, 4986, 65535, 4987, 65535, 65535,
+    4988, 4989, 4990, 65535, 65535, 65535, 4991, 65535, 65535, 65535, 4992, 65535, 4993, 4994, 4995, 65535,
+    4996, 65535, 65535, 65535, 4997, 65535, 65535, 4998, 65535, 65535, 4999, 65535, 65535, 65535, 65535, 5000,
+    5001, 65535, 5002, 65535, 65535, 65535, 5003, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 5004, 65535, 65535, 65535, 65535, 65535, 5005, 65535, 5006, 5007, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 5008, 65535, 5009,
+    5010, 65535, 65535, 65535, 65535, 5011, 5012, 65535, 5013, 65535, 5014, 65535, 5015, 65535, 65535, 65535,
+    65535, 65535, 5016, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 5017, 5018, 65535, 5019, 65535, 5020, 65535, 5021, 65535, 5022, 65535, 5023, 65535, 65535,
+    5024, 5025, 5026, 65535, 65535, 5027, 65535, 5028, 5029, 65535, 65535, 65535, 65535, 5030, 65535, 5031,
+    65535, 65535, 5032, 5033, 5034, 65535, 65535, 65535, 5035, 65535, 65535, 65535, 5036, 65535, 5037, 5038,
+    5039, 65535, 5040, 65535, 5041, 65535, 5042, 65535, 65535, 5043, 65535, 5044, 5045, 65535, 65535, 65535,
+    65535, 5046, 5047, 65535, 5048, 65535, 5049, 65535, 5050, 65535, 65535, 65535, 65535, 65535, 5051, 65535,
+    65535, 65535, 65535, 5052, 65535, 5053, 65535, 65535, 5054, 5055, 5056, 65535, 65535, 65535, 5057, 65535,
+    65535, 65535, 5058, 65535, 5059, 5060, 5061, 65535, 5062, 65535, 65535, 65535, 5063, 65535, 65535, 65535,
+    5064, 65535, 65535, 65535, 5065, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 5066,
+    5067, 65535, 65535, 65535, 65535, 5068, 65535, 5069, 65535, 5070, 5071, 65535, 5072, 65535, 65535, 65535,
+    5073, 65535, 5074, 65535, 5075, 65535, 65535, 65535, 5076, 5077, 65535, 65535, 5078, 65535, 65535, 5079,
+    65535, 65535, 65535, 65535, 65535, 5080, 65535, 5081, 5082, 65535, 65535, 65535, 65535, 5083, 5084, 65535,
+    5085, 65535, 5086, 65535, 5087, 65535, 65535, 65535, 65535, 65535, 5088, 65535, 65535, 65535, 65535, 5089,
+    5090, 65535, 5091, 65535, 5092, 65535, 5093, 65535, 5094, 65535, 5095, 65535, 65535, 65535, 5096, 5097,
+    65535, 65535, 5098, 65535, 5099, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 5100, 65535,
+    65535, 65535, 65535, 65535, 5101, 65535, 5102, 5103, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 5104, 65535, 65535, 65535, 65535, 65535, 5105,
+    65535, 5106, 5107, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 5108, 65535, 5109, 5110, 65535, 65535, 65535, 65535, 5111, 5112, 65535, 5113, 65535, 5114, 65535,
+    5115, 65535, 65535, 65535, 65535, 65535, 5116, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 5117, 65535, 65535, 5118, 65535, 65535, 65535, 65535, 5119,
+    5120, 65535, 5121, 65535, 65535, 65535, 5122, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 5123, 5124, 65535, 5125, 65535, 65535, 65535, 5126, 65535, 5127, 65535, 5128, 65535, 65535, 5129,
+    5130, 5131, 65535, 65535, 5132, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 5133, 65535, 65535, 5134, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 5135, 65535, 65535, 65535, 65535, 65535, 5136, 65535, 5137, 5138,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 5139, 65535, 65535, 65535,
+    65535, 65535, 5140, 65535, 5141, 5142, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 5143, 65535, 5144, 5145, 65535, 65535, 65535, 65535, 5146, 5147, 65535, 5148,
+    65535, 5149, 65535, 5150, 65535, 65535, 65535, 65535, 65535, 5151, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 5152, 65535, 5153, 5154, 65535, 65535,
+    65535, 65535, 5155, 5156, 65535, 5157, 65535, 5158, 65535, 5159, 65535, 65535, 65535, 65535, 65535, 5160,
+    65535, 65535, 65535, 65535, 5161, 5162, 65535, 5163, 65535, 5164, 65535, 5165, 65535, 5166, 65535, 5167,
+    65535, 65535, 5168, 5169, 5170, 65535, 65535, 5171, 65535, 5172, 5173, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 5174, 65535, 65535, 65535, 65535, 65535, 5175, 65535, 5176, 5177, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 5178, 65535, 65535, 65535, 65535, 65535, 5179,
+    65535, 5180, 5181, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 5182, 65535, 5183, 5184,
+    65535, 65535, 65535, 65535, 5185, 5186, 65535, 5187, 65535, 5188, 65535, 5189, 65535, 65535, 65535, 65535,
+    65535, 5190, 65535, 65535, 65535, 65535, 5191, 5192, 65535, 5193, 65535, 5194, 65535, 5195, 65535, 5196,
+    65535, 5197, 65535, 65535, 5198, 5199, 5200, 65535, 65535, 5201, 65535, 5202, 5203, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 5204, 65535, 65535, 65535, 65535, 65535, 5205, 65535, 5206, 5207, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 5208, 5209, 65535, 5210,
+    65535, 5211, 65535, 5212, 65535, 5213, 65535, 5214, 65535, 65535, 5215, 5216, 5217, 65535, 65535, 5218,
+    65535, 5219, 5220, 65535, 65535, 65535, 65535, 5221, 65535, 65535, 65535, 65535, 5222, 65535, 5223, 65535,
+    65535, 65535, 5224, 65535, 65535, 65535, 5225, 65535, 65535, 65535, 5226, 65535, 5227, 65535, 65535, 65535,
+    65535, 65535, 65535, 5228, 65535, 5229, 5230, 65535, 65535, 65535, 65535, 5231, 5232, 65535, 5233, 65535,
+    5234, 65535, 5235, 65535, 65535, 65535, 65535, 65535, 5236, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 5237, 65535, 65535, 65535, 65535, 65535, 5238, 65535, 5239, 5240, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 5241, 65535, 5242, 5243, 65535, 65535, 65535,
+    65535, 5244, 5245, 65535, 5246, 65535, 5247, 65535, 5248, 65535, 65535, 65535, 65535, 65535, 5249, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 5250, 65535, 65535,
+    65535, 65535, 65535, 5251, 65535, 5252, 5253, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 5254, 65535, 65535, 65535, 65535, 65535, 5255, 65535, 5256, 5257, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 5258, 65535, 5259, 5260, 65535,
+    65535, 65535, 65535, 5261, 5262, 65535, 5263, 65535, 5264, 65535, 5265, 65535, 65535, 65535, 65535, 65535,
+    5266, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 5267, 65535, 5268, 5269, 65535, 65535, 65535, 65535, 5270, 5271, 65535, 5272, 65535, 5273,
+    65535, 5274, 65535, 65535, 65535, 65535, 65535, 5275, 65535, 65535, 65535, 65535, 5276, 5277, 65535, 5278,
+    65535, 5279, 65535, 65535, 65535, 5280, 65535, 5281, 65535, 65535, 5282, 5283, 5284, 65535, 65535, 65535,
+    65535, 5285, 5286, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 5287, 65535, 65535, 65535, 65535,
+    65535, 5288, 65535, 5289, 5290, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 5291, 5292, 65535, 5293, 65535, 5294, 65535, 5295, 65535, 5296, 65535, 65535, 65535, 65535,
+    5297, 65535, 5298, 65535, 65535, 5299, 65535, 5300, 5301, 65535, 65535, 65535, 65535, 5302, 65535, 5303,
+    65535, 65535, 5304, 5305, 5306, 65535, 65535, 65535, 5307, 65535, 65535, 65535, 5308, 65535, 65535, 5309,
+    5310, 65535, 5311, 65535, 5312, 65535, 65535, 65535, 65535, 5313, 65535, 5314, 5315, 65535, 65535, 65535,
+    65535, 65535, 5316, 65535, 5317, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 5318, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 5319, 65535, 65535, 65535, 65535, 65535, 5320, 65535, 5321,
+    5322, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 5323, 5324, 65535, 65535, 65535, 65535, 5325, 5326, 65535, 5327, 65535, 5328, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 5329, 5330, 65535, 5331, 65535, 5332, 65535, 5333, 65535, 5334, 65535, 5335,
+    65535, 65535, 5336, 5337, 5338, 65535, 65535, 5339, 65535, 5340, 5341, 65535, 65535, 65535, 65535, 5342,
+    65535, 5343, 65535, 65535, 5344, 5345, 5346, 65535, 65535, 65535, 5347, 65535, 65535, 65535, 5348, 65535,
+    5349, 5350, 5351, 65535, 5352, 65535, 5353, 65535, 65535, 65535, 65535, 5354, 65535, 5355, 5356, 65535,
+    65535, 65535, 65535, 5357, 5358, 65535, 5359, 65535, 5360, 65535, 5361, 65535, 65535, 65535, 65535, 65535,
+    5362, 65535, 65535, 65535, 65535, 5363, 65535, 5364, 65535, 65535, 5365, 5366, 5367, 65535, 65535, 65535,
+    5368, 65535, 65535, 65535, 5369, 65535, 65535, 5370, 5371, 65535, 5372, 65535, 5373, 65535, 5374, 65535,
+    65535, 65535, 5375, 65535, 65535, 65535, 5376, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 5377, 5378, 65535, 65535, 65535, 65535, 5379, 65535, 5380, 65535, 5381, 5382, 65535, 5383, 65535,
+    5384, 65535, 5385, 65535, 5386, 65535, 65535, 65535, 65535, 5387, 65535, 5388, 65535, 65535, 5389, 65535,
+    5390, 5391, 65535, 65535, 65535, 65535, 65535, 5392, 65535, 5393, 5394, 65535, 65535, 65535, 65535, 5395,
+    5396, 65535, 5397, 65535, 5398, 65535, 5399, 65535, 65535, 65535, 65535, 65535, 5400, 65535, 65535, 65535,
+    65535, 5401, 5402, 65535, 5403, 65535, 5404, 65535, 65535, 65535, 5405, 65535, 5406, 65535, 65535, 65535,
+    5407, 65535, 65535, 65535, 65535, 65535, 5408, 5409, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    5410, 65535, 65535, 65535, 65535, 65535, 5411, 65535, 5412, 5413, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 5414, 65535, 65535, 65535, 65535,
+    65535, 5415, 65535, 5416, 5417, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 5418, 5419, 65535, 65535, 65535, 65535, 5420, 5421, 65535, 5422, 65535,
+    5423, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 5424, 65535, 5425, 5426, 65535, 65535, 65535,
+    65535, 65535, 5427, 65535, 5428, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 5429, 65535,
+    65535, 65535, 65535, 5430, 5431, 65535, 5432, 65535, 5433, 65535, 65535, 65535, 5434, 65535, 65535, 65535,
+    65535, 5435, 65535, 5436, 65535, 65535, 65535, 65535, 5437, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 5438, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 5439, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    5440, 5441, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 5442, 65535, 65535, 65535, 65535, 65535, 5443,
+    65535, 5444, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 5445,
+    65535, 65535, 65535, 65535, 65535, 5446, 65535, 5447, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 5448, 65535, 5449, 65535, 65535, 65535, 65535, 65535, 5450,
+    65535, 65535, 65535, 65535, 5451, 65535, 5452, 65535, 65535, 65535, 65535, 65535, 5453, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 5454, 65535, 65535, 65535, 65535, 65535, 5455, 65535, 5456, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 5457, 65535, 5458, 65535, 65535, 65535, 65535,
+    65535, 5459, 65535, 65535, 65535, 65535, 5460, 65535, 5461, 65535, 65535, 65535, 65535, 65535, 5462, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 5463,
+    65535, 5464, 65535, 65535, 65535, 65535, 65535, 5465, 65535, 65535, 65535, 65535, 5466, 65535, 5467, 65535,
+    65535, 65535, 65535, 65535, 5468, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 5469, 65535, 65535, 65535, 65535, 65535, 5470, 65535,
+    5471, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 5472, 65535,
+    65535, 65535, 65535, 65535, 5473, 65535, 5474, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    5475, 65535, 65535, 65535, 65535, 65535, 5476, 65535, 5477, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535, 65535,
+    65535, 65535, 65535,
+};
+
+const int8_t ttt_perfect_outcome[5478] = {
+    0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 1, 0, 1, 0, 0, 0,
+    1, -1, 0, 0, 1, 1, -1, 1, 1, 1, 1, 1, -1, 1, -1, 1,
+    -1, 1, 1, 0, 0, 0, 1, -1, 0, -1, 1, 0, 0, 0, 1, 1,
+    0, -1, 1, -1, 0, 1, -1, 1, -1, 1, -1, -1, 1, 1, -1, 1,
+    1, 1, -1, 1, 1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 1, 0, 0, 1, 0, 1, 1, 0, 1, 1, 1, 1, -1,
+    0, 1, 1, 1, 0, -1, -1, 1, 0, 0, 0, 1, 1, 1, 1, 1,
+    -1, 1, 1, 1, 1, -1, 0, 0, 0, 1, 1, 0, 1, 1, 1, 0,
+    0, 0, 0, 0, -1, 1, -1, 0, 1, -1, 1, -1, -1, -1, -1, 0,
+    0, 1, 1, 0, 1, -1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 0, 0, 1, 1, -1, 1, -1, 1, 1, 1,
+    1, -1, 1, 1, -1, 1, 1, 1, 0, 1, -1, -1, 1, 1, 0, 1,
+    1, 1, 1, -1, -1, 1, 1, -1, 0, 0, 0, 0, 1, 0, 0, 0,
+    1, 0, 1, 1, 1, 1, 1, 1, -1, 1, -1, -1, 1, 1, -1, 1,
+    -1, 1, -1, 1, 1, 1, 0, 0, 0, 1, -1, 0, 0, 1, 0, 1,
+    1, 1, 1, 1, 1, -1, 1, -1, -1, 1, 1, 1, 1, 1, 1, -1,
+    1, 1, -1, 1, -1, 0, 0, 1, 1, 0, 1, 0, 1, -1, -1, 0,
+    1, 1, -1, 0, 1, 1, 1, 1, -1, 1, 1, -1, 1, 1, -1, 1,
+    0, 0, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 0, -1, 1, -1,
+    0, 0, 0, 1, -1, 1, 1, 1, -1, -1, 1, -1, 1, -1, -1, -1,
+    1, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 1, 1, 0, 1, 1,
+    0, 0, 0, 0, 1, 1, -1, 1, 1, -1, 1, -1, 0, 0, 0, 0,
+    1, 0, 1, 1, -1, -1, 0, 0, 0, 1, -1, 0, 0, 0, 1, -1,
+    1, 1, 1, -1, 0, 1, -1, 1, 0, -1, -1, 1, 0, 0, 0, 1,
+    1, 1, 1, 1, -1, 0, 0, 1, -1, 0, 0, 0, 0, 0, 0, 1,
+    1, 0, 1, 1, 1, 1, 0, 0, 0, 0, 1, 1, 1, -1, 1, 1,
+    -1, 1, 1, -1, 1, 0, 0, 1, 0, 0, 1, 1, 1, 1, 0, 0,
+    0, 1, -1, 0, 1, 1, 0, 1, 1, 1, -1, 1, 1, 1, 0, 0,
+    1, 1, -1, 0, -1, 1, 1, -1, 1, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, -1, -1, 1, -1, 1, -1, -1, -1, 1, 1, 1, 1, 1, 1,
+    -1, 1, -1, 1, -1, 1, 1, -1, 1, -1, -1, 1, 1, -1, -1, -1,
+    1, 1, 1, 1, 0, 1, 0, 1, 1, -1, 1, 1, 1, -1, 0, 0,
+    0, 0, 1, 1, -1, 1, -1, -1, -1, -1, 1, 1, -1, 1, -1, 1,
+    -1, 1, 1, 0, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, -1, 0, 0, 0, 1, 1, 0, 0, 1, 1, 0, 1, 1,
+    -1, 0, 1, -1, 1, -1, 0, 0, 1, 1, -1, -1, 1, 1, 1, 1,
+    -1, 1, -1, 1, -1, 1, 1, 1, 1, 1, -1, 0, 0, 1, 0, 0,
+    0, 0, 0, -1, 1, 0, 1, -1, 1, 1, 1, 1, 1, 0, 1, 1,
+    1, 1, 1, 1, 1, 1, -1, -1, 1, 1, 1, 1, 1, 1, 1, 1,
+    -1, 1, -1, 1, -1, 1, 1, 0, 1, 1, 1, -1, 1, -1, 1, 1,
+    -1, -1, 1, 1, -1, -1, -1, -1, -1, -1, 0, 0, 1, -1, 1, 1,
+    -1, 1, 0, 1, 1, -1, 1, 1, 1, 1, -1, -1, 1, 1, -1, -1,
+    1, 1, -1, -1, 1, 1, 1, 1, 1, -1, -1, 1, 1, 1, -1, 1,
+    1, 1, -1, 0, 0, 1, 0, 0, 0, 0, 0, -1, 1, 1, -1, 1,
+    -1, -1, 1, 1, 1, 0, 1, 0, 1, 1, 0, 0, 0, 0, 0, 1,
+    1, 1, 1, 1, 1, -1, 1, 1, 1, -1, 0, 1, 1, 0, 0, 0,
+    0, 1, 1, 0, 1, 1, 1, 1, 0, 1, -1, 1, -1, 1, 1, -1,
+    1, 0, 1, 1, 1, 0, 1, 1, 1, 0, 1, 1, 1, 0, 0, 0,
+    0, 0, 1, -1, 0, 0, 1, 1, 1, -1, -1, 1, -1, 1, 0, 1,
+    0, 1, 1, -1, -1, 1, 0, 0, 1, -1, 1, 0, 1, 1, 1, 0,
+    1, -1, 1, 0, 0, 1, 1, 0, 1, 0, 1, 1, 1, 1, -1, 1,
+    0, -1, 1, 0, 1, 1, -1, 0, -1, 1, 0, 1, -1, 1, -1, 1,
+    1, -1, 1, 1, 1, -1, 0, 1, 1, 1, 0, 1, 0, 1, 0, 0,
+    0, 1, 1, 1, 1, 1, -1, 1, 1, -1, 1, 0, 1, -1, 0, 0,
+    0, 1, 1, 1, 0, 1, 0, 1, 0, 1, 1, -1, 1, 1, 1, -1,
+    1, 1, -1, 1, -1, 1, 1, 0, 1, -1, 1, 0, 1, 1, 1, 0,
+    0, 0, 1, 1, 0, 1, 1, 1, 0, 1, 1, 1, 0, 1, 1, 1,
+    0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, -1, 1, -1, 1, 0, -1, 0, 1, 1, 1,
+    -1, 1, 0, 1, 0, 0, 1, 1, -1, -1, 1, 1, -1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 0, -1, 1, 0, 1, 1, -1, 0, -1, 1,
+    0, 1, 0, 1, 0, 0, 1, 1, 0, 1, -1, 1, -1, -1, -1, -1,
+    0, 1, -1, 1, 1, -1, 1, -1, 1, 1, 1, -1, -1, 1, -1, 1,
+    0, -1, -1, 1, 1, 0, -1, 1, 1, 1, 1, 1, -1, -1, -1, 1,
+    -1, -1, 1, -1, 1, 0, 0, 1, 1, 1, -1, 1, 0, 1, 1, -1,
+    1, 1, 1, 1, -1, 1, 1, -1, 1, 1, 1, -1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, 0, 1,
+    -1, 0, 1, -1, 1, 0, 1, 1, 1, -1, 1, 0, 1, 1, 0, 1,
+    1, 1, -1, 1, 1, 1, -1, 0, 1, 1, 1, 0, 1, 0, 1, 1,
+    0, 0, 1, 1, 1, 1, -1, 1, -1, -1, -1, 1, 1, 1, 1, 1,
+    1, 1, -1, 1, -1, 1, 1, 1, 1, -1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, -1, -1, 1, -1, 1, 1, -1, 1, 1,
+    1, 1, 1, -1, -1, 1, -1, 1, -1, -1, -1, 1, 1, -1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, 1, 1, 1,
+    -1, 1, -1, 1, 1, -1, 1, 1, -1, -1, -1, -1, -1, -1, 0, 0,
+    1, 1, 0, 0, 0, 1, 0, 0, 1, 1, 1, 0, 1, 1, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, 1, 1, -1, 1, -1, 1, -1, 1,
+    1, 0, 1, -1, 0, 0, 1, 0, 0, 1, -1, -1, 1, -1, 0, 1,
+    0, -1, 1, -1, 1, -1, 1, -1, -1, 1, 1, -1, 0, 0, 1, -1,
+    0, -1, 1, 0, 0, 1, -1, 0, -1, 0, 1, 1, -1, 0, 0, 0,
+    1, 0, 0, -1, -1, 1, 1, 1, -1, 1, -1, 1, 0, 0, 1, 0,
+    1, 1, 1, 1, 1, 1, 1, 0, 1, -1, 1, 1, 1, 1, 1, 1,
+    -1, 1, -1, 1, 1, -1, 1, 0, 1, 1, 1, 1, 0, 1, 1, -1,
+    1, -1, 1, -1, -1, -1, -1, 1, -1, 0, 0, 1, -1, 1, -1, -1,
+    1, 0, 1, 1, -1, 0, 0, 1, 1, 1, 0, -1, -1, 1, -1, 1,
+    0, 1, 1, 0, 1, -1, -1, -1, 1, -1, 1, 1, -1, 1, -1, 1,
+    -1, 1, 1, -1, 1, 0, -1, 1, 0, 1, 0, 1, 0, 1, 0, 0,
+    0, 0, 0, 0, -1, 1, 1, 1, 1, 1, -1, 1, -1, -1, 1, 0,
+    1, -1, 0, 0, 1, -1, 0, 1, -1, 0, 0, 0, 0, 0, 1, 1,
+    -1, 1, 1, -1, 1, -1, -1, 1, 1, 1, 1, -1, 0, 0, 1, 0,
+    0, 0, 0, 0, -1, 1, 0, 0, 1, -1, 0, 0, 1, 0, 1, 1,
+    0, 0, 1, 0, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, -1, 1,
+    -1, 0, 0, 1, -1, 1, 1, 1, -1, 1, 0, 1, -1, 1, 0, 1,
+    -1, -1, -1, 1, 1, -1, 0, 1, 1, 1, 1, -1, 1, -1, -1, 1,
+    1, 1, 1, 1, 1, -1, 1, 1, -1, 0, 1, 0, 0, -1, 1, 1,
+    0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 0, 1,
+    1, -1, 1, 1, 1, -1, 0, 1, 1, 1, 1, 0, 1, -1, -1, 1,
+    1, 0, -1, 1, 0, 1, -1, -1, -1, 1, 1, -1, 0, 1, 1, -1,
+    -1, -1, -1, -1, -1, 1, 0, 1, 0, 1, -1, 1, 1, 1, -1, 1,
+    0, 0, 0, 1, 0, 1, 1, -1, 1, -1, 0, -1, 1, 1, 0, -1,
+    1, 1, 1, -1, 1, 0, 1, 1, 1, 1, -1, 1, 1, 1, -1, 1,
+    1, -1, 1, -1, 0, 0, 1, 1, 1, 1, -1, 1, -1, -1, 1, 1,
+    1, 1, -1, 1, 0, 1, 0, 1, 0, 1, -1, 1, 0, 1, 1, 1,
+    1, -1, 1, 1, 1, -1, 1, -1, 0, 0, 1, 0, 1, 0, 1, 1,
+    1, 0, 0, -1, 1, 0, 1, -1, 1, 1, 1, 1, -1, 0, 0, 1,
+    1, 0, 1, -1, -1, 1, 1, 0, -1, 1, 0, 1, -1, -1, -1, 1,
+    -1, 0, 0, 1, -1, -1, 1, -1, -1, 1, 0, 1, -1, 1, -1, 0,
+    1, 1, -1, -1, -1, 1, 0, 0, 1, 1, -1, 0, 1, 0, 0, -1,
+    1, 1, -1, 0, 0, 1, -1, 1, -1, 1, -1, 1, 1, 1, -1, 0,
+    1, 0, 1, 1, -1, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 1,
+    -1, 1, 0, 1, -1, 1, 0, 0, 1, 1, -1, 1, -1, 1, 1, 0,
+    0, 0, -1, -1, 1, -1, 0, 1, 0, 1, -1, -1, -1, -1, 0, 1,
+    0, 1, -1, -1, -1, 0, 0, 0, 0, 1, 0, 1, 0, 0, -1, 1,
+    1, 1, -1, 1, 0, 0, 1, -1, 1, -1, 1, -1, 1, -1, 0, 0,
+    0, 1, 0, 1, 1, -1, 1, -1, 0, 1, 1, -1, 1, -1, -1, 1,
+    1, 1, 1, -1, 0, 0, -1, 1, 0, 1, -1, 1, -1, 1, 1, 1,
+    -1, 1, -1, 0, 1, 1, -1, -1, -1, 1, 0, 1, -1, 1, 0, 1,
+    -1, -1, -1, 1, -1, 1, 0, 1, 1, -1, -1, -1, 1, 1, 1, 1,
+    -1, 1, -1, 1, -1, 0, 0, 1, 1, 1, -1, -1, 1, 1, 1, 1,
+    1, 0, -1, -1, 1, 0, 1, 1, 1, 1, -1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, 1, 1,
+    1, -1, 1, 1, 1, 1, 1, 1, 1, 1, -1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1, -1, -1,
+    1, -1, 1, 1, 1, 1, -1, 1, 1, 1, 1, 1, -1, -1, -1, 1,
+    1, 1, 1, 1, -1, -1, 1, 1, 1, -1, 1, 1, 1, -1, 1, 0,
+    1, 0, 1, 1, 0, 1, 1, 0, 1, 0, 1, 0, -1, -1, 1, 1,
+    -1, 0, 1, 1, 0, 0, 1, -1, 0, 0, 0, 1, -1, 1, 0, 0,
+    1, 1, -1, 1, 1, 1, -1, 1, 1, 1, 0, -1, 1, -1, 0, 0,
+    0, 1, -1, 1, 1, 1, -1, -1, 1, 1, 1, -1, 1, -1, 1, 1,
+    -1, -1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 1, 1, 1, 0, 1,
+    0, 0, 0, 0, 1, 0, 1, 1, 1, 1, 1, 0, 1, 0, 0, 1,
+    1, 1, 1, 1, 1, -1, 1, 1, 1, -1, 1, -1, 1, -1, 1, 1,
+    1, 1, -1, 0, 1, 1, 1, -1, -1, -1, 0, 0, 1, 0, 1, 1,
+    1, 1, -1, 1, -1, 1, -1, 1, -1, 1, 1, -1, 0, 1, 0, 1,
+    1, -1, -1, 0, 1, 1, 0, -1, 1, 1, 1, -1, 1, -1, 1, -1,
+    1, 1, 0, 0, 1, 1, -1, -1, -1, 0, 0, 1, 1, 0, 0, 1,
+    1, 0, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, -1, 0, 0,
+    1, 1, -1, -1, 1, 1, 1, 1, 1, 1, 1, 1, -1, 1, 1, -1,
+    1, 0, 1, -1, 0, -1, 1, 1, -1, -1, 1, 0, 0, 0, 0, 0,
+    0, 0, 1, -1, 1, -1, -1, 1, -1, 1, 1, 1, -1, 1, -1, 0,
+    0, 1, 0, 1, 1, 0, -1, -1, 1, 0, 0, 0, 1, 0, 0, 0,
+    0, 1, 1, 1, 1, -1, -1, -1, -1, -1, 1, -1, -1, 1, 0, 1,
+    -1, 1, 1, 1, -1, -1, 1, -1, 1, -1, -1, -1, 1, 1, -1, 0,
+    1, 1, 1, 1, 1, -1, -1, -1, 1, -1, -1, 1, 0, 1, -1, 0,
+    1, 0, 1, 1, -1, 1, 1, 1, -1, 0, 1, 1, 0, 1, 1, 1,
+    -1, 1, 0, 1, -1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, -1, -1, -1, 1, -1, 0, 1, 0, 1, -1, 1,
+    1, 1, -1, -1, 1, 1, -1, 0, 1, 0, 1, 1, 1, 1, 1, -1,
+    -1, 1, -1, 1, 1, -1, -1, 1, 0, 0, 1, 1, -1, 1, 0, 1,
+    -1, -1, -1, 1, 1, -1, -1, 1, 1, 0, -1, 1, -1, -1, 1, 0,
+    1, -1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1,
+    -1, 1, -1, -1, 1, 0, 1, -1, 1, 1, 1, -1, -1, 1, -1, 1,
+    -1, -1, -1, 1, -1, -1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, -1, 1, 0, 1, -1, 0, 1, 1, 1, -1, -1, 1,
+    -1, -1, -1, -1, -1, -1, 1, -1, 0, 0, 1, -1, 1, 1, 1, -1,
+    1, 1, 1, 0, 1, 0, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, -1, 1, -1, 1, -1, 1, 1, 0, 0, 1, 1, -1, 1, -1,
+    1, 1, -1, -1, 1, 0, -1, 1, 0, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 1, -1, 1, -1, 1, -1, 1, 1, 1, 1, -1, -1, 1, 1,
+    -1, 0, 1, 1, 0, -1, 0, 1, 0, 1, 1, -1, -1, 1, 1, 1,
+    -1, -1, 1, 1, 1, -1, -1, -1, 1, 1, 1, -1, 1, -1, -1, 1,
+    -1, 1, 1, 1, 1, 1, 1, -1, 1, -1, 1, -1, -1, 1, -1, 1,
+    1, -1, 1, -1, -1, 1, 1, 1, -1, -1, -1, -1, 1, -1, 1, -1,
+    -1, 1, -1, 1, -1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1, 1,
+    1, 1, 1, 1, -1, -1, -1, -1, -1, 1, 1, 1, -1, -1, -1, 1,
+    1, -1, 1, -1, 0, 0, 1, 1, 0, 0, 0, 0, 1, 0, 0, 0,
+    0, 0, 1, 1, 1, 1, 1, 1, -1, 1, -1, -1, 1, 0, 0, 1,
+    1, -1, 1, -1, 0, 0, 0, 1, -1, 0, 0, 0, 1, -1, -1, 1,
+    1, -1, 1, -1, 1, -1, 1, 1, 1, -1, 0, 0, 1, 0, 0, 0,
+    0, 0, -1, 1, 0, 1, -1, -1, 1, -1, 1, -1, 1, 1, 1, -1,
+    1, 1, 1, 1, -1, 1, -1, 1, 1, -1, -1, 1, 1, 1, 1, 1,
+    -1, 1, -1, 1, 1, -1, 1, -1, 1, -1, 0, 1, 1, 1, 0, -1,
+    -1, 1, 1, 1, 1, 1, 1, 0, 0, 1, -1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    -1, 1, -1, 1, -1, 1, 1, 1, 1, -1, 1, 1, 1, -1, -1, -1,
+    1, -1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, 1, 1, 1, -1,
+    -1, -1, 1, 1, 1, 1, 1, -1, 1, -1, 1, -1, 0, 0, 1, 1,
+    -1, -1, 1, 1, 0, 0, 1, 0, -1, 1, -1, 1, -1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, -1, 1, 0, -1, 1,
+    -1, 1, -1, 1, 1, 1, -1, -1, 1, -1, 1, -1, 1, -1, 1, 1,
+    -1, -1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    1, 0, 1, 0, 0, 0, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    1, -1, 1, 0, 0, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 0,
+    0, 1, -1, 1, -1, 1, -1, 1, 1, -1, 1, 1, -1, 1, -1, 1,
+    1, 1, 1, 1, -1, 1, -1, 1, -1, 1, -1, 1, 1, 1, -1, 1,
+    -1, 1, -1, 1, -1, 1, -1, -1, 0, 1, 1, -1, 0, 0, 1, 1,
+    1, 0, -1, -1, 1, 0, 1, 0, 1, 0, 0, 1, -1, -1, -1, -1,
+    -1, 1, 1, 1, 1, -1, 1, -1, 1, 1, 1, -1, 1, -1, 1, -1,
+    1, 1, 1, 1, -1, 1, -1, 1, -1, -1, -1, 1, 1, -1, 1, 1,
+    1, 1, -1, 1, -1, 1, -1, 1, -1, 1, 1, 1, 1, 1, -1, -1,
+    -1, -1, -1, 1, 1, 1, -1, -1, -1, 1, 1, 1, -1, 1, -1, -1,
+    -1, -1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 0, 1, 1, 1, 0,
+    0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, -1,
+    1, 1, -1, 1, 1, -1, 1, -1, 1, -1, 1, 0, 0, 1, -1, -1,
+    0, 0, 0, 0, -1, 1, -1, 1, -1, 1, -1, -1, 1, -1, 1, -1,
+    -1, -1, -1, 1, 0, 1, 1, 0, 0, -1, 0, 1, 1, 0, 0, 0,
+    0, 0, 0, 0, -1, -1, -1, -1, -1, 1, 0, 0, 0, 1, -1, 1,
+    0, 1, 1, 1, 0, 0, 0, 1, 0, 1, 1, 0, 1, 1, 1, -1,
+    0, 0, 1, 1, 1, -1, 1, -1, -1, 1, 1, 1, -1, 1, 0, 1,
+    -1, -1, -1, 1, 1, -1, 0, 0, 0, -1, 1, -1, -1, 1, 0, 1,
+    -1, 1, -1, 0, 0, -1, 1, 1, 1, -1, 1, -1, 0, 1, 0, 1,
+    1, -1, 1, -1, 0, 0, 1, 0, 0, -1, 1, 1, 0, -1, 1, 0,
+    1, 1, 1, 1, -1, -1, 1, 0, 1, 1, -1, -1, 1, 1, 0, 0,
+    1, -1, 1, 1, -1, 1, 1, 0, 1, 1, 1, -1, 0, 1, 1, -1,
+    -1, -1, 1, 0, 0, -1, -1, 1, -1, -1, 1, 0, 1, -1, -1, -1,
+    -1, -1, 1, 1, 1, -1, -1, -1, 1, -1, 0, 0, 1, 1, 0, 1,
+    -1, -1, -1, -1, 0, 1, 1, 1, 0, -1, -1, -1, 1, 1, 0, -1,
+    1, 1, 0, -1, -1, 0, 1, 1, -1, 1, -1, 0, 0, 1, 1, 1,
+    -1, 0, 0, 1, 0, 0, 0, 1, 1, 1, 1, -1, 1, 1, 1, -1,
+    1, -1, 0, 0, -1, 1, 0, 1, -1, 1, -1, 0, 0, 0, 1, -1,
+    0, -1, 1, 1, -1, 0, 0, 1, -1, 1, -1, -1, 1, 1, 1, 1,
+    -1, 1, 1, -1, 0, 1, 0, 0, -1, 1, 0, 1, 0, 1, 1, -1,
+    1, 1, 1, -1, 0, 0, 1, 1, 1, -1, 1, 0, 0, 0, 1, -1,
+    1, 1, 0, 1, 1, -1, 1, -1, 1, 1, 1, 0, 0, 0, -1, 1,
+    -1, 0, 0, 0, 1, -1, 1, 1, 1, -1, -1, 1, 0, 1, -1, -1,
+    -1, 1, -1, 0, 0, 0, 1, 0, 0, -1, 1, 1, 0, -1, 1, 0,
+    0, 1, 0, 0, -1, 1, -1, 1, -1, 0, 0, -1, 0, 1, 1, 1,
+    1, 1, -1, 0, 0, 1, 1, -1, 1, 0, 0, -1, 1, 1, 1, 1,
+    -1, 0, 1, 0, 1, 1, -1, -1, 0, 0, 0, 0, 1, 1, 1, 1,
+    -1, 0, -1, 1, -1, 0, 0, 0, 1, -1, 1, 1, 0, -1, -1, 0,
+    1, 0, 0, -1, 1, -1, 1, 0, 0, -1, 1, 1, 0, 1, -1, -1,
+    -1, 0, 0, 0, 1, -1, 0, 0, 1, 1, 1, 0, 1, 1, 1, 1,
+    -1, 0, 0, 0, 1, -1, 0, 1, 1, 1, -1, 0, 0, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, -1, 1, 0, 1, -1, -1, -1, 1, -1, 0,
+    0, 0, -1, 1, -1, 0, 0, 0, 1, -1, 1, -1, -1, 1, -1, -1,
+    -1, 1, -1, 1, 0, 1, -1, 1, 1, 0, -1, 1, 1, -1, 0, 0,
+    1, 0, 0, -1, 1, -1, -1, -1, -1, 1, 1, -1, 1, -1, -1, 1,
+    1, 1, 1, 1, -1, 1, 1, -1, 1, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, -1, 1, -1, 0, 0, -1, 1, 1, 1, -1, 1, -1, -1, 1,
+    0, 1, -1, 0, -1, 1, 1, -1, -1, 1, 1, -1, 1, -1, 1, -1,
+    1, 1, 1, -1, -1, 1, 1, 1, 1, -1, 1, -1, -1, 1, -1, -1,
+    1, 1, -1, -1, -1, 1, 1, 1, -1, 1, -1, 1, 1, -1, -1, 1,
+    1, 1, 1, 1, 1, 1, -1, -1, -1, 1, -1, 1, 1, 1, -1, -1,
+    -1, 1, -1, -1, 1, -1, -1, -1, -1, -1, -1, 1, -1, 1, -1, -1,
+    -1, 1, -1, 1, 1, 1, -1, -1, -1, 1, 1, 1, 1, -1, -1, -1,
+    -1, -1, 1, -1, 1, 1, 1, -1, 1, 1, -1, 1, -1, 0, 0, 1,
+    1, 1, -1, 1, -1, 0, 0, 1, -1, 0, 0, 0, 0, 0, 1, -1,
+    1, -1, 1, -1, 1, 1, 1, -1, 1, 1, 1, 1, -1, -1, 1, 1,
+    -1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 0, 1, -1, 1, 1, 1,
+    1, -1, 0, 0, 0, 1, 1, 0, 1, -1, 1, 0, 0, 1, 1, 0,
+    1, -1, 1, -1, -1, -1, 1, 1, 1, 1, 1, 1, 1, 1, -1, 1,
+    -1, -1, 1, 1, 1, 1, 1, 1, -1, 1, 1, -1, 1, -1, 1, -1,
+    1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, -1, 1, 1, 1, 1, -1, 1, 1, 1, 0, 0, 0, 0,
+    0, 1, -1, 0, 0, 0, 1, -1, 1, 0, -1, -1, 1, 1, 0, -1,
+    1, 1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 1, 0, 1, 1, 1,
+    1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, -1, 0, 0, -1, 1,
+    1, -1, 1, 1, -1, -1, 1, 1, -1, 1, 1, 1, 1, -1, 1, 1,
+    1, -1, 1, 1, 1, 1, -1, -1, 1, 1, -1, 1, 1, 1, 1, -1,
+    -1, 1, 1, -1, 0, 1, 1, 1, 1, 0, 1, -1, 1, 0, -1, -1,
+    1, 1, 1, -1, 1, 1, 1, -1, 1, -1, 0, 1, 1, -1, 1, 1,
+    1, -1, 1, 0, 1, -1, 1, 1, 1, -1, 1, -1, 1, 1, -1, 1,
+    -1, 1, 1, 0, 1, -1, -1, 1, 1, 0, 0, 1, -1, 1, -1, -1,
+    -1, 0, 1, 1, 1, 1, -1, -1, 1, -1, 1, 1, 1, 1, -1, 1,
+    0, -1, 1, 1, -1, -1, -1, 0, 1, 1, 1, 1, -1, 1, -1, 1,
+    -1, 1, 1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1, 1, 1,
+    -1, 0, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0, 1, 1, 1, -1,
+    1, 1, -1, 1, 1, 1, -1, 0, 0, 0, 1, 0, 0, 1, 1, 1,
+    0, 0, 0, 0, -1, -1, 1, -1, 0, 1, -1, 1, 0, -1, -1, -1,
+    0, 1, -1, 1, 0, -1, -1, 0, 0, 0, 1, 0, 0, 0, 1, -1,
+    1, 1, -1, -1, 1, 1, 0, 0, 1, -1, 1, -1, 1, -1, 1, -1,
+    1, -1, 0, 0, 0, 0, 0, 1, -1, 0, 0, 1, 1, 1, 1, -1,
+    -1, 1, 1, -1, 1, -1, 1, -1, -1, 1, 1, 1, -1, -1, 1, 1,
+    1, -1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1, 1, 1, 1, 1,
+    -1, -1, -1, -1, -1, 1, 1, 1, -1, -1, -1, 1, 1, 1, -1, 1,
+    -1, 1, -1, 1, -1, 1, 1, 1, -1, -1, -1, 1, 0, 1, 1, -1,
+    0, -1, 0, 1, 1, 0, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, -1, 1, 1, 1, -1,
+    0, -1, 1, -1, 1, 1, -1, 0, -1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, -1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, -1, -1, -1, -1, -1, -1, -1, 0, 1,
+    1, -1, 1, 1, -1, 0, 1, 1, 1, 1, -1, -1, -1, 1, -1, 1,
+    1, -1, 0, -1, 1, 1, 1, -1, 1, 1, 1, -1, -1, 1, 1, 0,
+    1, 1, 1, 0, -1, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 0,
+    1, 1, 1, 1, 1, 0, 0, 1, 0, 1, -1, 1, 1, 1, 1, 1,
+    1, -1, 1, 0, -1, 1, 0, 1, 0, 1, -1, 0, 0, -1, 0, 1,
+    1, 1, -1, 0, -1, 0, 1, -1, 1, 1, -1, 1, 1, 1, 0, -1,
+    0, -1, 1, -1, 1, 0, 1, -1, 0, -1, 1, 0, 0, 1, -1, 0,
+    -1, 0, 0, 1, -1, 1, 1, -1, 0, 0, 1, -1, 1, 1, 1, 1,
+    -1, 0, 1, 1, 0, 0, 1, 0, 1, 1, 0, 1, 1, 1, 1, 0,
+    1, 1, 1, 1, 1, 1, -1, 0, 0, 0, 1, 0, 1, -1, 1, 0,
+    0, 0, 1, 0, -1, 0, 1, -1, -1, 1, -1, 1, 0, -1, -1, -1,
+    0, 1, -1, 0, 0, 1, 0, 1, 1, 0, -1, 0, 0, 0, 1, -1,
+    0, 1, -1, 0, 0, 0, -1, 1, 1, -1, 0, 0, 1, -1, -1, 1,
+    1, -1, 1, 0, 0, 0, 0, 0, 1, -1, 0, 0, 1, 1, 1, 1,
+    -1, -1, 1, 1, -1, 1, 1, 1, 1, 1, -1, 1, 1, 1, 0, -1,
+    -1, 1, 1, 1, -1, 1, 1, -1, 0, -1, 1, -1, 1, 0, -1, 1,
+    1, -1, 0, 1, -1, 0, 1, -1, -1, 1, -1, 1, -1, -1, 1, 1,
+    1, 1, -1, 1, -1, 1, 1, -1, 1, -1, 1, -1, 1, 1, 1, 0,
+    0, 1, 0, 1, -1, 1, 1, 1, 1, 1, 1, -1, 1, 1, -1, 1,
+    1, -1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 0, 0, 1, 1, -1,
+    1, 1, -1, 1, 1, -1, -1, 1, 1, 1, 1, -1, -1, 1, -1, 1,
+    0, -1, -1, 1, 1, -1, 0, 0, 0, 1, -1, 1, 1, -1, 0, 0,
+    1, -1, 1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 0, -1, 1,
+    -1, 1, 1, -1, 0, 0, 1, 1, -1, 1, 1, -1, 1, 0, 0, 1,
+    1, 1, -1, 0, 1, 1, 0, 0, 1, 0, 1, 0, 0, 0, 1, 0,
+    1, 1, 1, -1, -1, 0, 1, -1, 0, 1, -1, 0, 0, 1, -1, 0,
+    0, 1, -1, 0, 0, 1, -1, 1, 1, -1, 1, -1, 1, -1, 0, 0,
+    1, -1, 0, 1, -1, 0, 0, 0, 0, 0, -1, 1, 1, 1, 1, 1,
+    1, 1, 1, -1, -1, -1, 1, -1, 1, 1, -1, 1, -1, 1, -1, -1,
+    -1, 1, 1, 1, 1, 1, 1, 1, -1, 1, 1, -1, 1, 1, -1, -1,
+    -1, -1, 1, 1, 1, -1, -1, -1, 1, 1, -1, 1, -1, -1, -1, -1,
+    1, -1, 1, -1, 1, 1, -1, 1, -1, 1, -1, 1, -1, 1, -1, 1,
+    -1, -1, -1, -1, -1, 1, 1, -1, 1, 0, -1, 1, 0, 1, 1, 1,
+    1, 1, 0, 0, 1, 1, 0, 0, -1, 1, 1, 1, 1, 1, -1, 1,
+    0, -1, 0, 0, 1, -1, 0, 0, 1, -1, -1, 1, -1, 1, 0, -1,
+    0, 1, 1, 1, -1, 1, 1, -1, 1, 0, -1, 0, 1, 1, 1, -1,
+    0, -1, 1, 0, 0, 1, -1, 0, -1, 1, 0, 1, 1, 0, 1, -1,
+    1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 1, 1, 1,
+    1, 1, 1, 1, 1, -1, 0, 0, 1, -1, 0, 1, -1, 1, -1, 1,
+    0, 1, 0, 1, 1, -1, -1, 1, -1, -1, -1, -1, -1, -1, 1, 0,
+    -1, 0, 1, -1, 0, 0, 1, -1, 0, -1, 1, 0, 0, 1, -1, 0,
+    -1, -1, 1, 1, -1, 0, 1, -1, 0, 0, -1, -1, 1, 1, 1, -1,
+    1, 1, 1, -1, 0, 1, 1, 1, 0, -1, 1, 0, -1, 1, -1, 1,
+    0, -1, 0, 1, 1, -1, 0, 0, 1, -1, 0, 0, -1, 1, -1, 1,
+    1, 1, -1, 1, 1, 1, -1, 1, 1, 1, 1, 1, 1, -1, 1, 1,
+    1, 0, 1, 1, 1, 1, 1, 1, -1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, 1, 1, -1, 1, 1, 1, -1, 1, 1,
+    1, -1, 1, 1, -1, -1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, 1, 1, -1, 1, 1, 1, 1, 1, 1, 1, 1,
+    1, 1, 1, 1, 1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 1, 1,
+    1, 1, 1, 1, 0, 1, 1, 1, -1, 1, -1, 1, -1, 1, 1, -1,
+    -1, 1, 1, 1, 1, -1, 1, 1, 1, -1, 1, -1, 1, 1, 1, 1,
+    1, 1, -1, 1, 1, -1, 1, -1, -1, 1, 1, 1, 1, -1, -1, 1,
+    -1, 1, 1, 1, -1, 1, -1, 1, 1, 1, -1, 1, -1, 0, 1, 1,
+    -1, -1, -1, 1, 0, 1, -1, 1, -1, 1, -1, -1, -1, 1, -1, 1,
+    1, 1, 1, 0, -1, -1, 0, 1, 1, 1, -1, 1, -1, 1, -1, 1,
+    -1, 1, -1, -1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, -1, 1,
+    1, 1, -1, 1, 1, 1, 1, -1, -1, 1, 1, 1, 0, 1, -1, -1,
+    1, 1, 0, -1, 1, -1, 1, -1, -1, -1, 1, 0, 0, 1, 1, -1,
+    -1, -1, -1, -1, -1, 1, 0, 0, 1, 1, -1, -1, -1, 0, 0, 0,
+    1, 1, -1, -1, 1, 1, -1, -1, 1, 1, -1, 1, -1, 1, -1, -1,
+    1, -1, 1, 1, 1, -1, 1, 1, 1, -1, 1, -1, 1, -1, -1, 1,
+    1, 1, 1, -1, -1, -1, 1, -1, 1, 1, -1, -1, -1, -1, 1, -1,
+    1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1,
+};
+
+const int8_t ttt_perfect_best[5478] = {
+    0, 4, 0, 3, 3, 4, 5, 3, 4, 4, 3, 4, 5, 0, 1, 4,
+    0, 6, 4, 4, 4, 0, 6, 8, 4, 6, 1, 0, 2, 0, 1, 0,
+    6, 4, 4, 0, 1, 7, 0, 8, 6, 6, 6, 0, 8, 7, 7, 8,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 0, 8, 7, 7, 8, 6, 6,
+    6, 6, 5, 8, 7, 5, 1, 0, 2, 0, 1, 0, 8, 7, 6, 0,
+    6, 0, 8, 6, 0, 8, 8, 7, 7, 6, 6, 6, 2, 1, 0, -1,
+    2, 2, 6, 2, 4, 8, 8, 8, 0, 3, 3, 4, 3, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 0, 2, 2, 6, 8, 8, 8, 6, 8, 8,
+    1, 0, 4, 3, 3, 3, 3, 3, 3, 3, 3, 3, -1, -1, -1, 0,
+    6, 6, 2, 8, 6, 0, 6, 0, 8, 7, 7, 8, 0, 1, 0, 8,
+    7, 8, 8, 8, 8, 7, 6, 6, 6, 0, 8, 8, 7, 7, 8, 7,
+    8, 6, 6, 6, 6, 6, 2, 2, 2, 8, 1, 0, 8, 8, 6, 2,
+    2, 2, 0, 1, 0, 4, 4, 8, 0, 6, 0, 2, 6, 0, 1, 4,
+    6, 6, 6, 8, 8, 2, 1, 0, -1, 0, 8, 7, 7, 8, 6, 6,
+    3, 6, 3, 8, 7, 8, 0, 1, 7, 0, 2, 6, 6, 6, 8, 8,
+    8, 7, 6, 8, 7, 2, 6, 1, 0, 6, 6, 7, 2, 1, 0, -1,
+    6, 0, 2, 0, 1, 0, 8, 6, 6, 4, 2, 4, 0, 3, 4, 4,
+    4, 0, 3, 4, 7, 3, 1, 0, 2, 4, 0, 1, 8, 0, -1, 4,
+    4, 4, 4, 4, 4, 4, 4, 4, 4, 8, 7, 5, 2, 2, 2, -1,
+    0, 1, 7, 0, 3, 2, 1, 0, -1, 2, 2, 2, 2, 2, -1, -1,
+    7, 8, 7, 7, 8, 0, 3, 0, 8, 3, 1, 8, 8, 7, 7, 3,
+    0, 3, 0, 8, 8, 0, -1, 8, 7, 5, 0, -1, 0, 8, 5, 5,
+    5, 5, 5, 5, 5, 5, 5, 2, 4, 2, 3, 0, 1, 4, 0, 3,
+    2, 1, 0, -1, 2, 2, 2, 2, 4, 1, 0, 4, 0, 4, 4, 7,
+    8, 2, 1, 0, -1, 2, 2, 2, -1, 0, 1, 7, 0, 8, 1, 8,
+    8, 7, 7, 8, 7, 8, 0, 3, 0, 8, 3, 8, 7, 2, 7, 0,
+    1, 8, 0, -1, 8, 1, 2, 8, 7, 8, 8, 8, 8, 7, 1, 0,
+    7, 0, 3, 4, 4, 3, 4, 4, 4, 4, 3, 3, 8, 8, 0, 2,
+    8, 0, -1, 4, 0, 4, 0, -1, 8, 8, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 2, 2, 2, 2, 2, -1, -1, 8, 8, 8, 7, 3, 2,
+    0, 2, -1, 8, 1, 8, 0, -1, 2, 1, 0, 2, 2, -1, -1, -1,
+    8, 7, 8, 3, 3, 3, 3, 3, 3, 3, 3, 3, 0, -1, 0, 8,
+    0, 8, 8, 0, -1, 0, -1, -1, -1, -1, 1, 0, 2, 0, 1, 0,
+    3, 8, 4, 2, 7, 8, 4, 4, 4, 5, 8, 5, 7, 4, 4, 4,
+    2, 1, 0, -1, 0, 8, 7, 7, 8, 0, 3, 3, 5, 8, 8, 7,
+    3, 5, 5, 2, 5, 2, 5, 5, 5, 5, 1, 0, 5, 5, 8, 7,
+    2, 0, 1, 0, -1, 8, 7, 2, 1, 0, -1, 2, 2, 2, 0, 1,
+    0, 8, 7, -1, 8, 8, 0, 3, 4, 8, 8, 3, 8, 8, 4, 4,
+    4, 4, 4, 4, 4, 4, 1, 0, 4, 4, 4, 4, 4, 4, 2, 0,
+    2, 8, 1, 0, -1, 8, 4, 3, 3, 3, 3, 2, 3, 0, 3, 3,
+    1, 0, 3, 3, -1, -1, -1, -1, -1, -1, 0, 8, 0, -1, 8, 0,
+    -1, 8, 8, 8, 7, 7, 2, 2, 2, 8, 1, 0, 8, 8, -1, 2,
+    2, 2, 2, 2, 8, 8, 8, 8, 7, -1, -1, 2, 1, 0, -1, 2,
+    1, 0, -1, 2, 2, 2, 0, 1, 0, 4, 4, 4, 8, 7, 2, 0,
+    1, 0, 7, 8, 7, 1, 8, 7, 7, 8, 0, 1, 7, 0, 8, 8,
+    7, 8, 2, 1, 0, -1, 2, 1, 0, -1, 1, 6, 4, 0, 6, 6,
+    6, 6, 8, 8, 4, 4, 6, 2, 6, 2, 4, 0, 1, 4, 0, 6,
+    4, 4, 4, 4, 8, 4, 6, 6, 6, 4, 4, 4, 4, 1, 0, 2,
+    6, 1, 1, -1, 0, 8, 2, 1, 0, -1, 1, 1, -1, 6, 8, 6,
+    6, 6, 1, 1, -1, 8, 0, 3, 0, 8, 6, 3, 8, 8, 8, 3,
+    6, 6, 6, 0, 8, 8, 6, 6, 8, 6, 8, 6, 6, 6, 5, 6,
+    5, 5, 5, 5, 5, 5, 5, 5, 5, 2, 6, 2, 8, 0, 1, 4,
+    0, 3, 2, 1, 0, -1, 2, 6, 6, 8, 8, 6, 8, 8, 0, 4,
+    4, 4, 8, 2, 1, 0, -1, 6, 0, 2, 6, 1, 1, -1, 0, 8,
+    2, 8, 8, 8, 6, 8, 8, 8, 6, 6, 6, 3, 6, 8, 0, 2,
+    8, 6, 1, 6, 0, 6, 8, 2, 0, 2, 8, 8, 8, 6, 8, 8,
+    6, 6, 6, 4, 4, 4, 4, 6, 4, 4, 4, 6, 4, 8, 4, 8,
+    0, 1, 4, 6, 6, 4, 6, 6, 8, 8, 8, 4, 6, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 1, 1, -1, 6, 8, 1, 6, 6, 1, 8,
+    -1, 8, 1, 2, 2, 6, 8, 1, -1, 0, 8, 1, 1, -1, 8, 0,
+    1, -1, 6, 6, 1, -1, 3, 3, 3, 3, 3, 3, 3, 3, 3, 6,
+    6, 2, 8, 6, 0, 8, 8, 6, 6, 6, 0, 6, -1, -1, -1, 8,
+    8, 8, 3, 8, 8, 3, 8, 3, 2, 1, 0, -1, 8, 8, 2, 8,
+    8, 1, 0, 4, 8, 8, 0, 4, 8, 2, 1, 0, -1, 1, 0, 2,
+    -1, 0, 1, -1, 8, 8, 8, 8, 8, 8, 2, 8, 8, 8, 8, 1,
+    8, 8, 3, 8, 0, 8, 8, 0, 8, 8, 0, -1, 8, 5, 5, 8,
+    8, 5, 8, 5, 8, 5, 8, 8, 5, 2, 1, 0, -1, 8, 8, 8,
+    4, 8, 8, 4, 8, 8, 2, 1, 0, -1, 8, 8, 8, 8, 8, 8,
+    8, 8, 3, 2, 1, 0, -1, 8, 8, 8, 8, 8, 8, 8, 8, 8,
+    8, 8, 8, 8, 8, 8, 2, 8, 2, 1, 0, 4, 8, 8, 8, 4,
+    3, 8, 0, 8, 4, 8, 8, 8, 0, -1, 8, 4, 4, 4, 8, 4,
+    4, 4, 4, 4, 8, 4, 4, 1, 0, 2, -1, 8, 1, -1, 8, 8,
+    2, 1, 0, -1, 0, 1, -1, 2, 2, -1, -1, 1, 8, -1, 8, 8,
+    3, 3, 8, 3, 3, 8, 3, 8, 3, 3, 8, 3, 0, 8, 8, 0,
+    -1, 8, 0, 8, 0, -1, 8, 8, -1, -1, -1, -1, -1, -1, 0, 1,
+    4, 4, 2, 0, 3, 3, 0, 4, 4, 4, 4, 1, 4, 4, 0, 4,
+    4, 4, 5, 4, 4, 4, 4, 4, 1, 4, 2, 0, 1, 0, -1, 8,
+    4, 1, 1, -1, 0, 8, 3, 0, 3, 1, 1, -1, 8, 1, 5, 5,
+    5, 0, 1, -1, 5, 5, 1, 1, -1, 8, 0, -1, 0, 8, 1, -1,
+    2, 2, 2, 0, 1, 0, 3, 3, -1, 2, 2, 2, 2, 2, 0, 8,
+    8, 0, 5, -1, -1, 2, 1, 0, -1, 0, 3, 3, 0, 4, 3, 8,
+    8, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0,
+    1, 0, -1, 8, 0, -1, 8, 8, 4, 4, 4, 3, 3, 3, 3, 0,
+    1, -1, 3, 3, -1, -1, -1, 0, -1, 0, 8, 0, -1, 1, 1, -1,
+    8, 2, 2, 2, 2, 2, 8, 8, 3, 8, 8, -1, -1, 2, 1, 2,
+    2, 2, 8, 8, 8, -1, -1, -1, 2, 0, 2, 8, 1, 0, -1, 8,
+    -1, 1, 4, 2, 1, 1, 0, 4, 3, 4, 1, 2, 4, 4, 2, 0,
+    1, 4, 0, 4, 1, 4, 4, 2, 1, 0, -1, 1, 1, -1, 8, 1,
+    1, -1, 0, 8, 1, -1, 1, 1, -1, 0, 8, 1, 0, 8, 1, 8,
+    -1, 8, 1, -1, 1, 1, -1, 8, 2, 1, 0, -1, 2, 2, 2, 0,
+    1, 0, 8, 8, -1, 2, 0, 2, 0, 1, 0, 6, 4, 6, 4, 6,
+    0, 4, 6, 4, 4, 8, 4, 4, 6, 4, 6, 2, 1, 0, -1, 0,
+    8, 0, 3, 8, 6, 6, 6, 6, 3, 8, 3, 8, 5, 5, 5, 5,
+    2, 1, 0, 5, 5, 1, 5, 5, 5, 8, 0, 2, 6, 1, 0, 6,
+    6, 8, 2, 1, 0, -1, 6, 0, 2, 1, 1, 0, 8, -1, 6, 4,
+    4, 0, 3, 4, 8, 8, 8, 8, 4, 3, 3, 6, 4, 4, 4, 4,
+    4, 1, 4, 4, 4, 1, 4, 4, 4, 2, 2, 2, 8, 1, 0, 8,
+    8, 4, 3, 3, 3, 3, 2, 1, 0, 3, 3, 1, 3, 3, 3, -1,
+    -1, -1, -1, -1, -1, 2, 8, 6, 6, 8, 0, 6, 6, 6, 6, 8,
+    0, 8, 1, 2, 2, 8, 1, 0, 8, -1, 6, 1, 1, 6, 8, -1,
+    1, 8, 8, -1, 6, 6, 6, 2, 1, 0, -1, 2, 1, 0, -1, 6,
+    0, 2, 0, 1, 0, 4, 6, 6, 8, 0, 2, 6, 1, 0, 6, 6,
+    8, 0, 1, 8, 2, 6, 6, 6, 6, 6, 6, 6, 8, 8, 2, 1,
+    0, -1, 2, 1, 0, -1, 0, 3, 0, 2, 3, 4, 4, 4, 4, 4,
+    3, 0, 3, 0, 4, 2, 0, -1, 4, 4, 4, 0, -1, 0, 4, 2,
+    2, 2, 4, 1, 0, 4, 4, 4, 2, 2, 2, 2, 2, -1, -1, 0,
+    1, 0, 3, 3, 1, 0, 2, -1, 0, 5, 5, 0, -1, 2, 1, 2,
+    2, 2, -1, -1, -1, 8, 0, 8, 3, 0, 2, 1, 1, 0, 8, -1,
+    3, 0, -1, 0, 8, 1, 1, 8, -1, 0, -1, 2, 1, 0, -1, 4,
+    2, 2, 4, 4, 1, 4, 4, 3, 3, 0, 3, 3, 4, 4, 4, 4,
+    0, 4, 4, 0, -1, 2, 2, 2, 2, 4, 0, 4, 4, 4, 4, 1,
+    0, 4, 1, 0, 2, -1, 3, 3, 3, 3, 3, -1, -1, -1, 2, 2,
+    2, 2, 2, -1, -1, 0, 8, 0, 8, 8, 1, 1, 0, 8, -1, 1,
+    8, 8, -1, 3, 0, 3, 1, 1, 8, -1, 1, -1, 0, -1, 0, 8,
+    1, 2, 2, 8, 1, 0, 8, -1, 8, 3, 0, 2, 4, 1, 0, 4,
+    3, 3, 0, -1, 0, 2, 0, 4, 4, 0, -1, 0, -1, 2, 1, 0,
+    -1, 2, 1, 2, 2, 2, -1, -1, -1, 3, 8, 8, 0, 2, 2, 0,
+    -1, -1, -1, 0, -1, 8, 8, 2, 2, 2, -1, -1, 8, 2, 1, 0,
+    -1, 0, -1, 0, -1, 0, 8, 2, 1, 0, -1, 8, 8, 8, 8, 8,
+    8, 8, 4, 4, 8, 8, 8, 8, 8, 8, 3, 8, 8, 5, 8, 8,
+    5, 5, 8, 5, 8, 5, 8, 5, 5, 8, 2, 1, 0, -1, 2, 1,
+    0, -1, 8, 8, 8, 8, 8, 8, 8, 8, 3, 4, 8, 8, 4, 4,
+    8, 4, 8, 4, 4, 4, 4, 4, 2, 1, 0, -1, 3, 8, 8, 3,
+    3, 8, 3, 3, 3, 8, 3, 3, 8, -1, -1, -1, -1, -1, -1, -1,
+    8, 0, 8, 8, 8, 0, -1, 8, 8, 2, 1, 0, -1, 1, 0, 2,
+    8, 1, 8, 8, -1, -1, 2, 1, 0, -1, 2, 1, 0, -1, 8, 8,
+    8, 8, 8, 8, 8, 8, 8, 4, 2, 4, 2, 4, 5, 5, 5, 0,
+    4, 4, 7, 4, 2, 4, 2, 5, 0, 1, 4, 0, 4, 2, 4, 4,
+    6, 4, 5, 5, 6, 5, 4, 4, 4, 4, 2, 0, 2, 3, 0, 1,
+    7, 0, -1, 2, 1, 0, -1, 0, 6, 6, 0, -1, 6, 0, 5, 0,
+    -1, 0, 7, 0, 1, 0, 2, 7, 5, 5, 5, 5, 7, 6, 6, 6,
+    0, 1, 2, 7, 7, 5, 7, 5, 6, 6, 6, 6, 6, 5, 5, 5,
+    5, 5, 5, 5, 5, 5, 2, 2, 2, -1, 0, 1, 6, 0, 4, 2,
+    1, 0, -1, 2, 2, 6, 2, 2, -1, -1, 0, 4, 6, 6, 4, 2,
+    1, 0, -1, 6, 0, 2, -1, 0, 1, 6, 0, -1, 2, 2, 2, 2,
+    7, -1, -1, 6, 6, 6, 6, 3, 2, 7, 2, -1, 6, 1, 6, 0,
+    6, 2, 2, 2, 2, 2, -1, -1, -1, 6, 6, 6, 4, 4, 4, 7,
+    4, 4, 6, 3, 4, 4, 4, 4, 4, 0, 1, 4, 0, 2, 4, 4,
+    6, 0, 1, 0, 7, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0,
+    6, 7, 0, -1, 6, 0, 6, 0, -1, 0, 7, 1, 0, 2, 6, 0,
+    1, 7, 0, -1, 0, -1, 0, 7, 0, 6, 6, 0, -1, 0, -1, 3,
+    3, 3, 3, 3, 3, 3, 3, 3, 6, 6, 0, 2, 6, 0, 1, 6,
+    7, 7, 6, 6, 6, -1, -1, -1, 7, 7, 7, 3, 7, 7, 7, 7,
+    3, 2, 1, 0, -1, 7, 7, 7, 7, 2, 1, 0, 4, 7, 1, 7,
+    7, 4, 2, 1, 0, -1, 1, 0, 2, -1, 0, 7, 7, 0, -1, 7,
+    7, 7, 7, 7, 1, 7, 5, 7, 1, 7, 7, 3, 7, 7, 7, 7,
+    0, 7, 7, 0, -1, 7, 5, 5, 7, 7, 5, 5, 5, 5, 5, 7,
+    7, 5, 2, 1, 0, -1, 1, 0, 2, -1, 7, 7, 7, 7, 4, 2,
+    1, 0, -1, 1, 7, 2, -1, 7, 7, 7, 7, 7, 2, 1, 0, -1,
+    0, 2, 2, 2, 7, -1, -1, 7, 7, 7, 7, 7, 7, 7, 7, 7,
+    2, 1, 0, 4, 7, 1, 7, 7, 3, 7, 0, 7, 4, 0, 7, 7,
+    0, -1, 7, 4, 4, 7, 4, 4, 4, 4, 4, 4, 4, 7, 4, 1,
+    0, 2, -1, 0, 7, 7, 0, -1, 2, 1, 0, -1, 0, 2, 2, 0,
+    -1, -1, -1, 0, -1, 0, 7, 7, 3, 3, 7, 3, 3, 7, 3, 7,
+    3, 3, 7, 3, 0, 7, 7, 0, -1, 7, 7, 7, 0, -1, 0, 7,
+    -1, -1, -1, -1, -1, -1, 0, 4, 0, 3, 4, 5, 5, 3, 5, 3,
+    4, 4, 4, 4, 5, 4, 4, 4, 5, 5, 5, 4, 4, 4, 4, 4,
+    4, 0, 2, 5, 1, 0, -1, 4, 4, 0, 3, 3, 0, -1, 3, 0,
+    5, 0, -1, 0, 7, 5, 0, 5, 5, 0, 5, 5, 0, -1, 0, -1,
+    0, -1, 0, -1, 0, -1, 0, -1, 2, 2, 2, 5, 1, 0, 5, 5,
+    -1, 2, 2, 2, 2, 2, 5, 5, 5, 5, 7, -1, -1, 2, 1, 0,
+    -1, 2, 2, 3, 2, 2, -1, -1, 4, 4, 4, 3, 4, 1, 0, 2,
+    -1, 4, 4, 4, 4, 4, 2, 1, 0, -1, 2, -1, -1, 4, 0, 4,
+    3, 0, 2, -1, 0, 3, 3, 0, -1, -1, -1, -1, 0, -1, 0, -1,
+    -1, 0, -1, 0, -1, 2, 2, 2, 2, 2, -1, -1, -1, -1, -1, 2,
+    2, 2, 2, 2, -1, -1, -1, -1, -1, 2, 2, 2, -1, -1, -1, 4,
+    0, 2, 0, 1, 0, 3, 4, 4, 0, 4, 0, 2, 4, 0, 1, 4,
+    0, 4, 4, 4, 4, 2, 1, 0, -1, 0, -1, 0, 7, 0, 3, 3,
+    0, -1, 0, -1, 0, 1, 7, 0, -1, 1, 0, 7, 0, -1, 0, 7,
+    0, -1, 0, -1, 0, -1, 2, 1, 0, -1, 2, 2, 2, 0, 1, 0,
+    7, 7, -1, 6, 6, 6, 3, 6, 6, 3, 6, 3, 2, 1, 0, -1,
+    6, 6, 6, 6, 2, 6, 0, 5, 6, 1, 0, 4, 4, 2, 1, 0,
+    -1, 6, 0, 6, 6, 0, 1, -1, 0, -1, 6, 6, 6, 6, 6, 1,
+    0, 5, 6, 6, 6, 6, 6, 6, 6, 6, 5, 6, 6, 6, 6, 6,
+    6, 5, 5, 6, 6, 5, 5, 5, 5, 5, 6, 6, 5, 2, 1, 0,
+    -1, 6, 0, 2, -1, 6, 6, 6, 6, 4, 2, 1, 0, -1, 1, 0,
+    2, -1, 6, 6, 6, 6, 6, 2, 1, 0, -1, 0, 2, 6, 2, 2,
+    -1, -1, 6, 6, 6, 6, 6, 6, 6, 2, 6, 2, 6, 6, 6, 6,
+    1, 0, 4, 4, 6, 6, 6, 6, 6, 6, 4, 6, 4, 6, 4, 4,
+    4, 4, 4, 6, 4, 6, 4, 4, 4, 4, 1, 0, 6, 6, 0, 1,
+    -1, 0, -1, 2, 1, 0, -1, 0, 1, -1, 0, -1, 6, 0, 6, 0,
+    -1, -1, 6, 3, 3, 6, 6, 3, 6, 3, 6, 3, 6, 6, 3, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, 6, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    0, 3, 3, 0, 4, 3, 5, 5, 4, 4, 4, 4, 4, 2, 2, 2,
+    5, 4, 1, 4, 0, 4, 0, 4, 0, -1, 4, 0, -1, 5, 4, 4,
+    4, 4, 3, 0, 2, 3, 0, 1, -1, 0, -1, 2, 1, 0, -1, 0,
+    -1, 0, -1, 0, -1, 0, -1, -1, 2, 2, 2, 2, 2, 5, 5, 3,
+    5, 5, -1, -1, 2, 2, 2, 2, 2, 5, 5, 5, -1, -1, -1, 1,
+    0, 2, 5, 5, 0, -1, 5, -1, 3, 2, 2, -1, 4, 1, 3, 0,
+    4, 2, 1, 0, -1, 0, -1, 2, 2, -1, 0, 4, 0, -1, 4, 2,
+    1, 0, -1, 0, -1, 0, -1, 0, -1, 2, 2, 2, 2, 2, -1, -1,
+    -1, -1, -1, 2, 2, 2, -1, -1, -1, 2, 2, 0, -1, 2, -1, -1,
+    -1, -1, 4, 4, 4, 4, 4, 3, 3, 3, 0, 4, 4, 4, 4, 0,
+    1, 4, 0, 4, 1, 0, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0,
+    4, 0, -1, 4, 4, 0, 1, -1, 0, -1, 3, 0, 3, 0, -1, -1,
+    1, 0, 2, -1, 0, 1, -1, 0, -1, 0, -1, -1, 0, -1, 0, -1,
+    -1, 1, 0, 2, 3, 3, 3, 3, 3, -1, 2, 2, 2, 2, 2, 0,
+    1, -1, 0, -1, -1, -1, -1, -1, -1, 2, 4, 0, 2, 4, 5, 5,
+    5, 5, 4, 4, 0, 4, 4, 5, 2, 4, 4, 5, 4, 5, 0, 1,
+    0, 4, 4, 4, 0, 2, 5, 1, 0, 5, 4, 4, 0, 2, 2, 0,
+    -1, 1, 0, 5, 0, -1, 0, 3, 5, 0, 5, 5, 0, 5, 5, 0,
+    -1, 0, -1, 0, 6, 0, 5, 6, 0, -1, 0, -1, 1, 2, 2, 5,
+    1, 0, 5, -1, 6, 1, 1, 0, 2, -1, 1, 5, 5, -1, 6, 6,
+    6, 2, 1, 0, -1, 2, 2, 2, 2, 4, -1, -1, 4, 4, 0, 3,
+    4, 1, 4, 2, -1, 4, 4, 4, 4, 4, 2, 1, 2, 2, 2, -1,
+    -1, -1, 4, 0, 4, 1, 0, 2, -1, 0, 3, 3, 0, -1, -1, -1,
+    -1, 0, 2, 6, 0, -1, -1, -1, 0, -1, 0, 6, 2, 1, 2, 2,
+    -1, -1, -1, 1, 6, 6, 1, 2, 2, -1, -1, 0, 1, 6, 6, -1,
+    2, 2, 2, -1, -1, 6, 4, 0, 2, 0, 1, 0, 3, 4, 4, 0,
+    1, 0, 2, 4, 0, 1, 4, 4, 4, 4, 0, 4, 2, 1, 0, -1,
+    0, -1, 0, 2, 0, 6, 6, 0, -1, 0, -1, 0, 1, 2, 0, -1,
+    6, 0, 6, 0, -1, 0, 6, 0, -1, 0, -1, 0, 6, 2, 1, 0,
+    -1, 6, 0, 2, 1, 1, 0, 6, -1, 6, 4, 2, 2, 4, 4, 1,
+    4, 4, 0, 1, 0, 3, 3, 1, 4, 2, 4, 0, 1, 4, 0, -1,
+    2, 4, 2, 2, 4, 0, 4, 4, 4, 4, 4, 0, 4, 2, 0, 2,
+    -1, 0, 1, 3, 0, -1, 2, 1, 0, -1, 0, 2, 2, 0, -1, -1,
+    -1, 0, -1, 0, 5, 1, 1, 0, 2, -1, 1, 5, 5, -1, 3, 0,
+    3, 1, 1, 2, -1, 1, -1, 0, -1, 0, 5, 1, 5, 5, 5, 1,
+    5, 5, -1, 5, 2, 4, 2, -1, 1, 1, 3, 0, 4, 2, 1, 0,
+    -1, 2, 2, 2, 2, 4, -1, -1, 0, 4, 0, 4, 4, 2, 1, 0,
+    -1, 2, 0, 2, -1, 0, 1, -1, 0, -1, 1, 2, 2, -1, -1, 1,
+    1, 0, 3, -1, 1, -1, 1, 1, -1, -1, 2, 1, 2, 2, -1, -1,
+    -1, 1, 0, -1, 0, 1, 0, 2, 3, 4, 4, 4, 4, 4, 3, 0,
+    3, 0, 1, 2, 0, -1, 4, 4, 4, 0, -1, 0, 4, 4, 4, 4,
+    4, 4, 4, 4, 4, 4, 0, 2, 2, 0, -1, -1, -1, 0, -1, 0,
+    3, 2, 0, 2, -1, 0, 1, -1, 0, -1, 0, -1, 0, 2, -1, -1,
+    -1, 0, -1, 3, 3, 3, 0, 1, 3, 3, -1, 3, 0, -1, 0, 2,
+    1, 1, -1, -1, 0, -1, -1, -1, -1, 4, 0, 2, 5, 1, 0, 5,
+    4, 4, 4, 4, 0, 5, 4, 5, 5, 5, 5, 4, 4, 4, 4, 2,
+    1, 0, -1, 0, -1, 0, 3, 0, 5, 3, 0, -1, 0, -1, 0, 5,
+    5, 0, -1, 5, 0, 5, 0, -1, 0, 5, 0, -1, 0, -1, 0, -1,
+    2, 1, 0, -1, 1, 2, 2, 5, 1, 0, 5, -1, -1, 2, 1, 2,
+    2, 2, -1, -1, -1, 4, 4, 4, 0, 2, 2, 2, 4, -1, -1, 4,
+    4, 4, 4, 4, 2, 2, 2, -1, -1, 4, 0, 2, 3, 0, -1, -1,
+    -1, 0, -1, 0, 3, -1, -1, -1, -1, -1, -1, 0, -1, 0, -1, -1,
+    -1, 0, -1, 2, 2, 2, -1, -1, -1, 2, 1, 2, 2, -1, -1, -1,
+    -1, -1, 2, -1, 2, 1, 0, -1, 4, 0, 2, 0, 1, 0, 4, 4,
+    4, 0, -1, 0, -1, 0, 3, 0, -1, 0, 2, 0, 1, -1, 0, -1,
+    0, -1, 0, -1, 2, 1, 0, -1, 2, 2, 2, 0, 1, 0, 4, 6,
+    5, 6, 6, 2, 4, 6, 6, 4, 4, 4, 6, 6, 5, 5, 2, 1,
+    0, -1, 0, 2, 7, 7, 3, 6, 6, 3, 6, 6, 5, 7, 5, 5,
+    5, 2, 5, 2, 1, 0, 5, 5, 5, 5, 5, 5, 1, 7, 2, 6,
+    1, 0, 6, 6, 7, 2, 1, 0, -1, 6, 0, 2, 0, 1, 0, -1,
+    6, 6, 0, 3, 6, 4, 3, 6, 4, 4, 4, 7, 3, 4, 6, 4,
+    4, 4, 4, 2, 4, 4, 4, 4, 1, 4, 4, 4, 1, 0, 2, 0,
+    1, 0, 4, 4, 4, 3, 3, 2, 3, 3, 1, 0, 3, 3, 3, 0,
+    3, 3, -1, -1, -1, -1, -1, -1, 0, 1, 7, 7, 2, 6, 6, 6,
+    6, 6, 1, 7, 7, 1, 0, 2, 0, 1, 0, -1, 7, 6, 0, 6,
+    0, -1, 6, 0, -1, 0, 7, 6, 0, 6, 2, 1, 0, -1, 2, 1,
+    0, -1, 6, 2, 2, 0, 1, 0, 4, 6, -1, 2, 7, 2, 6, 1,
+    0, 6, 6, -1, 2, 2, 2, 7, 6, 6, 6, 6, 6, 6, -1, -1,
+    2, 1, 0, -1, 2, 1, 0, -1, 0, 3, 2, 4, 3, 4, 4, 4,
+    4, 3, 3, 5, 5, 0, 4, 4, 0, -1, 4, 0, 4, 0, -1, 5,
+    4, 2, 2, 2, 4, 1, 0, 4, 4, 5, 2, 2, 2, 2, 2, -1,
+    -1, 5, 5, 5, 7, 3, 1, 0, 2, -1, 5, 5, 5, 0, -1, 2,
+    2, 0, 2, 2, -1, -1, -1, 5, 7, 5, 3, 0, 2, 0, 1, 0,
+    -1, 3, 3, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 2, 1, 0,
+    -1, 3, 4, 4, 3, 3, 4, 4, 4, 3, 3, 3, 4, 3, 4, 0,
+    4, 4, 0, 4, 4, 0, -1, 0, 1, 2, 4, 2, 4, 4, 4, 4,
+    4, 1, 0, 4, 1, 0, 2, -1, 3, 3, 3, 3, 3, -1, -1, -1,
+    2, 2, 2, 2, 2, -1, -1, 0, 1, 7, 7, 7, 0, 3, 0, -1,
+    3, 0, -1, 0, 7, 3, 0, 3, 0, -1, 0, -1, 0, -1, 0, -1,
+    0, -1, 1, 0, 2, 0, 1, 0, -1, 7, 7, 3, 2, 2, 4, 1,
+    0, 4, 3, -1, 0, -1, 2, 2, 0, 4, 4, 0, -1, -1, 2, 1,
+    0, -1, 2, 2, 2, 2, 2, -1, -1, -1, -1, -1, 2, 2, 2, 0,
+    -1, -1, -1, -1, -1, 2, 2, 2, -1, -1, -1, 2, 1, 0, -1, 0,
+    -1, 0, -1, 0, -1, 2, 1, 0, -1, 7, 7, 7, 7, 7, 7, 4,
+    7, 4, 7, 7, 7, 7, 7, 7, 7, 7, 7, 5, 7, 7, 5, 5,
+    7, 5, 7, 5, 7, 5, 5, 5, 2, 1, 0, -1, 2, 1, 0, -1,
+    7, 7, 7, 7, 7, 7, 3, 7, 3, 4, 7, 7, 4, 4, 7, 4,
+    4, 4, 7, 4, 4, 4, 2, 1, 0, -1, 3, 7, 7, 3, 3, 7,
+    3, 3, 3, 7, 3, 3, 7, -1, -1, -1, -1, -1, -1, -1, 7, 7,
+    7, 0, 7, 0, -1, 7, 7, 2, 1, 0, -1, 1, 0, 2, 0, 7,
+    0, -1, 7, -1, 2, 1, 0, -1, 2, 1, 0, -1, 1, 7, 2, 7,
+    7, 7, 7, 7, -1, 0, 1, 4, 4, 2, 1, 4, 4, 0, 3, 5,
+    4, 5, 2, 4, 4, 0, 6, 4, 4, 4, 5, 5, 5, 4, 6, 1,
+    4, 2, 1, 1, 0, 4, 4, 4, 1, 1, -1, 0, 2, 1, 6, 6,
+    1, 5, -1, 5, 1, 5, 5, 5, 5, 1, -1, 5, 5, 1, 1, -1,
+    2, 0, 1, -1, 6, 6, 1, -1, 2, 0, 2, 0, 1, 0, -1, 3,
+    3, 0, 6, 0, -1, 6, 0, -1, 0, 6, 6, 0, 5, 2, 1, 0,
+    -1, 1, 4, 4, 0, 3, 4, 3, 4, 4, 3, 4, 4, 3, 4, 4,
+    4, 4, 4, 4, 4, 4, 4, 0, 1, 4, 4, 2, 0, 1, 4, 0,
+    4, 1, 4, 4, 1, 3, 3, 3, 0, 1, -1, 3, 3, -1, -1, -1,
+    1, 1, -1, 0, 2, 6, 6, 6, 1, 1, -1, 6, 0, 1, 0, -1,
+    2, 0, -1, 0, 3, 6, 0, 6, 0, -1, 0, 6, 0, -1, 0, 6,
+    0, -1, 6, 1, 0, 2, 0, 1, 0, -1, 6, 6, 2, 4, 2, 1,
+    1, 0, 4, 6, -1, 2, 2, 2, 4, 6, 0, 4, 4, 6, 6, -1,
+    -1, 2, 1, 0, -1, 1, 2, -1, 2, 0, 1, -1, 6, 6, -1, 2,
+    1, -1, 2, 2, 1, 6, 6, -1, -1, 1, -1, 1, 1, -1, 6, 2,
+    1, 0, -1, 6, 0, 2, 0, 1, 0, -1, 6, -1, 2, 4, 4, 0,
+    3, 4, 4, 4, 5, 5, 5, 4, 3, 4, 0, 2, 4, 5, 1, 4,
+    0, -1, 4, 5, 4, 4, 2, 4, 4, 4, 4, 4, 5, 4, 5, 1,
+    2, 2, -1, 5, 1, -1, 0, 5, 2, 1, 0, -1, 0, 1, -1, 2,
+    2, -1, -1, 1, 5, -1, 5, 0, 3, 0, -1, 3, 0, -1, 0, 3,
+    3, 0, 5, 0, -1, 0, -1, 0, -1, 0, -1, 0, -1, 5, 0, 5,
+    0, 5, 0, -1, 5, 5, 4, 0, 2, 4, 0, 1, 4, 0, 3, 2,
+    1, 0, -1, 1, 4, 4, 0, 2, 4, 4, 4, 0, 1, 4, 4, 4,
+    2, 1, 0, -1, 1, 2, 2, -1, 1, 1, -1, 0, -1, 0, -1, 0,
+    3, 0, -1, 0, 3, 0, -1, 3, 0, -1, 0, -1, 0, -1, 0, 1,
+    0, -1, 2, 0, -1, 0, -1, 1, 0, -1, 2, 2, 2, 4, 3, 4,
+    4, 4, 4, 3, -1, -1, 2, 1, 2, 0, -1, 4, 0, 4, -1, -1,
+    1, 4, 2, 4, 4, 4, 4, 4, -1, 2, 1, -1, 2, 2, -1, -1,
+    -1, -1, 2, 2, 2, -1, -1, -1, 1, 2, -1, 2, -1, -1, -1, -1,
+    3, 0, 2, 0, 3, 0, -1, 3, -1, 0, -1, 0, -1, 0, -1, 0,
+    -1, -1, -1, -1, -1, 1, 4, 2, 1, 1, 0, 4, 3, 4, 4, 2,
+    4, 4, 2, 1, 4, 4, 0, 4, 1, 4, 4, 2, 1, 0, -1, 1,
+    1, -1, 2, 1, 1, -1, 0, 3, 1, -1, 0, 1, -1, 5, 5, 1,
+    5, 5, 1, 5, -1, 5, 1, -1, 1, 1, -1, 5, 2, 1, 0, -1,
+    2, 0, 2, 0, 1, 0, -1, 5, -1, 4, 1, 4, 4, 2, 0, 1,
+    3, 0, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 1, 4, 2, 0, 1, 0, -1, 4, 4, 0, 1, -1, 3,
+    3, 3, 3, 3, 1, 1, -1, 3, -1, -1, -1, -1, -1, -1, 1, 1,
+    -1, 2, 0, -1, 0, -1, 1, -1, 2, 0, 2, 0, 1, 0, -1, 3,
+    -1, 0, 2, 0, -1, 2, 0, -1, 0, -1, -1, -1, 2, 1, 0, -1,
+    2, 1, 0, -1, 2, 4, 2, 1, 1, 0, 4, 4, -1, 1, -1, 1,
+    1, -1, 3, 1, 2, -1, 2, 1, 1, -1, 0, -1, -1, 1, -1, 2,
+    1, 0, -1, 2, 1, 0, -1, 6, 6, 6, 6, 6, 6, 4, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6, 3, 5, 6, 6, 5, 5, 6, 5,
+    6, 5, 6, 5, 5, 5, 2, 1, 0, -1, 2, 1, 0, -1, 6, 6,
+    6, 6, 6, 6, 3, 3, 6, 4, 6, 6, 4, 4, 6, 4, 4, 4,
+    4, 4, 4, 6, 2, 1, 0, -1, 3, 6, 6, 3, 3, 6, 3, 6,
+    3, 6, 3, 3, 6, -1, -1, -1, -1, -1, -1, -1, 6, 6, 6, 6,
+    6, 6, 6, 6, 6, 2, 1, 0, -1, 6, 0, 6, 0, 1, 0, -1,
+    -1, 6, 2, 1, 0, -1, 2, 1, 0, -1, 6, 0, 2, 6, 6, 6,
+    6, 6, -1, 3, 0, 2, 4, 1, 0, 4, 3, 3, 0, -1, 0, 4,
+    0, 4, 4, 0, -1, 0, -1, 2, 1, 0, -1, 2, 1, 2, 2, 2,
+    -1, -1, -1, 3, 5, 5, 0, 2, 2, 0, -1, -1, -1, 0, -1, 5,
+    5, 2, 2, 2, -1, -1, 5, 2, 1, 0, -1, 0, -1, 0, -1, 0,
+    -1, 3, 3, 0, 4, 3, 4, 4, 4, 4, 4, 3, 3, 3, 0, 4,
+    4, 0, -1, 4, 4, 4, 0, -1, 0, 4, 2, 2, 2, 4, 1, 0,
+    4, 4, 4, 0, 2, 2, 2, 2, -1, -1, 3, 3, 3, 3, 3, -1,
+    -1, -1, -1, -1, -1, 2, 2, 2, 2, 2, -1, -1, -1, 1, 0, -1,
+    3, 0, 2, 0, 1, 0, -1, -1, 3, 0, -1, 0, -1, 0, -1, -1,
+    0, -1, 2, 1, 0, -1, 2, 1, 0, -1, 0, -1, 0, -1, 0, 4,
+    2, 2, 2, -1, -1, -1, 0, -1, 2, 2, -1, -1, -1, -1, 2, -1,
+    0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+    -1, -1, -1, -1, -1, -1,
+};
+
+const uint8_t ttt_perfect_moves[5478][9] = {
+    {38, 38, 38, 38, 38, 38, 38, 38, 38},
+    {0, 25, 25, 25, 34, 25, 25, 25, 25},
+    {34, 0, 34, 25, 34, 25, 25, 34, 25},
+    {0, 0, 25, 30, 30, 25, 30, 25, 30},
+    {0, 0, 30, 23, 23, 30, 23, 30, 30},
+    {25, 25, 0, 25, 34, 25, 25, 25, 25},
+    {0, 25, 0, 30, 30, 23, 23, 30, 23},
+    {0, 0, 0, 23, 26, 17, 23, 26, 17},
+    {30, 0, 0, 30, 23, 23, 30, 30, 23},
+    {0, 0, 0, 17, 26, 17, 17, 17, 17},
+    {0, 25, 0, 23, 30, 30, 23, 30, 23},
+    {25, 0, 0, 25, 30, 30, 30, 25, 30},
+    {0, 0, 0, 17, 26, 23, 17, 26, 23},
+    {34, 25, 25, 0, 34, 34, 34, 25, 25},
+    {0, 30, 30, 0, 30, 25, 25, 25, 30},
+    {0, 0, 17, 0, 26, 26, 17, 26, 17},
+    {23, 0, 30, 0, 23, 25, 25, 30, 30},
+    {0, 0, 9, 0, 9, 9, 17, 9, 9},
+    {0, 17, 0, 0, 26, 26, 17, 17, 17},
+    {17, 0, 0, 0, 26, 17, 17, 17, 17},
+    {0, 0, 0, 0, 15, 15, 17, 23, 23},
+    {23, 25, 0, 0, 30, 25, 25, 25, 30},
+    {0, 9, 0, 0, 9, 9, 17, 9, 9},
+    {17, 0, 0, 0, 26, 25, 17, 26, 23},
+    {0, 0, 0, 0, 15, 17, 17, 17, 22},
+    {0, 0, 0, 0, 15, 15, 7, 23, 15},
+    {0, 23, 23, 0, 23, 30, 30, 30, 30},
+    {23, 0, 25, 0, 23, 30, 30, 25, 30},
+    {0, 0, 17, 0, 9, 9, 9, 9, 9},
+    {23, 25, 0, 0, 23, 30, 30, 30, 23},
+    {0, 17, 0, 0, 9, 9, 9, 9, 9},
+    {23, 0, 0, 0, 9, 9, 9, 9, 9},
+    {0, 0, 0, 0, 9, 9, 17, 9, 9},
+    {0, 0, 0, 0, 15, 22, 17, 22, 15},
+    {0, 0, 0, 0, 15, 22, 17, 17, 17},
+    {34, 25, 34, 25, 0, 25, 34, 25, 34},
+    {0, 30, 30, 30, 0, 30, 30, 30, 30},
+    {0, 0, 9, 9, 0, 9, 9, 26, 9},
+    {23, 0, 23, 23, 0, 23, 23, 30, 23},
+    {0, 0, 9, 9, 0, 9, 9, 9, 17},
+    {0, 9, 0, 9, 0, 9, 26, 9, 9},
+    {9, 0, 0, 9, 0, 9, 17, 9, 9},
+    {0, 0, 0, 15, 0, 15, 7, 22, 15},
+    {30, 30, 0, 30, 0, 30, 30, 30, 30},
+    {0, 9, 0, 9, 0, 9, 9, 9, 26},
+    {9, 0, 0, 9, 0, 9, 9, 26, 9},
+    {0, 0, 0, 15, 0, 15, 22, 7, 22},
+    {0, 0, 0, 15, 0, 15, 15, 22, 7},
+    {0, 9, 9, 0, 0, 26, 9, 9, 9},
+    {9, 0, 9, 0, 0, 17, 9, 9, 9},
+    {0, 0, 15, 0, 0, 7, 9, 9, 9},
+    {0, 0, 0, 0, 0, 9, 9, 9, 9},
+    {9, 9, 0, 0, 0, 26, 9, 9, 9},
+    {0, 15, 0, 0, 0, 7, 9, 9, 9},
+    {0, 0, 0, 0, 0, 9, 9, 9, 9},
+    {15, 0, 0, 0, 0, 7, 9, 9, 9},
+    {0, 0, 0, 0, 0, 9, 9, 9, 9},
+    {23, 23, 23, 0, 0, 30, 23, 23, 23},
+    {0, 9, 9, 0, 0, 9, 9, 9, 17},
+    {9, 0, 9, 0, 0, 9, 9, 17, 9},
+    {0, 0, 9, 0, 0, 9, 15, 7, 9},
+    {0, 0, 15, 0, 0, 22, 15, 22, 7},
+    {9, 9, 0, 0, 0, 9, 17, 9, 9},
+    {0, 9, 0, 0, 0, 9, 7, 9, 9},
+    {0, 0, 0, 0, 0, 9, 7, 9, 9},
+    {15, 0, 0, 0, 0, 15, 7, 22, 15},
+    {0, 0, 0, 0, 0, 9, 9, 9, 9},
+    {0, 15, 0, 0, 0, 22, 22, 15, 7},
+    {15, 0, 0, 0, 0, 22, 22, 7, 15},
+    {0, 0, 0, 0, 0, 9, 9, 9, 9},
+    {0, 30, 30, 30, 0, 30, 30, 30, 30},
+    {30, 0, 30, 30, 0, 30, 30, 25, 30},
+    {0, 0, 26, 9, 0, 9, 9, 9, 9},
+    {30, 30, 0, 30, 0, 30, 30, 30, 30},
+    {0, 26, 0, 9, 0, 9, 9, 9, 9},
+    {26, 0, 0, 9, 0, 9, 9, 9, 9},
+    {0, 0, 0, 9, 0, 9, 9, 9, 22},
+    {0, 0, 0, 9, 0, 9, 9, 22, 9},
+    {0, 0, 0, 9, 0, 9, 22, 9, 9},
+    {30, 30, 30, 0, 0, 25, 30, 30, 30},
+    {0, 9, 9, 0, 0, 9, 26, 9, 9},
+    {26, 0, 26, 0, 0, 17, 26, 17, 17},
+    {0, 0, 9, 0, 0, 9, 9, 9, 22},
+    {0, 0, 9, 0, 0, 9, 7, 22, 9},
+    {26, 26, 0, 0, 0, 17, 26, 26, 17},
+    {0, 9, 0, 0, 0, 9, 9, 9, 22},
+    {0, 0, 0, 0, 0, 18, 18, 18, 7},
+    {9, 0, 0, 0, 0, 9, 9, 22, 9},
+    {0, 0, 0, 0, 0, 9, 18, 7, 9},
+    {0, 9, 0, 0, 0, 9, 7, 9, 9},
+    {9, 0, 0, 0, 0, 9, 22, 9, 9},
+    {0, 0, 0, 0, 0, 9, 7, 9, 9},
+    {0, 0, 7, 0, 0, 22, 9, 9, 9},
+    {0, 7, 0, 0, 0, 15, 9, 9, 9},
+    {7, 0, 0, 0, 0, 15, 9, 9, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {25, 25, 34, 34, 34, 0, 25, 25, 34},
+    {0, 25, 23, 25, 30, 0, 30, 25, 25},
+    {0, 0, 17, 25, 26, 0, 23, 26, 17},
+    {30, 0, 23, 25, 23, 0, 30, 30, 25},
+    {0, 0, 17, 17, 26, 0, 17, 17, 17},
+    {0, 9, 0, 9, 9, 0, 9, 9, 17},
+    {9, 0, 0, 9, 9, 0, 9, 9, 17},
+    {0, 0, 0, 15, 15, 0, 15, 23, 7},
+    {30, 30, 0, 25, 30, 0, 30, 25, 25},
+    {0, 17, 0, 26, 26, 0, 17, 17, 17},
+    {17, 0, 0, 26, 26, 0, 17, 26, 17},
+    {0, 0, 0, 17, 15, 0, 22, 17, 17},
+    {0, 0, 0, 15, 15, 0, 23, 23, 17},
+    {0, 9, 9, 0, 23, 0, 9, 9, 9},
+    {9, 0, 9, 0, 23, 0, 9, 9, 9},
+    {0, 0, 15, 0, 7, 0, 9, 9, 9},
+    {0, 0, 0, 0, 9, 0, 9, 9, 9},
+    {9, 9, 0, 0, 23, 0, 9, 9, 9},
+    {0, 17, 0, 0, 7, 0, 9, 9, 9},
+    {0, 0, 0, 0, 15, 0, 9, 9, 9},
+    {15, 0, 0, 0, 7, 0, 9, 9, 9},
+    {0, 0, 0, 0, 9, 0, 9, 9, 9},
+    {30, 30, 30, 0, 30, 0, 30, 30, 30},
+    {0, 17, 26, 0, 17, 0, 17, 17, 26},
+    {25, 0, 26, 0, 17, 0, 25, 17, 26},
+    {0, 0, 9, 0, 9, 0, 23, 9, 9},
+    {0, 0, 22, 0, 22, 0, 22, 22, 15},
+    {9, 9, 0, 0, 9, 0, 9, 9, 26},
+    {0, 9, 0, 0, 9, 0, 15, 9, 7},
+    {0, 0, 0, 0, 9, 0, 7, 9, 15},
+    {22, 0, 0, 0, 15, 0, 15, 22, 7},
+    {0, 0, 0, 0, 9, 0, 9, 9, 18},
+    {0, 22, 0, 0, 22, 0, 22, 22, 22},
+    {22, 0, 0, 0, 22, 0, 22, 22, 17},
+    {0, 0, 0, 0, 18, 0, 17, 18, 18},
+    {0, 9, 9, 26, 0, 0, 9, 9, 9},
+    {9, 0, 9, 17, 0, 0, 9, 9, 9},
+    {0, 0, 15, 7, 0, 0, 9, 9, 9},
+    {0, 0, 0, 9, 0, 0, 9, 9, 9},
+    {9, 9, 0, 26, 0, 0, 9, 9, 9},
+    {0, 15, 0, 7, 0, 0, 9, 9, 9},
+    {0, 0, 0, 9, 0, 0, 9, 9, 9},
+    {15, 0, 0, 7, 0, 0, 9, 9, 9},
+    {0, 0, 0, 9, 0, 0, 9, 9, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {26, 17, 26, 0, 0, 0, 26, 17, 26},
+    {0, 9, 9, 0, 0, 0, 22, 9, 9},
+    {0, 0, 9, 0, 0, 0, 7, 18, 9},
+    {22, 0, 15, 0, 0, 0, 22, 17, 15},
+    {0, 0, 9, 0, 0, 0, 9, 9, 18},
+    {0, 9, 0, 0, 0, 0, 7, 9, 9},
+    {9, 0, 0, 0, 0, 0, 9, 9, 9},
+    {0, 0, 0, 0, 0, 0, 7, 9, 7},
+    {22, 22, 0, 0, 0, 0, 22, 22, 17},
+    {0, 9, 0, 0, 0, 0, 9, 9, 18},
+    {9, 0, 0, 0, 0, 0, 9, 18, 9},
+    {0, 0, 0, 0, 0, 0, 14, 7, 9},
+    {0, 0, 0, 0, 0, 0, 14, 14, 7},
+    {30, 30, 30, 25, 0, 0, 30, 30, 30},
+    {0, 26, 26, 17, 0, 0, 17, 26, 26},
+    {26, 0, 26, 17, 0, 0, 17, 17, 26},
+    {0, 0, 9, 9, 0, 0, 9, 9, 22},
+    {0, 0, 9, 9, 0, 0, 9, 22, 9},
+    {9, 9, 0, 9, 0, 0, 9, 9, 26},
+    {0, 9, 0, 9, 0, 0, 9, 9, 7},
+    {0, 0, 0, 9, 0, 0, 9, 9, 7},
+    {9, 0, 0, 9, 0, 0, 9, 22, 7},
+    {0, 0, 0, 9, 0, 0, 9, 7, 18},
+    {0, 9, 0, 9, 0, 0, 22, 9, 9},
+    {9, 0, 0, 9, 0, 0, 22, 9, 9},
+    {0, 0, 0, 18, 0, 0, 7, 18, 18},
+    {23, 23, 23, 0, 0, 0, 23, 23, 23},
+    {0, 9, 9, 0, 0, 0, 9, 9, 17},
+    {0, 0, 15, 0, 0, 0, 15, 18, 7},
+    {9, 0, 9, 0, 0, 0, 9, 17, 9},
+    {0, 0, 9, 0, 0, 0, 15, 7, 9},
+    {0, 9, 0, 0, 0, 0, 9, 9, 7},
+    {9, 0, 0, 0, 0, 0, 9, 7, 15},
+    {0, 0, 0, 0, 0, 0, 9, 9, 7},
+    {9, 9, 0, 0, 0, 0, 17, 9, 9},
+    {0, 9, 0, 0, 0, 0, 7, 9, 9},
+    {15, 0, 0, 0, 0, 0, 7, 18, 15},
+    {0, 0, 0, 0, 0, 0, 9, 9, 9},
+    {0, 0, 0, 0, 0, 0, 7, 9, 9},
+    {0, 22, 15, 0, 0, 0, 22, 22, 22},
+    {22, 0, 15, 0, 0, 0, 22, 17, 22},
+    {0, 0, 18, 0, 0, 0, 9, 9, 9},
+    {15, 15, 0, 0, 0, 0, 22, 22, 7},
+    {0, 9, 0, 0, 0, 0, 9, 9, 9},
+    {9, 0, 0, 0, 0, 0, 9, 9, 9},
+    {0, 0, 0, 0, 0, 0, 9, 9, 7},
+    {0, 0, 0, 0, 0, 0, 9, 14, 7},
+    {0, 0, 0, 0, 0, 0, 14, 9, 9},
+    {0, 25, 23, 30, 23, 0, 23, 30, 30},
+    {25, 0, 23, 30, 23, 0, 30, 25, 30},
+    {0, 0, 23, 9, 9, 0, 9, 9, 9},
+    {23, 23, 0, 30, 23, 0, 30, 30, 30},
+    {0, 17, 0, 9, 9, 0, 9, 9, 9},
+    {17, 0, 0, 9, 9, 0, 9, 9, 9},
+    {0, 0, 0, 22, 15, 0, 17, 17, 17},
+    {0, 0, 0, 22, 15, 0, 15, 22, 17},
+    {0, 0, 0, 9, 9, 0, 9, 9, 17},
+    {30, 30, 30, 0, 30, 0, 30, 30, 30},
+    {0, 9, 9, 0, 9, 0, 26, 9, 9},
+    {26, 0, 25, 0, 17, 0, 26, 17, 25},
+    {0, 0, 22, 0, 22, 0, 17, 22, 22},
+    {0, 0, 22, 0, 15, 0, 7, 22, 15},
+    {26, 17, 0, 0, 17, 0, 26, 17, 17},
+    {0, 22, 0, 0, 22, 0, 22, 22, 22},
+    {0, 0, 0, 0, 18, 0, 18, 18, 17},
+    {22, 0, 0, 0, 22, 0, 15, 22, 22},
+    {0, 0, 0, 0, 9, 0, 18, 9, 9},
+    {0, 9, 0, 0, 9, 0, 7, 9, 15},
+    {9, 0, 0, 0, 9, 0, 9, 9, 23},
+    {0, 0, 0, 0, 9, 0, 15, 9, 7},
+    {0, 0, 7, 0, 15, 0, 9, 9, 9},
+    {0, 7, 0, 0, 15, 0, 9, 9, 9},
+    {7, 0, 0, 0, 15, 0, 9, 9, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {23, 23, 23, 30, 0, 0, 23, 23, 23},
+    {0, 9, 9, 9, 0, 0, 9, 9, 17},
+    {9, 0, 9, 9, 0, 0, 9, 17, 9},
+    {0, 0, 15, 22, 0, 0, 15, 7, 22},
+    {0, 0, 15, 15, 0, 0, 15, 22, 7},
+    {9, 9, 0, 9, 0, 0, 17, 9, 9},
+    {0, 15, 0, 22, 0, 0, 7, 15, 22},
+    {0, 0, 0, 9, 0, 0, 9, 9, 9},
+    {15, 0, 0, 22, 0, 0, 7, 22, 15},
+    {0, 0, 0, 9, 0, 0, 9, 9, 9},
+    {0, 9, 0, 9, 0, 0, 9, 9, 7},
+    {9, 0, 0, 9, 0, 0, 9, 7, 15},
+    {0, 0, 0, 9, 0, 0, 9, 9, 7},
+    {26, 17, 26, 0, 0, 0, 26, 17, 26},
+    {0, 22, 22, 0, 0, 0, 17, 22, 22},
+    {0, 0, 9, 0, 0, 0, 9, 18, 9},
+    {15, 0, 22, 0, 0, 0, 15, 17, 22},
+    {0, 0, 9, 0, 0, 0, 9, 9, 9},
+    {0, 9, 0, 0, 0, 0, 18, 9, 9},
+    {9, 0, 0, 0, 0, 0, 18, 9, 9},
+    {0, 0, 0, 0, 0, 0, 7, 14, 14},
+    {9, 9, 0, 0, 0, 0, 9, 9, 22},
+    {0, 9, 0, 0, 0, 0, 9, 9, 7},
+    {9, 0, 0, 0, 0, 0, 9, 18, 7},
+    {0, 0, 0, 0, 0, 0, 9, 7, 14},
+    {0, 0, 0, 0, 0, 0, 7, 9, 7},
+    {0, 15, 15, 0, 0, 0, 15, 15, 7},
+    {15, 0, 15, 0, 0, 0, 15, 7, 15},
+    {0, 0, 9, 0, 0, 0, 9, 9, 9},
+    {15, 15, 0, 0, 0, 0, 7, 15, 15},
+    {0, 9, 0, 0, 0, 0, 9, 9, 9},
+    {9, 0, 0, 0, 0, 0, 9, 9, 9},
+    {0, 0, 0, 0, 0, 0, 7, 7, 9},
+    {0, 0, 0, 0, 0, 0, 7, 15, 7},
+    {0, 0, 0, 0, 0, 0, 9, 7, 7},
+    {0, 0, 7, 15, 0, 0, 9, 9, 9},
+    {0, 7, 0, 15, 0, 0, 9, 9, 9},
+    {7, 0, 0, 22, 0, 0, 9, 9, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 15, 15, 0, 0, 0, 7, 22, 22},
+    {15, 0, 22, 0, 0, 0, 22, 17, 22},
+    {0, 0, 9, 0, 0, 0, 9, 9, 9},
+    {15, 22, 0, 0, 0, 0, 22, 22, 22},
+    {0, 9, 0, 0, 0, 0, 9, 9, 9},
+    {18, 0, 0, 0, 0, 0, 9, 9, 9},
+    {0, 0, 0, 0, 0, 0, 9, 9, 14},
+    {0, 0, 0, 0, 0, 0, 7, 14, 9},
+    {0, 0, 0, 0, 0, 0, 7, 9, 9},
+    {25, 25, 25, 25, 34, 25, 0, 25, 25},
+    {0, 30, 23, 25, 30, 30, 0, 23, 23},
+    {0, 0, 17, 17, 26, 17, 0, 26, 17},
+    {23, 0, 30, 25, 23, 30, 0, 30, 23},
+    {0, 0, 9, 17, 9, 9, 0, 9, 9},
+    {0, 9, 0, 9, 17, 9, 0, 9, 9},
+    {9, 0, 0, 9, 26, 9, 0, 9, 9},
+    {0, 0, 0, 17, 7, 15, 0, 15, 15},
+    {23, 30, 0, 25, 30, 30, 0, 25, 23},
+    {0, 9, 0, 17, 9, 9, 0, 9, 9},
+    {17, 0, 0, 17, 26, 25, 0, 26, 26},
+    {0, 0, 0, 17, 22, 22, 0, 15, 22},
+    {0, 0, 0, 7, 15, 23, 0, 15, 15},
+    {0, 23, 23, 0, 26, 26, 0, 17, 17},
+    {23, 0, 9, 0, 9, 9, 0, 9, 9},
+    {0, 0, 17, 0, 9, 9, 0, 9, 9},
+    {0, 0, 0, 0, 15, 9, 0, 9, 9},
+    {23, 9, 0, 0, 9, 9, 0, 9, 9},
+    {0, 17, 0, 0, 9, 9, 0, 9, 9},
+    {0, 0, 0, 0, 18, 18, 0, 18, 15},
+    {7, 0, 0, 0, 9, 9, 0, 9, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {30, 30, 30, 0, 23, 30, 0, 23, 23},
+    {0, 17, 17, 0, 26, 17, 0, 17, 17},
+    {17, 0, 17, 0, 26, 17, 0, 17, 17},
+    {0, 0, 17, 0, 15, 23, 0, 15, 23},
+    {0, 0, 17, 0, 15, 22, 0, 22, 15},
+    {9, 9, 0, 0, 26, 9, 0, 9, 9},
+    {0, 17, 0, 0, 7, 15, 0, 15, 15},
+    {0, 0, 0, 0, 15, 9, 0, 9, 9},
+    {17, 0, 0, 0, 7, 15, 0, 15, 15},
+    {0, 0, 0, 0, 15, 9, 0, 9, 9},
+    {0, 17, 0, 0, 22, 22, 0, 22, 15},
+    {17, 0, 0, 0, 22, 22, 0, 15, 22},
+    {0, 0, 0, 0, 18, 15, 0, 18, 18},
+    {0, 9, 26, 9, 0, 9, 0, 9, 9},
+    {9, 0, 17, 9, 0, 9, 0, 9, 9},
+    {0, 0, 7, 9, 0, 9, 0, 9, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {26, 17, 0, 17, 0, 17, 0, 17, 26},
+    {0, 22, 0, 9, 0, 9, 0, 9, 9},
+    {0, 0, 0, 9, 0, 9, 0, 18, 9},
+    {15, 0, 0, 9, 0, 9, 0, 9, 9},
+    {0, 0, 0, 9, 0, 9, 0, 9, 9},
+    {0, 0, 7, 0, 0, 9, 0, 9, 9},
+    {0, 7, 0, 0, 0, 15, 0, 9, 9},
+    {7, 0, 0, 0, 0, 9, 0, 9, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 17, 0, 0, 9, 0, 9, 9},
+    {0, 15, 7, 0, 0, 22, 0, 15, 15},
+    {0, 0, 9, 0, 0, 9, 0, 9, 9},
+    {15, 0, 7, 0, 0, 22, 0, 15, 15},
+    {0, 0, 9, 0, 0, 9, 0, 9, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {22, 22, 0, 0, 0, 22, 0, 15, 15},
+    {0, 9, 0, 0, 0, 9, 0, 9, 18},
+    {9, 0, 0, 0, 0, 9, 0, 18, 9},
+    {0, 0, 0, 0, 0, 14, 0, 7, 14},
+    {0, 0, 0, 0, 0, 14, 0, 14, 7},
+    {30, 30, 30, 30, 0, 30, 0, 30, 30},
+    {0, 9, 9, 26, 0, 9, 0, 9, 9},
+    {26, 0, 26, 26, 0, 26, 0, 17, 17},
+    {0, 0, 9, 9, 0, 9, 0, 9, 22},
+    {0, 0, 9, 7, 0, 9, 0, 15, 9},
+    {17, 26, 0, 26, 0, 26, 0, 26, 17},
+    {0, 9, 0, 9, 0, 9, 0, 9, 15},
+    {0, 0, 0, 15, 0, 15, 0, 18, 7},
+    {9, 0, 0, 9, 0, 9, 0, 22, 9},
+    {0, 0, 0, 15, 0, 9, 0, 7, 9},
+    {0, 22, 0, 7, 0, 22, 0, 15, 15},
+    {22, 0, 0, 22, 0, 22, 0, 17, 22},
+    {0, 0, 0, 18, 0, 9, 0, 9, 9},
+    {26, 9, 9, 0, 0, 9, 0, 9, 9},
+    {0, 9, 9, 0, 0, 9, 0, 9, 22},
+    {0, 0, 18, 0, 0, 18, 0, 18, 7},
+    {7, 0, 9, 0, 0, 9, 0, 15, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 15, 0, 0, 0, 18, 0, 15, 7},
+    {15, 0, 0, 0, 0, 9, 0, 7, 9},
+    {0, 0, 0, 0, 0, 9, 0, 9, 9},
+    {7, 22, 0, 0, 0, 17, 0, 15, 15},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {18, 0, 0, 0, 0, 9, 0, 9, 9},
+    {0, 0, 0, 0, 0, 9, 0, 9, 14},
+    {0, 9, 9, 0, 0, 22, 0, 9, 9},
+    {9, 0, 9, 0, 0, 22, 0, 9, 9},
+    {0, 0, 18, 0, 0, 7, 0, 9, 9},
+    {9, 9, 0, 0, 0, 22, 0, 9, 9},
+    {0, 15, 0, 0, 0, 7, 0, 9, 9},
+    {15, 0, 0, 0, 0, 7, 0, 9, 9},
+    {0, 0, 0, 0, 0, 9, 0, 9, 9},
+    {0, 0, 0, 0, 0, 9, 0, 9, 9},
+    {0, 0, 0, 0, 0, 14, 0, 9, 9},
+    {0, 17, 26, 17, 17, 0, 0, 17, 17},
+    {17, 0, 25, 17, 26, 0, 0, 17, 17},
+    {0, 0, 15, 9, 9, 0, 0, 9, 9},
+    {0, 0, 0, 9, 9, 0, 0, 9, 9},
+    {26, 25, 0, 26, 26, 0, 0, 17, 17},
+    {0, 22, 0, 9, 9, 0, 0, 9, 9},
+    {0, 0, 0, 17, 18, 0, 0, 18, 17},
+    {23, 0, 0, 9, 9, 0, 0, 9, 9},
+    {0, 0, 0, 17, 9, 0, 0, 9, 9},
+    {0, 0, 7, 0, 15, 0, 0, 9, 9},
+    {0, 7, 0, 0, 15, 0, 0, 9, 9},
+    {7, 0, 0, 0, 9, 0, 0, 9, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {17, 17, 26, 0, 17, 0, 0, 17, 26},
+    {0, 23, 15, 0, 22, 0, 0, 23, 15},
+    {0, 0, 17, 0, 17, 0, 0, 17, 17},
+    {22, 0, 15, 0, 22, 0, 0, 22, 15},
+    {0, 0, 17, 0, 18, 0, 0, 17, 18},
+    {0, 9, 0, 0, 9, 0, 0, 9, 9},
+    {9, 0, 0, 0, 9, 0, 0, 9, 9},
+    {0, 0, 0, 0, 7, 0, 0, 15, 7},
+    {22, 22, 0, 0, 22, 0, 0, 22, 22},
+    {0, 17, 0, 0, 18, 0, 0, 18, 18},
+    {17, 0, 0, 0, 18, 0, 0, 18, 18},
+    {0, 0, 0, 0, 14, 0, 0, 15, 14},
+    {0, 0, 0, 0, 14, 0, 0, 14, 15},
+    {0, 0, 7, 9, 0, 0, 0, 9, 9},
+    {0, 7, 0, 18, 0, 0, 0, 9, 9},
+    {7, 0, 0, 18, 0, 0, 0, 9, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 18, 0, 0, 0, 0, 9, 9},
+    {9, 0, 18, 0, 0, 0, 0, 9, 9},
+    {0, 0, 7, 0, 0, 0, 0, 9, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {18, 18, 0, 0, 0, 0, 0, 18, 18},
+    {0, 14, 0, 0, 0, 0, 0, 9, 9},
+    {0, 0, 0, 0, 0, 0, 0, 10, 9},
+    {14, 0, 0, 0, 0, 0, 0, 9, 9},
+    {0, 0, 0, 0, 0, 0, 0, 9, 10},
+    {17, 26, 26, 17, 0, 0, 0, 26, 26},
+    {0, 9, 9, 9, 0, 0, 0, 9, 15},
+    {0, 0, 18, 17, 0, 0, 0, 18, 7},
+    {9, 0, 9, 9, 0, 0, 0, 22, 9},
+    {0, 0, 9, 18, 0, 0, 0, 7, 9},
+    {0, 9, 0, 9, 0, 0, 0, 9, 7},
+    {9, 0, 0, 9, 0, 0, 0, 7, 15},
+    {0, 0, 0, 9, 0, 0, 0, 9, 7},
+    {22, 22, 0, 17, 0, 0, 0, 22, 22},
+    {0, 9, 0, 18, 0, 0, 0, 9, 9},
+    {18, 0, 0, 18, 0, 0, 0, 18, 18},
+    {0, 0, 0, 9, 0, 0, 0, 9, 14},
+    {0, 0, 0, 7, 0, 0, 0, 15, 9},
+    {0, 15, 15, 0, 0, 0, 0, 15, 7},
+    {15, 0, 9, 0, 0, 0, 0, 7, 9},
+    {0, 0, 9, 0, 0, 0, 0, 9, 9},
+    {0, 0, 0, 0, 0, 0, 0, 7, 7},
+    {15, 9, 0, 0, 0, 0, 0, 9, 9},
+    {0, 9, 0, 0, 0, 0, 0, 9, 9},
+    {0, 0, 0, 0, 0, 0, 0, 10, 7},
+    {7, 0, 0, 0, 0, 0, 0, 9, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {22, 22, 22, 0, 0, 0, 0, 22, 15},
+    {0, 18, 18, 0, 0, 0, 0, 18, 18},
+    {17, 0, 18, 0, 0, 0, 0, 17, 18},
+    {0, 0, 9, 0, 0, 0, 0, 9, 15},
+    {0, 0, 9, 0, 0, 0, 0, 14, 9},
+    {9, 9, 0, 0, 0, 0, 0, 9, 18},
+    {0, 9, 0, 0, 0, 0, 0, 9, 7},
+    {0, 0, 0, 0, 0, 0, 0, 9, 7},
+    {9, 0, 0, 0, 0, 0, 0, 14, 7},
+    {0, 0, 0, 0, 0, 0, 0, 7, 10},
+    {0, 14, 0, 0, 0, 0, 0, 14, 14},
+    {14, 0, 0, 0, 0, 0, 0, 14, 14},
+    {0, 0, 0, 0, 0, 0, 0, 10, 10},
+    {23, 30, 30, 30, 23, 0, 0, 25, 23},
+    {0, 9, 9, 17, 9, 0, 0, 9, 9},
+    {17, 0, 25, 17, 26, 0, 0, 17, 17},
+    {0, 0, 17, 17, 15, 0, 0, 15, 22},
+    {0, 0, 15, 7, 15, 0, 0, 15, 15},
+    {9, 9, 0, 9, 26, 0, 0, 9, 9},
+    {0, 17, 0, 22, 7, 0, 0, 15, 15},
+    {0, 0, 0, 9, 15, 0, 0, 9, 9},
+    {15, 0, 0, 15, 7, 0, 0, 15, 15},
+    {0, 0, 0, 9, 9, 0, 0, 9, 9},
+    {0, 9, 0, 7, 9, 0, 0, 9, 15},
+    {9, 0, 0, 9, 9, 0, 0, 9, 23},
+    {0, 0, 0, 15, 9, 0, 0, 9, 7},
+    {26, 9, 9, 0, 9, 0, 0, 9, 9},
+    {0, 17, 22, 0, 17, 0, 0, 17, 22},
+    {0, 0, 18, 0, 18, 0, 0, 18, 15},
+    {7, 0, 15, 0, 15, 0, 0, 15, 15},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 0, 0, 18, 0, 0, 9, 9},
+    {9, 0, 0, 0, 9, 0, 0, 9, 9},
+    {0, 0, 0, 0, 7, 0, 0, 15, 15},
+    {7, 9, 0, 0, 9, 0, 0, 9, 15},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {18, 0, 0, 0, 9, 0, 0, 9, 7},
+    {0, 0, 0, 0, 9, 0, 0, 9, 14},
+    {0, 9, 9, 0, 15, 0, 0, 9, 9},
+    {9, 0, 9, 0, 15, 0, 0, 9, 9},
+    {0, 0, 15, 0, 7, 0, 0, 9, 9},
+    {9, 9, 0, 0, 7, 0, 0, 9, 9},
+    {0, 9, 0, 0, 7, 0, 0, 9, 9},
+    {9, 0, 0, 0, 7, 0, 0, 9, 9},
+    {0, 0, 0, 0, 7, 0, 0, 9, 9},
+    {0, 0, 0, 0, 7, 0, 0, 9, 9},
+    {0, 0, 0, 0, 9, 0, 0, 9, 9},
+    {9, 9, 17, 9, 0, 0, 0, 9, 9},
+    {0, 15, 7, 17, 0, 0, 0, 15, 15},
+    {0, 0, 9, 9, 0, 0, 0, 9, 9},
+    {15, 0, 7, 15, 0, 0, 0, 15, 15},
+    {0, 0, 9, 9, 0, 0, 0, 9, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 0, 9, 0, 0, 0, 9, 15},
+    {0, 9, 0, 9, 0, 0, 0, 9, 7},
+    {9, 0, 0, 9, 0, 0, 0, 18, 7},
+    {0, 0, 0, 9, 0, 0, 0, 7, 14},
+    {0, 0, 0, 7, 0, 0, 0, 9, 7},
+    {0, 9, 15, 0, 0, 0, 0, 9, 9},
+    {9, 0, 9, 0, 0, 0, 0, 9, 9},
+    {0, 0, 7, 0, 0, 0, 0, 9, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {15, 9, 0, 0, 0, 0, 0, 9, 7},
+    {0, 9, 0, 0, 0, 0, 0, 9, 9},
+    {0, 0, 0, 0, 0, 0, 0, 10, 7},
+    {7, 0, 0, 0, 0, 0, 0, 9, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {15, 15, 7, 0, 0, 0, 0, 15, 15},
+    {0, 9, 9, 0, 0, 0, 0, 9, 9},
+    {9, 0, 9, 0, 0, 0, 0, 9, 9},
+    {0, 0, 7, 0, 0, 0, 0, 7, 15},
+    {0, 0, 7, 0, 0, 0, 0, 15, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 0, 0, 0, 0, 0, 9, 7},
+    {9, 0, 0, 0, 0, 0, 0, 7, 15},
+    {0, 0, 0, 0, 0, 0, 0, 9, 7},
+    {0, 9, 9, 7, 0, 0, 0, 9, 9},
+    {9, 0, 9, 22, 0, 0, 0, 9, 9},
+    {0, 0, 9, 7, 0, 0, 0, 9, 9},
+    {9, 9, 0, 22, 0, 0, 0, 9, 9},
+    {0, 9, 0, 7, 0, 0, 0, 9, 9},
+    {15, 0, 0, 7, 0, 0, 0, 9, 9},
+    {0, 0, 0, 9, 0, 0, 0, 9, 9},
+    {0, 0, 0, 7, 0, 0, 0, 9, 9},
+    {0, 0, 0, 7, 0, 0, 0, 9, 9},
+    {7, 22, 22, 0, 0, 0, 0, 15, 15},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {18, 0, 9, 0, 0, 0, 0, 9, 9},
+    {0, 0, 9, 0, 0, 0, 0, 9, 14},
+    {18, 9, 0, 0, 0, 0, 0, 9, 9},
+    {0, 9, 0, 0, 0, 0, 0, 9, 14},
+    {0, 0, 0, 0, 0, 0, 0, 10, 7},
+    {7, 0, 0, 0, 0, 0, 0, 15, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 0, 0, 9, 15},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 23, 23, 25, 30, 30, 0, 30, 23},
+    {23, 0, 25, 25, 30, 25, 0, 25, 30},
+    {0, 0, 17, 9, 9, 9, 0, 9, 9},
+    {23, 25, 0, 30, 30, 25, 0, 30, 23},
+    {0, 17, 0, 9, 9, 9, 0, 9, 9},
+    {23, 0, 0, 9, 9, 9, 0, 9, 9},
+    {0, 0, 0, 17, 9, 9, 0, 9, 9},
+    {0, 0, 0, 17, 22, 22, 0, 22, 15},
+    {0, 0, 0, 9, 15, 9, 0, 9, 9},
+    {25, 25, 30, 0, 30, 25, 0, 30, 30},
+    {0, 17, 17, 0, 26, 26, 0, 23, 23},
+    {17, 0, 17, 0, 26, 26, 0, 25, 23},
+    {0, 0, 17, 0, 15, 17, 0, 17, 22},
+    {0, 0, 17, 0, 15, 17, 0, 22, 17},
+    {17, 17, 0, 0, 26, 26, 0, 25, 26},
+    {0, 17, 0, 0, 22, 15, 0, 22, 22},
+    {0, 0, 0, 0, 18, 18, 0, 18, 15},
+    {17, 0, 0, 0, 22, 15, 0, 22, 22},
+    {0, 0, 0, 0, 18, 18, 0, 15, 18},
+    {0, 9, 0, 0, 15, 9, 0, 9, 9},
+    {9, 0, 0, 0, 15, 9, 0, 9, 9},
+    {0, 0, 0, 0, 7, 15, 0, 15, 15},
+    {0, 0, 7, 0, 15, 23, 0, 15, 15},
+    {0, 7, 0, 0, 15, 15, 0, 23, 15},
+    {7, 0, 0, 0, 9, 9, 0, 9, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {30, 30, 30, 30, 0, 30, 0, 30, 30},
+    {0, 9, 9, 9, 0, 9, 0, 9, 26},
+    {9, 0, 9, 9, 0, 9, 0, 26, 9},
+    {0, 0, 9, 15, 0, 9, 0, 7, 9},
+    {0, 0, 22, 15, 0, 15, 0, 22, 7},
+    {26, 17, 0, 17, 0, 17, 0, 17, 26},
+    {0, 9, 0, 22, 0, 9, 0, 9, 9},
+    {0, 0, 0, 7, 0, 9, 0, 15, 9},
+    {22, 0, 0, 22, 0, 15, 0, 22, 15},
+    {0, 0, 0, 9, 0, 9, 0, 9, 18},
+    {0, 15, 0, 15, 0, 15, 0, 15, 7},
+    {15, 0, 0, 15, 0, 15, 0, 7, 15},
+    {0, 0, 0, 9, 0, 9, 0, 9, 9},
+    {9, 9, 9, 0, 0, 26, 0, 9, 9},
+    {0, 15, 22, 0, 0, 7, 0, 15, 22},
+    {0, 0, 9, 0, 0, 9, 0, 9, 9},
+    {15, 0, 22, 0, 0, 7, 0, 22, 15},
+    {0, 0, 9, 0, 0, 9, 0, 9, 9},
+    {0, 9, 0, 0, 0, 18, 0, 9, 9},
+    {9, 0, 0, 0, 0, 18, 0, 9, 9},
+    {0, 0, 0, 0, 0, 7, 0, 14, 14},
+    {15, 15, 0, 0, 0, 7, 0, 15, 15},
+    {0, 9, 0, 0, 0, 9, 0, 9, 9},
+    {9, 0, 0, 0, 0, 9, 0, 9, 9},
+    {0, 0, 0, 0, 0, 7, 0, 7, 15},
+    {0, 0, 0, 0, 0, 7, 0, 15, 7},
+    {0, 15, 15, 0, 0, 22, 0, 15, 7},
+    {15, 0, 9, 0, 0, 9, 0, 7, 9},
+    {0, 0, 9, 0, 0, 9, 0, 9, 9},
+    {15, 9, 0, 0, 0, 9, 0, 9, 9},
+    {0, 9, 0, 0, 0, 9, 0, 9, 9},
+    {7, 0, 0, 0, 0, 9, 0, 9, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 14, 0, 14, 7},
+    {0, 0, 0, 0, 0, 15, 0, 7, 7},
+    {0, 0, 7, 9, 0, 9, 0, 9, 9},
+    {0, 7, 0, 22, 0, 15, 0, 22, 15},
+    {7, 0, 0, 22, 0, 15, 0, 17, 15},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 22, 0, 0, 9, 0, 9, 9},
+    {9, 0, 22, 0, 0, 9, 0, 9, 9},
+    {0, 0, 7, 0, 0, 9, 0, 9, 9},
+    {22, 22, 0, 0, 0, 17, 0, 22, 22},
+    {0, 18, 0, 0, 0, 9, 0, 9, 9},
+    {18, 0, 0, 0, 0, 9, 0, 9, 9},
+    {0, 0, 0, 0, 0, 9, 0, 9, 14},
+    {0, 0, 0, 0, 0, 9, 0, 14, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {30, 25, 25, 25, 30, 0, 0, 25, 23},
+    {0, 17, 17, 17, 17, 0, 0, 17, 26},
+    {23, 0, 17, 25, 17, 0, 0, 25, 23},
+    {0, 0, 9, 17, 9, 0, 0, 9, 9},
+    {0, 0, 22, 17, 15, 0, 0, 22, 15},
+    {9, 9, 0, 9, 9, 0, 0, 9, 23},
+    {0, 9, 0, 15, 9, 0, 0, 9, 7},
+    {0, 0, 0, 7, 9, 0, 0, 9, 15},
+    {22, 0, 0, 15, 15, 0, 0, 22, 7},
+    {0, 0, 0, 9, 9, 0, 0, 9, 18},
+    {0, 9, 0, 9, 15, 0, 0, 9, 9},
+    {9, 0, 0, 9, 15, 0, 0, 9, 9},
+    {0, 0, 0, 17, 7, 0, 0, 15, 15},
+    {9, 9, 9, 0, 23, 0, 0, 9, 9},
+    {0, 17, 15, 0, 7, 0, 0, 17, 15},
+    {0, 0, 9, 0, 15, 0, 0, 9, 9},
+    {17, 0, 15, 0, 7, 0, 0, 22, 15},
+    {0, 0, 9, 0, 15, 0, 0, 9, 9},
+    {0, 9, 0, 0, 9, 0, 0, 9, 9},
+    {9, 0, 0, 0, 9, 0, 0, 9, 9},
+    {0, 0, 0, 0, 7, 0, 0, 15, 7},
+    {9, 9, 0, 0, 7, 0, 0, 9, 9},
+    {0, 9, 0, 0, 7, 0, 0, 9, 9},
+    {9, 0, 0, 0, 7, 0, 0, 9, 9},
+    {0, 0, 0, 0, 7, 0, 0, 9, 9},
+    {0, 0, 0, 0, 7, 0, 0, 9, 9},
+    {0, 23, 15, 0, 22, 0, 0, 23, 15},
+    {23, 0, 9, 0, 9, 0, 0, 9, 9},
+    {0, 0, 17, 0, 9, 0, 0, 9, 9},
+    {15, 9, 0, 0, 9, 0, 0, 9, 7},
+    {0, 9, 0, 0, 9, 0, 0, 9, 9},
+    {7, 0, 0, 0, 9, 0, 0, 9, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 14, 0, 0, 14, 7},
+    {0, 0, 0, 0, 15, 0, 0, 9, 9},
+    {9, 9, 9, 26, 0, 0, 0, 9, 9},
+    {0, 9, 9, 7, 0, 0, 0, 9, 9},
+    {0, 0, 9, 7, 0, 0, 0, 9, 9},
+    {15, 0, 15, 7, 0, 0, 0, 22, 15},
+    {0, 0, 9, 9, 0, 0, 0, 9, 9},
+    {0, 9, 0, 7, 0, 0, 0, 9, 9},
+    {9, 0, 0, 9, 0, 0, 0, 9, 9},
+    {0, 0, 0, 7, 0, 0, 0, 9, 7},
+    {15, 15, 0, 7, 0, 0, 0, 15, 15},
+    {0, 9, 0, 9, 0, 0, 0, 9, 9},
+    {9, 0, 0, 9, 0, 0, 0, 9, 9},
+    {0, 0, 0, 7, 0, 0, 0, 7, 9},
+    {0, 0, 0, 7, 0, 0, 0, 15, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {22, 9, 9, 0, 0, 0, 0, 9, 9},
+    {0, 9, 9, 0, 0, 0, 0, 9, 18},
+    {7, 0, 9, 0, 0, 0, 0, 15, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 14, 0, 0, 0, 0, 14, 7},
+    {7, 9, 0, 0, 0, 0, 0, 9, 15},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {14, 0, 0, 0, 0, 0, 0, 9, 7},
+    {0, 0, 0, 0, 0, 0, 0, 9, 10},
+    {0, 15, 0, 0, 0, 0, 0, 15, 7},
+    {15, 0, 0, 0, 0, 0, 0, 7, 9},
+    {0, 0, 0, 0, 0, 0, 0, 9, 9},
+    {0, 9, 15, 9, 0, 0, 0, 9, 9},
+    {9, 0, 15, 9, 0, 0, 0, 9, 9},
+    {0, 0, 7, 9, 0, 0, 0, 9, 9},
+    {15, 15, 0, 17, 0, 0, 0, 22, 7},
+    {0, 9, 0, 9, 0, 0, 0, 9, 9},
+    {9, 0, 0, 9, 0, 0, 0, 9, 9},
+    {0, 0, 0, 9, 0, 0, 0, 9, 7},
+    {0, 0, 0, 9, 0, 0, 0, 14, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 17, 0, 0, 0, 0, 9, 9},
+    {0, 15, 7, 0, 0, 0, 0, 15, 15},
+    {15, 0, 7, 0, 0, 0, 0, 15, 15},
+    {0, 0, 9, 0, 0, 0, 0, 9, 9},
+    {0, 0, 9, 0, 0, 0, 0, 9, 9},
+    {9, 9, 0, 0, 0, 0, 0, 9, 15},
+    {0, 9, 0, 0, 0, 0, 0, 9, 7},
+    {0, 0, 0, 0, 0, 0, 0, 9, 7},
+    {9, 0, 0, 0, 0, 0, 0, 14, 7},
+    {0, 0, 0, 0, 0, 0, 0, 7, 10},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 0, 0, 9, 9},
+    {0, 7, 0, 0, 0, 0, 0, 15, 7},
+    {7, 0, 0, 0, 0, 0, 0, 9, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 17, 15, 0, 0, 15, 15},
+    {0, 7, 0, 22, 15, 0, 0, 22, 15},
+    {7, 0, 0, 22, 15, 0, 0, 15, 22},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 17, 22, 0, 17, 0, 0, 17, 22},
+    {17, 0, 22, 0, 22, 0, 0, 22, 22},
+    {0, 0, 15, 0, 9, 0, 0, 9, 9},
+    {22, 22, 0, 0, 22, 0, 0, 22, 22},
+    {0, 18, 0, 0, 9, 0, 0, 9, 9},
+    {18, 0, 0, 0, 9, 0, 0, 9, 9},
+    {0, 0, 0, 0, 14, 0, 0, 14, 14},
+    {0, 0, 0, 0, 14, 0, 0, 14, 14},
+    {0, 0, 0, 0, 9, 0, 0, 9, 9},
+    {0, 15, 15, 17, 0, 0, 0, 15, 7},
+    {15, 0, 15, 22, 0, 0, 0, 7, 15},
+    {0, 0, 9, 9, 0, 0, 0, 9, 9},
+    {15, 15, 0, 22, 0, 0, 0, 22, 22},
+    {0, 9, 0, 9, 0, 0, 0, 9, 9},
+    {9, 0, 0, 9, 0, 0, 0, 9, 9},
+    {0, 0, 0, 14, 0, 0, 0, 7, 9},
+    {0, 0, 0, 14, 0, 0, 0, 14, 7},
+    {0, 0, 0, 9, 0, 0, 0, 7, 7},
+    {17, 22, 22, 0, 0, 0, 0, 22, 22},
+    {0, 9, 9, 0, 0, 0, 0, 9, 15},
+    {9, 0, 9, 0, 0, 0, 0, 18, 9},
+    {0, 0, 14, 0, 0, 0, 0, 7, 14},
+    {0, 0, 14, 0, 0, 0, 0, 14, 7},
+    {18, 18, 0, 0, 0, 0, 0, 18, 18},
+    {0, 14, 0, 0, 0, 0, 0, 14, 14},
+    {0, 0, 0, 0, 0, 0, 0, 10, 9},
+    {14, 0, 0, 0, 0, 0, 0, 14, 14},
+    {0, 0, 0, 0, 0, 0, 0, 9, 10},
+    {0, 9, 0, 0, 0, 0, 0, 9, 7},
+    {9, 0, 0, 0, 0, 0, 0, 7, 15},
+    {0, 0, 0, 0, 0, 0, 0, 9, 7},
+    {0, 0, 7, 0, 0, 0, 0, 7, 7},
+    {0, 7, 0, 0, 0, 0, 0, 15, 7},
+    {7, 0, 0, 0, 0, 0, 0, 7, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 0, 0, 9, 9},
+    {0, 7, 0, 0, 0, 0, 0, 14, 14},
+    {7, 0, 0, 0, 0, 0, 0, 14, 14},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {25, 34, 25, 25, 34, 25, 34, 0, 34},
+    {0, 25, 30, 25, 30, 25, 23, 0, 25},
+    {0, 0, 9, 9, 23, 9, 9, 0, 9},
+    {30, 0, 30, 30, 30, 30, 30, 0, 30},
+    {0, 0, 17, 17, 17, 17, 26, 0, 26},
+    {0, 17, 0, 17, 17, 17, 26, 0, 17},
+    {17, 0, 0, 17, 17, 17, 26, 0, 26},
+    {0, 0, 0, 23, 22, 23, 15, 0, 15},
+    {30, 25, 0, 25, 30, 25, 25, 0, 23},
+    {0, 17, 0, 17, 17, 17, 17, 0, 26},
+    {9, 0, 0, 9, 23, 9, 9, 0, 9},
+    {0, 0, 0, 17, 7, 17, 15, 0, 15},
+    {0, 0, 0, 23, 22, 23, 15, 0, 15},
+    {0, 25, 23, 0, 26, 26, 17, 0, 17},
+    {25, 0, 25, 0, 17, 17, 26, 0, 26},
+    {0, 0, 23, 0, 9, 9, 9, 0, 9},
+    {0, 0, 0, 0, 17, 17, 17, 0, 17},
+    {23, 25, 0, 0, 17, 25, 17, 0, 23},
+    {0, 17, 0, 0, 9, 9, 9, 0, 9},
+    {0, 0, 0, 0, 15, 9, 9, 0, 9},
+    {23, 0, 0, 0, 9, 9, 9, 0, 9},
+    {0, 0, 0, 0, 9, 9, 17, 0, 9},
+    {30, 25, 30, 0, 23, 30, 23, 0, 25},
+    {0, 17, 17, 0, 26, 17, 17, 0, 17},
+    {9, 0, 9, 0, 23, 9, 9, 0, 9},
+    {0, 0, 9, 0, 7, 9, 15, 0, 9},
+    {0, 0, 22, 0, 22, 22, 22, 0, 15},
+    {17, 17, 0, 0, 26, 17, 25, 0, 17},
+    {0, 9, 0, 0, 9, 9, 15, 0, 9},
+    {0, 0, 0, 0, 15, 9, 7, 0, 9},
+    {22, 0, 0, 0, 22, 22, 15, 0, 15},
+    {0, 0, 0, 0, 18, 17, 17, 0, 18},
+    {0, 17, 0, 0, 15, 22, 22, 0, 15},
+    {17, 0, 0, 0, 7, 22, 15, 0, 15},
+    {0, 0, 0, 0, 15, 9, 9, 0, 9},
+    {0, 26, 9, 9, 0, 9, 9, 0, 9},
+    {26, 0, 26, 17, 0, 17, 26, 0, 26},
+    {0, 0, 22, 9, 0, 9, 9, 0, 9},
+    {0, 0, 0, 9, 0, 9, 18, 0, 9},
+    {9, 26, 0, 9, 0, 9, 9, 0, 9},
+    {0, 7, 0, 9, 0, 9, 9, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {22, 0, 0, 9, 0, 9, 9, 0, 9},
+    {0, 0, 0, 9, 0, 9, 9, 0, 18},
+    {0, 0, 7, 0, 0, 18, 9, 0, 9},
+    {0, 7, 0, 0, 0, 9, 9, 0, 9},
+    {7, 0, 0, 0, 0, 15, 9, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 17, 9, 0, 0, 9, 9, 0, 9},
+    {0, 7, 9, 0, 0, 9, 15, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {22, 0, 22, 0, 0, 17, 15, 0, 15},
+    {0, 0, 9, 0, 0, 9, 9, 0, 18},
+    {0, 9, 0, 0, 0, 9, 7, 0, 9},
+    {9, 0, 0, 0, 0, 9, 18, 0, 9},
+    {0, 0, 0, 0, 0, 9, 7, 0, 9},
+    {15, 7, 0, 0, 0, 22, 15, 0, 15},
+    {0, 9, 0, 0, 0, 9, 9, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 14, 14, 0, 7},
+    {30, 25, 30, 30, 0, 30, 30, 0, 30},
+    {0, 17, 17, 26, 0, 26, 26, 0, 26},
+    {23, 0, 23, 23, 0, 23, 23, 0, 23},
+    {0, 0, 9, 9, 0, 9, 9, 0, 17},
+    {0, 0, 22, 22, 0, 22, 15, 0, 22},
+    {17, 17, 0, 26, 0, 26, 26, 0, 26},
+    {0, 9, 0, 9, 0, 9, 9, 0, 15},
+    {0, 0, 0, 15, 0, 15, 15, 0, 7},
+    {22, 0, 0, 22, 0, 22, 22, 0, 15},
+    {0, 0, 0, 18, 0, 18, 18, 0, 18},
+    {0, 9, 0, 9, 0, 9, 15, 0, 9},
+    {9, 0, 0, 9, 0, 9, 17, 0, 9},
+    {0, 0, 0, 15, 0, 15, 7, 0, 15},
+    {26, 17, 17, 0, 0, 17, 26, 0, 26},
+    {0, 9, 9, 0, 0, 9, 9, 0, 22},
+    {0, 0, 15, 0, 0, 18, 15, 0, 7},
+    {22, 0, 22, 0, 0, 17, 15, 0, 22},
+    {0, 0, 9, 0, 0, 9, 18, 0, 9},
+    {0, 17, 0, 0, 0, 18, 18, 0, 7},
+    {17, 0, 0, 0, 0, 17, 18, 0, 18},
+    {0, 0, 0, 0, 0, 9, 9, 0, 15},
+    {9, 9, 0, 0, 0, 9, 15, 0, 9},
+    {0, 9, 0, 0, 0, 9, 7, 0, 9},
+    {15, 0, 0, 0, 0, 15, 7, 0, 15},
+    {0, 0, 0, 0, 0, 9, 9, 0, 9},
+    {0, 0, 0, 0, 0, 9, 7, 0, 9},
+    {0, 9, 9, 0, 0, 22, 9, 0, 9},
+    {9, 0, 9, 0, 0, 17, 9, 0, 9},
+    {0, 0, 15, 0, 0, 7, 9, 0, 9},
+    {9, 9, 0, 0, 0, 22, 9, 0, 9},
+    {0, 18, 0, 0, 0, 7, 9, 0, 9},
+    {15, 0, 0, 0, 0, 7, 9, 0, 9},
+    {0, 0, 0, 0, 0, 9, 9, 0, 9},
+    {0, 0, 0, 0, 0, 14, 9, 0, 9},
+    {0, 0, 0, 0, 0, 9, 9, 0, 9},
+    {0, 25, 23, 25, 17, 0, 23, 0, 17},
+    {25, 0, 25, 17, 17, 0, 26, 0, 26},
+    {0, 0, 23, 9, 9, 0, 9, 0, 9},
+    {0, 0, 0, 9, 9, 0, 9, 0, 17},
+    {23, 25, 0, 26, 26, 0, 17, 0, 17},
+    {0, 17, 0, 9, 9, 0, 9, 0, 9},
+    {0, 0, 0, 9, 15, 0, 9, 0, 9},
+    {23, 0, 0, 9, 9, 0, 9, 0, 9},
+    {0, 0, 0, 17, 17, 0, 17, 0, 17},
+    {0, 0, 7, 0, 15, 0, 9, 0, 9},
+    {0, 7, 0, 0, 15, 0, 9, 0, 9},
+    {7, 0, 0, 0, 15, 0, 9, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {25, 17, 26, 0, 17, 0, 25, 0, 26},
+    {0, 9, 9, 0, 9, 0, 23, 0, 9},
+    {0, 0, 9, 0, 15, 0, 7, 0, 9},
+    {22, 0, 22, 0, 17, 0, 22, 0, 15},
+    {0, 0, 17, 0, 17, 0, 17, 0, 18},
+    {0, 9, 0, 0, 9, 0, 7, 0, 15},
+    {9, 0, 0, 0, 9, 0, 9, 0, 18},
+    {0, 0, 0, 0, 9, 0, 15, 0, 7},
+    {22, 22, 0, 0, 22, 0, 22, 0, 17},
+    {0, 17, 0, 0, 18, 0, 17, 0, 18},
+    {9, 0, 0, 0, 18, 0, 9, 0, 9},
+    {0, 0, 0, 0, 7, 0, 15, 0, 9},
+    {0, 0, 0, 0, 14, 0, 14, 0, 15},
+    {0, 0, 7, 15, 0, 0, 9, 0, 9},
+    {0, 7, 0, 9, 0, 0, 9, 0, 9},
+    {7, 0, 0, 18, 0, 0, 9, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 15, 9, 0, 0, 0, 7, 0, 9},
+    {15, 0, 18, 0, 0, 0, 18, 0, 18},
+    {0, 0, 9, 0, 0, 0, 9, 0, 9},
+    {0, 0, 0, 0, 0, 0, 7, 0, 9},
+    {9, 18, 0, 0, 0, 0, 9, 0, 9},
+    {0, 7, 0, 0, 0, 0, 9, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {14, 0, 0, 0, 0, 0, 9, 0, 9},
+    {0, 0, 0, 0, 0, 0, 9, 0, 10},
+    {17, 17, 26, 17, 0, 0, 26, 0, 26},
+    {0, 9, 9, 9, 0, 0, 9, 0, 15},
+    {0, 0, 15, 15, 0, 0, 15, 0, 7},
+    {22, 0, 22, 17, 0, 0, 22, 0, 15},
+    {0, 0, 17, 17, 0, 0, 18, 0, 18},
+    {0, 9, 0, 9, 0, 0, 9, 0, 7},
+    {9, 0, 0, 9, 0, 0, 9, 0, 18},
+    {0, 0, 0, 9, 0, 0, 9, 0, 7},
+    {9, 9, 0, 9, 0, 0, 22, 0, 9},
+    {0, 17, 0, 18, 0, 0, 7, 0, 18},
+    {15, 0, 0, 18, 0, 0, 7, 0, 15},
+    {0, 0, 0, 9, 0, 0, 9, 0, 9},
+    {0, 0, 0, 9, 0, 0, 15, 0, 9},
+    {0, 15, 15, 0, 0, 0, 15, 0, 7},
+    {15, 0, 15, 0, 0, 0, 18, 0, 18},
+    {0, 0, 9, 0, 0, 0, 9, 0, 9},
+    {0, 0, 0, 0, 0, 0, 9, 0, 7},
+    {15, 15, 0, 0, 0, 0, 7, 0, 15},
+    {0, 9, 0, 0, 0, 0, 9, 0, 9},
+    {0, 0, 0, 0, 0, 0, 7, 0, 7},
+    {9, 0, 0, 0, 0, 0, 9, 0, 9},
+    {0, 0, 0, 0, 0, 0, 7, 0, 9},
+    {22, 17, 22, 0, 0, 0, 22, 0, 15},
+    {0, 17, 18, 0, 0, 0, 17, 0, 18},
+    {15, 0, 18, 0, 0, 0, 15, 0, 18},
+    {0, 0, 9, 0, 0, 0, 9, 0, 9},
+    {0, 0, 14, 0, 0, 0, 14, 0, 15},
+    {9, 9, 0, 0, 0, 0, 9, 0, 18},
+    {0, 9, 0, 0, 0, 0, 9, 0, 7},
+    {0, 0, 0, 0, 0, 0, 7, 0, 7},
+    {14, 0, 0, 0, 0, 0, 14, 0, 7},
+    {0, 0, 0, 0, 0, 0, 9, 0, 10},
+    {0, 9, 0, 0, 0, 0, 14, 0, 9},
+    {9, 0, 0, 0, 0, 0, 14, 0, 9},
+    {0, 0, 0, 0, 0, 0, 7, 0, 10},
+    {30, 25, 30, 30, 23, 0, 25, 0, 23},
+    {0, 17, 17, 17, 26, 0, 17, 0, 25},
+    {9, 0, 9, 9, 23, 0, 9, 0, 9},
+    {0, 0, 17, 22, 7, 0, 15, 0, 15},
+    {0, 0, 22, 22, 22, 0, 15, 0, 15},
+    {17, 17, 0, 17, 26, 0, 17, 0, 17},
+    {0, 17, 0, 22, 15, 0, 15, 0, 22},
+    {0, 0, 0, 9, 15, 0, 9, 0, 9},
+    {22, 0, 0, 22, 22, 0, 15, 0, 22},
+    {0, 0, 0, 17, 18, 0, 18, 0, 17},
+    {0, 9, 0, 9, 9, 0, 9, 0, 15},
+    {9, 0, 0, 9, 7, 0, 9, 0, 15},
+    {0, 0, 0, 9, 15, 0, 9, 0, 7},
+    {26, 17, 25, 0, 17, 0, 26, 0, 25},
+    {0, 22, 22, 0, 22, 0, 17, 0, 22},
+    {0, 0, 9, 0, 18, 0, 9, 0, 9},
+    {22, 0, 22, 0, 17, 0, 15, 0, 22},
+    {0, 0, 9, 0, 9, 0, 18, 0, 9},
+    {0, 17, 0, 0, 18, 0, 18, 0, 17},
+    {17, 0, 0, 0, 17, 0, 18, 0, 17},
+    {0, 0, 0, 0, 14, 0, 15, 0, 14},
+    {9, 9, 0, 0, 9, 0, 9, 0, 23},
+    {0, 9, 0, 0, 9, 0, 15, 0, 7},
+    {9, 0, 0, 0, 15, 0, 9, 0, 7},
+    {0, 0, 0, 0, 7, 0, 9, 0, 15},
+    {0, 0, 0, 0, 9, 0, 7, 0, 15},
+    {0, 9, 9, 0, 15, 0, 9, 0, 9},
+    {9, 0, 9, 0, 7, 0, 9, 0, 9},
+    {0, 0, 9, 0, 7, 0, 9, 0, 9},
+    {9, 9, 0, 0, 15, 0, 9, 0, 9},
+    {0, 17, 0, 0, 7, 0, 9, 0, 9},
+    {9, 0, 0, 0, 7, 0, 9, 0, 9},
+    {0, 0, 0, 0, 7, 0, 9, 0, 9},
+    {0, 0, 0, 0, 15, 0, 9, 0, 9},
+    {0, 0, 0, 0, 7, 0, 9, 0, 9},
+    {9, 17, 9, 9, 0, 0, 9, 0, 9},
+    {0, 7, 15, 22, 0, 0, 15, 0, 15},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {22, 0, 22, 17, 0, 0, 15, 0, 15},
+    {0, 0, 9, 9, 0, 0, 9, 0, 18},
+    {0, 9, 0, 9, 0, 0, 9, 0, 9},
+    {9, 0, 0, 9, 0, 0, 18, 0, 9},
+    {0, 0, 0, 14, 0, 0, 7, 0, 14},
+    {9, 7, 0, 9, 0, 0, 9, 0, 15},
+    {0, 9, 0, 9, 0, 0, 9, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 9, 0, 0, 9, 0, 7},
+    {0, 18, 9, 0, 0, 0, 9, 0, 9},
+    {18, 0, 15, 0, 0, 0, 18, 0, 18},
+    {0, 0, 14, 0, 0, 0, 9, 0, 9},
+    {0, 0, 0, 0, 0, 0, 10, 0, 9},
+    {9, 15, 0, 0, 0, 0, 9, 0, 7},
+    {0, 7, 0, 0, 0, 0, 9, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 0, 0, 0, 0, 0, 9, 0, 9},
+    {0, 0, 0, 0, 0, 0, 9, 0, 7},
+    {15, 7, 15, 0, 0, 0, 15, 0, 15},
+    {0, 9, 9, 0, 0, 0, 9, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 15, 0, 0, 0, 15, 0, 7},
+    {9, 9, 0, 0, 0, 0, 9, 0, 9},
+    {0, 7, 0, 0, 0, 0, 7, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {15, 0, 0, 0, 0, 0, 7, 0, 15},
+    {0, 0, 0, 0, 0, 0, 9, 0, 9},
+    {0, 7, 0, 0, 0, 0, 9, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 22, 0, 0, 9, 0, 9},
+    {9, 0, 9, 17, 0, 0, 9, 0, 9},
+    {0, 0, 15, 7, 0, 0, 9, 0, 9},
+    {9, 9, 0, 22, 0, 0, 9, 0, 9},
+    {0, 18, 0, 7, 0, 0, 9, 0, 9},
+    {15, 0, 0, 7, 0, 0, 9, 0, 9},
+    {0, 0, 0, 9, 0, 0, 9, 0, 9},
+    {0, 0, 0, 14, 0, 0, 9, 0, 9},
+    {0, 0, 0, 9, 0, 0, 9, 0, 9},
+    {22, 17, 22, 0, 0, 0, 15, 0, 22},
+    {0, 9, 9, 0, 0, 0, 18, 0, 9},
+    {18, 0, 15, 0, 0, 0, 18, 0, 15},
+    {0, 0, 9, 0, 0, 0, 9, 0, 14},
+    {0, 0, 14, 0, 0, 0, 7, 0, 14},
+    {18, 17, 0, 0, 0, 0, 18, 0, 17},
+    {0, 9, 0, 0, 0, 0, 9, 0, 14},
+    {0, 0, 0, 0, 0, 0, 10, 0, 7},
+    {14, 0, 0, 0, 0, 0, 15, 0, 14},
+    {0, 0, 0, 0, 0, 0, 10, 0, 9},
+    {0, 9, 0, 0, 0, 0, 7, 0, 9},
+    {9, 0, 0, 0, 0, 0, 9, 0, 9},
+    {0, 0, 0, 0, 0, 0, 7, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 9, 9, 9, 0, 0, 17},
+    {9, 0, 9, 9, 9, 9, 0, 0, 26},
+    {0, 0, 15, 9, 9, 9, 0, 0, 7},
+    {0, 0, 0, 9, 9, 9, 0, 0, 9},
+    {9, 9, 0, 9, 9, 9, 0, 0, 23},
+    {0, 15, 0, 9, 9, 9, 0, 0, 7},
+    {0, 0, 0, 9, 9, 9, 0, 0, 9},
+    {15, 0, 0, 9, 9, 9, 0, 0, 7},
+    {0, 0, 0, 9, 9, 9, 0, 0, 9},
+    {0, 0, 7, 0, 9, 9, 0, 0, 15},
+    {0, 7, 0, 0, 9, 9, 0, 0, 15},
+    {7, 0, 0, 0, 9, 9, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 9, 0, 9, 9, 0, 0, 17},
+    {0, 15, 15, 0, 15, 23, 0, 0, 7},
+    {0, 0, 9, 0, 9, 9, 0, 0, 9},
+    {22, 0, 15, 0, 15, 22, 0, 0, 7},
+    {0, 0, 9, 0, 9, 9, 0, 0, 18},
+    {0, 9, 0, 0, 9, 9, 0, 0, 9},
+    {9, 0, 0, 0, 9, 9, 0, 0, 9},
+    {0, 0, 0, 0, 7, 15, 0, 0, 7},
+    {22, 15, 0, 0, 15, 22, 0, 0, 7},
+    {0, 9, 0, 0, 9, 9, 0, 0, 18},
+    {9, 0, 0, 0, 9, 9, 0, 0, 9},
+    {0, 0, 0, 0, 7, 15, 0, 0, 7},
+    {0, 0, 0, 0, 14, 14, 0, 0, 7},
+    {0, 0, 7, 9, 0, 9, 0, 0, 9},
+    {0, 7, 0, 9, 0, 9, 0, 0, 9},
+    {7, 0, 0, 9, 0, 9, 0, 0, 15},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 0, 0, 9, 0, 0, 9},
+    {9, 0, 9, 0, 0, 9, 0, 0, 9},
+    {0, 0, 7, 0, 0, 9, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 0, 0, 0, 9, 0, 0, 9},
+    {0, 7, 0, 0, 0, 9, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {14, 0, 0, 0, 0, 9, 0, 0, 7},
+    {0, 0, 0, 0, 0, 9, 0, 0, 10},
+    {9, 9, 9, 9, 0, 9, 0, 0, 26},
+    {0, 9, 9, 9, 0, 9, 0, 0, 7},
+    {0, 0, 9, 9, 0, 9, 0, 0, 7},
+    {15, 0, 22, 15, 0, 22, 0, 0, 7},
+    {0, 0, 9, 9, 0, 9, 0, 0, 9},
+    {0, 9, 0, 9, 0, 9, 0, 0, 7},
+    {9, 0, 0, 9, 0, 9, 0, 0, 18},
+    {0, 0, 0, 9, 0, 9, 0, 0, 7},
+    {15, 17, 0, 15, 0, 22, 0, 0, 7},
+    {0, 9, 0, 9, 0, 9, 0, 0, 9},
+    {9, 0, 0, 9, 0, 9, 0, 0, 15},
+    {0, 0, 0, 9, 0, 9, 0, 0, 7},
+    {0, 0, 0, 7, 0, 15, 0, 0, 7},
+    {0, 9, 9, 0, 0, 9, 0, 0, 7},
+    {9, 0, 9, 0, 0, 9, 0, 0, 9},
+    {0, 0, 9, 0, 0, 9, 0, 0, 7},
+    {0, 0, 0, 0, 0, 9, 0, 0, 7},
+    {9, 9, 0, 0, 0, 9, 0, 0, 9},
+    {0, 9, 0, 0, 0, 9, 0, 0, 7},
+    {0, 0, 0, 0, 0, 9, 0, 0, 7},
+    {7, 0, 0, 0, 0, 9, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 9, 0, 0, 22, 0, 0, 7},
+    {0, 9, 9, 0, 0, 7, 0, 0, 18},
+    {9, 0, 9, 0, 0, 7, 0, 0, 15},
+    {0, 0, 9, 0, 0, 9, 0, 0, 7},
+    {0, 0, 9, 0, 0, 14, 0, 0, 7},
+    {9, 9, 0, 0, 0, 7, 0, 0, 15},
+    {0, 9, 0, 0, 0, 9, 0, 0, 7},
+    {0, 0, 0, 0, 0, 7, 0, 0, 7},
+    {9, 0, 0, 0, 0, 14, 0, 0, 7},
+    {0, 0, 0, 0, 0, 7, 0, 0, 10},
+    {0, 9, 0, 0, 0, 14, 0, 0, 7},
+    {9, 0, 0, 0, 0, 14, 0, 0, 7},
+    {0, 0, 0, 0, 0, 7, 0, 0, 10},
+    {0, 0, 7, 9, 9, 0, 0, 0, 15},
+    {0, 7, 0, 9, 9, 0, 0, 0, 15},
+    {7, 0, 0, 9, 9, 0, 0, 0, 18},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 0, 9, 0, 0, 0, 17},
+    {9, 0, 9, 0, 9, 0, 0, 0, 18},
+    {0, 0, 15, 0, 9, 0, 0, 0, 7},
+    {0, 0, 0, 0, 9, 0, 0, 0, 9},
+    {9, 9, 0, 0, 9, 0, 0, 0, 18},
+    {0, 15, 0, 0, 9, 0, 0, 0, 7},
+    {0, 0, 0, 0, 9, 0, 0, 0, 9},
+    {14, 0, 0, 0, 9, 0, 0, 0, 7},
+    {0, 0, 0, 0, 9, 0, 0, 0, 10},
+    {0, 0, 7, 0, 0, 0, 0, 0, 9},
+    {0, 7, 0, 0, 0, 0, 0, 0, 9},
+    {7, 0, 0, 0, 0, 0, 0, 0, 10},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 9, 0, 0, 0, 0, 7},
+    {9, 0, 9, 9, 0, 0, 0, 0, 18},
+    {0, 0, 9, 9, 0, 0, 0, 0, 7},
+    {0, 0, 0, 9, 0, 0, 0, 0, 7},
+    {9, 9, 0, 9, 0, 0, 0, 0, 18},
+    {0, 9, 0, 9, 0, 0, 0, 0, 7},
+    {0, 0, 0, 9, 0, 0, 0, 0, 7},
+    {15, 0, 0, 9, 0, 0, 0, 0, 7},
+    {0, 0, 0, 9, 0, 0, 0, 0, 9},
+    {0, 0, 7, 0, 0, 0, 0, 0, 7},
+    {0, 7, 0, 0, 0, 0, 0, 0, 7},
+    {7, 0, 0, 0, 0, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 9, 0, 0, 0, 0, 0, 18},
+    {0, 9, 9, 0, 0, 0, 0, 0, 7},
+    {0, 0, 9, 0, 0, 0, 0, 0, 7},
+    {14, 0, 14, 0, 0, 0, 0, 0, 7},
+    {0, 0, 9, 0, 0, 0, 0, 0, 10},
+    {0, 9, 0, 0, 0, 0, 0, 0, 7},
+    {9, 0, 0, 0, 0, 0, 0, 0, 10},
+    {0, 0, 0, 0, 0, 0, 0, 0, 7},
+    {14, 14, 0, 0, 0, 0, 0, 0, 7},
+    {0, 9, 0, 0, 0, 0, 0, 0, 10},
+    {9, 0, 0, 0, 0, 0, 0, 0, 10},
+    {0, 0, 0, 0, 0, 0, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 7},
+    {9, 9, 9, 9, 9, 0, 0, 0, 23},
+    {0, 15, 15, 17, 15, 0, 0, 0, 7},
+    {0, 0, 9, 9, 9, 0, 0, 0, 9},
+    {15, 0, 15, 15, 15, 0, 0, 0, 7},
+    {0, 0, 9, 9, 9, 0, 0, 0, 9},
+    {0, 9, 0, 9, 9, 0, 0, 0, 9},
+    {9, 0, 0, 9, 9, 0, 0, 0, 9},
+    {0, 0, 0, 15, 7, 0, 0, 0, 7},
+    {9, 9, 0, 9, 9, 0, 0, 0, 7},
+    {0, 9, 0, 9, 9, 0, 0, 0, 7},
+    {9, 0, 0, 9, 9, 0, 0, 0, 7},
+    {0, 0, 0, 9, 7, 0, 0, 0, 7},
+    {0, 0, 0, 7, 9, 0, 0, 0, 7},
+    {0, 9, 9, 0, 9, 0, 0, 0, 15},
+    {9, 0, 9, 0, 9, 0, 0, 0, 9},
+    {0, 0, 15, 0, 9, 0, 0, 0, 7},
+    {0, 0, 0, 0, 9, 0, 0, 0, 9},
+    {9, 9, 0, 0, 9, 0, 0, 0, 7},
+    {0, 9, 0, 0, 9, 0, 0, 0, 7},
+    {0, 0, 0, 0, 9, 0, 0, 0, 7},
+    {7, 0, 0, 0, 9, 0, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 9, 0, 15, 0, 0, 0, 7},
+    {0, 9, 9, 0, 7, 0, 0, 0, 15},
+    {9, 0, 9, 0, 7, 0, 0, 0, 9},
+    {0, 0, 9, 0, 7, 0, 0, 0, 7},
+    {0, 0, 9, 0, 15, 0, 0, 0, 7},
+    {9, 9, 0, 0, 7, 0, 0, 0, 9},
+    {0, 9, 0, 0, 7, 0, 0, 0, 7},
+    {0, 0, 0, 0, 7, 0, 0, 0, 9},
+    {9, 0, 0, 0, 7, 0, 0, 0, 7},
+    {0, 0, 0, 0, 7, 0, 0, 0, 9},
+    {0, 9, 0, 0, 9, 0, 0, 0, 7},
+    {9, 0, 0, 0, 7, 0, 0, 0, 7},
+    {0, 0, 0, 0, 7, 0, 0, 0, 7},
+    {0, 9, 9, 9, 0, 0, 0, 0, 9},
+    {9, 0, 9, 9, 0, 0, 0, 0, 9},
+    {0, 0, 7, 9, 0, 0, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 0, 9, 0, 0, 0, 0, 7},
+    {0, 7, 0, 9, 0, 0, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 0, 0, 9, 0, 0, 0, 0, 7},
+    {0, 0, 0, 9, 0, 0, 0, 0, 7},
+    {0, 0, 7, 0, 0, 0, 0, 0, 9},
+    {0, 7, 0, 0, 0, 0, 0, 0, 7},
+    {7, 0, 0, 0, 0, 0, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 9, 0, 0, 0, 0, 0, 9},
+    {0, 7, 7, 0, 0, 0, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {15, 0, 7, 0, 0, 0, 0, 0, 7},
+    {0, 0, 9, 0, 0, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 7, 0, 0, 0, 0, 0, 0, 7},
+    {0, 9, 0, 0, 0, 0, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 7},
+    {9, 9, 9, 15, 0, 0, 0, 0, 7},
+    {0, 9, 9, 7, 0, 0, 0, 0, 9},
+    {9, 0, 9, 7, 0, 0, 0, 0, 15},
+    {0, 0, 9, 9, 0, 0, 0, 0, 7},
+    {0, 0, 9, 7, 0, 0, 0, 0, 7},
+    {9, 9, 0, 7, 0, 0, 0, 0, 15},
+    {0, 9, 0, 9, 0, 0, 0, 0, 7},
+    {0, 0, 0, 7, 0, 0, 0, 0, 7},
+    {9, 0, 0, 15, 0, 0, 0, 0, 7},
+    {0, 0, 0, 7, 0, 0, 0, 0, 9},
+    {0, 9, 0, 7, 0, 0, 0, 0, 7},
+    {9, 0, 0, 9, 0, 0, 0, 0, 7},
+    {0, 0, 0, 7, 0, 0, 0, 0, 7},
+    {9, 9, 9, 0, 0, 0, 0, 0, 9},
+    {0, 9, 9, 0, 0, 0, 0, 0, 7},
+    {0, 0, 9, 0, 0, 0, 0, 0, 7},
+    {7, 0, 15, 0, 0, 0, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 0, 0, 0, 0, 0, 0, 7},
+    {9, 0, 0, 0, 0, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 7},
+    {7, 9, 0, 0, 0, 0, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 0, 0, 0, 0, 0, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {30, 25, 30, 30, 30, 25, 0, 0, 25},
+    {0, 26, 17, 17, 26, 17, 0, 0, 17},
+    {9, 0, 9, 9, 23, 9, 0, 0, 9},
+    {0, 0, 9, 17, 7, 9, 0, 0, 9},
+    {0, 0, 22, 22, 22, 22, 0, 0, 22},
+    {26, 26, 0, 25, 26, 17, 0, 0, 17},
+    {0, 9, 0, 22, 9, 9, 0, 0, 9},
+    {0, 0, 0, 7, 15, 9, 0, 0, 9},
+    {22, 0, 0, 22, 22, 22, 0, 0, 22},
+    {0, 0, 0, 17, 18, 18, 0, 0, 18},
+    {0, 9, 0, 9, 15, 9, 0, 0, 9},
+    {9, 0, 0, 9, 7, 9, 0, 0, 9},
+    {0, 0, 0, 9, 7, 9, 0, 0, 9},
+    {17, 26, 17, 0, 26, 26, 0, 0, 17},
+    {0, 17, 22, 0, 15, 17, 0, 0, 17},
+    {0, 0, 9, 0, 15, 9, 0, 0, 9},
+    {22, 0, 22, 0, 22, 22, 0, 0, 17},
+    {0, 0, 17, 0, 18, 18, 0, 0, 18},
+    {0, 17, 0, 0, 18, 18, 0, 0, 17},
+    {17, 0, 0, 0, 18, 18, 0, 0, 18},
+    {0, 0, 0, 0, 14, 15, 0, 0, 14},
+    {9, 9, 0, 0, 15, 9, 0, 0, 9},
+    {0, 17, 0, 0, 7, 15, 0, 0, 15},
+    {9, 0, 0, 0, 7, 9, 0, 0, 9},
+    {0, 0, 0, 0, 7, 9, 0, 0, 9},
+    {0, 0, 0, 0, 15, 9, 0, 0, 9},
+    {0, 15, 23, 0, 15, 23, 0, 0, 17},
+    {15, 0, 9, 0, 7, 9, 0, 0, 9},
+    {0, 0, 9, 0, 9, 9, 0, 0, 9},
+    {23, 9, 0, 0, 9, 9, 0, 0, 9},
+    {0, 17, 0, 0, 9, 9, 0, 0, 9},
+    {7, 0, 0, 0, 9, 9, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 14, 14, 0, 0, 15},
+    {0, 0, 0, 0, 7, 9, 0, 0, 9},
+    {9, 26, 9, 9, 0, 9, 0, 0, 9},
+    {0, 7, 9, 15, 0, 9, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {22, 0, 22, 22, 0, 22, 0, 0, 17},
+    {0, 0, 9, 9, 0, 9, 0, 0, 18},
+    {0, 18, 0, 7, 0, 9, 0, 0, 9},
+    {18, 0, 0, 18, 0, 18, 0, 0, 18},
+    {0, 0, 0, 14, 0, 9, 0, 0, 9},
+    {15, 7, 0, 15, 0, 15, 0, 0, 15},
+    {0, 9, 0, 9, 0, 9, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 15, 0, 15, 0, 0, 7},
+    {0, 9, 9, 0, 0, 9, 0, 0, 9},
+    {9, 0, 9, 0, 0, 18, 0, 0, 9},
+    {0, 0, 14, 0, 0, 7, 0, 0, 9},
+    {0, 0, 0, 0, 0, 10, 0, 0, 9},
+    {9, 9, 0, 0, 0, 9, 0, 0, 9},
+    {0, 7, 0, 0, 0, 7, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {15, 0, 0, 0, 0, 7, 0, 0, 9},
+    {0, 0, 0, 0, 0, 9, 0, 0, 9},
+    {15, 7, 9, 0, 0, 9, 0, 0, 9},
+    {0, 9, 9, 0, 0, 9, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 14, 0, 0, 14, 0, 0, 7},
+    {7, 18, 0, 0, 0, 9, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {14, 0, 0, 0, 0, 9, 0, 0, 9},
+    {0, 0, 0, 0, 0, 9, 0, 0, 10},
+    {0, 7, 0, 0, 0, 15, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 22, 9, 0, 9, 0, 0, 9},
+    {9, 0, 17, 9, 0, 9, 0, 0, 9},
+    {0, 0, 7, 9, 0, 9, 0, 0, 9},
+    {22, 17, 0, 22, 0, 22, 0, 0, 22},
+    {0, 18, 0, 9, 0, 9, 0, 0, 9},
+    {15, 0, 0, 9, 0, 9, 0, 0, 9},
+    {0, 0, 0, 9, 0, 9, 0, 0, 9},
+    {0, 0, 0, 14, 0, 14, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 22, 0, 0, 9, 0, 0, 9},
+    {0, 18, 7, 0, 0, 18, 0, 0, 18},
+    {15, 0, 7, 0, 0, 18, 0, 0, 15},
+    {0, 0, 9, 0, 0, 9, 0, 0, 9},
+    {0, 0, 14, 0, 0, 9, 0, 0, 9},
+    {18, 18, 0, 0, 0, 18, 0, 0, 18},
+    {0, 9, 0, 0, 0, 9, 0, 0, 14},
+    {0, 0, 0, 0, 0, 10, 0, 0, 7},
+    {14, 0, 0, 0, 0, 14, 0, 0, 14},
+    {0, 0, 0, 0, 0, 10, 0, 0, 10},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 9, 0, 0, 9},
+    {0, 7, 0, 0, 0, 15, 0, 0, 9},
+    {7, 0, 0, 0, 0, 9, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {23, 26, 17, 25, 26, 0, 0, 0, 17},
+    {0, 9, 9, 17, 9, 0, 0, 0, 9},
+    {0, 0, 9, 7, 15, 0, 0, 0, 9},
+    {22, 0, 22, 22, 22, 0, 0, 0, 17},
+    {0, 0, 17, 17, 18, 0, 0, 0, 18},
+    {0, 9, 0, 7, 9, 0, 0, 0, 15},
+    {9, 0, 0, 9, 9, 0, 0, 0, 18},
+    {0, 0, 0, 15, 9, 0, 0, 0, 7},
+    {9, 9, 0, 9, 15, 0, 0, 0, 9},
+    {0, 17, 0, 17, 7, 0, 0, 0, 17},
+    {9, 0, 0, 9, 7, 0, 0, 0, 9},
+    {0, 0, 0, 9, 7, 0, 0, 0, 9},
+    {0, 0, 0, 9, 15, 0, 0, 0, 9},
+    {0, 9, 9, 0, 15, 0, 0, 0, 9},
+    {9, 0, 9, 0, 18, 0, 0, 0, 9},
+    {0, 0, 15, 0, 7, 0, 0, 0, 9},
+    {0, 0, 0, 0, 9, 0, 0, 0, 9},
+    {9, 9, 0, 0, 7, 0, 0, 0, 9},
+    {0, 9, 0, 0, 7, 0, 0, 0, 9},
+    {0, 0, 0, 0, 7, 0, 0, 0, 9},
+    {9, 0, 0, 0, 7, 0, 0, 0, 9},
+    {0, 0, 0, 0, 7, 0, 0, 0, 9},
+    {23, 9, 9, 0, 9, 0, 0, 0, 9},
+    {0, 17, 17, 0, 17, 0, 0, 0, 17},
+    {7, 0, 9, 0, 15, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 14, 0, 14, 0, 0, 0, 15},
+    {7, 9, 0, 0, 9, 0, 0, 0, 18},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {14, 0, 0, 0, 9, 0, 0, 0, 7},
+    {0, 0, 0, 0, 9, 0, 0, 0, 10},
+    {0, 9, 0, 0, 15, 0, 0, 0, 9},
+    {9, 0, 0, 0, 7, 0, 0, 0, 9},
+    {0, 0, 0, 0, 7, 0, 0, 0, 9},
+    {0, 9, 9, 7, 0, 0, 0, 0, 9},
+    {9, 0, 9, 18, 0, 0, 0, 0, 9},
+    {0, 0, 9, 7, 0, 0, 0, 0, 9},
+    {0, 0, 0, 7, 0, 0, 0, 0, 9},
+    {9, 9, 0, 9, 0, 0, 0, 0, 9},
+    {0, 7, 0, 7, 0, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {15, 0, 0, 7, 0, 0, 0, 0, 9},
+    {0, 0, 0, 9, 0, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 18, 9, 0, 0, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {14, 0, 9, 0, 0, 0, 0, 0, 9},
+    {0, 0, 9, 0, 0, 0, 0, 0, 10},
+    {7, 0, 0, 0, 0, 0, 0, 0, 10},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {15, 7, 0, 0, 0, 0, 0, 0, 9},
+    {0, 9, 0, 0, 0, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 7},
+    {9, 9, 22, 9, 0, 0, 0, 0, 9},
+    {0, 18, 7, 17, 0, 0, 0, 0, 18},
+    {15, 0, 7, 15, 0, 0, 0, 0, 15},
+    {0, 0, 9, 9, 0, 0, 0, 0, 9},
+    {0, 0, 14, 9, 0, 0, 0, 0, 9},
+    {9, 9, 0, 9, 0, 0, 0, 0, 18},
+    {0, 9, 0, 9, 0, 0, 0, 0, 7},
+    {0, 0, 0, 7, 0, 0, 0, 0, 7},
+    {14, 0, 0, 14, 0, 0, 0, 0, 7},
+    {0, 0, 0, 9, 0, 0, 0, 0, 10},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {15, 18, 7, 0, 0, 0, 0, 0, 15},
+    {0, 9, 9, 0, 0, 0, 0, 0, 9},
+    {0, 0, 7, 0, 0, 0, 0, 0, 7},
+    {9, 0, 14, 0, 0, 0, 0, 0, 9},
+    {0, 0, 7, 0, 0, 0, 0, 0, 10},
+    {0, 9, 0, 0, 0, 0, 0, 0, 7},
+    {9, 0, 0, 0, 0, 0, 0, 0, 10},
+    {0, 0, 0, 0, 0, 0, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 15, 0, 0, 0, 0, 0, 9},
+    {9, 0, 9, 0, 0, 0, 0, 0, 9},
+    {0, 0, 7, 0, 0, 0, 0, 0, 9},
+    {15, 9, 0, 0, 0, 0, 0, 0, 7},
+    {0, 9, 0, 0, 0, 0, 0, 0, 9},
+    {7, 0, 0, 0, 0, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 15, 22, 17, 15, 0, 0, 0, 17},
+    {15, 0, 15, 22, 7, 0, 0, 0, 17},
+    {0, 0, 9, 9, 9, 0, 0, 0, 9},
+    {22, 15, 0, 22, 22, 0, 0, 0, 17},
+    {0, 18, 0, 9, 9, 0, 0, 0, 9},
+    {9, 0, 0, 9, 9, 0, 0, 0, 9},
+    {0, 0, 0, 14, 7, 0, 0, 0, 9},
+    {0, 0, 0, 14, 14, 0, 0, 0, 14},
+    {0, 0, 0, 9, 7, 0, 0, 0, 9},
+    {17, 22, 22, 0, 22, 0, 0, 0, 22},
+    {0, 18, 15, 0, 18, 0, 0, 0, 18},
+    {9, 0, 9, 0, 18, 0, 0, 0, 9},
+    {0, 0, 14, 0, 7, 0, 0, 0, 14},
+    {0, 0, 14, 0, 14, 0, 0, 0, 14},
+    {18, 18, 0, 0, 18, 0, 0, 0, 17},
+    {0, 14, 0, 0, 14, 0, 0, 0, 14},
+    {0, 0, 0, 0, 10, 0, 0, 0, 9},
+    {14, 0, 0, 0, 14, 0, 0, 0, 14},
+    {0, 0, 0, 0, 10, 0, 0, 0, 10},
+    {0, 9, 0, 0, 9, 0, 0, 0, 9},
+    {9, 0, 0, 0, 7, 0, 0, 0, 9},
+    {0, 0, 0, 0, 7, 0, 0, 0, 7},
+    {0, 0, 7, 0, 7, 0, 0, 0, 9},
+    {0, 7, 0, 0, 15, 0, 0, 0, 9},
+    {7, 0, 0, 0, 7, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {15, 7, 22, 22, 0, 0, 0, 0, 15},
+    {0, 9, 9, 9, 0, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 14, 14, 0, 0, 0, 0, 7},
+    {9, 18, 0, 9, 0, 0, 0, 0, 9},
+    {0, 7, 0, 14, 0, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {14, 0, 0, 14, 0, 0, 0, 0, 14},
+    {0, 0, 0, 9, 0, 0, 0, 0, 10},
+    {0, 7, 0, 9, 0, 0, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 18, 9, 0, 0, 0, 0, 0, 9},
+    {0, 7, 14, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {14, 0, 14, 0, 0, 0, 0, 0, 14},
+    {0, 0, 9, 0, 0, 0, 0, 0, 10},
+    {0, 10, 0, 0, 0, 0, 0, 0, 9},
+    {10, 0, 0, 0, 0, 0, 0, 0, 10},
+    {0, 0, 0, 0, 0, 0, 0, 0, 6},
+    {9, 7, 0, 0, 0, 0, 0, 0, 15},
+    {0, 9, 0, 0, 0, 0, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 7},
+    {0, 7, 15, 0, 0, 0, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {15, 7, 0, 0, 0, 0, 0, 0, 9},
+    {0, 9, 0, 0, 0, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 7},
+    {0, 0, 7, 9, 0, 0, 0, 0, 9},
+    {0, 7, 0, 14, 0, 0, 0, 0, 9},
+    {7, 0, 0, 14, 0, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 14, 0, 0, 0, 0, 0, 9},
+    {9, 0, 14, 0, 0, 0, 0, 0, 9},
+    {0, 0, 7, 0, 0, 0, 0, 0, 9},
+    {14, 14, 0, 0, 0, 0, 0, 0, 14},
+    {0, 10, 0, 0, 0, 0, 0, 0, 9},
+    {10, 0, 0, 0, 0, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 30, 23, 25, 23, 30, 23, 0, 30},
+    {30, 0, 30, 30, 30, 30, 30, 0, 30},
+    {0, 0, 26, 9, 9, 9, 9, 0, 9},
+    {23, 30, 0, 30, 23, 25, 30, 0, 23},
+    {0, 17, 0, 9, 9, 9, 9, 0, 9},
+    {26, 0, 0, 9, 9, 9, 9, 0, 9},
+    {0, 0, 0, 17, 17, 17, 22, 0, 22},
+    {0, 0, 0, 9, 15, 9, 9, 0, 9},
+    {0, 0, 0, 17, 17, 17, 22, 0, 22},
+    {25, 30, 30, 0, 23, 25, 23, 0, 30},
+    {0, 9, 9, 0, 9, 9, 23, 0, 9},
+    {26, 0, 26, 0, 17, 17, 25, 0, 25},
+    {0, 0, 17, 0, 22, 22, 22, 0, 22},
+    {0, 0, 9, 0, 15, 9, 7, 0, 9},
+    {17, 17, 0, 0, 26, 17, 25, 0, 17},
+    {0, 17, 0, 0, 15, 15, 17, 0, 22},
+    {0, 0, 0, 0, 18, 18, 18, 0, 15},
+    {9, 0, 0, 0, 15, 9, 9, 0, 9},
+    {0, 0, 0, 0, 7, 9, 15, 0, 9},
+    {0, 17, 0, 0, 15, 15, 7, 0, 15},
+    {17, 0, 0, 0, 22, 22, 22, 0, 22},
+    {0, 0, 0, 0, 9, 9, 15, 0, 9},
+    {0, 0, 7, 0, 15, 22, 22, 0, 15},
+    {0, 7, 0, 0, 15, 15, 15, 0, 15},
+    {7, 0, 0, 0, 15, 15, 15, 0, 15},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {23, 30, 23, 23, 0, 23, 23, 0, 23},
+    {0, 9, 9, 9, 0, 9, 9, 0, 17},
+    {26, 0, 26, 17, 0, 17, 26, 0, 26},
+    {0, 0, 17, 22, 0, 22, 22, 0, 22},
+    {0, 0, 15, 15, 0, 15, 15, 0, 7},
+    {9, 9, 0, 9, 0, 9, 17, 0, 9},
+    {0, 17, 0, 15, 0, 15, 7, 0, 15},
+    {0, 0, 0, 9, 0, 9, 15, 0, 9},
+    {15, 0, 0, 15, 0, 15, 7, 0, 15},
+    {0, 0, 0, 9, 0, 9, 9, 0, 9},
+    {0, 17, 0, 15, 0, 15, 15, 0, 7},
+    {17, 0, 0, 22, 0, 22, 22, 0, 22},
+    {0, 0, 0, 9, 0, 9, 9, 0, 15},
+    {9, 9, 9, 0, 0, 17, 9, 0, 9},
+    {0, 22, 15, 0, 0, 7, 15, 0, 22},
+    {0, 0, 9, 0, 0, 18, 9, 0, 9},
+    {15, 0, 15, 0, 0, 7, 15, 0, 15},
+    {0, 0, 9, 0, 0, 9, 9, 0, 9},
+    {0, 9, 0, 0, 0, 9, 9, 0, 9},
+    {9, 0, 0, 0, 0, 9, 9, 0, 9},
+    {0, 0, 0, 0, 0, 7, 7, 0, 15},
+    {15, 22, 0, 0, 0, 7, 15, 0, 15},
+    {0, 9, 0, 0, 0, 9, 9, 0, 9},
+    {9, 0, 0, 0, 0, 18, 9, 0, 9},
+    {0, 0, 0, 0, 0, 7, 14, 0, 14},
+    {0, 0, 0, 0, 0, 7, 7, 0, 7},
+    {0, 15, 15, 0, 0, 22, 15, 0, 7},
+    {15, 0, 15, 0, 0, 17, 22, 0, 22},
+    {0, 0, 9, 0, 0, 9, 9, 0, 9},
+    {15, 15, 0, 0, 0, 15, 7, 0, 15},
+    {0, 9, 0, 0, 0, 9, 9, 0, 9},
+    {9, 0, 0, 0, 0, 9, 9, 0, 9},
+    {0, 0, 0, 0, 0, 9, 7, 0, 9},
+    {0, 0, 0, 0, 0, 15, 7, 0, 7},
+    {0, 0, 0, 0, 0, 14, 14, 0, 7},
+    {0, 0, 7, 15, 0, 22, 15, 0, 22},
+    {0, 7, 0, 9, 0, 9, 9, 0, 9},
+    {7, 0, 0, 22, 0, 15, 22, 0, 15},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 15, 9, 0, 0, 9, 7, 0, 9},
+    {15, 0, 22, 0, 0, 17, 22, 0, 22},
+    {0, 0, 9, 0, 0, 9, 9, 0, 9},
+    {9, 22, 0, 0, 0, 9, 9, 0, 9},
+    {0, 7, 0, 0, 0, 9, 9, 0, 9},
+    {18, 0, 0, 0, 0, 9, 9, 0, 9},
+    {0, 0, 0, 0, 0, 9, 9, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 9, 7, 0, 9},
+    {30, 30, 25, 25, 23, 0, 30, 0, 23},
+    {0, 17, 17, 17, 26, 0, 17, 0, 25},
+    {26, 0, 26, 17, 17, 0, 25, 0, 25},
+    {0, 0, 17, 22, 22, 0, 22, 0, 22},
+    {0, 0, 9, 9, 15, 0, 9, 0, 9},
+    {9, 9, 0, 9, 9, 0, 9, 0, 23},
+    {0, 17, 0, 15, 15, 0, 15, 0, 7},
+    {0, 0, 0, 9, 9, 0, 9, 0, 15},
+    {9, 0, 0, 9, 15, 0, 9, 0, 7},
+    {0, 0, 0, 9, 7, 0, 9, 0, 15},
+    {0, 17, 0, 15, 15, 0, 22, 0, 17},
+    {17, 0, 0, 22, 22, 0, 22, 0, 22},
+    {0, 0, 0, 18, 18, 0, 15, 0, 18},
+    {9, 9, 9, 0, 23, 0, 9, 0, 9},
+    {0, 22, 15, 0, 7, 0, 17, 0, 15},
+    {0, 0, 9, 0, 18, 0, 9, 0, 9},
+    {9, 0, 9, 0, 7, 0, 9, 0, 9},
+    {0, 0, 9, 0, 7, 0, 9, 0, 9},
+    {0, 9, 0, 0, 9, 0, 9, 0, 9},
+    {9, 0, 0, 0, 7, 0, 9, 0, 9},
+    {0, 0, 0, 0, 7, 0, 9, 0, 7},
+    {15, 22, 0, 0, 7, 0, 15, 0, 17},
+    {0, 9, 0, 0, 9, 0, 9, 0, 9},
+    {9, 0, 0, 0, 18, 0, 9, 0, 9},
+    {0, 0, 0, 0, 7, 0, 14, 0, 14},
+    {0, 0, 0, 0, 7, 0, 7, 0, 9},
+    {0, 22, 15, 0, 22, 0, 22, 0, 15},
+    {22, 0, 15, 0, 17, 0, 22, 0, 22},
+    {0, 0, 18, 0, 9, 0, 9, 0, 9},
+    {15, 15, 0, 0, 15, 0, 15, 0, 7},
+    {0, 9, 0, 0, 9, 0, 9, 0, 9},
+    {9, 0, 0, 0, 9, 0, 9, 0, 9},
+    {0, 0, 0, 0, 9, 0, 15, 0, 7},
+    {0, 0, 0, 0, 15, 0, 9, 0, 7},
+    {0, 0, 0, 0, 14, 0, 14, 0, 14},
+    {9, 9, 9, 17, 0, 0, 9, 0, 9},
+    {0, 22, 15, 7, 0, 0, 15, 0, 15},
+    {0, 0, 9, 18, 0, 0, 9, 0, 9},
+    {15, 0, 15, 7, 0, 0, 15, 0, 15},
+    {0, 0, 9, 9, 0, 0, 9, 0, 9},
+    {0, 9, 0, 9, 0, 0, 9, 0, 9},
+    {9, 0, 0, 9, 0, 0, 9, 0, 9},
+    {0, 0, 0, 7, 0, 0, 7, 0, 7},
+    {15, 22, 0, 7, 0, 0, 22, 0, 15},
+    {0, 9, 0, 9, 0, 0, 9, 0, 9},
+    {9, 0, 0, 18, 0, 0, 9, 0, 9},
+    {0, 0, 0, 7, 0, 0, 14, 0, 14},
+    {0, 0, 0, 7, 0, 0, 15, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {22, 17, 15, 0, 0, 0, 22, 0, 15},
+    {0, 9, 9, 0, 0, 0, 9, 0, 18},
+    {18, 0, 18, 0, 0, 0, 15, 0, 18},
+    {0, 0, 9, 0, 0, 0, 14, 0, 9},
+    {0, 0, 15, 0, 0, 0, 15, 0, 7},
+    {9, 9, 0, 0, 0, 0, 9, 0, 9},
+    {0, 9, 0, 0, 0, 0, 7, 0, 7},
+    {0, 0, 0, 0, 0, 0, 7, 0, 9},
+    {15, 0, 0, 0, 0, 0, 7, 0, 7},
+    {0, 0, 0, 0, 0, 0, 9, 0, 9},
+    {0, 14, 0, 0, 0, 0, 14, 0, 7},
+    {14, 0, 0, 0, 0, 0, 14, 0, 14},
+    {0, 0, 0, 0, 0, 0, 9, 0, 10},
+    {0, 22, 9, 9, 0, 0, 9, 0, 9},
+    {22, 0, 15, 17, 0, 0, 22, 0, 22},
+    {0, 0, 18, 9, 0, 0, 9, 0, 9},
+    {9, 15, 0, 9, 0, 0, 9, 0, 7},
+    {0, 7, 0, 9, 0, 0, 9, 0, 9},
+    {9, 0, 0, 9, 0, 0, 9, 0, 9},
+    {0, 0, 0, 9, 0, 0, 9, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 9, 0, 0, 14, 0, 9},
+    {9, 17, 9, 0, 0, 0, 9, 0, 9},
+    {0, 7, 9, 0, 0, 0, 15, 0, 9},
+    {18, 0, 18, 0, 0, 0, 15, 0, 15},
+    {0, 0, 9, 0, 0, 0, 9, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 7, 0, 0, 0, 0, 9, 0, 15},
+    {0, 9, 0, 0, 0, 0, 9, 0, 7},
+    {0, 0, 0, 0, 0, 0, 9, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 0, 0, 0, 0, 7, 0, 9},
+    {9, 0, 0, 0, 0, 0, 14, 0, 9},
+    {0, 0, 0, 0, 0, 0, 7, 0, 9},
+    {0, 0, 7, 0, 0, 0, 14, 0, 14},
+    {0, 7, 0, 0, 0, 0, 9, 0, 7},
+    {7, 0, 0, 0, 0, 0, 15, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 15, 15, 0, 15, 0, 15},
+    {0, 7, 0, 15, 15, 0, 15, 0, 15},
+    {7, 0, 0, 22, 15, 0, 15, 0, 22},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 15, 15, 0, 15, 0, 7, 0, 15},
+    {15, 0, 22, 0, 17, 0, 22, 0, 22},
+    {0, 0, 9, 0, 9, 0, 9, 0, 9},
+    {15, 22, 0, 0, 22, 0, 15, 0, 22},
+    {0, 9, 0, 0, 9, 0, 9, 0, 9},
+    {18, 0, 0, 0, 9, 0, 9, 0, 9},
+    {0, 0, 0, 0, 14, 0, 14, 0, 14},
+    {0, 0, 0, 0, 15, 0, 7, 0, 9},
+    {0, 0, 0, 0, 9, 0, 7, 0, 15},
+    {0, 15, 15, 15, 0, 0, 15, 0, 7},
+    {15, 0, 15, 17, 0, 0, 22, 0, 22},
+    {0, 0, 9, 9, 0, 0, 9, 0, 9},
+    {15, 15, 0, 22, 0, 0, 7, 0, 15},
+    {0, 9, 0, 9, 0, 0, 9, 0, 9},
+    {9, 0, 0, 9, 0, 0, 9, 0, 9},
+    {0, 0, 0, 14, 0, 0, 7, 0, 14},
+    {0, 0, 0, 15, 0, 0, 7, 0, 7},
+    {0, 0, 0, 9, 0, 0, 9, 0, 7},
+    {15, 17, 22, 0, 0, 0, 15, 0, 22},
+    {0, 9, 9, 0, 0, 0, 9, 0, 9},
+    {18, 0, 18, 0, 0, 0, 18, 0, 15},
+    {0, 0, 14, 0, 0, 0, 14, 0, 14},
+    {0, 0, 15, 0, 0, 0, 7, 0, 7},
+    {9, 9, 0, 0, 0, 0, 18, 0, 9},
+    {0, 14, 0, 0, 0, 0, 7, 0, 14},
+    {0, 0, 0, 0, 0, 0, 10, 0, 9},
+    {15, 0, 0, 0, 0, 0, 7, 0, 15},
+    {0, 0, 0, 0, 0, 0, 9, 0, 9},
+    {0, 9, 0, 0, 0, 0, 7, 0, 7},
+    {9, 0, 0, 0, 0, 0, 9, 0, 14},
+    {0, 0, 0, 0, 0, 0, 9, 0, 7},
+    {0, 0, 7, 0, 0, 0, 15, 0, 7},
+    {0, 7, 0, 0, 0, 0, 7, 0, 7},
+    {7, 0, 0, 0, 0, 0, 7, 0, 15},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 0, 7, 0, 15},
+    {0, 7, 0, 0, 0, 0, 7, 0, 9},
+    {7, 0, 0, 0, 0, 0, 14, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {23, 30, 30, 23, 23, 30, 0, 0, 30},
+    {0, 9, 9, 17, 9, 9, 0, 0, 9},
+    {26, 0, 26, 17, 17, 17, 0, 0, 17},
+    {0, 0, 22, 22, 22, 22, 0, 0, 22},
+    {0, 0, 9, 7, 15, 9, 0, 0, 9},
+    {9, 9, 0, 9, 26, 9, 0, 0, 9},
+    {0, 22, 0, 17, 7, 15, 0, 0, 15},
+    {0, 0, 0, 9, 18, 9, 0, 0, 9},
+    {9, 0, 0, 9, 7, 9, 0, 0, 9},
+    {0, 0, 0, 9, 7, 9, 0, 0, 9},
+    {0, 22, 0, 7, 15, 22, 0, 0, 15},
+    {22, 0, 0, 22, 22, 22, 0, 0, 22},
+    {0, 0, 0, 18, 9, 9, 0, 0, 9},
+    {17, 9, 9, 0, 9, 9, 0, 0, 9},
+    {0, 22, 17, 0, 15, 17, 0, 0, 17},
+    {0, 0, 18, 0, 18, 18, 0, 0, 17},
+    {7, 0, 9, 0, 15, 9, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 0, 0, 15, 9, 0, 0, 9},
+    {9, 0, 0, 0, 7, 9, 0, 0, 9},
+    {0, 0, 0, 0, 7, 9, 0, 0, 9},
+    {7, 22, 0, 0, 15, 15, 0, 0, 22},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {18, 0, 0, 0, 9, 9, 0, 0, 9},
+    {0, 0, 0, 0, 14, 14, 0, 0, 14},
+    {0, 22, 15, 0, 15, 22, 0, 0, 17},
+    {22, 0, 15, 0, 22, 22, 0, 0, 22},
+    {0, 0, 18, 0, 9, 9, 0, 0, 9},
+    {15, 15, 0, 0, 7, 15, 0, 0, 15},
+    {0, 9, 0, 0, 9, 9, 0, 0, 9},
+    {9, 0, 0, 0, 9, 9, 0, 0, 9},
+    {0, 0, 0, 0, 7, 15, 0, 0, 15},
+    {0, 0, 0, 0, 7, 9, 0, 0, 9},
+    {0, 0, 0, 0, 14, 14, 0, 0, 14},
+    {9, 9, 17, 9, 0, 9, 0, 0, 9},
+    {0, 22, 7, 15, 0, 15, 0, 0, 22},
+    {0, 0, 18, 9, 0, 9, 0, 0, 9},
+    {15, 0, 7, 15, 0, 15, 0, 0, 15},
+    {0, 0, 9, 9, 0, 9, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {15, 22, 0, 15, 0, 22, 0, 0, 22},
+    {0, 9, 0, 9, 0, 9, 0, 0, 9},
+    {18, 0, 0, 18, 0, 18, 0, 0, 18},
+    {0, 0, 0, 14, 0, 14, 0, 0, 14},
+    {0, 0, 0, 7, 0, 15, 0, 0, 7},
+    {0, 9, 9, 0, 0, 9, 0, 0, 9},
+    {9, 0, 9, 0, 0, 9, 0, 0, 9},
+    {0, 0, 7, 0, 0, 7, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 0, 0, 0, 9, 0, 0, 9},
+    {0, 14, 0, 0, 0, 7, 0, 0, 9},
+    {0, 0, 0, 0, 0, 10, 0, 0, 9},
+    {7, 0, 0, 0, 0, 7, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {15, 22, 7, 0, 0, 22, 0, 0, 15},
+    {0, 9, 9, 0, 0, 9, 0, 0, 9},
+    {9, 0, 18, 0, 0, 9, 0, 0, 9},
+    {0, 0, 7, 0, 0, 14, 0, 0, 14},
+    {0, 0, 7, 0, 0, 15, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 14, 0, 0, 0, 14, 0, 0, 7},
+    {14, 0, 0, 0, 0, 14, 0, 0, 14},
+    {0, 0, 0, 0, 0, 9, 0, 0, 10},
+    {0, 15, 9, 7, 0, 9, 0, 0, 9},
+    {15, 0, 22, 22, 0, 22, 0, 0, 22},
+    {0, 0, 9, 9, 0, 9, 0, 0, 9},
+    {9, 22, 0, 9, 0, 9, 0, 0, 9},
+    {0, 7, 0, 9, 0, 9, 0, 0, 9},
+    {18, 0, 0, 9, 0, 9, 0, 0, 9},
+    {0, 0, 0, 9, 0, 9, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 7, 0, 14, 0, 0, 14},
+    {7, 22, 9, 0, 0, 9, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {18, 0, 9, 0, 0, 9, 0, 0, 9},
+    {0, 0, 9, 0, 0, 9, 0, 0, 14},
+    {15, 7, 0, 0, 0, 9, 0, 0, 9},
+    {0, 9, 0, 0, 0, 9, 0, 0, 9},
+    {0, 0, 0, 0, 0, 10, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 14, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 14, 0, 0, 9},
+    {0, 7, 0, 0, 0, 9, 0, 0, 9},
+    {7, 0, 0, 0, 0, 15, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {17, 17, 17, 17, 26, 0, 0, 0, 17},
+    {0, 22, 15, 17, 15, 0, 0, 0, 22},
+    {0, 0, 18, 17, 18, 0, 0, 0, 17},
+    {9, 0, 9, 9, 15, 0, 0, 0, 9},
+    {0, 0, 9, 17, 7, 0, 0, 0, 9},
+    {0, 9, 0, 9, 9, 0, 0, 0, 9},
+    {9, 0, 0, 9, 7, 0, 0, 0, 9},
+    {0, 0, 0, 9, 7, 0, 0, 0, 7},
+    {22, 22, 0, 15, 22, 0, 0, 0, 17},
+    {0, 9, 0, 18, 9, 0, 0, 0, 9},
+    {18, 0, 0, 18, 18, 0, 0, 0, 17},
+    {0, 0, 0, 14, 14, 0, 0, 0, 14},
+    {0, 0, 0, 7, 15, 0, 0, 0, 9},
+    {0, 9, 9, 0, 15, 0, 0, 0, 9},
+    {9, 0, 9, 0, 7, 0, 0, 0, 9},
+    {0, 0, 9, 0, 7, 0, 0, 0, 9},
+    {0, 0, 0, 0, 7, 0, 0, 0, 9},
+    {9, 9, 0, 0, 9, 0, 0, 0, 9},
+    {0, 14, 0, 0, 7, 0, 0, 0, 9},
+    {0, 0, 0, 0, 10, 0, 0, 0, 9},
+    {7, 0, 0, 0, 7, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {22, 22, 15, 0, 22, 0, 0, 0, 22},
+    {0, 17, 18, 0, 18, 0, 0, 0, 17},
+    {17, 0, 18, 0, 17, 0, 0, 0, 17},
+    {0, 0, 15, 0, 14, 0, 0, 0, 14},
+    {0, 0, 9, 0, 15, 0, 0, 0, 9},
+    {9, 9, 0, 0, 9, 0, 0, 0, 9},
+    {0, 15, 0, 0, 7, 0, 0, 0, 7},
+    {0, 0, 0, 0, 9, 0, 0, 0, 9},
+    {9, 0, 0, 0, 7, 0, 0, 0, 7},
+    {0, 0, 0, 0, 7, 0, 0, 0, 9},
+    {0, 14, 0, 0, 14, 0, 0, 0, 14},
+    {14, 0, 0, 0, 14, 0, 0, 0, 14},
+    {0, 0, 0, 0, 10, 0, 0, 0, 10},
+    {0, 9, 9, 9, 0, 0, 0, 0, 9},
+    {9, 0, 9, 9, 0, 0, 0, 0, 9},
+    {0, 0, 7, 7, 0, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 0, 18, 0, 0, 0, 0, 9},
+    {0, 14, 0, 7, 0, 0, 0, 0, 9},
+    {0, 0, 0, 10, 0, 0, 0, 0, 9},
+    {15, 0, 0, 7, 0, 0, 0, 0, 9},
+    {0, 0, 0, 9, 0, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 18, 0, 0, 0, 0, 0, 9},
+    {0, 14, 7, 0, 0, 0, 0, 0, 14},
+    {0, 0, 10, 0, 0, 0, 0, 0, 9},
+    {15, 0, 7, 0, 0, 0, 0, 0, 15},
+    {0, 0, 9, 0, 0, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {14, 14, 0, 0, 0, 0, 0, 0, 14},
+    {0, 9, 0, 0, 0, 0, 0, 0, 10},
+    {10, 0, 0, 0, 0, 0, 0, 0, 10},
+    {0, 0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 0, 0, 7},
+    {9, 22, 9, 9, 0, 0, 0, 0, 9},
+    {0, 7, 9, 18, 0, 0, 0, 0, 9},
+    {18, 0, 18, 17, 0, 0, 0, 0, 17},
+    {0, 0, 9, 9, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 7, 0, 9, 0, 0, 0, 0, 15},
+    {0, 9, 0, 9, 0, 0, 0, 0, 7},
+    {0, 0, 0, 9, 0, 0, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 14, 0, 7, 0, 0, 0, 0, 9},
+    {14, 0, 0, 14, 0, 0, 0, 0, 14},
+    {0, 0, 0, 10, 0, 0, 0, 0, 9},
+    {15, 7, 9, 0, 0, 0, 0, 0, 9},
+    {0, 9, 9, 0, 0, 0, 0, 0, 9},
+    {0, 0, 10, 0, 0, 0, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 7, 0, 0, 0, 0, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 14, 0, 0, 0, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 0, 0, 0, 0, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 14, 9, 0, 0, 0, 0, 0, 9},
+    {14, 0, 15, 0, 0, 0, 0, 0, 14},
+    {0, 0, 10, 0, 0, 0, 0, 0, 9},
+    {9, 15, 0, 0, 0, 0, 0, 0, 7},
+    {0, 7, 0, 0, 0, 0, 0, 0, 9},
+    {9, 0, 0, 0, 0, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 15, 15, 7, 15, 0, 0, 0, 15},
+    {15, 0, 15, 22, 22, 0, 0, 0, 22},
+    {0, 0, 9, 9, 9, 0, 0, 0, 9},
+    {15, 15, 0, 15, 7, 0, 0, 0, 17},
+    {0, 9, 0, 9, 9, 0, 0, 0, 9},
+    {9, 0, 0, 9, 9, 0, 0, 0, 9},
+    {0, 0, 0, 14, 7, 0, 0, 0, 14},
+    {0, 0, 0, 7, 7, 0, 0, 0, 9},
+    {0, 0, 0, 7, 9, 0, 0, 0, 15},
+    {7, 22, 15, 0, 15, 0, 0, 0, 22},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {18, 0, 9, 0, 9, 0, 0, 0, 9},
+    {0, 0, 14, 0, 14, 0, 0, 0, 14},
+    {9, 9, 0, 0, 9, 0, 0, 0, 9},
+    {0, 14, 0, 0, 7, 0, 0, 0, 14},
+    {0, 0, 0, 0, 10, 0, 0, 0, 9},
+    {7, 0, 0, 0, 7, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 9, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 15, 0, 0, 0, 9},
+    {0, 7, 0, 0, 7, 0, 0, 0, 9},
+    {7, 0, 0, 0, 7, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {15, 22, 7, 15, 0, 0, 0, 0, 15},
+    {0, 9, 9, 9, 0, 0, 0, 0, 9},
+    {9, 0, 18, 9, 0, 0, 0, 0, 9},
+    {0, 0, 7, 14, 0, 0, 0, 0, 14},
+    {0, 0, 7, 7, 0, 0, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 0, 7, 0, 0, 0, 0, 7},
+    {9, 0, 0, 9, 0, 0, 0, 0, 14},
+    {0, 0, 0, 9, 0, 0, 0, 0, 7},
+    {9, 9, 9, 0, 0, 0, 0, 0, 9},
+    {0, 14, 7, 0, 0, 0, 0, 0, 14},
+    {0, 0, 10, 0, 0, 0, 0, 0, 9},
+    {7, 0, 7, 0, 0, 0, 0, 0, 15},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 9, 0, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 0, 0, 0, 0, 0, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 15, 7, 0, 0, 0, 0, 0, 7},
+    {15, 0, 7, 0, 0, 0, 0, 0, 15},
+    {0, 0, 9, 0, 0, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 7},
+    {0, 0, 7, 7, 0, 0, 0, 0, 9},
+    {0, 7, 0, 7, 0, 0, 0, 0, 9},
+    {7, 0, 0, 14, 0, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 14, 0, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 14, 0, 0, 0, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 0, 0, 0, 0, 0, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 7, 9, 9, 9, 0, 0, 15},
+    {0, 7, 0, 9, 9, 9, 0, 0, 15},
+    {7, 0, 0, 9, 9, 9, 0, 0, 15},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 0, 9, 9, 0, 0, 17},
+    {9, 0, 9, 0, 9, 9, 0, 0, 23},
+    {0, 0, 15, 0, 9, 9, 0, 0, 7},
+    {9, 9, 0, 0, 9, 9, 0, 0, 23},
+    {0, 15, 0, 0, 9, 9, 0, 0, 7},
+    {18, 0, 0, 0, 9, 9, 0, 0, 7},
+    {0, 0, 0, 0, 9, 9, 0, 0, 14},
+    {0, 0, 0, 0, 9, 9, 0, 0, 9},
+    {0, 0, 0, 0, 9, 9, 0, 0, 9},
+    {0, 9, 9, 9, 0, 9, 0, 0, 7},
+    {9, 0, 9, 9, 0, 9, 0, 0, 22},
+    {0, 0, 9, 9, 0, 9, 0, 0, 7},
+    {9, 9, 0, 9, 0, 9, 0, 0, 15},
+    {0, 9, 0, 9, 0, 9, 0, 0, 7},
+    {15, 0, 0, 9, 0, 9, 0, 0, 7},
+    {0, 0, 0, 9, 0, 9, 0, 0, 9},
+    {0, 0, 0, 9, 0, 9, 0, 0, 7},
+    {0, 0, 0, 9, 0, 9, 0, 0, 7},
+    {9, 9, 9, 0, 0, 7, 0, 0, 15},
+    {0, 9, 9, 0, 0, 9, 0, 0, 7},
+    {9, 0, 9, 0, 0, 18, 0, 0, 7},
+    {0, 0, 9, 0, 0, 7, 0, 0, 14},
+    {0, 0, 9, 0, 0, 7, 0, 0, 7},
+    {9, 9, 0, 0, 0, 18, 0, 0, 7},
+    {0, 9, 0, 0, 0, 7, 0, 0, 14},
+    {0, 0, 0, 0, 0, 10, 0, 0, 7},
+    {9, 0, 0, 0, 0, 7, 0, 0, 15},
+    {0, 0, 0, 0, 0, 9, 0, 0, 7},
+    {0, 9, 0, 0, 0, 7, 0, 0, 7},
+    {9, 0, 0, 0, 0, 7, 0, 0, 15},
+    {0, 0, 0, 0, 0, 9, 0, 0, 7},
+    {0, 0, 7, 0, 0, 9, 0, 0, 7},
+    {0, 7, 0, 0, 0, 9, 0, 0, 7},
+    {7, 0, 0, 0, 0, 9, 0, 0, 9},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 9, 0, 0, 9},
+    {0, 7, 0, 0, 0, 9, 0, 0, 9},
+    {7, 0, 0, 0, 0, 9, 0, 0, 15},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 9, 9, 0, 0, 0, 15},
+    {9, 0, 9, 9, 9, 0, 0, 0, 23},
+    {0, 0, 15, 9, 9, 0, 0, 0, 7},
+    {9, 9, 0, 9, 9, 0, 0, 0, 7},
+    {0, 9, 0, 9, 9, 0, 0, 0, 7},
+    {9, 0, 0, 9, 9, 0, 0, 0, 7},
+    {0, 0, 0, 9, 9, 0, 0, 0, 7},
+    {0, 0, 0, 9, 9, 0, 0, 0, 7},
+    {0, 0, 0, 9, 9, 0, 0, 0, 9},
+    {9, 9, 9, 0, 7, 0, 0, 0, 15},
+    {0, 9, 9, 0, 15, 0, 0, 0, 7},
+    {9, 0, 9, 0, 15, 0, 0, 0, 7},
+    {0, 0, 9, 0, 7, 0, 0, 0, 15},
+    {0, 0, 9, 0, 7, 0, 0, 0, 9},
+    {9, 9, 0, 0, 9, 0, 0, 0, 7},
+    {0, 9, 0, 0, 7, 0, 0, 0, 7},
+    {0, 0, 0, 0, 9, 0, 0, 0, 7},
+    {9, 0, 0, 0, 7, 0, 0, 0, 7},
+    {0, 0, 0, 0, 7, 0, 0, 0, 7},
+    {0, 9, 0, 0, 7, 0, 0, 0, 9},
+    {9, 0, 0, 0, 7, 0, 0, 0, 9},
+    {0, 0, 0, 0, 7, 0, 0, 0, 7},
+    {0, 0, 7, 0, 9, 0, 0, 0, 15},
+    {0, 7, 0, 0, 9, 0, 0, 0, 7},
+    {7, 0, 0, 0, 9, 0, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 9, 7, 0, 0, 0, 0, 15},
+    {0, 9, 9, 9, 0, 0, 0, 0, 7},
+    {9, 0, 9, 15, 0, 0, 0, 0, 7},
+    {0, 0, 9, 7, 0, 0, 0, 0, 9},
+    {0, 0, 9, 7, 0, 0, 0, 0, 7},
+    {9, 9, 0, 9, 0, 0, 0, 0, 7},
+    {0, 9, 0, 7, 0, 0, 0, 0, 7},
+    {0, 0, 0, 7, 0, 0, 0, 0, 7},
+    {9, 0, 0, 7, 0, 0, 0, 0, 7},
+    {0, 0, 0, 9, 0, 0, 0, 0, 7},
+    {0, 9, 0, 7, 0, 0, 0, 0, 7},
+    {9, 0, 0, 7, 0, 0, 0, 0, 15},
+    {0, 0, 0, 9, 0, 0, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 0, 0, 0, 0, 0, 7},
+    {9, 0, 9, 0, 0, 0, 0, 0, 9},
+    {0, 0, 9, 0, 0, 0, 0, 0, 7},
+    {9, 9, 0, 0, 0, 0, 0, 0, 7},
+    {0, 9, 0, 0, 0, 0, 0, 0, 7},
+    {7, 0, 0, 0, 0, 0, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 7},
+    {0, 0, 7, 9, 0, 0, 0, 0, 9},
+    {0, 7, 0, 9, 0, 0, 0, 0, 7},
+    {7, 0, 0, 9, 0, 0, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 0, 0, 0, 0, 0, 9},
+    {9, 0, 9, 0, 0, 0, 0, 0, 9},
+    {0, 0, 7, 0, 0, 0, 0, 0, 7},
+    {9, 9, 0, 0, 0, 0, 0, 0, 7},
+    {0, 7, 0, 0, 0, 0, 0, 0, 7},
+    {9, 0, 0, 0, 0, 0, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 9, 0, 0, 0, 15},
+    {0, 7, 0, 0, 9, 0, 0, 0, 15},
+    {7, 0, 0, 0, 9, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 9, 0, 0, 0, 0, 7},
+    {0, 7, 0, 9, 0, 0, 0, 0, 7},
+    {7, 0, 0, 9, 0, 0, 0, 0, 14},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 0, 0, 0, 0, 0, 7},
+    {9, 0, 9, 0, 0, 0, 0, 0, 14},
+    {0, 0, 9, 0, 0, 0, 0, 0, 7},
+    {9, 9, 0, 0, 0, 0, 0, 0, 14},
+    {0, 9, 0, 0, 0, 0, 0, 0, 7},
+    {10, 0, 0, 0, 0, 0, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 6},
+    {0, 0, 0, 0, 0, 0, 0, 0, 7},
+    {0, 0, 0, 0, 0, 0, 0, 0, 7},
+    {25, 25, 25, 25, 34, 25, 25, 25, 0},
+    {0, 30, 23, 30, 30, 25, 23, 25, 0},
+    {0, 0, 17, 25, 26, 17, 26, 26, 0},
+    {30, 0, 23, 30, 23, 25, 23, 30, 0},
+    {0, 0, 9, 9, 26, 9, 9, 9, 0},
+    {0, 9, 0, 9, 9, 17, 9, 9, 0},
+    {9, 0, 0, 9, 9, 17, 9, 9, 0},
+    {0, 0, 0, 23, 15, 7, 15, 15, 0},
+    {23, 30, 0, 30, 30, 25, 23, 23, 0},
+    {0, 9, 0, 9, 17, 9, 9, 9, 0},
+    {17, 0, 0, 17, 26, 17, 17, 26, 0},
+    {0, 0, 0, 22, 22, 17, 22, 15, 0},
+    {0, 0, 0, 15, 7, 17, 15, 15, 0},
+    {0, 25, 26, 0, 26, 26, 17, 17, 0},
+    {25, 0, 17, 0, 26, 17, 17, 17, 0},
+    {0, 0, 23, 0, 9, 9, 9, 9, 0},
+    {0, 0, 0, 0, 9, 17, 9, 9, 0},
+    {26, 17, 0, 0, 17, 17, 17, 17, 0},
+    {0, 22, 0, 0, 9, 9, 9, 9, 0},
+    {0, 0, 0, 0, 18, 17, 17, 18, 0},
+    {15, 0, 0, 0, 9, 9, 9, 9, 0},
+    {0, 0, 0, 0, 9, 9, 9, 9, 0},
+    {30, 30, 23, 0, 23, 30, 23, 25, 0},
+    {0, 9, 9, 0, 26, 9, 9, 9, 0},
+    {25, 0, 17, 0, 26, 17, 17, 17, 0},
+    {0, 0, 9, 0, 9, 9, 23, 9, 0},
+    {0, 0, 15, 0, 7, 15, 15, 15, 0},
+    {9, 9, 0, 0, 9, 17, 9, 9, 0},
+    {0, 9, 0, 0, 9, 7, 15, 9, 0},
+    {0, 0, 0, 0, 9, 15, 7, 9, 0},
+    {15, 0, 0, 0, 15, 7, 15, 15, 0},
+    {0, 0, 0, 0, 9, 9, 9, 9, 0},
+    {0, 17, 0, 0, 7, 22, 15, 15, 0},
+    {17, 0, 0, 0, 15, 17, 22, 15, 0},
+    {0, 0, 0, 0, 15, 9, 9, 9, 0},
+    {0, 17, 26, 17, 0, 17, 26, 17, 0},
+    {17, 0, 9, 9, 0, 9, 9, 9, 0},
+    {0, 0, 15, 9, 0, 9, 9, 9, 0},
+    {0, 0, 0, 9, 0, 9, 9, 9, 0},
+    {26, 9, 0, 9, 0, 9, 9, 9, 0},
+    {0, 22, 0, 9, 0, 9, 9, 9, 0},
+    {0, 0, 0, 9, 0, 9, 9, 18, 0},
+    {7, 0, 0, 9, 0, 9, 9, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 18, 9, 9, 0},
+    {0, 7, 0, 0, 0, 18, 9, 9, 0},
+    {7, 0, 0, 0, 0, 9, 9, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {17, 9, 9, 0, 0, 9, 9, 9, 0},
+    {0, 9, 9, 0, 0, 9, 15, 9, 0},
+    {0, 0, 9, 0, 0, 9, 7, 18, 0},
+    {7, 0, 15, 0, 0, 15, 15, 15, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 0, 0, 0, 9, 7, 9, 0},
+    {9, 0, 0, 0, 0, 9, 9, 9, 0},
+    {0, 0, 0, 0, 0, 7, 7, 9, 0},
+    {7, 15, 0, 0, 0, 17, 15, 15, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 0, 0, 0, 0, 9, 9, 9, 0},
+    {0, 0, 0, 0, 0, 9, 14, 7, 0},
+    {30, 30, 30, 30, 0, 30, 30, 30, 0},
+    {0, 26, 17, 26, 0, 26, 17, 26, 0},
+    {26, 0, 26, 26, 0, 26, 17, 17, 0},
+    {0, 0, 22, 22, 0, 22, 22, 17, 0},
+    {0, 0, 9, 9, 0, 9, 9, 22, 0},
+    {9, 9, 0, 9, 0, 26, 9, 9, 0},
+    {0, 22, 0, 22, 0, 7, 15, 15, 0},
+    {0, 0, 0, 9, 0, 18, 9, 9, 0},
+    {9, 0, 0, 9, 0, 7, 9, 15, 0},
+    {0, 0, 0, 9, 0, 15, 9, 7, 0},
+    {0, 9, 0, 9, 0, 9, 15, 9, 0},
+    {9, 0, 0, 9, 0, 9, 22, 9, 0},
+    {0, 0, 0, 15, 0, 15, 7, 18, 0},
+    {26, 26, 17, 0, 0, 17, 26, 26, 0},
+    {0, 22, 22, 0, 0, 17, 22, 22, 0},
+    {0, 0, 18, 0, 0, 18, 18, 18, 0},
+    {9, 0, 9, 0, 0, 9, 9, 22, 0},
+    {0, 0, 9, 0, 0, 9, 15, 7, 0},
+    {0, 9, 0, 0, 0, 18, 9, 9, 0},
+    {9, 0, 0, 0, 0, 18, 9, 7, 0},
+    {0, 0, 0, 0, 0, 7, 9, 15, 0},
+    {9, 9, 0, 0, 0, 9, 15, 9, 0},
+    {0, 9, 0, 0, 0, 9, 7, 9, 0},
+    {18, 0, 0, 0, 0, 17, 7, 18, 0},
+    {0, 0, 0, 0, 0, 9, 14, 9, 0},
+    {0, 0, 0, 0, 0, 9, 7, 9, 0},
+    {0, 9, 9, 0, 0, 22, 9, 9, 0},
+    {9, 0, 9, 0, 0, 22, 9, 9, 0},
+    {0, 0, 15, 0, 0, 7, 9, 9, 0},
+    {9, 9, 0, 0, 0, 7, 9, 9, 0},
+    {0, 9, 0, 0, 0, 7, 9, 9, 0},
+    {9, 0, 0, 0, 0, 7, 9, 9, 0},
+    {0, 0, 0, 0, 0, 7, 9, 9, 0},
+    {0, 0, 0, 0, 0, 7, 9, 9, 0},
+    {0, 0, 0, 0, 0, 9, 9, 9, 0},
+    {0, 9, 23, 9, 9, 0, 9, 9, 0},
+    {9, 0, 23, 9, 9, 0, 9, 9, 0},
+    {0, 0, 7, 9, 9, 0, 9, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {23, 23, 0, 26, 26, 0, 17, 17, 0},
+    {0, 17, 0, 9, 9, 0, 9, 9, 0},
+    {0, 0, 0, 18, 18, 0, 15, 18, 0},
+    {17, 0, 0, 9, 9, 0, 9, 9, 0},
+    {0, 0, 0, 9, 15, 0, 9, 9, 0},
+    {0, 0, 7, 0, 9, 0, 9, 9, 0},
+    {0, 7, 0, 0, 15, 0, 9, 9, 0},
+    {7, 0, 0, 0, 15, 0, 9, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 26, 0, 9, 0, 9, 9, 0},
+    {0, 9, 7, 0, 9, 0, 15, 9, 0},
+    {0, 0, 18, 0, 9, 0, 7, 9, 0},
+    {15, 0, 7, 0, 15, 0, 15, 15, 0},
+    {0, 0, 9, 0, 9, 0, 9, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {22, 17, 0, 0, 17, 0, 22, 17, 0},
+    {0, 9, 0, 0, 18, 0, 9, 9, 0},
+    {18, 0, 0, 0, 18, 0, 15, 18, 0},
+    {0, 0, 0, 0, 9, 0, 14, 9, 0},
+    {0, 0, 0, 0, 7, 0, 15, 15, 0},
+    {0, 0, 7, 9, 0, 0, 9, 9, 0},
+    {0, 7, 0, 15, 0, 0, 9, 9, 0},
+    {7, 0, 0, 9, 0, 0, 9, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 15, 0, 0, 0, 7, 9, 0},
+    {9, 0, 9, 0, 0, 0, 9, 9, 0},
+    {0, 0, 7, 0, 0, 0, 9, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {15, 9, 0, 0, 0, 0, 9, 9, 0},
+    {0, 9, 0, 0, 0, 0, 9, 9, 0},
+    {0, 0, 0, 0, 0, 0, 7, 10, 0},
+    {7, 0, 0, 0, 0, 0, 9, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 26, 9, 0, 0, 9, 9, 0},
+    {0, 22, 7, 17, 0, 0, 15, 15, 0},
+    {0, 0, 18, 9, 0, 0, 9, 9, 0},
+    {9, 0, 7, 9, 0, 0, 9, 15, 0},
+    {0, 0, 15, 9, 0, 0, 9, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 0, 9, 0, 0, 22, 9, 0},
+    {0, 15, 0, 18, 0, 0, 7, 15, 0},
+    {18, 0, 0, 18, 0, 0, 7, 18, 0},
+    {0, 0, 0, 9, 0, 0, 14, 9, 0},
+    {0, 0, 0, 9, 0, 0, 9, 9, 0},
+    {0, 9, 15, 0, 0, 0, 9, 9, 0},
+    {9, 0, 15, 0, 0, 0, 9, 7, 0},
+    {0, 0, 7, 0, 0, 0, 9, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {15, 15, 0, 0, 0, 0, 7, 15, 0},
+    {0, 9, 0, 0, 0, 0, 9, 9, 0},
+    {0, 0, 0, 0, 0, 0, 7, 10, 0},
+    {9, 0, 0, 0, 0, 0, 9, 9, 0},
+    {0, 0, 0, 0, 0, 0, 7, 7, 0},
+    {22, 22, 7, 0, 0, 0, 15, 15, 0},
+    {0, 9, 18, 0, 0, 0, 9, 9, 0},
+    {9, 0, 18, 0, 0, 0, 9, 9, 0},
+    {0, 0, 7, 0, 0, 0, 15, 9, 0},
+    {0, 0, 7, 0, 0, 0, 9, 15, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 0, 0, 0, 0, 14, 9, 0},
+    {9, 0, 0, 0, 0, 0, 14, 9, 0},
+    {0, 0, 0, 0, 0, 0, 7, 10, 0},
+    {30, 30, 30, 30, 23, 0, 23, 23, 0},
+    {0, 9, 9, 9, 26, 0, 9, 9, 0},
+    {17, 0, 17, 17, 26, 0, 17, 17, 0},
+    {0, 0, 17, 22, 22, 0, 22, 15, 0},
+    {0, 0, 17, 15, 7, 0, 15, 15, 0},
+    {17, 17, 0, 17, 26, 0, 17, 17, 0},
+    {0, 17, 0, 22, 22, 0, 15, 22, 0},
+    {0, 0, 0, 15, 18, 0, 18, 18, 0},
+    {17, 0, 0, 22, 15, 0, 15, 22, 0},
+    {0, 0, 0, 9, 15, 0, 9, 9, 0},
+    {0, 17, 0, 15, 7, 0, 15, 15, 0},
+    {17, 0, 0, 23, 15, 0, 23, 15, 0},
+    {0, 0, 0, 9, 15, 0, 9, 9, 0},
+    {26, 17, 17, 0, 17, 0, 26, 17, 0},
+    {0, 22, 22, 0, 22, 0, 22, 22, 0},
+    {0, 0, 17, 0, 18, 0, 18, 18, 0},
+    {15, 0, 22, 0, 22, 0, 15, 22, 0},
+    {0, 0, 9, 0, 9, 0, 9, 9, 0},
+    {0, 17, 0, 0, 18, 0, 18, 18, 0},
+    {17, 0, 0, 0, 18, 0, 18, 17, 0},
+    {0, 0, 0, 0, 14, 0, 15, 14, 0},
+    {15, 23, 0, 0, 22, 0, 15, 23, 0},
+    {0, 9, 0, 0, 9, 0, 9, 9, 0},
+    {17, 0, 0, 0, 17, 0, 17, 17, 0},
+    {0, 0, 0, 0, 14, 0, 14, 15, 0},
+    {0, 0, 0, 0, 7, 0, 7, 15, 0},
+    {0, 9, 9, 0, 7, 0, 9, 9, 0},
+    {9, 0, 9, 0, 15, 0, 9, 9, 0},
+    {0, 0, 9, 0, 7, 0, 9, 9, 0},
+    {9, 9, 0, 0, 15, 0, 9, 9, 0},
+    {0, 9, 0, 0, 7, 0, 9, 9, 0},
+    {15, 0, 0, 0, 7, 0, 9, 9, 0},
+    {0, 0, 0, 0, 9, 0, 9, 9, 0},
+    {0, 0, 0, 0, 7, 0, 9, 9, 0},
+    {0, 0, 0, 0, 7, 0, 9, 9, 0},
+    {17, 9, 9, 9, 0, 0, 9, 9, 0},
+    {0, 22, 22, 22, 0, 0, 15, 15, 0},
+    {0, 0, 9, 9, 0, 0, 9, 18, 0},
+    {7, 0, 15, 22, 0, 0, 15, 15, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 0, 9, 0, 0, 18, 9, 0},
+    {9, 0, 0, 9, 0, 0, 9, 9, 0},
+    {0, 0, 0, 14, 0, 0, 7, 14, 0},
+    {7, 15, 0, 22, 0, 0, 15, 15, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 0, 0, 9, 0, 0, 9, 9, 0},
+    {0, 0, 0, 14, 0, 0, 14, 7, 0},
+    {0, 18, 18, 0, 0, 0, 18, 18, 0},
+    {18, 0, 9, 0, 0, 0, 9, 9, 0},
+    {0, 0, 14, 0, 0, 0, 9, 9, 0},
+    {0, 0, 0, 0, 0, 0, 10, 9, 0},
+    {18, 9, 0, 0, 0, 0, 9, 9, 0},
+    {0, 14, 0, 0, 0, 0, 9, 9, 0},
+    {0, 0, 0, 0, 0, 0, 9, 10, 0},
+    {7, 0, 0, 0, 0, 0, 9, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 15, 15, 0, 0, 0, 15, 15, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 0, 9, 0, 0, 0, 9, 9, 0},
+    {0, 0, 9, 0, 0, 0, 15, 7, 0},
+    {9, 9, 0, 0, 0, 0, 9, 9, 0},
+    {0, 9, 0, 0, 0, 0, 7, 9, 0},
+    {0, 0, 0, 0, 0, 0, 7, 9, 0},
+    {7, 0, 0, 0, 0, 0, 7, 15, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 0, 15, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 22, 0, 0, 9, 9, 0},
+    {9, 0, 9, 22, 0, 0, 9, 9, 0},
+    {0, 0, 15, 7, 0, 0, 9, 9, 0},
+    {9, 9, 0, 22, 0, 0, 9, 9, 0},
+    {0, 15, 0, 7, 0, 0, 9, 9, 0},
+    {18, 0, 0, 7, 0, 0, 9, 9, 0},
+    {0, 0, 0, 14, 0, 0, 9, 9, 0},
+    {0, 0, 0, 9, 0, 0, 9, 9, 0},
+    {0, 0, 0, 9, 0, 0, 9, 9, 0},
+    {22, 22, 22, 0, 0, 0, 15, 22, 0},
+    {0, 9, 9, 0, 0, 0, 18, 9, 0},
+    {18, 0, 17, 0, 0, 0, 18, 17, 0},
+    {0, 0, 14, 0, 0, 0, 14, 14, 0},
+    {0, 0, 9, 0, 0, 0, 7, 14, 0},
+    {18, 18, 0, 0, 0, 0, 18, 18, 0},
+    {0, 14, 0, 0, 0, 0, 14, 14, 0},
+    {0, 0, 0, 0, 0, 0, 10, 10, 0},
+    {9, 0, 0, 0, 0, 0, 9, 14, 0},
+    {0, 0, 0, 0, 0, 0, 10, 7, 0},
+    {0, 9, 0, 0, 0, 0, 7, 9, 0},
+    {9, 0, 0, 0, 0, 0, 15, 9, 0},
+    {0, 0, 0, 0, 0, 0, 7, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 9, 9, 9, 0, 17, 0},
+    {9, 0, 9, 9, 9, 9, 0, 17, 0},
+    {0, 0, 15, 9, 9, 9, 0, 7, 0},
+    {0, 0, 0, 9, 9, 9, 0, 9, 0},
+    {9, 9, 0, 9, 9, 9, 0, 17, 0},
+    {0, 22, 0, 9, 9, 9, 0, 7, 0},
+    {0, 0, 0, 9, 9, 9, 0, 18, 0},
+    {15, 0, 0, 9, 9, 9, 0, 7, 0},
+    {0, 0, 0, 9, 9, 9, 0, 9, 0},
+    {0, 0, 7, 0, 9, 9, 0, 15, 0},
+    {0, 7, 0, 0, 9, 9, 0, 18, 0},
+    {7, 0, 0, 0, 9, 9, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 9, 0, 9, 9, 0, 17, 0},
+    {0, 23, 15, 0, 15, 15, 0, 7, 0},
+    {0, 0, 9, 0, 9, 9, 0, 17, 0},
+    {15, 0, 15, 0, 15, 15, 0, 7, 0},
+    {0, 0, 9, 0, 9, 9, 0, 9, 0},
+    {0, 9, 0, 0, 9, 9, 0, 9, 0},
+    {9, 0, 0, 0, 9, 9, 0, 9, 0},
+    {0, 0, 0, 0, 7, 7, 0, 7, 0},
+    {15, 22, 0, 0, 15, 22, 0, 7, 0},
+    {0, 9, 0, 0, 9, 9, 0, 9, 0},
+    {9, 0, 0, 0, 9, 9, 0, 18, 0},
+    {0, 0, 0, 0, 14, 14, 0, 7, 0},
+    {0, 0, 0, 0, 7, 15, 0, 7, 0},
+    {0, 0, 7, 9, 0, 9, 0, 9, 0},
+    {0, 7, 0, 9, 0, 9, 0, 18, 0},
+    {7, 0, 0, 9, 0, 9, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 0, 0, 9, 0, 9, 0},
+    {9, 0, 9, 0, 0, 9, 0, 9, 0},
+    {0, 0, 7, 0, 0, 9, 0, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 0, 0, 0, 9, 0, 9, 0},
+    {0, 14, 0, 0, 0, 9, 0, 7, 0},
+    {0, 0, 0, 0, 0, 9, 0, 10, 0},
+    {7, 0, 0, 0, 0, 9, 0, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 9, 9, 0, 9, 0, 26, 0},
+    {0, 22, 15, 22, 0, 15, 0, 7, 0},
+    {0, 0, 9, 9, 0, 9, 0, 18, 0},
+    {9, 0, 9, 9, 0, 9, 0, 7, 0},
+    {0, 0, 9, 9, 0, 9, 0, 7, 0},
+    {0, 9, 0, 9, 0, 9, 0, 9, 0},
+    {9, 0, 0, 9, 0, 9, 0, 7, 0},
+    {0, 0, 0, 9, 0, 7, 0, 7, 0},
+    {15, 22, 0, 15, 0, 22, 0, 7, 0},
+    {0, 9, 0, 9, 0, 9, 0, 9, 0},
+    {9, 0, 0, 9, 0, 9, 0, 18, 0},
+    {0, 0, 0, 14, 0, 14, 0, 7, 0},
+    {0, 0, 0, 7, 0, 9, 0, 7, 0},
+    {0, 9, 9, 0, 0, 9, 0, 18, 0},
+    {9, 0, 9, 0, 0, 9, 0, 7, 0},
+    {0, 0, 9, 0, 0, 9, 0, 7, 0},
+    {0, 0, 0, 0, 0, 9, 0, 7, 0},
+    {9, 9, 0, 0, 0, 9, 0, 9, 0},
+    {0, 14, 0, 0, 0, 9, 0, 7, 0},
+    {0, 0, 0, 0, 0, 9, 0, 10, 0},
+    {7, 0, 0, 0, 0, 9, 0, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 9, 0, 0, 15, 0, 7, 0},
+    {0, 9, 9, 0, 0, 7, 0, 15, 0},
+    {9, 0, 9, 0, 0, 7, 0, 18, 0},
+    {0, 0, 9, 0, 0, 15, 0, 7, 0},
+    {0, 0, 9, 0, 0, 9, 0, 7, 0},
+    {9, 9, 0, 0, 0, 7, 0, 9, 0},
+    {0, 9, 0, 0, 0, 7, 0, 7, 0},
+    {0, 0, 0, 0, 0, 7, 0, 9, 0},
+    {9, 0, 0, 0, 0, 7, 0, 7, 0},
+    {0, 0, 0, 0, 0, 7, 0, 7, 0},
+    {0, 9, 0, 0, 0, 14, 0, 7, 0},
+    {9, 0, 0, 0, 0, 14, 0, 7, 0},
+    {0, 0, 0, 0, 0, 7, 0, 10, 0},
+    {0, 0, 7, 9, 9, 0, 0, 9, 0},
+    {0, 7, 0, 9, 9, 0, 0, 18, 0},
+    {7, 0, 0, 9, 9, 0, 0, 15, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 0, 9, 0, 0, 9, 0},
+    {9, 0, 9, 0, 9, 0, 0, 9, 0},
+    {0, 0, 7, 0, 9, 0, 0, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 0, 0, 9, 0, 0, 18, 0},
+    {0, 14, 0, 0, 9, 0, 0, 7, 0},
+    {0, 0, 0, 0, 9, 0, 0, 10, 0},
+    {15, 0, 0, 0, 9, 0, 0, 7, 0},
+    {0, 0, 0, 0, 9, 0, 0, 9, 0},
+    {0, 0, 7, 0, 0, 0, 0, 9, 0},
+    {0, 7, 0, 0, 0, 0, 0, 10, 0},
+    {7, 0, 0, 0, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 9, 0, 0, 0, 9, 0},
+    {9, 0, 9, 9, 0, 0, 0, 7, 0},
+    {0, 0, 7, 9, 0, 0, 0, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 0, 9, 0, 0, 0, 18, 0},
+    {0, 14, 0, 9, 0, 0, 0, 7, 0},
+    {0, 0, 0, 9, 0, 0, 0, 10, 0},
+    {9, 0, 0, 9, 0, 0, 0, 7, 0},
+    {0, 0, 0, 9, 0, 0, 0, 7, 0},
+    {0, 0, 7, 0, 0, 0, 0, 7, 0},
+    {0, 7, 0, 0, 0, 0, 0, 10, 0},
+    {7, 0, 0, 0, 0, 0, 0, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 9, 0, 0, 0, 0, 9, 0},
+    {0, 15, 7, 0, 0, 0, 0, 7, 0},
+    {0, 0, 9, 0, 0, 0, 0, 9, 0},
+    {9, 0, 7, 0, 0, 0, 0, 7, 0},
+    {0, 0, 9, 0, 0, 0, 0, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {14, 14, 0, 0, 0, 0, 0, 7, 0},
+    {0, 9, 0, 0, 0, 0, 0, 10, 0},
+    {9, 0, 0, 0, 0, 0, 0, 10, 0},
+    {0, 0, 0, 0, 0, 0, 0, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 7, 0},
+    {9, 9, 9, 9, 9, 0, 0, 17, 0},
+    {0, 22, 15, 22, 15, 0, 0, 7, 0},
+    {0, 0, 9, 9, 9, 0, 0, 18, 0},
+    {15, 0, 15, 15, 15, 0, 0, 7, 0},
+    {0, 0, 9, 9, 9, 0, 0, 9, 0},
+    {0, 9, 0, 9, 9, 0, 0, 9, 0},
+    {9, 0, 0, 9, 9, 0, 0, 9, 0},
+    {0, 0, 0, 15, 7, 0, 0, 7, 0},
+    {15, 23, 0, 15, 15, 0, 0, 7, 0},
+    {0, 9, 0, 9, 9, 0, 0, 9, 0},
+    {9, 0, 0, 9, 9, 0, 0, 17, 0},
+    {0, 0, 0, 14, 14, 0, 0, 7, 0},
+    {0, 0, 0, 7, 7, 0, 0, 7, 0},
+    {0, 9, 9, 0, 9, 0, 0, 18, 0},
+    {9, 0, 9, 0, 9, 0, 0, 9, 0},
+    {0, 0, 15, 0, 9, 0, 0, 7, 0},
+    {0, 0, 0, 0, 9, 0, 0, 9, 0},
+    {9, 9, 0, 0, 9, 0, 0, 9, 0},
+    {0, 14, 0, 0, 9, 0, 0, 7, 0},
+    {0, 0, 0, 0, 9, 0, 0, 10, 0},
+    {7, 0, 0, 0, 9, 0, 0, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 9, 0, 15, 0, 0, 7, 0},
+    {0, 9, 9, 0, 7, 0, 0, 9, 0},
+    {9, 0, 9, 0, 7, 0, 0, 17, 0},
+    {0, 0, 9, 0, 15, 0, 0, 7, 0},
+    {0, 0, 9, 0, 7, 0, 0, 7, 0},
+    {9, 9, 0, 0, 7, 0, 0, 9, 0},
+    {0, 9, 0, 0, 7, 0, 0, 7, 0},
+    {0, 0, 0, 0, 7, 0, 0, 9, 0},
+    {9, 0, 0, 0, 7, 0, 0, 7, 0},
+    {0, 0, 0, 0, 7, 0, 0, 9, 0},
+    {0, 9, 0, 0, 7, 0, 0, 7, 0},
+    {9, 0, 0, 0, 15, 0, 0, 7, 0},
+    {0, 0, 0, 0, 7, 0, 0, 9, 0},
+    {0, 9, 9, 9, 0, 0, 0, 9, 0},
+    {9, 0, 9, 9, 0, 0, 0, 9, 0},
+    {0, 0, 7, 9, 0, 0, 0, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 0, 9, 0, 0, 0, 9, 0},
+    {0, 14, 0, 9, 0, 0, 0, 7, 0},
+    {0, 0, 0, 9, 0, 0, 0, 10, 0},
+    {7, 0, 0, 9, 0, 0, 0, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 0, 0, 9, 0},
+    {0, 7, 0, 0, 0, 0, 0, 10, 0},
+    {7, 0, 0, 0, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 9, 0, 0, 0, 0, 9, 0},
+    {0, 15, 7, 0, 0, 0, 0, 7, 0},
+    {0, 0, 9, 0, 0, 0, 0, 9, 0},
+    {7, 0, 7, 0, 0, 0, 0, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 15, 0, 0, 0, 0, 0, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 0, 0, 0, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 7, 0},
+    {9, 9, 9, 15, 0, 0, 0, 7, 0},
+    {0, 9, 9, 7, 0, 0, 0, 9, 0},
+    {9, 0, 9, 7, 0, 0, 0, 18, 0},
+    {0, 0, 9, 14, 0, 0, 0, 7, 0},
+    {0, 0, 9, 7, 0, 0, 0, 7, 0},
+    {9, 9, 0, 7, 0, 0, 0, 15, 0},
+    {0, 9, 0, 14, 0, 0, 0, 7, 0},
+    {0, 0, 0, 7, 0, 0, 0, 10, 0},
+    {9, 0, 0, 9, 0, 0, 0, 7, 0},
+    {0, 0, 0, 7, 0, 0, 0, 7, 0},
+    {0, 9, 0, 7, 0, 0, 0, 7, 0},
+    {9, 0, 0, 15, 0, 0, 0, 7, 0},
+    {0, 0, 0, 7, 0, 0, 0, 9, 0},
+    {9, 9, 9, 0, 0, 0, 0, 9, 0},
+    {0, 14, 14, 0, 0, 0, 0, 7, 0},
+    {0, 0, 9, 0, 0, 0, 0, 10, 0},
+    {7, 0, 9, 0, 0, 0, 0, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 0, 0, 0, 0, 0, 10, 0},
+    {9, 0, 0, 0, 0, 0, 0, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 7, 0},
+    {7, 15, 0, 0, 0, 0, 0, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 0, 0, 0, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {23, 30, 23, 30, 30, 23, 0, 25, 0},
+    {0, 9, 9, 9, 17, 9, 0, 9, 0},
+    {26, 0, 17, 17, 17, 17, 0, 17, 0},
+    {0, 0, 9, 22, 9, 9, 0, 9, 0},
+    {0, 0, 15, 17, 7, 15, 0, 22, 0},
+    {9, 9, 0, 9, 9, 17, 0, 9, 0},
+    {0, 9, 0, 22, 9, 7, 0, 9, 0},
+    {0, 0, 0, 7, 9, 18, 0, 9, 0},
+    {15, 0, 0, 22, 15, 7, 0, 22, 0},
+    {0, 0, 0, 9, 9, 9, 0, 9, 0},
+    {0, 9, 0, 9, 7, 9, 0, 9, 0},
+    {9, 0, 0, 9, 15, 9, 0, 9, 0},
+    {0, 0, 0, 9, 7, 9, 0, 9, 0},
+    {17, 17, 17, 0, 26, 26, 0, 17, 0},
+    {0, 22, 22, 0, 22, 15, 0, 17, 0},
+    {0, 0, 17, 0, 18, 18, 0, 17, 0},
+    {17, 0, 22, 0, 15, 15, 0, 17, 0},
+    {0, 0, 9, 0, 15, 9, 0, 9, 0},
+    {0, 9, 0, 0, 9, 18, 0, 9, 0},
+    {9, 0, 0, 0, 9, 18, 0, 9, 0},
+    {0, 0, 0, 0, 14, 7, 0, 14, 0},
+    {9, 9, 0, 0, 15, 9, 0, 9, 0},
+    {0, 9, 0, 0, 7, 9, 0, 9, 0},
+    {17, 0, 0, 0, 7, 17, 0, 17, 0},
+    {0, 0, 0, 0, 15, 9, 0, 9, 0},
+    {0, 0, 0, 0, 7, 9, 0, 9, 0},
+    {0, 15, 15, 0, 7, 15, 0, 17, 0},
+    {15, 0, 9, 0, 9, 9, 0, 9, 0},
+    {0, 0, 9, 0, 9, 9, 0, 9, 0},
+    {15, 9, 0, 0, 9, 7, 0, 9, 0},
+    {0, 9, 0, 0, 9, 9, 0, 9, 0},
+    {7, 0, 0, 0, 9, 9, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 7, 7, 0, 15, 0},
+    {0, 0, 0, 0, 7, 9, 0, 9, 0},
+    {26, 9, 9, 9, 0, 9, 0, 9, 0},
+    {0, 9, 9, 22, 0, 9, 0, 9, 0},
+    {0, 0, 9, 7, 0, 9, 0, 18, 0},
+    {7, 0, 15, 15, 0, 15, 0, 17, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 0, 7, 0, 18, 0, 9, 0},
+    {9, 0, 0, 9, 0, 9, 0, 9, 0},
+    {0, 0, 0, 14, 0, 7, 0, 9, 0},
+    {7, 15, 0, 15, 0, 15, 0, 15, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 0, 0, 9, 0, 9, 0, 9, 0},
+    {0, 0, 0, 15, 0, 9, 0, 7, 0},
+    {0, 9, 9, 0, 0, 18, 0, 9, 0},
+    {9, 0, 9, 0, 0, 9, 0, 9, 0},
+    {0, 0, 14, 0, 0, 7, 0, 9, 0},
+    {0, 0, 0, 0, 0, 10, 0, 9, 0},
+    {9, 9, 0, 0, 0, 9, 0, 9, 0},
+    {0, 15, 0, 0, 0, 7, 0, 9, 0},
+    {0, 0, 0, 0, 0, 9, 0, 9, 0},
+    {7, 0, 0, 0, 0, 7, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 9, 9, 0, 0, 9, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 9, 0, 0, 9, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 9, 0, 0, 0, 9, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 7, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 9, 0, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 15, 9, 0, 9, 0, 9, 0},
+    {9, 0, 15, 9, 0, 9, 0, 9, 0},
+    {0, 0, 7, 9, 0, 9, 0, 9, 0},
+    {15, 15, 0, 22, 0, 7, 0, 22, 0},
+    {0, 9, 0, 9, 0, 9, 0, 9, 0},
+    {9, 0, 0, 9, 0, 9, 0, 9, 0},
+    {0, 0, 0, 14, 0, 7, 0, 9, 0},
+    {0, 0, 0, 9, 0, 7, 0, 14, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 22, 0, 0, 9, 0, 9, 0},
+    {0, 15, 7, 0, 0, 18, 0, 15, 0},
+    {18, 0, 7, 0, 0, 18, 0, 17, 0},
+    {0, 0, 14, 0, 0, 9, 0, 9, 0},
+    {0, 0, 9, 0, 0, 9, 0, 9, 0},
+    {9, 9, 0, 0, 0, 18, 0, 9, 0},
+    {0, 14, 0, 0, 0, 7, 0, 14, 0},
+    {0, 0, 0, 0, 0, 10, 0, 9, 0},
+    {9, 0, 0, 0, 0, 7, 0, 14, 0},
+    {0, 0, 0, 0, 0, 10, 0, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 9, 0, 9, 0},
+    {0, 7, 0, 0, 0, 7, 0, 9, 0},
+    {7, 0, 0, 0, 0, 7, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 17, 9, 9, 0, 0, 9, 0},
+    {0, 9, 7, 15, 9, 0, 0, 9, 0},
+    {0, 0, 15, 7, 9, 0, 0, 9, 0},
+    {15, 0, 7, 15, 15, 0, 0, 17, 0},
+    {0, 0, 9, 9, 9, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 0, 9, 15, 0, 0, 9, 0},
+    {0, 9, 0, 9, 7, 0, 0, 9, 0},
+    {15, 0, 0, 15, 7, 0, 0, 17, 0},
+    {0, 0, 0, 9, 9, 0, 0, 9, 0},
+    {0, 0, 0, 9, 7, 0, 0, 9, 0},
+    {0, 9, 9, 0, 9, 0, 0, 9, 0},
+    {9, 0, 9, 0, 9, 0, 0, 9, 0},
+    {0, 0, 7, 0, 7, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 0, 0, 7, 0, 0, 9, 0},
+    {0, 9, 0, 0, 7, 0, 0, 9, 0},
+    {0, 0, 0, 0, 7, 0, 0, 9, 0},
+    {9, 0, 0, 0, 7, 0, 0, 9, 0},
+    {0, 0, 0, 0, 7, 0, 0, 9, 0},
+    {15, 9, 7, 0, 9, 0, 0, 9, 0},
+    {0, 9, 9, 0, 9, 0, 0, 9, 0},
+    {7, 0, 15, 0, 9, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 7, 0, 0, 15, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 0, 0, 7, 0, 0, 9, 0},
+    {9, 0, 0, 0, 9, 0, 0, 9, 0},
+    {0, 0, 0, 0, 7, 0, 0, 9, 0},
+    {0, 9, 9, 7, 0, 0, 0, 9, 0},
+    {9, 0, 9, 9, 0, 0, 0, 9, 0},
+    {0, 0, 7, 7, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 0, 9, 0, 0, 0, 9, 0},
+    {0, 9, 0, 7, 0, 0, 0, 9, 0},
+    {0, 0, 0, 7, 0, 0, 0, 9, 0},
+    {7, 0, 0, 7, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 9, 9, 0, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 7, 0, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 9, 0, 0, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 7, 9, 0, 0, 0, 9, 0},
+    {0, 9, 7, 9, 0, 0, 0, 9, 0},
+    {9, 0, 7, 9, 0, 0, 0, 9, 0},
+    {0, 0, 7, 9, 0, 0, 0, 9, 0},
+    {0, 0, 7, 9, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 7, 0, 0, 0, 0, 9, 0},
+    {0, 9, 7, 0, 0, 0, 0, 9, 0},
+    {0, 0, 7, 0, 0, 0, 0, 9, 0},
+    {9, 0, 7, 0, 0, 0, 0, 9, 0},
+    {0, 0, 7, 0, 0, 0, 0, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 7, 0, 0, 0, 0, 9, 0},
+    {9, 0, 7, 0, 0, 0, 0, 9, 0},
+    {0, 0, 7, 0, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 15, 15, 22, 7, 0, 0, 17, 0},
+    {15, 0, 22, 22, 15, 0, 0, 17, 0},
+    {0, 0, 9, 9, 9, 0, 0, 9, 0},
+    {15, 22, 0, 22, 22, 0, 0, 17, 0},
+    {0, 9, 0, 9, 9, 0, 0, 9, 0},
+    {18, 0, 0, 9, 9, 0, 0, 9, 0},
+    {0, 0, 0, 14, 9, 0, 0, 9, 0},
+    {0, 0, 0, 14, 7, 0, 0, 14, 0},
+    {0, 0, 0, 9, 7, 0, 0, 9, 0},
+    {22, 22, 22, 0, 22, 0, 0, 22, 0},
+    {0, 9, 9, 0, 18, 0, 0, 9, 0},
+    {18, 0, 17, 0, 18, 0, 0, 17, 0},
+    {0, 0, 14, 0, 14, 0, 0, 14, 0},
+    {0, 0, 14, 0, 7, 0, 0, 14, 0},
+    {18, 18, 0, 0, 18, 0, 0, 17, 0},
+    {0, 14, 0, 0, 14, 0, 0, 14, 0},
+    {0, 0, 0, 0, 10, 0, 0, 10, 0},
+    {14, 0, 0, 0, 14, 0, 0, 14, 0},
+    {0, 0, 0, 0, 10, 0, 0, 9, 0},
+    {0, 9, 0, 0, 7, 0, 0, 9, 0},
+    {9, 0, 0, 0, 15, 0, 0, 9, 0},
+    {0, 0, 0, 0, 7, 0, 0, 9, 0},
+    {0, 0, 7, 0, 7, 0, 0, 9, 0},
+    {0, 7, 0, 0, 7, 0, 0, 9, 0},
+    {7, 0, 0, 0, 9, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 15, 22, 22, 0, 0, 0, 15, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 0, 9, 9, 0, 0, 0, 9, 0},
+    {0, 0, 9, 14, 0, 0, 0, 7, 0},
+    {18, 9, 0, 9, 0, 0, 0, 9, 0},
+    {0, 9, 0, 14, 0, 0, 0, 9, 0},
+    {0, 0, 0, 7, 0, 0, 0, 10, 0},
+    {7, 0, 0, 14, 0, 0, 0, 14, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 15, 0, 0, 0, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {18, 9, 9, 0, 0, 0, 0, 9, 0},
+    {0, 14, 14, 0, 0, 0, 0, 14, 0},
+    {0, 0, 9, 0, 0, 0, 0, 10, 0},
+    {7, 0, 14, 0, 0, 0, 0, 14, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 10, 0, 0, 0, 0, 0, 10, 0},
+    {10, 0, 0, 0, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 6, 0},
+    {7, 15, 0, 0, 0, 0, 0, 15, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 0, 0, 0, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 7, 0},
+    {7, 0, 9, 0, 0, 0, 0, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 9, 0, 0, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 9, 0, 0, 0, 9, 0},
+    {0, 7, 0, 14, 0, 0, 0, 9, 0},
+    {7, 0, 0, 14, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 14, 0, 0, 0, 0, 9, 0},
+    {9, 0, 14, 0, 0, 0, 0, 9, 0},
+    {0, 0, 7, 0, 0, 0, 0, 9, 0},
+    {14, 14, 0, 0, 0, 0, 0, 14, 0},
+    {0, 10, 0, 0, 0, 0, 0, 9, 0},
+    {10, 0, 0, 0, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 6, 0},
+    {0, 0, 0, 0, 0, 0, 0, 6, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 9, 9, 9, 23, 0, 0},
+    {9, 0, 9, 9, 9, 9, 26, 0, 0},
+    {0, 0, 15, 9, 9, 9, 7, 0, 0},
+    {0, 0, 0, 9, 9, 9, 9, 0, 0},
+    {9, 9, 0, 9, 9, 9, 17, 0, 0},
+    {0, 15, 0, 9, 9, 9, 7, 0, 0},
+    {0, 0, 0, 9, 9, 9, 9, 0, 0},
+    {15, 0, 0, 9, 9, 9, 7, 0, 0},
+    {0, 0, 0, 9, 9, 9, 9, 0, 0},
+    {0, 0, 7, 0, 9, 9, 18, 0, 0},
+    {0, 7, 0, 0, 9, 9, 15, 0, 0},
+    {7, 0, 0, 0, 9, 9, 15, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 9, 0, 9, 9, 23, 0, 0},
+    {0, 9, 9, 0, 9, 9, 7, 0, 0},
+    {0, 0, 9, 0, 9, 9, 7, 0, 0},
+    {15, 0, 15, 0, 15, 15, 7, 0, 0},
+    {0, 0, 9, 0, 9, 9, 9, 0, 0},
+    {0, 9, 0, 0, 9, 9, 7, 0, 0},
+    {9, 0, 0, 0, 9, 9, 9, 0, 0},
+    {0, 0, 0, 0, 9, 7, 7, 0, 0},
+    {15, 15, 0, 0, 15, 17, 7, 0, 0},
+    {0, 9, 0, 0, 9, 9, 9, 0, 0},
+    {9, 0, 0, 0, 9, 9, 9, 0, 0},
+    {0, 0, 0, 0, 7, 9, 7, 0, 0},
+    {0, 0, 0, 0, 7, 15, 7, 0, 0},
+    {0, 0, 7, 9, 0, 9, 15, 0, 0},
+    {0, 7, 0, 9, 0, 9, 9, 0, 0},
+    {7, 0, 0, 9, 0, 9, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 0, 0, 9, 7, 0, 0},
+    {9, 0, 9, 0, 0, 9, 9, 0, 0},
+    {0, 0, 9, 0, 0, 9, 7, 0, 0},
+    {0, 0, 0, 0, 0, 9, 7, 0, 0},
+    {9, 9, 0, 0, 0, 9, 9, 0, 0},
+    {0, 7, 0, 0, 0, 9, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 9, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 9, 9, 0, 9, 26, 0, 0},
+    {0, 17, 15, 22, 0, 15, 7, 0, 0},
+    {0, 0, 9, 9, 0, 9, 15, 0, 0},
+    {22, 0, 15, 22, 0, 15, 7, 0, 0},
+    {0, 0, 9, 9, 0, 9, 18, 0, 0},
+    {0, 9, 0, 9, 0, 9, 9, 0, 0},
+    {9, 0, 0, 9, 0, 9, 9, 0, 0},
+    {0, 0, 0, 15, 0, 7, 7, 0, 0},
+    {9, 9, 0, 9, 0, 9, 7, 0, 0},
+    {0, 9, 0, 9, 0, 9, 7, 0, 0},
+    {9, 0, 0, 9, 0, 9, 7, 0, 0},
+    {0, 0, 0, 9, 0, 9, 7, 0, 0},
+    {0, 0, 0, 9, 0, 9, 7, 0, 0},
+    {0, 9, 9, 0, 0, 9, 18, 0, 0},
+    {9, 0, 9, 0, 0, 9, 18, 0, 0},
+    {0, 0, 15, 0, 0, 9, 7, 0, 0},
+    {0, 0, 0, 0, 0, 9, 9, 0, 0},
+    {9, 9, 0, 0, 0, 9, 7, 0, 0},
+    {0, 9, 0, 0, 0, 9, 7, 0, 0},
+    {0, 0, 0, 0, 0, 9, 7, 0, 0},
+    {9, 0, 0, 0, 0, 9, 7, 0, 0},
+    {0, 0, 0, 0, 0, 9, 7, 0, 0},
+    {9, 9, 9, 0, 0, 15, 7, 0, 0},
+    {0, 9, 9, 0, 0, 7, 15, 0, 0},
+    {9, 0, 9, 0, 0, 7, 15, 0, 0},
+    {0, 0, 9, 0, 0, 9, 7, 0, 0},
+    {0, 0, 9, 0, 0, 15, 7, 0, 0},
+    {9, 9, 0, 0, 0, 7, 9, 0, 0},
+    {0, 9, 0, 0, 0, 7, 7, 0, 0},
+    {0, 0, 0, 0, 0, 7, 7, 0, 0},
+    {9, 0, 0, 0, 0, 7, 7, 0, 0},
+    {0, 0, 0, 0, 0, 7, 9, 0, 0},
+    {0, 9, 0, 0, 0, 9, 7, 0, 0},
+    {9, 0, 0, 0, 0, 9, 7, 0, 0},
+    {0, 0, 0, 0, 0, 7, 7, 0, 0},
+    {0, 0, 7, 9, 9, 0, 9, 0, 0},
+    {0, 7, 0, 9, 9, 0, 15, 0, 0},
+    {7, 0, 0, 9, 9, 0, 15, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 0, 9, 0, 7, 0, 0},
+    {9, 0, 9, 0, 9, 0, 9, 0, 0},
+    {0, 0, 7, 0, 9, 0, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 0, 0, 9, 0, 15, 0, 0},
+    {0, 9, 0, 0, 9, 0, 7, 0, 0},
+    {0, 0, 0, 0, 9, 0, 7, 0, 0},
+    {15, 0, 0, 0, 9, 0, 7, 0, 0},
+    {0, 0, 0, 0, 9, 0, 9, 0, 0},
+    {0, 0, 7, 0, 0, 0, 7, 0, 0},
+    {0, 7, 0, 0, 0, 0, 7, 0, 0},
+    {7, 0, 0, 0, 0, 0, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 9, 0, 0, 9, 0, 0},
+    {9, 0, 9, 9, 0, 0, 9, 0, 0},
+    {0, 0, 7, 9, 0, 0, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 0, 9, 0, 0, 7, 0, 0},
+    {0, 9, 0, 9, 0, 0, 7, 0, 0},
+    {0, 0, 0, 9, 0, 0, 7, 0, 0},
+    {9, 0, 0, 9, 0, 0, 7, 0, 0},
+    {0, 0, 0, 9, 0, 0, 7, 0, 0},
+    {0, 0, 7, 0, 0, 0, 9, 0, 0},
+    {0, 7, 0, 0, 0, 0, 7, 0, 0},
+    {7, 0, 0, 0, 0, 0, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 9, 0, 0, 0, 9, 0, 0},
+    {0, 9, 7, 0, 0, 0, 7, 0, 0},
+    {0, 0, 9, 0, 0, 0, 7, 0, 0},
+    {15, 0, 7, 0, 0, 0, 7, 0, 0},
+    {0, 0, 9, 0, 0, 0, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 0, 0, 0, 0, 7, 0, 0},
+    {0, 9, 0, 0, 0, 0, 7, 0, 0},
+    {9, 0, 0, 0, 0, 0, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 7, 0, 0},
+    {9, 9, 9, 9, 9, 0, 17, 0, 0},
+    {0, 15, 22, 22, 15, 0, 7, 0, 0},
+    {0, 0, 9, 9, 9, 0, 9, 0, 0},
+    {15, 0, 22, 22, 15, 0, 7, 0, 0},
+    {0, 0, 9, 9, 9, 0, 9, 0, 0},
+    {0, 9, 0, 9, 9, 0, 18, 0, 0},
+    {9, 0, 0, 9, 9, 0, 18, 0, 0},
+    {0, 0, 0, 14, 14, 0, 7, 0, 0},
+    {15, 15, 0, 23, 15, 0, 7, 0, 0},
+    {0, 9, 0, 9, 9, 0, 9, 0, 0},
+    {9, 0, 0, 9, 9, 0, 9, 0, 0},
+    {0, 0, 0, 15, 7, 0, 7, 0, 0},
+    {0, 0, 0, 15, 7, 0, 7, 0, 0},
+    {0, 9, 9, 0, 9, 0, 18, 0, 0},
+    {9, 0, 9, 0, 9, 0, 18, 0, 0},
+    {0, 0, 14, 0, 9, 0, 7, 0, 0},
+    {0, 0, 0, 0, 9, 0, 10, 0, 0},
+    {9, 9, 0, 0, 9, 0, 17, 0, 0},
+    {0, 15, 0, 0, 9, 0, 7, 0, 0},
+    {0, 0, 0, 0, 9, 0, 9, 0, 0},
+    {15, 0, 0, 0, 9, 0, 7, 0, 0},
+    {0, 0, 0, 0, 9, 0, 9, 0, 0},
+    {9, 9, 9, 0, 15, 0, 7, 0, 0},
+    {0, 9, 9, 0, 7, 0, 9, 0, 0},
+    {9, 0, 9, 0, 7, 0, 9, 0, 0},
+    {0, 0, 9, 0, 7, 0, 7, 0, 0},
+    {0, 0, 9, 0, 7, 0, 7, 0, 0},
+    {9, 9, 0, 0, 7, 0, 15, 0, 0},
+    {0, 9, 0, 0, 9, 0, 7, 0, 0},
+    {0, 0, 0, 0, 7, 0, 7, 0, 0},
+    {9, 0, 0, 0, 15, 0, 7, 0, 0},
+    {0, 0, 0, 0, 7, 0, 9, 0, 0},
+    {0, 9, 0, 0, 7, 0, 7, 0, 0},
+    {9, 0, 0, 0, 7, 0, 7, 0, 0},
+    {0, 0, 0, 0, 7, 0, 9, 0, 0},
+    {0, 9, 9, 9, 0, 0, 9, 0, 0},
+    {9, 0, 9, 9, 0, 0, 9, 0, 0},
+    {0, 0, 14, 9, 0, 0, 7, 0, 0},
+    {0, 0, 0, 9, 0, 0, 10, 0, 0},
+    {9, 9, 0, 9, 0, 0, 9, 0, 0},
+    {0, 7, 0, 9, 0, 0, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 9, 0, 0, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 0, 10, 0, 0},
+    {0, 7, 0, 0, 0, 0, 9, 0, 0},
+    {7, 0, 0, 0, 0, 0, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 9, 0, 0, 0, 9, 0, 0},
+    {0, 7, 9, 0, 0, 0, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 15, 0, 0, 0, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 0, 0, 0, 0, 7, 0, 0},
+    {9, 0, 0, 0, 0, 0, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 7, 0, 0},
+    {7, 7, 0, 0, 0, 0, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 9, 22, 0, 0, 7, 0, 0},
+    {0, 9, 9, 7, 0, 0, 15, 0, 0},
+    {9, 0, 9, 7, 0, 0, 15, 0, 0},
+    {0, 0, 9, 14, 0, 0, 7, 0, 0},
+    {0, 0, 9, 14, 0, 0, 7, 0, 0},
+    {9, 9, 0, 7, 0, 0, 18, 0, 0},
+    {0, 9, 0, 14, 0, 0, 7, 0, 0},
+    {0, 0, 0, 7, 0, 0, 10, 0, 0},
+    {9, 0, 0, 14, 0, 0, 7, 0, 0},
+    {0, 0, 0, 7, 0, 0, 10, 0, 0},
+    {0, 9, 0, 9, 0, 0, 7, 0, 0},
+    {9, 0, 0, 9, 0, 0, 7, 0, 0},
+    {0, 0, 0, 7, 0, 0, 7, 0, 0},
+    {9, 9, 9, 0, 0, 0, 18, 0, 0},
+    {0, 14, 14, 0, 0, 0, 7, 0, 0},
+    {0, 0, 9, 0, 0, 0, 10, 0, 0},
+    {14, 0, 14, 0, 0, 0, 7, 0, 0},
+    {0, 0, 9, 0, 0, 0, 10, 0, 0},
+    {0, 9, 0, 0, 0, 0, 10, 0, 0},
+    {9, 0, 0, 0, 0, 0, 10, 0, 0},
+    {0, 0, 0, 0, 0, 0, 7, 0, 0},
+    {9, 9, 0, 0, 0, 0, 7, 0, 0},
+    {0, 9, 0, 0, 0, 0, 7, 0, 0},
+    {9, 0, 0, 0, 0, 0, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {23, 26, 17, 23, 26, 17, 0, 0, 0},
+    {0, 9, 9, 17, 9, 9, 0, 0, 0},
+    {0, 0, 9, 7, 15, 9, 0, 0, 0},
+    {22, 0, 22, 17, 17, 17, 0, 0, 0},
+    {0, 0, 9, 9, 18, 9, 0, 0, 0},
+    {0, 9, 0, 7, 9, 18, 0, 0, 0},
+    {9, 0, 0, 9, 9, 18, 0, 0, 0},
+    {0, 0, 0, 14, 9, 7, 0, 0, 0},
+    {9, 9, 0, 9, 15, 9, 0, 0, 0},
+    {0, 9, 0, 9, 7, 9, 0, 0, 0},
+    {9, 0, 0, 9, 7, 9, 0, 0, 0},
+    {0, 0, 0, 9, 7, 9, 0, 0, 0},
+    {0, 0, 0, 9, 7, 9, 0, 0, 0},
+    {0, 18, 15, 0, 18, 18, 0, 0, 0},
+    {18, 0, 15, 0, 18, 18, 0, 0, 0},
+    {0, 0, 14, 0, 9, 9, 0, 0, 0},
+    {0, 0, 0, 0, 9, 10, 0, 0, 0},
+    {15, 15, 0, 0, 7, 17, 0, 0, 0},
+    {0, 9, 0, 0, 9, 9, 0, 0, 0},
+    {0, 0, 0, 0, 7, 9, 0, 0, 0},
+    {9, 0, 0, 0, 9, 9, 0, 0, 0},
+    {0, 0, 0, 0, 7, 9, 0, 0, 0},
+    {17, 9, 9, 0, 9, 9, 0, 0, 0},
+    {0, 9, 9, 0, 15, 9, 0, 0, 0},
+    {7, 0, 9, 0, 15, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 15, 0, 7, 15, 0, 0, 0},
+    {7, 9, 0, 0, 9, 15, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {15, 0, 0, 0, 9, 7, 0, 0, 0},
+    {0, 0, 0, 0, 9, 9, 0, 0, 0},
+    {0, 9, 0, 0, 7, 9, 0, 0, 0},
+    {9, 0, 0, 0, 7, 9, 0, 0, 0},
+    {0, 0, 0, 0, 7, 9, 0, 0, 0},
+    {0, 15, 9, 7, 0, 9, 0, 0, 0},
+    {15, 0, 9, 9, 0, 9, 0, 0, 0},
+    {0, 0, 9, 9, 0, 9, 0, 0, 0},
+    {0, 0, 0, 7, 0, 10, 0, 0, 0},
+    {9, 9, 0, 9, 0, 9, 0, 0, 0},
+    {0, 7, 0, 9, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 9, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 10, 0, 0, 0},
+    {0, 7, 0, 0, 0, 9, 0, 0, 0},
+    {7, 0, 0, 0, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 9, 9, 0, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 9, 0, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 7, 0, 0, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 22, 9, 0, 9, 0, 0, 0},
+    {0, 18, 7, 15, 0, 15, 0, 0, 0},
+    {15, 0, 7, 15, 0, 15, 0, 0, 0},
+    {0, 0, 9, 9, 0, 9, 0, 0, 0},
+    {0, 0, 14, 9, 0, 9, 0, 0, 0},
+    {9, 9, 0, 9, 0, 18, 0, 0, 0},
+    {0, 9, 0, 14, 0, 7, 0, 0, 0},
+    {0, 0, 0, 7, 0, 10, 0, 0, 0},
+    {14, 0, 0, 14, 0, 7, 0, 0, 0},
+    {0, 0, 0, 9, 0, 10, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {18, 18, 7, 0, 0, 18, 0, 0, 0},
+    {0, 9, 14, 0, 0, 9, 0, 0, 0},
+    {0, 0, 7, 0, 0, 10, 0, 0, 0},
+    {9, 0, 14, 0, 0, 9, 0, 0, 0},
+    {0, 0, 7, 0, 0, 10, 0, 0, 0},
+    {0, 9, 0, 0, 0, 10, 0, 0, 0},
+    {9, 0, 0, 0, 0, 10, 0, 0, 0},
+    {0, 0, 0, 0, 0, 7, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 0, 0, 9, 0, 0, 0},
+    {9, 0, 9, 0, 0, 9, 0, 0, 0},
+    {0, 0, 7, 0, 0, 7, 0, 0, 0},
+    {9, 9, 0, 0, 0, 7, 0, 0, 0},
+    {0, 9, 0, 0, 0, 7, 0, 0, 0},
+    {7, 0, 0, 0, 0, 7, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 7, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 15, 7, 9, 0, 0, 0, 0},
+    {9, 0, 15, 9, 9, 0, 0, 0, 0},
+    {0, 0, 7, 9, 9, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {15, 15, 0, 15, 7, 0, 0, 0, 0},
+    {0, 9, 0, 9, 9, 0, 0, 0, 0},
+    {0, 0, 0, 7, 7, 0, 0, 0, 0},
+    {9, 0, 0, 9, 9, 0, 0, 0, 0},
+    {0, 0, 0, 9, 7, 0, 0, 0, 0},
+    {0, 0, 7, 0, 9, 0, 0, 0, 0},
+    {0, 7, 0, 0, 7, 0, 0, 0, 0},
+    {7, 0, 0, 0, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 9, 15, 0, 9, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {15, 0, 7, 0, 9, 0, 0, 0, 0},
+    {0, 0, 9, 0, 9, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 0, 0, 9, 0, 0, 0, 0},
+    {0, 9, 0, 0, 7, 0, 0, 0, 0},
+    {7, 0, 0, 0, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 7, 0, 0, 0, 0},
+    {0, 0, 7, 7, 0, 0, 0, 0, 0},
+    {0, 7, 0, 7, 0, 0, 0, 0, 0},
+    {7, 0, 0, 9, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 9, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 9, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 7, 9, 0, 0, 0, 0, 0},
+    {0, 9, 7, 9, 0, 0, 0, 0, 0},
+    {0, 0, 7, 7, 0, 0, 0, 0, 0},
+    {9, 0, 7, 9, 0, 0, 0, 0, 0},
+    {0, 0, 7, 9, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 7, 0, 0, 0, 0, 0, 0},
+    {9, 0, 7, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 7, 0, 0, 0, 0, 0, 0},
+    {0, 9, 7, 0, 0, 0, 0, 0, 0},
+    {7, 0, 7, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {17, 17, 17, 22, 15, 0, 0, 0, 0},
+    {0, 9, 9, 9, 15, 0, 0, 0, 0},
+    {9, 0, 9, 9, 15, 0, 0, 0, 0},
+    {0, 0, 9, 14, 7, 0, 0, 0, 0},
+    {0, 0, 14, 14, 7, 0, 0, 0, 0},
+    {18, 18, 0, 15, 18, 0, 0, 0, 0},
+    {0, 9, 0, 14, 9, 0, 0, 0, 0},
+    {0, 0, 0, 7, 10, 0, 0, 0, 0},
+    {14, 0, 0, 14, 14, 0, 0, 0, 0},
+    {0, 0, 0, 9, 10, 0, 0, 0, 0},
+    {0, 9, 0, 9, 7, 0, 0, 0, 0},
+    {9, 0, 0, 9, 7, 0, 0, 0, 0},
+    {0, 0, 0, 9, 7, 0, 0, 0, 0},
+    {18, 18, 17, 0, 18, 0, 0, 0, 0},
+    {0, 14, 14, 0, 14, 0, 0, 0, 0},
+    {0, 0, 9, 0, 10, 0, 0, 0, 0},
+    {14, 0, 14, 0, 14, 0, 0, 0, 0},
+    {0, 0, 9, 0, 10, 0, 0, 0, 0},
+    {0, 10, 0, 0, 10, 0, 0, 0, 0},
+    {10, 0, 0, 0, 10, 0, 0, 0, 0},
+    {0, 0, 0, 0, 6, 0, 0, 0, 0},
+    {9, 9, 0, 0, 15, 0, 0, 0, 0},
+    {0, 9, 0, 0, 7, 0, 0, 0, 0},
+    {9, 0, 0, 0, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 7, 0, 0, 0, 0},
+    {0, 9, 9, 0, 7, 0, 0, 0, 0},
+    {9, 0, 9, 0, 7, 0, 0, 0, 0},
+    {0, 0, 9, 0, 7, 0, 0, 0, 0},
+    {9, 9, 0, 0, 9, 0, 0, 0, 0},
+    {0, 9, 0, 0, 7, 0, 0, 0, 0},
+    {7, 0, 0, 0, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 7, 0, 0, 0, 0},
+    {9, 9, 9, 9, 0, 0, 0, 0, 0},
+    {0, 7, 9, 14, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 14, 14, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 10, 0, 7, 0, 0, 0, 0, 0},
+    {10, 0, 0, 9, 0, 0, 0, 0, 0},
+    {0, 0, 0, 6, 0, 0, 0, 0, 0},
+    {7, 7, 0, 15, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 10, 9, 0, 0, 0, 0, 0, 0},
+    {10, 0, 9, 0, 0, 0, 0, 0, 0},
+    {0, 0, 6, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 0, 0, 0, 0, 0, 0, 0},
+    {0, 7, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 7, 9, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 9, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 9, 0, 0, 0, 0, 0},
+    {9, 0, 9, 9, 0, 0, 0, 0, 0},
+    {0, 0, 7, 7, 0, 0, 0, 0, 0},
+    {9, 9, 0, 14, 0, 0, 0, 0, 0},
+    {0, 10, 0, 7, 0, 0, 0, 0, 0},
+    {10, 0, 0, 7, 0, 0, 0, 0, 0},
+    {0, 0, 0, 6, 0, 0, 0, 0, 0},
+    {0, 0, 0, 6, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 14, 0, 0, 0, 0, 0, 0},
+    {0, 10, 7, 0, 0, 0, 0, 0, 0},
+    {10, 0, 7, 0, 0, 0, 0, 0, 0},
+    {0, 0, 6, 0, 0, 0, 0, 0, 0},
+    {0, 0, 6, 0, 0, 0, 0, 0, 0},
+    {10, 10, 0, 0, 0, 0, 0, 0, 0},
+    {0, 6, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {6, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {30, 30, 23, 30, 23, 23, 30, 0, 0},
+    {0, 9, 9, 9, 26, 9, 9, 0, 0},
+    {26, 0, 26, 17, 17, 17, 17, 0, 0},
+    {0, 0, 22, 22, 22, 22, 22, 0, 0},
+    {0, 0, 9, 9, 7, 9, 9, 0, 0},
+    {9, 9, 0, 9, 9, 17, 9, 0, 0},
+    {0, 22, 0, 22, 15, 7, 15, 0, 0},
+    {0, 0, 0, 9, 9, 18, 9, 0, 0},
+    {9, 0, 0, 9, 15, 7, 9, 0, 0},
+    {0, 0, 0, 9, 7, 9, 9, 0, 0},
+    {0, 22, 0, 15, 7, 17, 15, 0, 0},
+    {22, 0, 0, 22, 22, 22, 22, 0, 0},
+    {0, 0, 0, 9, 18, 9, 9, 0, 0},
+    {17, 17, 17, 0, 26, 17, 17, 0, 0},
+    {0, 22, 22, 0, 22, 15, 17, 0, 0},
+    {0, 0, 18, 0, 18, 18, 17, 0, 0},
+    {9, 0, 9, 0, 15, 9, 9, 0, 0},
+    {0, 0, 9, 0, 7, 9, 9, 0, 0},
+    {0, 9, 0, 0, 9, 18, 9, 0, 0},
+    {9, 0, 0, 0, 7, 17, 9, 0, 0},
+    {0, 0, 0, 0, 15, 7, 9, 0, 0},
+    {15, 22, 0, 0, 15, 17, 22, 0, 0},
+    {0, 9, 0, 0, 9, 9, 9, 0, 0},
+    {18, 0, 0, 0, 18, 17, 17, 0, 0},
+    {0, 0, 0, 0, 14, 14, 14, 0, 0},
+    {0, 0, 0, 0, 7, 9, 7, 0, 0},
+    {0, 15, 15, 0, 7, 15, 17, 0, 0},
+    {15, 0, 15, 0, 22, 22, 22, 0, 0},
+    {0, 0, 9, 0, 9, 9, 9, 0, 0},
+    {15, 15, 0, 0, 15, 7, 15, 0, 0},
+    {0, 9, 0, 0, 9, 9, 9, 0, 0},
+    {9, 0, 0, 0, 9, 9, 9, 0, 0},
+    {0, 0, 0, 0, 9, 7, 15, 0, 0},
+    {0, 0, 0, 0, 7, 7, 9, 0, 0},
+    {0, 0, 0, 0, 7, 14, 14, 0, 0},
+    {17, 9, 9, 9, 0, 9, 9, 0, 0},
+    {0, 22, 15, 22, 0, 15, 22, 0, 0},
+    {0, 0, 18, 18, 0, 18, 18, 0, 0},
+    {7, 0, 15, 15, 0, 15, 15, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 0, 9, 0, 9, 9, 0, 0},
+    {9, 0, 0, 9, 0, 9, 9, 0, 0},
+    {0, 0, 0, 15, 0, 7, 7, 0, 0},
+    {7, 22, 0, 15, 0, 15, 22, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {18, 0, 0, 9, 0, 9, 9, 0, 0},
+    {0, 0, 0, 14, 0, 14, 14, 0, 0},
+    {0, 9, 9, 0, 0, 18, 9, 0, 0},
+    {9, 0, 9, 0, 0, 9, 9, 0, 0},
+    {0, 0, 15, 0, 0, 7, 9, 0, 0},
+    {0, 0, 0, 0, 0, 9, 9, 0, 0},
+    {9, 9, 0, 0, 0, 9, 9, 0, 0},
+    {0, 14, 0, 0, 0, 7, 9, 0, 0},
+    {0, 0, 0, 0, 0, 10, 9, 0, 0},
+    {7, 0, 0, 0, 0, 7, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 22, 15, 0, 0, 15, 15, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {18, 0, 9, 0, 0, 9, 9, 0, 0},
+    {0, 0, 9, 0, 0, 9, 14, 0, 0},
+    {9, 9, 0, 0, 0, 9, 9, 0, 0},
+    {0, 9, 0, 0, 0, 7, 7, 0, 0},
+    {0, 0, 0, 0, 0, 9, 7, 0, 0},
+    {7, 0, 0, 0, 0, 7, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 14, 14, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 22, 9, 9, 0, 9, 9, 0, 0},
+    {22, 0, 15, 22, 0, 22, 22, 0, 0},
+    {0, 0, 18, 9, 0, 9, 9, 0, 0},
+    {9, 15, 0, 9, 0, 7, 9, 0, 0},
+    {0, 7, 0, 9, 0, 9, 9, 0, 0},
+    {9, 0, 0, 9, 0, 9, 9, 0, 0},
+    {0, 0, 0, 14, 0, 7, 14, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 9, 0, 9, 14, 0, 0},
+    {9, 22, 9, 0, 0, 9, 9, 0, 0},
+    {0, 7, 9, 0, 0, 9, 15, 0, 0},
+    {18, 0, 18, 0, 0, 17, 17, 0, 0},
+    {0, 0, 14, 0, 0, 14, 14, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 7, 0, 0, 0, 18, 9, 0, 0},
+    {0, 14, 0, 0, 0, 7, 9, 0, 0},
+    {0, 0, 0, 0, 0, 10, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 0, 0, 0, 9, 7, 0, 0},
+    {9, 0, 0, 0, 0, 9, 14, 0, 0},
+    {0, 0, 0, 0, 0, 9, 7, 0, 0},
+    {0, 0, 7, 0, 0, 14, 9, 0, 0},
+    {0, 7, 0, 0, 0, 7, 9, 0, 0},
+    {7, 0, 0, 0, 0, 7, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 17, 9, 9, 0, 9, 0, 0},
+    {0, 22, 7, 15, 15, 0, 22, 0, 0},
+    {0, 0, 18, 9, 9, 0, 9, 0, 0},
+    {9, 0, 7, 9, 15, 0, 9, 0, 0},
+    {0, 0, 9, 9, 7, 0, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {17, 22, 0, 17, 15, 0, 17, 0, 0},
+    {0, 9, 0, 9, 15, 0, 9, 0, 0},
+    {18, 0, 0, 18, 18, 0, 17, 0, 0},
+    {0, 0, 0, 14, 14, 0, 14, 0, 0},
+    {0, 0, 0, 9, 7, 0, 9, 0, 0},
+    {0, 9, 9, 0, 9, 0, 9, 0, 0},
+    {9, 0, 9, 0, 7, 0, 9, 0, 0},
+    {0, 0, 7, 0, 7, 0, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 0, 0, 15, 0, 9, 0, 0},
+    {0, 14, 0, 0, 7, 0, 9, 0, 0},
+    {0, 0, 0, 0, 10, 0, 9, 0, 0},
+    {9, 0, 0, 0, 7, 0, 9, 0, 0},
+    {0, 0, 0, 0, 7, 0, 9, 0, 0},
+    {15, 22, 7, 0, 15, 0, 22, 0, 0},
+    {0, 9, 9, 0, 9, 0, 9, 0, 0},
+    {9, 0, 18, 0, 9, 0, 9, 0, 0},
+    {0, 0, 7, 0, 9, 0, 14, 0, 0},
+    {0, 0, 7, 0, 7, 0, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 14, 0, 0, 7, 0, 14, 0, 0},
+    {14, 0, 0, 0, 14, 0, 14, 0, 0},
+    {0, 0, 0, 0, 10, 0, 9, 0, 0},
+    {0, 9, 9, 9, 0, 0, 9, 0, 0},
+    {9, 0, 9, 9, 0, 0, 9, 0, 0},
+    {0, 0, 7, 7, 0, 0, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 0, 9, 0, 0, 9, 0, 0},
+    {0, 14, 0, 7, 0, 0, 9, 0, 0},
+    {0, 0, 0, 10, 0, 0, 9, 0, 0},
+    {7, 0, 0, 7, 0, 0, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 9, 0, 0, 0, 9, 0, 0},
+    {0, 9, 7, 0, 0, 0, 14, 0, 0},
+    {0, 0, 10, 0, 0, 0, 7, 0, 0},
+    {7, 0, 7, 0, 0, 0, 15, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 14, 0, 0, 0, 0, 14, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 0, 0, 0, 0, 0, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 6, 0, 0},
+    {9, 22, 7, 9, 0, 0, 9, 0, 0},
+    {0, 7, 15, 9, 0, 0, 9, 0, 0},
+    {9, 0, 18, 9, 0, 0, 9, 0, 0},
+    {0, 0, 7, 14, 0, 0, 14, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 0, 9, 0, 0, 9, 0, 0},
+    {9, 0, 0, 9, 0, 0, 14, 0, 0},
+    {0, 0, 0, 10, 0, 0, 7, 0, 0},
+    {9, 7, 15, 0, 0, 0, 9, 0, 0},
+    {0, 14, 7, 0, 0, 0, 9, 0, 0},
+    {0, 0, 10, 0, 0, 0, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 0, 0, 0, 0, 9, 0, 0},
+    {0, 7, 0, 0, 0, 0, 7, 0, 0},
+    {10, 0, 0, 0, 0, 0, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 6, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 14, 7, 0, 0, 0, 9, 0, 0},
+    {14, 0, 7, 0, 0, 0, 14, 0, 0},
+    {0, 0, 10, 0, 0, 0, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 6, 0, 0},
+    {0, 15, 15, 15, 7, 0, 15, 0, 0},
+    {15, 0, 22, 22, 22, 0, 22, 0, 0},
+    {0, 0, 9, 9, 9, 0, 9, 0, 0},
+    {15, 22, 0, 22, 15, 0, 17, 0, 0},
+    {0, 9, 0, 9, 9, 0, 9, 0, 0},
+    {18, 0, 0, 9, 9, 0, 9, 0, 0},
+    {0, 0, 0, 14, 14, 0, 14, 0, 0},
+    {0, 0, 0, 9, 7, 0, 9, 0, 0},
+    {0, 0, 0, 15, 7, 0, 15, 0, 0},
+    {15, 22, 22, 0, 22, 0, 22, 0, 0},
+    {0, 9, 9, 0, 9, 0, 9, 0, 0},
+    {18, 0, 17, 0, 17, 0, 17, 0, 0},
+    {0, 0, 14, 0, 14, 0, 14, 0, 0},
+    {0, 0, 9, 0, 7, 0, 7, 0, 0},
+    {18, 17, 0, 0, 18, 0, 17, 0, 0},
+    {0, 14, 0, 0, 14, 0, 14, 0, 0},
+    {0, 0, 0, 0, 10, 0, 10, 0, 0},
+    {9, 0, 0, 0, 15, 0, 9, 0, 0},
+    {0, 0, 0, 0, 7, 0, 9, 0, 0},
+    {0, 15, 0, 0, 7, 0, 7, 0, 0},
+    {15, 0, 0, 0, 14, 0, 14, 0, 0},
+    {0, 0, 0, 0, 9, 0, 9, 0, 0},
+    {0, 0, 7, 0, 7, 0, 9, 0, 0},
+    {0, 7, 0, 0, 7, 0, 9, 0, 0},
+    {7, 0, 0, 0, 15, 0, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 22, 15, 22, 0, 0, 15, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {18, 0, 9, 9, 0, 0, 9, 0, 0},
+    {0, 0, 14, 14, 0, 0, 14, 0, 0},
+    {9, 9, 0, 9, 0, 0, 9, 0, 0},
+    {0, 14, 0, 14, 0, 0, 7, 0, 0},
+    {0, 0, 0, 9, 0, 0, 10, 0, 0},
+    {7, 0, 0, 15, 0, 0, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 14, 0, 0, 14, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {18, 9, 9, 0, 0, 0, 9, 0, 0},
+    {0, 14, 14, 0, 0, 0, 14, 0, 0},
+    {0, 0, 10, 0, 0, 0, 10, 0, 0},
+    {7, 0, 15, 0, 0, 0, 15, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 0, 0, 0, 0, 10, 0, 0},
+    {9, 0, 0, 0, 0, 0, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 7, 0, 0},
+    {7, 14, 0, 0, 0, 0, 14, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 0, 0, 0, 0, 0, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 6, 0, 0},
+    {7, 0, 15, 0, 0, 0, 15, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 15, 0, 0, 0, 0, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 0, 0, 0, 0, 0, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 7, 0, 0},
+    {0, 0, 7, 15, 0, 0, 9, 0, 0},
+    {0, 7, 0, 9, 0, 0, 9, 0, 0},
+    {7, 0, 0, 14, 0, 0, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 15, 9, 0, 0, 0, 7, 0, 0},
+    {15, 0, 14, 0, 0, 0, 14, 0, 0},
+    {0, 0, 9, 0, 0, 0, 9, 0, 0},
+    {9, 14, 0, 0, 0, 0, 9, 0, 0},
+    {0, 7, 0, 0, 0, 0, 9, 0, 0},
+    {10, 0, 0, 0, 0, 0, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 6, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 7, 0, 0},
+    {17, 17, 17, 17, 26, 17, 0, 0, 0},
+    {0, 22, 15, 17, 22, 22, 0, 0, 0},
+    {0, 0, 18, 17, 18, 18, 0, 0, 0},
+    {9, 0, 9, 9, 15, 9, 0, 0, 0},
+    {0, 0, 9, 9, 7, 9, 0, 0, 0},
+    {0, 9, 0, 9, 9, 9, 0, 0, 0},
+    {9, 0, 0, 9, 7, 9, 0, 0, 0},
+    {0, 0, 0, 9, 7, 7, 0, 0, 0},
+    {15, 22, 0, 22, 22, 17, 0, 0, 0},
+    {0, 9, 0, 9, 9, 9, 0, 0, 0},
+    {18, 0, 0, 18, 18, 17, 0, 0, 0},
+    {0, 0, 0, 14, 14, 14, 0, 0, 0},
+    {0, 0, 0, 7, 7, 9, 0, 0, 0},
+    {0, 15, 18, 0, 18, 18, 0, 0, 0},
+    {15, 0, 9, 0, 7, 9, 0, 0, 0},
+    {0, 0, 9, 0, 9, 9, 0, 0, 0},
+    {0, 0, 0, 0, 7, 9, 0, 0, 0},
+    {18, 9, 0, 0, 9, 9, 0, 0, 0},
+    {0, 14, 0, 0, 9, 9, 0, 0, 0},
+    {0, 0, 0, 0, 10, 10, 0, 0, 0},
+    {7, 0, 0, 0, 9, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {17, 22, 15, 0, 15, 22, 0, 0, 0},
+    {0, 9, 9, 0, 15, 9, 0, 0, 0},
+    {17, 0, 18, 0, 18, 17, 0, 0, 0},
+    {0, 0, 15, 0, 14, 14, 0, 0, 0},
+    {0, 0, 9, 0, 7, 9, 0, 0, 0},
+    {9, 9, 0, 0, 9, 9, 0, 0, 0},
+    {0, 15, 0, 0, 7, 7, 0, 0, 0},
+    {0, 0, 0, 0, 9, 9, 0, 0, 0},
+    {9, 0, 0, 0, 7, 7, 0, 0, 0},
+    {0, 0, 0, 0, 7, 9, 0, 0, 0},
+    {0, 14, 0, 0, 7, 14, 0, 0, 0},
+    {14, 0, 0, 0, 14, 14, 0, 0, 0},
+    {0, 0, 0, 0, 10, 9, 0, 0, 0},
+    {0, 9, 18, 9, 0, 9, 0, 0, 0},
+    {9, 0, 9, 9, 0, 9, 0, 0, 0},
+    {0, 0, 7, 9, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {18, 9, 0, 9, 0, 9, 0, 0, 0},
+    {0, 14, 0, 9, 0, 9, 0, 0, 0},
+    {0, 0, 0, 10, 0, 10, 0, 0, 0},
+    {7, 0, 0, 9, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 9, 0, 0, 0},
+    {0, 7, 0, 0, 0, 10, 0, 0, 0},
+    {7, 0, 0, 0, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 9, 0, 0, 9, 0, 0, 0},
+    {0, 14, 7, 0, 0, 14, 0, 0, 0},
+    {0, 0, 10, 0, 0, 9, 0, 0, 0},
+    {7, 0, 7, 0, 0, 15, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 14, 0, 0, 0, 14, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 0, 0, 0, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 6, 0, 0, 0},
+    {9, 22, 9, 9, 0, 9, 0, 0, 0},
+    {0, 7, 9, 15, 0, 9, 0, 0, 0},
+    {18, 0, 18, 18, 0, 18, 0, 0, 0},
+    {0, 0, 14, 14, 0, 14, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 7, 0, 9, 0, 15, 0, 0, 0},
+    {0, 14, 0, 9, 0, 7, 0, 0, 0},
+    {0, 0, 0, 9, 0, 10, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 14, 0, 7, 0, 9, 0, 0, 0},
+    {14, 0, 0, 14, 0, 14, 0, 0, 0},
+    {0, 0, 0, 10, 0, 9, 0, 0, 0},
+    {18, 7, 9, 0, 0, 9, 0, 0, 0},
+    {0, 14, 9, 0, 0, 9, 0, 0, 0},
+    {0, 0, 10, 0, 0, 10, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 7, 0, 0, 0, 10, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 14, 0, 0, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 0, 0, 0, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 6, 0, 0, 0},
+    {0, 9, 9, 0, 0, 9, 0, 0, 0},
+    {9, 0, 9, 0, 0, 14, 0, 0, 0},
+    {0, 0, 10, 0, 0, 7, 0, 0, 0},
+    {9, 9, 0, 0, 0, 7, 0, 0, 0},
+    {0, 7, 0, 0, 0, 7, 0, 0, 0},
+    {9, 0, 0, 0, 0, 7, 0, 0, 0},
+    {0, 0, 0, 0, 0, 7, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 6, 0, 0, 0},
+    {0, 9, 18, 9, 9, 0, 0, 0, 0},
+    {9, 0, 15, 9, 7, 0, 0, 0, 0},
+    {0, 0, 7, 9, 9, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {18, 15, 0, 18, 18, 0, 0, 0, 0},
+    {0, 14, 0, 9, 9, 0, 0, 0, 0},
+    {0, 0, 0, 10, 10, 0, 0, 0, 0},
+    {9, 0, 0, 9, 9, 0, 0, 0, 0},
+    {0, 0, 0, 9, 7, 0, 0, 0, 0},
+    {0, 0, 7, 0, 7, 0, 0, 0, 0},
+    {0, 7, 0, 0, 10, 0, 0, 0, 0},
+    {7, 0, 0, 0, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 18, 0, 9, 0, 0, 0, 0},
+    {0, 14, 7, 0, 14, 0, 0, 0, 0},
+    {0, 0, 10, 0, 9, 0, 0, 0, 0},
+    {9, 0, 7, 0, 15, 0, 0, 0, 0},
+    {0, 0, 9, 0, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {14, 14, 0, 0, 14, 0, 0, 0, 0},
+    {0, 9, 0, 0, 10, 0, 0, 0, 0},
+    {10, 0, 0, 0, 10, 0, 0, 0, 0},
+    {0, 0, 0, 0, 6, 0, 0, 0, 0},
+    {0, 0, 0, 0, 7, 0, 0, 0, 0},
+    {0, 0, 7, 9, 0, 0, 0, 0, 0},
+    {0, 7, 0, 10, 0, 0, 0, 0, 0},
+    {7, 0, 0, 9, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 10, 0, 0, 0, 0, 0, 0},
+    {9, 0, 9, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 9, 0, 0, 0, 0, 0, 0, 0},
+    {0, 6, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 7, 18, 9, 0, 0, 0, 0, 0},
+    {0, 14, 7, 9, 0, 0, 0, 0, 0},
+    {0, 0, 10, 9, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 14, 0, 9, 0, 0, 0, 0, 0},
+    {0, 7, 0, 10, 0, 0, 0, 0, 0},
+    {10, 0, 0, 10, 0, 0, 0, 0, 0},
+    {0, 0, 0, 6, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 7, 10, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 7, 0, 0, 0, 0, 0, 0, 0},
+    {0, 6, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 14, 7, 0, 0, 0, 0, 0, 0},
+    {0, 7, 10, 0, 0, 0, 0, 0, 0},
+    {9, 0, 10, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 6, 0, 0, 0, 0, 0, 0, 0},
+    {6, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {15, 22, 17, 22, 15, 0, 0, 0, 0},
+    {0, 9, 9, 9, 9, 0, 0, 0, 0},
+    {18, 0, 17, 17, 18, 0, 0, 0, 0},
+    {0, 0, 14, 14, 14, 0, 0, 0, 0},
+    {0, 0, 9, 7, 7, 0, 0, 0, 0},
+    {9, 9, 0, 9, 15, 0, 0, 0, 0},
+    {0, 14, 0, 14, 7, 0, 0, 0, 0},
+    {0, 0, 0, 9, 10, 0, 0, 0, 0},
+    {9, 0, 0, 9, 7, 0, 0, 0, 0},
+    {0, 0, 0, 9, 7, 0, 0, 0, 0},
+    {0, 15, 0, 7, 7, 0, 0, 0, 0},
+    {15, 0, 0, 14, 14, 0, 0, 0, 0},
+    {0, 0, 0, 9, 9, 0, 0, 0, 0},
+    {18, 9, 9, 0, 9, 0, 0, 0, 0},
+    {0, 14, 14, 0, 14, 0, 0, 0, 0},
+    {0, 0, 10, 0, 10, 0, 0, 0, 0},
+    {7, 0, 9, 0, 15, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 0, 0, 10, 0, 0, 0, 0},
+    {9, 0, 0, 0, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 7, 0, 0, 0, 0},
+    {7, 14, 0, 0, 14, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 0, 0, 0, 9, 0, 0, 0, 0},
+    {0, 0, 0, 0, 6, 0, 0, 0, 0},
+    {0, 9, 9, 0, 7, 0, 0, 0, 0},
+    {9, 0, 9, 0, 15, 0, 0, 0, 0},
+    {0, 0, 9, 0, 7, 0, 0, 0, 0},
+    {9, 9, 0, 0, 7, 0, 0, 0, 0},
+    {0, 9, 0, 0, 7, 0, 0, 0, 0},
+    {9, 0, 0, 0, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 7, 0, 0, 0, 0},
+    {9, 9, 9, 9, 0, 0, 0, 0, 0},
+    {0, 14, 7, 14, 0, 0, 0, 0, 0},
+    {0, 0, 10, 9, 0, 0, 0, 0, 0},
+    {7, 0, 7, 15, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 14, 0, 14, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 0, 0, 9, 0, 0, 0, 0, 0},
+    {0, 0, 0, 6, 0, 0, 0, 0, 0},
+    {0, 9, 10, 0, 0, 0, 0, 0, 0},
+    {9, 0, 9, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 9, 0, 0, 0, 0, 0, 0, 0},
+    {0, 6, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 15, 7, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 0, 9, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 7, 0, 0, 0, 0, 0},
+    {9, 0, 9, 14, 0, 0, 0, 0, 0},
+    {0, 0, 9, 7, 0, 0, 0, 0, 0},
+    {9, 9, 0, 9, 0, 0, 0, 0, 0},
+    {0, 7, 0, 7, 0, 0, 0, 0, 0},
+    {10, 0, 0, 7, 0, 0, 0, 0, 0},
+    {0, 0, 0, 6, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 7, 0, 0, 0, 0, 0},
+    {7, 14, 9, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 0, 9, 0, 0, 0, 0, 0, 0},
+    {0, 0, 6, 0, 0, 0, 0, 0, 0},
+    {10, 7, 0, 0, 0, 0, 0, 0, 0},
+    {0, 6, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 15, 15, 17, 7, 15, 0, 0, 0},
+    {15, 0, 15, 23, 22, 23, 0, 0, 0},
+    {0, 0, 9, 9, 9, 9, 0, 0, 0},
+    {15, 15, 0, 23, 15, 7, 0, 0, 0},
+    {0, 9, 0, 9, 9, 9, 0, 0, 0},
+    {9, 0, 0, 9, 9, 9, 0, 0, 0},
+    {0, 0, 0, 14, 9, 7, 0, 0, 0},
+    {0, 0, 0, 9, 7, 7, 0, 0, 0},
+    {0, 0, 0, 9, 7, 9, 0, 0, 0},
+    {17, 23, 23, 0, 15, 15, 0, 0, 0},
+    {0, 9, 9, 0, 15, 9, 0, 0, 0},
+    {17, 0, 17, 0, 17, 17, 0, 0, 0},
+    {0, 0, 14, 0, 14, 15, 0, 0, 0},
+    {0, 0, 9, 0, 7, 9, 0, 0, 0},
+    {9, 9, 0, 0, 9, 17, 0, 0, 0},
+    {0, 14, 0, 0, 14, 7, 0, 0, 0},
+    {0, 0, 0, 0, 9, 10, 0, 0, 0},
+    {9, 0, 0, 0, 15, 7, 0, 0, 0},
+    {0, 0, 0, 0, 7, 9, 0, 0, 0},
+    {0, 9, 0, 0, 7, 9, 0, 0, 0},
+    {9, 0, 0, 0, 15, 9, 0, 0, 0},
+    {0, 0, 0, 0, 7, 9, 0, 0, 0},
+    {0, 0, 7, 0, 7, 15, 0, 0, 0},
+    {0, 7, 0, 0, 7, 7, 0, 0, 0},
+    {7, 0, 0, 0, 9, 7, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 22, 15, 15, 0, 15, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {18, 0, 9, 9, 0, 9, 0, 0, 0},
+    {0, 0, 9, 14, 0, 9, 0, 0, 0},
+    {9, 9, 0, 9, 0, 9, 0, 0, 0},
+    {0, 9, 0, 14, 0, 7, 0, 0, 0},
+    {0, 0, 0, 7, 0, 10, 0, 0, 0},
+    {7, 0, 0, 15, 0, 7, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 15, 0, 15, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 9, 0, 0, 9, 0, 0, 0},
+    {0, 14, 14, 0, 0, 7, 0, 0, 0},
+    {0, 0, 9, 0, 0, 10, 0, 0, 0},
+    {7, 0, 15, 0, 0, 7, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 0, 0, 0, 10, 0, 0, 0},
+    {9, 0, 0, 0, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 7, 0, 0, 0},
+    {7, 15, 0, 0, 0, 7, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 0, 0, 0, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 7, 0, 0, 0},
+    {7, 0, 9, 0, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 9, 0, 0, 0, 7, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 9, 0, 9, 0, 0, 0},
+    {0, 7, 0, 9, 0, 7, 0, 0, 0},
+    {7, 0, 0, 15, 0, 7, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 0, 0, 9, 0, 0, 0},
+    {9, 0, 15, 0, 0, 9, 0, 0, 0},
+    {0, 0, 7, 0, 0, 9, 0, 0, 0},
+    {9, 15, 0, 0, 0, 7, 0, 0, 0},
+    {0, 7, 0, 0, 0, 9, 0, 0, 0},
+    {9, 0, 0, 0, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 7, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {15, 23, 7, 15, 15, 0, 0, 0, 0},
+    {0, 9, 9, 9, 9, 0, 0, 0, 0},
+    {9, 0, 17, 9, 9, 0, 0, 0, 0},
+    {0, 0, 7, 15, 9, 0, 0, 0, 0},
+    {0, 0, 7, 9, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 0, 9, 7, 0, 0, 0, 0},
+    {9, 0, 0, 9, 15, 0, 0, 0, 0},
+    {0, 0, 0, 9, 7, 0, 0, 0, 0},
+    {9, 9, 9, 0, 9, 0, 0, 0, 0},
+    {0, 15, 7, 0, 7, 0, 0, 0, 0},
+    {0, 0, 9, 0, 9, 0, 0, 0, 0},
+    {9, 0, 7, 0, 7, 0, 0, 0, 0},
+    {0, 0, 9, 0, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 0, 0, 7, 0, 0, 0, 0},
+    {0, 9, 0, 0, 7, 0, 0, 0, 0},
+    {9, 0, 0, 0, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 7, 0, 0, 0, 0},
+    {0, 15, 7, 0, 7, 0, 0, 0, 0},
+    {15, 0, 7, 0, 9, 0, 0, 0, 0},
+    {0, 0, 9, 0, 9, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 7, 0, 0, 0, 0},
+    {9, 9, 9, 9, 0, 0, 0, 0, 0},
+    {0, 9, 7, 7, 0, 0, 0, 0, 0},
+    {0, 0, 9, 7, 0, 0, 0, 0, 0},
+    {7, 0, 7, 7, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 15, 0, 7, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 0, 0, 9, 0, 0, 0, 0, 0},
+    {0, 0, 0, 7, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 9, 7, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 9, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 7, 9, 0, 0, 0, 0, 0},
+    {9, 0, 7, 9, 0, 0, 0, 0, 0},
+    {0, 0, 7, 9, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 7, 0, 0, 0, 0, 0, 0},
+    {0, 7, 7, 0, 0, 0, 0, 0, 0},
+    {9, 0, 7, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 15, 7, 0, 0, 0, 0},
+    {0, 7, 0, 15, 7, 0, 0, 0, 0},
+    {7, 0, 0, 14, 14, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 15, 15, 0, 7, 0, 0, 0, 0},
+    {15, 0, 14, 0, 14, 0, 0, 0, 0},
+    {0, 0, 9, 0, 9, 0, 0, 0, 0},
+    {15, 14, 0, 0, 14, 0, 0, 0, 0},
+    {0, 9, 0, 0, 9, 0, 0, 0, 0},
+    {10, 0, 0, 0, 9, 0, 0, 0, 0},
+    {0, 0, 0, 0, 6, 0, 0, 0, 0},
+    {0, 0, 0, 0, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 7, 0, 0, 0, 0},
+    {7, 0, 14, 14, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 14, 0, 14, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 0, 0, 9, 0, 0, 0, 0, 0},
+    {0, 0, 0, 6, 0, 0, 0, 0, 0},
+    {7, 14, 14, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {10, 0, 9, 0, 0, 0, 0, 0, 0},
+    {0, 0, 6, 0, 0, 0, 0, 0, 0},
+    {10, 9, 0, 0, 0, 0, 0, 0, 0},
+    {0, 6, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 0, 0, 0, 0},
+    {0, 7, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 25, 23, 25, 30, 30, 23, 30, 0},
+    {25, 0, 23, 25, 30, 25, 30, 25, 0},
+    {0, 0, 23, 9, 9, 9, 9, 9, 0},
+    {23, 23, 0, 30, 30, 25, 23, 30, 0},
+    {0, 17, 0, 9, 9, 9, 9, 9, 0},
+    {17, 0, 0, 9, 9, 9, 9, 9, 0},
+    {0, 0, 0, 9, 15, 9, 9, 9, 0},
+    {0, 0, 0, 22, 22, 17, 15, 22, 0},
+    {0, 0, 0, 9, 9, 17, 9, 9, 0},
+    {25, 25, 30, 0, 30, 25, 23, 25, 0},
+    {0, 9, 9, 0, 9, 9, 23, 9, 0},
+    {17, 0, 23, 0, 17, 25, 23, 25, 0},
+    {0, 0, 9, 0, 15, 9, 9, 9, 0},
+    {0, 0, 22, 0, 15, 15, 7, 22, 0},
+    {17, 17, 0, 0, 17, 17, 26, 17, 0},
+    {0, 9, 0, 0, 15, 9, 9, 9, 0},
+    {0, 0, 0, 0, 7, 17, 15, 15, 0},
+    {22, 0, 0, 0, 15, 17, 15, 22, 0},
+    {0, 0, 0, 0, 9, 9, 18, 9, 0},
+    {0, 9, 0, 0, 9, 15, 7, 9, 0},
+    {9, 0, 0, 0, 9, 17, 9, 9, 0},
+    {0, 0, 0, 0, 9, 7, 15, 9, 0},
+    {0, 0, 7, 0, 15, 22, 22, 15, 0},
+    {0, 7, 0, 0, 15, 22, 15, 22, 0},
+    {7, 0, 0, 0, 15, 17, 15, 15, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {30, 30, 30, 30, 0, 30, 30, 30, 0},
+    {0, 17, 26, 17, 0, 17, 26, 17, 0},
+    {9, 0, 9, 9, 0, 9, 9, 26, 0},
+    {0, 0, 15, 15, 0, 15, 15, 7, 0},
+    {0, 0, 22, 15, 0, 22, 15, 22, 0},
+    {9, 9, 0, 9, 0, 9, 26, 9, 0},
+    {0, 15, 0, 15, 0, 15, 7, 15, 0},
+    {0, 0, 0, 9, 0, 9, 9, 9, 0},
+    {22, 0, 0, 15, 0, 15, 7, 22, 0},
+    {0, 0, 0, 9, 0, 9, 18, 9, 0},
+    {0, 9, 0, 9, 0, 22, 9, 9, 0},
+    {9, 0, 0, 9, 0, 15, 9, 7, 0},
+    {0, 0, 0, 9, 0, 7, 9, 15, 0},
+    {9, 9, 9, 0, 0, 26, 9, 9, 0},
+    {0, 15, 15, 0, 0, 7, 15, 15, 0},
+    {0, 0, 9, 0, 0, 9, 9, 9, 0},
+    {15, 0, 15, 0, 0, 7, 15, 22, 0},
+    {0, 0, 9, 0, 0, 9, 9, 9, 0},
+    {0, 9, 0, 0, 0, 9, 9, 9, 0},
+    {9, 0, 0, 0, 0, 9, 9, 9, 0},
+    {0, 0, 0, 0, 0, 7, 7, 15, 0},
+    {9, 9, 0, 0, 0, 7, 9, 9, 0},
+    {0, 9, 0, 0, 0, 7, 9, 9, 0},
+    {9, 0, 0, 0, 0, 7, 9, 9, 0},
+    {0, 0, 0, 0, 0, 7, 9, 7, 0},
+    {0, 0, 0, 0, 0, 7, 7, 9, 0},
+    {0, 15, 15, 0, 0, 22, 22, 22, 0},
+    {15, 0, 15, 0, 0, 22, 15, 7, 0},
+    {0, 0, 9, 0, 0, 9, 9, 9, 0},
+    {15, 15, 0, 0, 0, 17, 7, 15, 0},
+    {0, 9, 0, 0, 0, 9, 9, 9, 0},
+    {9, 0, 0, 0, 0, 9, 9, 9, 0},
+    {0, 0, 0, 0, 0, 9, 7, 7, 0},
+    {0, 0, 0, 0, 0, 14, 7, 14, 0},
+    {0, 0, 0, 0, 0, 14, 9, 7, 0},
+    {0, 0, 7, 15, 0, 22, 15, 17, 0},
+    {0, 7, 0, 15, 0, 22, 15, 22, 0},
+    {7, 0, 0, 9, 0, 9, 9, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 15, 15, 0, 0, 17, 7, 22, 0},
+    {15, 0, 9, 0, 0, 9, 9, 9, 0},
+    {0, 0, 9, 0, 0, 9, 9, 9, 0},
+    {15, 9, 0, 0, 0, 9, 9, 9, 0},
+    {0, 9, 0, 0, 0, 9, 9, 9, 0},
+    {7, 0, 0, 0, 0, 9, 9, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 9, 7, 14, 0},
+    {0, 0, 0, 0, 0, 9, 7, 9, 0},
+    {30, 25, 25, 25, 30, 0, 30, 30, 0},
+    {0, 17, 17, 26, 26, 0, 26, 25, 0},
+    {17, 0, 17, 26, 26, 0, 23, 25, 0},
+    {0, 0, 9, 9, 15, 0, 9, 9, 0},
+    {0, 0, 17, 15, 22, 0, 22, 22, 0},
+    {17, 17, 0, 26, 26, 0, 23, 23, 0},
+    {0, 9, 0, 9, 15, 0, 9, 9, 0},
+    {0, 0, 0, 15, 7, 0, 15, 15, 0},
+    {17, 0, 0, 17, 15, 0, 17, 22, 0},
+    {0, 0, 0, 18, 18, 0, 18, 15, 0},
+    {0, 17, 0, 15, 22, 0, 22, 22, 0},
+    {17, 0, 0, 17, 15, 0, 22, 17, 0},
+    {0, 0, 0, 18, 18, 0, 15, 18, 0},
+    {9, 9, 9, 0, 23, 0, 9, 9, 0},
+    {0, 9, 9, 0, 7, 0, 9, 9, 0},
+    {0, 0, 9, 0, 7, 0, 9, 9, 0},
+    {15, 0, 17, 0, 7, 0, 15, 22, 0},
+    {0, 0, 9, 0, 9, 0, 9, 9, 0},
+    {0, 9, 0, 0, 7, 0, 9, 9, 0},
+    {9, 0, 0, 0, 15, 0, 9, 9, 0},
+    {0, 0, 0, 0, 7, 0, 9, 9, 0},
+    {15, 17, 0, 0, 7, 0, 15, 17, 0},
+    {0, 9, 0, 0, 9, 0, 9, 9, 0},
+    {9, 0, 0, 0, 15, 0, 9, 9, 0},
+    {0, 0, 0, 0, 7, 0, 9, 9, 0},
+    {0, 0, 0, 0, 7, 0, 7, 15, 0},
+    {0, 22, 22, 0, 22, 0, 22, 22, 0},
+    {22, 0, 17, 0, 22, 0, 22, 22, 0},
+    {0, 0, 18, 0, 9, 0, 9, 9, 0},
+    {22, 17, 0, 0, 17, 0, 22, 17, 0},
+    {0, 18, 0, 0, 9, 0, 9, 9, 0},
+    {15, 0, 0, 0, 9, 0, 9, 9, 0},
+    {0, 0, 0, 0, 9, 0, 9, 9, 0},
+    {0, 0, 0, 0, 14, 0, 14, 14, 0},
+    {0, 0, 0, 0, 14, 0, 14, 14, 0},
+    {9, 9, 9, 26, 0, 0, 9, 9, 0},
+    {0, 15, 15, 7, 0, 0, 15, 15, 0},
+    {0, 0, 9, 9, 0, 0, 9, 9, 0},
+    {22, 0, 15, 7, 0, 0, 15, 22, 0},
+    {0, 0, 9, 18, 0, 0, 9, 9, 0},
+    {0, 9, 0, 9, 0, 0, 9, 9, 0},
+    {9, 0, 0, 9, 0, 0, 9, 9, 0},
+    {0, 0, 0, 7, 0, 0, 7, 15, 0},
+    {22, 15, 0, 7, 0, 0, 22, 15, 0},
+    {0, 9, 0, 18, 0, 0, 9, 9, 0},
+    {9, 0, 0, 9, 0, 0, 9, 9, 0},
+    {0, 0, 0, 7, 0, 0, 15, 7, 0},
+    {0, 0, 0, 7, 0, 0, 14, 14, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {22, 22, 17, 0, 0, 0, 22, 22, 0},
+    {0, 18, 18, 0, 0, 0, 18, 18, 0},
+    {9, 0, 9, 0, 0, 0, 9, 18, 0},
+    {0, 0, 9, 0, 0, 0, 15, 7, 0},
+    {0, 0, 14, 0, 0, 0, 14, 14, 0},
+    {9, 9, 0, 0, 0, 0, 15, 9, 0},
+    {0, 9, 0, 0, 0, 0, 7, 9, 0},
+    {0, 0, 0, 0, 0, 0, 7, 9, 0},
+    {14, 0, 0, 0, 0, 0, 7, 14, 0},
+    {0, 0, 0, 0, 0, 0, 10, 9, 0},
+    {0, 14, 0, 0, 0, 0, 14, 14, 0},
+    {14, 0, 0, 0, 0, 0, 14, 7, 0},
+    {0, 0, 0, 0, 0, 0, 9, 10, 0},
+    {0, 22, 22, 17, 0, 0, 22, 22, 0},
+    {22, 0, 9, 9, 0, 0, 9, 9, 0},
+    {0, 0, 18, 9, 0, 0, 9, 9, 0},
+    {22, 9, 0, 9, 0, 0, 9, 9, 0},
+    {0, 18, 0, 9, 0, 0, 9, 9, 0},
+    {7, 0, 0, 9, 0, 0, 9, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 9, 0, 0, 9, 14, 0},
+    {0, 0, 0, 9, 0, 0, 14, 9, 0},
+    {17, 9, 9, 0, 0, 0, 9, 9, 0},
+    {0, 9, 9, 0, 0, 0, 15, 9, 0},
+    {7, 0, 15, 0, 0, 0, 15, 15, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 9, 0, 0, 0, 7, 14, 0},
+    {7, 15, 0, 0, 0, 0, 15, 15, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 0, 0, 0, 0, 0, 9, 9, 0},
+    {0, 0, 0, 0, 0, 0, 10, 7, 0},
+    {0, 9, 0, 0, 0, 0, 7, 9, 0},
+    {9, 0, 0, 0, 0, 0, 9, 9, 0},
+    {0, 0, 0, 0, 0, 0, 7, 9, 0},
+    {0, 0, 7, 0, 0, 0, 14, 14, 0},
+    {0, 7, 0, 0, 0, 0, 14, 14, 0},
+    {7, 0, 0, 0, 0, 0, 9, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 9, 9, 0, 9, 9, 0},
+    {0, 7, 0, 15, 15, 0, 15, 23, 0},
+    {7, 0, 0, 23, 15, 0, 15, 15, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 15, 0, 9, 0, 7, 9, 0},
+    {9, 0, 23, 0, 9, 0, 9, 9, 0},
+    {0, 0, 7, 0, 9, 0, 9, 9, 0},
+    {15, 23, 0, 0, 22, 0, 15, 23, 0},
+    {0, 9, 0, 0, 9, 0, 9, 9, 0},
+    {17, 0, 0, 0, 9, 0, 9, 9, 0},
+    {0, 0, 0, 0, 15, 0, 9, 9, 0},
+    {0, 0, 0, 0, 14, 0, 7, 14, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 15, 9, 0, 0, 9, 9, 0},
+    {9, 0, 15, 9, 0, 0, 9, 7, 0},
+    {0, 0, 7, 9, 0, 0, 9, 9, 0},
+    {15, 15, 0, 22, 0, 0, 7, 15, 0},
+    {0, 9, 0, 9, 0, 0, 9, 9, 0},
+    {9, 0, 0, 9, 0, 0, 9, 9, 0},
+    {0, 0, 0, 15, 0, 0, 7, 7, 0},
+    {0, 0, 0, 14, 0, 0, 7, 14, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 22, 0, 0, 0, 9, 9, 0},
+    {0, 9, 7, 0, 0, 0, 15, 9, 0},
+    {9, 0, 7, 0, 0, 0, 9, 15, 0},
+    {0, 0, 15, 0, 0, 0, 9, 7, 0},
+    {0, 0, 14, 0, 0, 0, 7, 9, 0},
+    {9, 9, 0, 0, 0, 0, 18, 9, 0},
+    {0, 15, 0, 0, 0, 0, 7, 15, 0},
+    {0, 0, 0, 0, 0, 0, 9, 9, 0},
+    {14, 0, 0, 0, 0, 0, 7, 14, 0},
+    {0, 0, 0, 0, 0, 0, 10, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 0, 9, 7, 0},
+    {0, 7, 0, 0, 0, 0, 7, 15, 0},
+    {7, 0, 0, 0, 0, 0, 7, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 0, 7, 9, 0},
+    {0, 7, 0, 0, 0, 0, 7, 15, 0},
+    {7, 0, 0, 0, 0, 0, 9, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {23, 30, 23, 23, 30, 30, 0, 25, 0},
+    {0, 9, 9, 17, 9, 9, 0, 9, 0},
+    {17, 0, 26, 17, 17, 17, 0, 17, 0},
+    {0, 0, 9, 9, 15, 9, 0, 9, 0},
+    {0, 0, 15, 7, 15, 22, 0, 22, 0},
+    {9, 9, 0, 9, 17, 9, 0, 9, 0},
+    {0, 9, 0, 9, 7, 9, 0, 9, 0},
+    {0, 0, 0, 9, 7, 9, 0, 9, 0},
+    {15, 0, 0, 15, 7, 17, 0, 22, 0},
+    {0, 0, 0, 9, 9, 9, 0, 9, 0},
+    {0, 9, 0, 7, 9, 22, 0, 9, 0},
+    {9, 0, 0, 9, 9, 22, 0, 9, 0},
+    {0, 0, 0, 18, 9, 7, 0, 9, 0},
+    {17, 9, 9, 0, 9, 9, 0, 9, 0},
+    {0, 9, 9, 0, 15, 9, 0, 9, 0},
+    {0, 0, 15, 0, 7, 15, 0, 17, 0},
+    {7, 0, 15, 0, 15, 15, 0, 17, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 0, 0, 7, 9, 0, 9, 0},
+    {9, 0, 0, 0, 9, 9, 0, 9, 0},
+    {0, 0, 0, 0, 7, 9, 0, 9, 0},
+    {7, 9, 0, 0, 9, 15, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {15, 0, 0, 0, 9, 7, 0, 9, 0},
+    {0, 0, 0, 0, 9, 9, 0, 9, 0},
+    {0, 22, 15, 0, 22, 22, 0, 17, 0},
+    {22, 0, 15, 0, 15, 22, 0, 17, 0},
+    {0, 0, 18, 0, 9, 9, 0, 9, 0},
+    {15, 15, 0, 0, 7, 22, 0, 17, 0},
+    {0, 9, 0, 0, 9, 9, 0, 9, 0},
+    {9, 0, 0, 0, 9, 9, 0, 9, 0},
+    {0, 0, 0, 0, 7, 9, 0, 9, 0},
+    {0, 0, 0, 0, 7, 14, 0, 14, 0},
+    {0, 0, 0, 0, 9, 14, 0, 9, 0},
+    {9, 9, 26, 9, 0, 9, 0, 9, 0},
+    {0, 15, 7, 15, 0, 15, 0, 15, 0},
+    {0, 0, 9, 9, 0, 9, 0, 9, 0},
+    {15, 0, 7, 15, 0, 15, 0, 17, 0},
+    {0, 0, 9, 9, 0, 9, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 0, 9, 0, 22, 0, 9, 0},
+    {0, 9, 0, 18, 0, 7, 0, 9, 0},
+    {9, 0, 0, 9, 0, 7, 0, 18, 0},
+    {0, 0, 0, 9, 0, 15, 0, 7, 0},
+    {0, 0, 0, 7, 0, 14, 0, 9, 0},
+    {0, 9, 9, 0, 0, 9, 0, 9, 0},
+    {9, 0, 9, 0, 0, 9, 0, 9, 0},
+    {0, 0, 7, 0, 0, 7, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 0, 0, 0, 7, 0, 9, 0},
+    {0, 9, 0, 0, 0, 7, 0, 9, 0},
+    {0, 0, 0, 0, 0, 7, 0, 9, 0},
+    {7, 0, 0, 0, 0, 7, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {22, 15, 7, 0, 0, 22, 0, 15, 0},
+    {0, 9, 18, 0, 0, 9, 0, 9, 0},
+    {9, 0, 9, 0, 0, 9, 0, 9, 0},
+    {0, 0, 7, 0, 0, 15, 0, 7, 0},
+    {0, 0, 7, 0, 0, 14, 0, 14, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 0, 0, 0, 14, 0, 9, 0},
+    {9, 0, 0, 0, 0, 14, 0, 7, 0},
+    {0, 0, 0, 0, 0, 7, 0, 10, 0},
+    {0, 15, 15, 7, 0, 22, 0, 22, 0},
+    {15, 0, 9, 9, 0, 9, 0, 9, 0},
+    {0, 0, 9, 9, 0, 9, 0, 9, 0},
+    {15, 9, 0, 9, 0, 9, 0, 9, 0},
+    {0, 9, 0, 9, 0, 9, 0, 9, 0},
+    {7, 0, 0, 9, 0, 9, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 7, 0, 9, 0, 14, 0},
+    {0, 0, 0, 7, 0, 14, 0, 9, 0},
+    {7, 9, 9, 0, 0, 9, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 9, 0, 0, 9, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 9, 0, 0, 0, 9, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 9, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 9, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 14, 0, 9, 0},
+    {0, 7, 0, 0, 0, 14, 0, 9, 0},
+    {7, 0, 0, 0, 0, 9, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {17, 17, 17, 26, 26, 0, 0, 17, 0},
+    {0, 9, 9, 9, 15, 0, 0, 9, 0},
+    {0, 0, 17, 17, 7, 0, 0, 17, 0},
+    {22, 0, 17, 15, 15, 0, 0, 17, 0},
+    {0, 0, 9, 18, 9, 0, 0, 9, 0},
+    {0, 9, 0, 9, 7, 0, 0, 9, 0},
+    {9, 0, 0, 9, 15, 0, 0, 9, 0},
+    {0, 0, 0, 9, 7, 0, 0, 9, 0},
+    {22, 22, 0, 15, 22, 0, 0, 17, 0},
+    {0, 9, 0, 18, 9, 0, 0, 9, 0},
+    {17, 0, 0, 18, 18, 0, 0, 17, 0},
+    {0, 0, 0, 9, 15, 0, 0, 9, 0},
+    {0, 0, 0, 7, 14, 0, 0, 14, 0},
+    {0, 9, 9, 0, 7, 0, 0, 9, 0},
+    {9, 0, 9, 0, 9, 0, 0, 9, 0},
+    {0, 0, 9, 0, 7, 0, 0, 9, 0},
+    {0, 0, 0, 0, 7, 0, 0, 9, 0},
+    {9, 9, 0, 0, 9, 0, 0, 9, 0},
+    {0, 9, 0, 0, 7, 0, 0, 9, 0},
+    {0, 0, 0, 0, 7, 0, 0, 9, 0},
+    {7, 0, 0, 0, 7, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {22, 22, 22, 0, 22, 0, 0, 22, 0},
+    {0, 18, 18, 0, 18, 0, 0, 17, 0},
+    {17, 0, 18, 0, 18, 0, 0, 17, 0},
+    {0, 0, 9, 0, 15, 0, 0, 9, 0},
+    {0, 0, 14, 0, 14, 0, 0, 14, 0},
+    {9, 9, 0, 0, 18, 0, 0, 9, 0},
+    {0, 9, 0, 0, 7, 0, 0, 9, 0},
+    {0, 0, 0, 0, 7, 0, 0, 9, 0},
+    {14, 0, 0, 0, 7, 0, 0, 14, 0},
+    {0, 0, 0, 0, 10, 0, 0, 9, 0},
+    {0, 14, 0, 0, 14, 0, 0, 14, 0},
+    {14, 0, 0, 0, 14, 0, 0, 14, 0},
+    {0, 0, 0, 0, 10, 0, 0, 10, 0},
+    {0, 9, 9, 9, 0, 0, 0, 9, 0},
+    {9, 0, 9, 9, 0, 0, 0, 9, 0},
+    {0, 0, 7, 7, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 0, 18, 0, 0, 0, 9, 0},
+    {0, 15, 0, 7, 0, 0, 0, 9, 0},
+    {0, 0, 0, 9, 0, 0, 0, 9, 0},
+    {14, 0, 0, 7, 0, 0, 0, 9, 0},
+    {0, 0, 0, 10, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 18, 0, 0, 0, 0, 9, 0},
+    {0, 15, 7, 0, 0, 0, 0, 15, 0},
+    {0, 0, 9, 0, 0, 0, 0, 9, 0},
+    {14, 0, 7, 0, 0, 0, 0, 14, 0},
+    {0, 0, 10, 0, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {14, 14, 0, 0, 0, 0, 0, 14, 0},
+    {0, 10, 0, 0, 0, 0, 0, 10, 0},
+    {9, 0, 0, 0, 0, 0, 0, 10, 0},
+    {0, 0, 0, 0, 0, 0, 0, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 6, 0},
+    {22, 9, 9, 9, 0, 0, 0, 9, 0},
+    {0, 9, 9, 18, 0, 0, 0, 9, 0},
+    {7, 0, 18, 18, 0, 0, 0, 17, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 9, 7, 0, 0, 0, 14, 0},
+    {7, 15, 0, 18, 0, 0, 0, 15, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 0, 0, 9, 0, 0, 0, 9, 0},
+    {0, 0, 0, 10, 0, 0, 0, 7, 0},
+    {0, 14, 0, 7, 0, 0, 0, 14, 0},
+    {14, 0, 0, 9, 0, 0, 0, 9, 0},
+    {0, 0, 0, 10, 0, 0, 0, 9, 0},
+    {7, 9, 9, 0, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 9, 0, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 0, 0, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 9, 0, 0, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 14, 14, 0, 0, 0, 0, 14, 0},
+    {14, 0, 9, 0, 0, 0, 0, 9, 0},
+    {0, 0, 10, 0, 0, 0, 0, 9, 0},
+    {14, 9, 0, 0, 0, 0, 0, 9, 0},
+    {0, 10, 0, 0, 0, 0, 0, 9, 0},
+    {7, 0, 0, 0, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 6, 0},
+    {0, 0, 0, 0, 0, 0, 0, 6, 0},
+    {0, 9, 15, 7, 9, 0, 0, 9, 0},
+    {9, 0, 15, 9, 9, 0, 0, 9, 0},
+    {0, 0, 7, 9, 9, 0, 0, 9, 0},
+    {15, 15, 0, 15, 7, 0, 0, 17, 0},
+    {0, 9, 0, 9, 9, 0, 0, 9, 0},
+    {9, 0, 0, 9, 9, 0, 0, 9, 0},
+    {0, 0, 0, 9, 7, 0, 0, 9, 0},
+    {0, 0, 0, 7, 7, 0, 0, 15, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 9, 15, 0, 9, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {15, 0, 7, 0, 9, 0, 0, 9, 0},
+    {0, 0, 9, 0, 9, 0, 0, 9, 0},
+    {9, 9, 0, 0, 9, 0, 0, 9, 0},
+    {0, 9, 0, 0, 7, 0, 0, 9, 0},
+    {0, 0, 0, 0, 7, 0, 0, 9, 0},
+    {7, 0, 0, 0, 7, 0, 0, 15, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 9, 0, 0, 9, 0},
+    {0, 7, 0, 0, 7, 0, 0, 9, 0},
+    {7, 0, 0, 0, 7, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 7, 9, 0, 0, 0, 9, 0},
+    {0, 9, 7, 9, 0, 0, 0, 9, 0},
+    {9, 0, 7, 9, 0, 0, 0, 9, 0},
+    {0, 0, 7, 9, 0, 0, 0, 7, 0},
+    {0, 0, 7, 7, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 7, 0, 0, 0, 0, 9, 0},
+    {0, 9, 7, 0, 0, 0, 0, 9, 0},
+    {0, 0, 7, 0, 0, 0, 0, 9, 0},
+    {7, 0, 7, 0, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 7, 0, 0, 0, 0, 9, 0},
+    {9, 0, 7, 0, 0, 0, 0, 7, 0},
+    {0, 0, 7, 0, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 7, 0, 0, 0, 9, 0},
+    {0, 7, 0, 7, 0, 0, 0, 9, 0},
+    {7, 0, 0, 9, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 9, 0, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 9, 0, 0, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 9, 9, 9, 0, 15, 0},
+    {0, 7, 0, 9, 9, 9, 0, 22, 0},
+    {7, 0, 0, 9, 9, 9, 0, 15, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 0, 9, 9, 0, 17, 0},
+    {9, 0, 9, 0, 9, 9, 0, 17, 0},
+    {0, 0, 15, 0, 9, 9, 0, 7, 0},
+    {9, 9, 0, 0, 9, 9, 0, 22, 0},
+    {0, 18, 0, 0, 9, 9, 0, 7, 0},
+    {15, 0, 0, 0, 9, 9, 0, 7, 0},
+    {0, 0, 0, 0, 9, 9, 0, 9, 0},
+    {0, 0, 0, 0, 9, 9, 0, 14, 0},
+    {0, 0, 0, 0, 9, 9, 0, 9, 0},
+    {0, 9, 9, 9, 0, 9, 0, 22, 0},
+    {9, 0, 9, 9, 0, 9, 0, 7, 0},
+    {0, 0, 9, 9, 0, 9, 0, 7, 0},
+    {9, 9, 0, 9, 0, 9, 0, 22, 0},
+    {0, 18, 0, 9, 0, 9, 0, 7, 0},
+    {9, 0, 0, 9, 0, 9, 0, 7, 0},
+    {0, 0, 0, 9, 0, 9, 0, 7, 0},
+    {0, 0, 0, 9, 0, 9, 0, 14, 0},
+    {0, 0, 0, 9, 0, 9, 0, 7, 0},
+    {9, 9, 9, 0, 0, 7, 0, 15, 0},
+    {0, 9, 9, 0, 0, 15, 0, 7, 0},
+    {9, 0, 9, 0, 0, 9, 0, 7, 0},
+    {0, 0, 9, 0, 0, 7, 0, 7, 0},
+    {0, 0, 9, 0, 0, 7, 0, 14, 0},
+    {9, 9, 0, 0, 0, 18, 0, 7, 0},
+    {0, 9, 0, 0, 0, 7, 0, 15, 0},
+    {0, 0, 0, 0, 0, 9, 0, 7, 0},
+    {9, 0, 0, 0, 0, 7, 0, 14, 0},
+    {0, 0, 0, 0, 0, 10, 0, 7, 0},
+    {0, 9, 0, 0, 0, 7, 0, 9, 0},
+    {9, 0, 0, 0, 0, 7, 0, 7, 0},
+    {0, 0, 0, 0, 0, 7, 0, 7, 0},
+    {0, 0, 7, 0, 0, 9, 0, 7, 0},
+    {0, 7, 0, 0, 0, 9, 0, 14, 0},
+    {7, 0, 0, 0, 0, 9, 0, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 9, 0, 9, 0},
+    {0, 7, 0, 0, 0, 9, 0, 14, 0},
+    {7, 0, 0, 0, 0, 9, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 9, 9, 0, 0, 22, 0},
+    {9, 0, 9, 9, 9, 0, 0, 17, 0},
+    {0, 0, 15, 9, 9, 0, 0, 7, 0},
+    {9, 9, 0, 9, 9, 0, 0, 17, 0},
+    {0, 18, 0, 9, 9, 0, 0, 7, 0},
+    {15, 0, 0, 9, 9, 0, 0, 7, 0},
+    {0, 0, 0, 9, 9, 0, 0, 9, 0},
+    {0, 0, 0, 9, 9, 0, 0, 14, 0},
+    {0, 0, 0, 9, 9, 0, 0, 9, 0},
+    {9, 9, 9, 0, 7, 0, 0, 17, 0},
+    {0, 9, 9, 0, 15, 0, 0, 7, 0},
+    {9, 0, 9, 0, 15, 0, 0, 7, 0},
+    {0, 0, 9, 0, 7, 0, 0, 9, 0},
+    {0, 0, 9, 0, 7, 0, 0, 14, 0},
+    {9, 9, 0, 0, 15, 0, 0, 7, 0},
+    {0, 9, 0, 0, 7, 0, 0, 9, 0},
+    {0, 0, 0, 0, 7, 0, 0, 7, 0},
+    {9, 0, 0, 0, 7, 0, 0, 14, 0},
+    {0, 0, 0, 0, 10, 0, 0, 7, 0},
+    {0, 9, 0, 0, 7, 0, 0, 9, 0},
+    {9, 0, 0, 0, 7, 0, 0, 9, 0},
+    {0, 0, 0, 0, 7, 0, 0, 7, 0},
+    {0, 0, 7, 0, 9, 0, 0, 15, 0},
+    {0, 7, 0, 0, 9, 0, 0, 14, 0},
+    {7, 0, 0, 0, 9, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 9, 7, 0, 0, 0, 15, 0},
+    {0, 9, 9, 18, 0, 0, 0, 7, 0},
+    {9, 0, 9, 9, 0, 0, 0, 7, 0},
+    {0, 0, 9, 7, 0, 0, 0, 7, 0},
+    {0, 0, 9, 7, 0, 0, 0, 14, 0},
+    {9, 9, 0, 15, 0, 0, 0, 7, 0},
+    {0, 9, 0, 7, 0, 0, 0, 9, 0},
+    {0, 0, 0, 7, 0, 0, 0, 7, 0},
+    {9, 0, 0, 7, 0, 0, 0, 14, 0},
+    {0, 0, 0, 10, 0, 0, 0, 7, 0},
+    {0, 9, 0, 7, 0, 0, 0, 15, 0},
+    {9, 0, 0, 7, 0, 0, 0, 7, 0},
+    {0, 0, 0, 9, 0, 0, 0, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 0, 0, 0, 0, 14, 0},
+    {9, 0, 9, 0, 0, 0, 0, 7, 0},
+    {0, 0, 9, 0, 0, 0, 0, 7, 0},
+    {9, 9, 0, 0, 0, 0, 0, 9, 0},
+    {0, 10, 0, 0, 0, 0, 0, 7, 0},
+    {7, 0, 0, 0, 0, 0, 0, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 6, 0},
+    {0, 0, 0, 0, 0, 0, 0, 7, 0},
+    {0, 0, 7, 9, 0, 0, 0, 9, 0},
+    {0, 7, 0, 9, 0, 0, 0, 14, 0},
+    {7, 0, 0, 9, 0, 0, 0, 9, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 0, 0, 0, 0, 9, 0},
+    {9, 0, 9, 0, 0, 0, 0, 9, 0},
+    {0, 0, 7, 0, 0, 0, 0, 7, 0},
+    {9, 9, 0, 0, 0, 0, 0, 9, 0},
+    {0, 10, 0, 0, 0, 0, 0, 7, 0},
+    {7, 0, 0, 0, 0, 0, 0, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 6, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 9, 0, 0, 9, 0},
+    {0, 7, 0, 0, 9, 0, 0, 14, 0},
+    {7, 0, 0, 0, 9, 0, 0, 15, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 9, 0, 0, 0, 7, 0},
+    {0, 7, 0, 9, 0, 0, 0, 14, 0},
+    {7, 0, 0, 9, 0, 0, 0, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 0, 0, 0, 0, 9, 0},
+    {9, 0, 9, 0, 0, 0, 0, 7, 0},
+    {0, 0, 7, 0, 0, 0, 0, 7, 0},
+    {9, 9, 0, 0, 0, 0, 0, 14, 0},
+    {0, 10, 0, 0, 0, 0, 0, 7, 0},
+    {9, 0, 0, 0, 0, 0, 0, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 7, 0},
+    {0, 0, 0, 0, 0, 0, 0, 6, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {30, 25, 30, 25, 30, 30, 25, 0, 0},
+    {0, 26, 26, 17, 26, 25, 17, 0, 0},
+    {9, 0, 9, 9, 23, 9, 9, 0, 0},
+    {0, 0, 9, 9, 7, 9, 9, 0, 0},
+    {0, 0, 22, 22, 22, 22, 22, 0, 0},
+    {17, 26, 0, 17, 26, 17, 17, 0, 0},
+    {0, 9, 0, 9, 15, 9, 9, 0, 0},
+    {0, 0, 0, 9, 7, 9, 9, 0, 0},
+    {22, 0, 0, 22, 22, 22, 22, 0, 0},
+    {0, 0, 0, 18, 18, 17, 18, 0, 0},
+    {0, 9, 0, 9, 9, 22, 9, 0, 0},
+    {9, 0, 0, 9, 7, 17, 9, 0, 0},
+    {0, 0, 0, 9, 15, 7, 9, 0, 0},
+    {17, 26, 23, 0, 26, 25, 17, 0, 0},
+    {0, 9, 9, 0, 15, 9, 9, 0, 0},
+    {0, 0, 9, 0, 7, 9, 9, 0, 0},
+    {22, 0, 22, 0, 22, 22, 17, 0, 0},
+    {0, 0, 9, 0, 9, 9, 18, 0, 0},
+    {0, 17, 0, 0, 7, 17, 17, 0, 0},
+    {17, 0, 0, 0, 18, 17, 18, 0, 0},
+    {0, 0, 0, 0, 15, 9, 9, 0, 0},
+    {9, 9, 0, 0, 9, 17, 9, 0, 0},
+    {0, 9, 0, 0, 9, 7, 15, 0, 0},
+    {9, 0, 0, 0, 15, 7, 9, 0, 0},
+    {0, 0, 0, 0, 7, 9, 9, 0, 0},
+    {0, 0, 0, 0, 9, 15, 7, 0, 0},
+    {0, 15, 22, 0, 22, 22, 17, 0, 0},
+    {15, 0, 15, 0, 7, 22, 17, 0, 0},
+    {0, 0, 9, 0, 9, 9, 9, 0, 0},
+    {22, 15, 0, 0, 15, 17, 17, 0, 0},
+    {0, 18, 0, 0, 9, 9, 9, 0, 0},
+    {9, 0, 0, 0, 9, 9, 9, 0, 0},
+    {0, 0, 0, 0, 7, 9, 9, 0, 0},
+    {0, 0, 0, 0, 14, 14, 14, 0, 0},
+    {0, 0, 0, 0, 7, 14, 9, 0, 0},
+    {9, 26, 9, 9, 0, 9, 9, 0, 0},
+    {0, 7, 15, 15, 0, 15, 15, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {22, 0, 22, 22, 0, 22, 17, 0, 0},
+    {0, 0, 18, 18, 0, 18, 18, 0, 0},
+    {0, 9, 0, 9, 0, 9, 9, 0, 0},
+    {9, 0, 0, 9, 0, 9, 18, 0, 0},
+    {0, 0, 0, 15, 0, 15, 7, 0, 0},
+    {9, 7, 0, 9, 0, 15, 9, 0, 0},
+    {0, 18, 0, 9, 0, 7, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 9, 0, 14, 9, 0, 0},
+    {0, 9, 9, 0, 0, 9, 9, 0, 0},
+    {9, 0, 9, 0, 0, 18, 9, 0, 0},
+    {0, 0, 15, 0, 0, 7, 9, 0, 0},
+    {0, 0, 0, 0, 0, 9, 9, 0, 0},
+    {9, 9, 0, 0, 0, 7, 9, 0, 0},
+    {0, 7, 0, 0, 0, 7, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 0, 0, 0, 0, 7, 9, 0, 0},
+    {0, 0, 0, 0, 0, 7, 9, 0, 0},
+    {22, 7, 15, 0, 0, 22, 15, 0, 0},
+    {0, 18, 9, 0, 0, 9, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 14, 0, 0, 14, 14, 0, 0},
+    {9, 9, 0, 0, 0, 9, 9, 0, 0},
+    {0, 7, 0, 0, 0, 9, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {14, 0, 0, 0, 0, 14, 7, 0, 0},
+    {0, 0, 0, 0, 0, 9, 10, 0, 0},
+    {0, 7, 0, 0, 0, 14, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 17, 22, 22, 0, 22, 22, 0, 0},
+    {17, 0, 9, 9, 0, 9, 9, 0, 0},
+    {0, 0, 15, 9, 0, 9, 9, 0, 0},
+    {22, 9, 0, 9, 0, 9, 9, 0, 0},
+    {0, 18, 0, 9, 0, 9, 9, 0, 0},
+    {7, 0, 0, 9, 0, 9, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 14, 0, 14, 14, 0, 0},
+    {0, 0, 0, 9, 0, 9, 9, 0, 0},
+    {22, 9, 9, 0, 0, 9, 9, 0, 0},
+    {0, 9, 9, 0, 0, 9, 18, 0, 0},
+    {7, 0, 15, 0, 0, 15, 15, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 14, 0, 0, 14, 7, 0, 0},
+    {7, 18, 0, 0, 0, 17, 18, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {14, 0, 0, 0, 0, 9, 9, 0, 0},
+    {0, 0, 0, 0, 0, 9, 10, 0, 0},
+    {0, 9, 0, 0, 0, 9, 7, 0, 0},
+    {9, 0, 0, 0, 0, 9, 9, 0, 0},
+    {0, 0, 0, 0, 0, 7, 7, 0, 0},
+    {0, 0, 7, 0, 0, 14, 9, 0, 0},
+    {0, 7, 0, 0, 0, 14, 9, 0, 0},
+    {7, 0, 0, 0, 0, 9, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {17, 26, 17, 26, 26, 0, 17, 0, 0},
+    {0, 9, 9, 9, 15, 0, 9, 0, 0},
+    {0, 0, 9, 9, 7, 0, 9, 0, 0},
+    {22, 0, 22, 22, 22, 0, 17, 0, 0},
+    {0, 0, 17, 18, 18, 0, 18, 0, 0},
+    {0, 17, 0, 15, 7, 0, 15, 0, 0},
+    {17, 0, 0, 18, 18, 0, 18, 0, 0},
+    {0, 0, 0, 9, 15, 0, 9, 0, 0},
+    {22, 17, 0, 17, 15, 0, 17, 0, 0},
+    {0, 17, 0, 18, 18, 0, 17, 0, 0},
+    {9, 0, 0, 9, 15, 0, 9, 0, 0},
+    {0, 0, 0, 9, 7, 0, 9, 0, 0},
+    {0, 0, 0, 15, 14, 0, 14, 0, 0},
+    {0, 9, 9, 0, 7, 0, 9, 0, 0},
+    {9, 0, 9, 0, 18, 0, 9, 0, 0},
+    {0, 0, 9, 0, 7, 0, 9, 0, 0},
+    {0, 0, 0, 0, 7, 0, 9, 0, 0},
+    {9, 9, 0, 0, 15, 0, 9, 0, 0},
+    {0, 9, 0, 0, 7, 0, 9, 0, 0},
+    {0, 0, 0, 0, 7, 0, 9, 0, 0},
+    {15, 0, 0, 0, 7, 0, 9, 0, 0},
+    {0, 0, 0, 0, 9, 0, 9, 0, 0},
+    {22, 22, 17, 0, 22, 0, 22, 0, 0},
+    {0, 18, 18, 0, 18, 0, 17, 0, 0},
+    {9, 0, 9, 0, 18, 0, 9, 0, 0},
+    {0, 0, 9, 0, 7, 0, 9, 0, 0},
+    {0, 0, 14, 0, 14, 0, 14, 0, 0},
+    {15, 18, 0, 0, 18, 0, 18, 0, 0},
+    {0, 9, 0, 0, 9, 0, 9, 0, 0},
+    {0, 0, 0, 0, 7, 0, 7, 0, 0},
+    {14, 0, 0, 0, 14, 0, 14, 0, 0},
+    {0, 0, 0, 0, 10, 0, 10, 0, 0},
+    {0, 14, 0, 0, 14, 0, 14, 0, 0},
+    {14, 0, 0, 0, 7, 0, 14, 0, 0},
+    {0, 0, 0, 0, 10, 0, 9, 0, 0},
+    {0, 9, 9, 9, 0, 0, 9, 0, 0},
+    {9, 0, 9, 18, 0, 0, 9, 0, 0},
+    {0, 0, 15, 7, 0, 0, 9, 0, 0},
+    {0, 0, 0, 9, 0, 0, 9, 0, 0},
+    {9, 9, 0, 9, 0, 0, 9, 0, 0},
+    {0, 7, 0, 7, 0, 0, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {14, 0, 0, 7, 0, 0, 9, 0, 0},
+    {0, 0, 0, 10, 0, 0, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 18, 9, 0, 0, 0, 9, 0, 0},
+    {0, 7, 9, 0, 0, 0, 15, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {14, 0, 14, 0, 0, 0, 14, 0, 0},
+    {0, 0, 10, 0, 0, 0, 10, 0, 0},
+    {0, 9, 0, 0, 0, 0, 7, 0, 0},
+    {9, 0, 0, 0, 0, 0, 10, 0, 0},
+    {0, 0, 0, 0, 0, 0, 7, 0, 0},
+    {14, 7, 0, 0, 0, 0, 14, 0, 0},
+    {0, 10, 0, 0, 0, 0, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 6, 0, 0},
+    {22, 9, 9, 9, 0, 0, 9, 0, 0},
+    {0, 18, 18, 18, 0, 0, 18, 0, 0},
+    {7, 0, 15, 18, 0, 0, 15, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 14, 14, 0, 0, 14, 0, 0},
+    {7, 18, 0, 18, 0, 0, 18, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {14, 0, 0, 9, 0, 0, 9, 0, 0},
+    {0, 0, 0, 10, 0, 0, 10, 0, 0},
+    {0, 9, 0, 9, 0, 0, 14, 0, 0},
+    {9, 0, 0, 9, 0, 0, 9, 0, 0},
+    {0, 0, 0, 10, 0, 0, 7, 0, 0},
+    {7, 18, 15, 0, 0, 0, 15, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {14, 0, 9, 0, 0, 0, 9, 0, 0},
+    {0, 0, 9, 0, 0, 0, 10, 0, 0},
+    {7, 0, 0, 0, 0, 0, 10, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 0, 0, 0, 0, 9, 0, 0},
+    {0, 9, 0, 0, 0, 0, 7, 0, 0},
+    {7, 0, 0, 0, 0, 0, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 7, 0, 0},
+    {0, 14, 14, 0, 0, 0, 14, 0, 0},
+    {14, 0, 9, 0, 0, 0, 9, 0, 0},
+    {0, 0, 10, 0, 0, 0, 9, 0, 0},
+    {14, 9, 0, 0, 0, 0, 9, 0, 0},
+    {0, 10, 0, 0, 0, 0, 9, 0, 0},
+    {7, 0, 0, 0, 0, 0, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 6, 0, 0},
+    {0, 0, 0, 0, 0, 0, 6, 0, 0},
+    {0, 9, 23, 9, 9, 0, 9, 0, 0},
+    {9, 0, 15, 9, 7, 0, 9, 0, 0},
+    {0, 0, 7, 9, 9, 0, 9, 0, 0},
+    {23, 15, 0, 23, 15, 0, 17, 0, 0},
+    {0, 17, 0, 9, 9, 0, 9, 0, 0},
+    {9, 0, 0, 9, 9, 0, 9, 0, 0},
+    {0, 0, 0, 9, 7, 0, 9, 0, 0},
+    {0, 0, 0, 14, 14, 0, 15, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 23, 0, 9, 0, 9, 0, 0},
+    {0, 9, 7, 0, 9, 0, 18, 0, 0},
+    {9, 0, 7, 0, 15, 0, 9, 0, 0},
+    {0, 0, 9, 0, 7, 0, 9, 0, 0},
+    {0, 0, 14, 0, 9, 0, 7, 0, 0},
+    {17, 17, 0, 0, 17, 0, 17, 0, 0},
+    {0, 9, 0, 0, 15, 0, 9, 0, 0},
+    {0, 0, 0, 0, 7, 0, 9, 0, 0},
+    {14, 0, 0, 0, 14, 0, 15, 0, 0},
+    {0, 0, 0, 0, 9, 0, 10, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 7, 0, 9, 0, 0},
+    {0, 7, 0, 0, 15, 0, 9, 0, 0},
+    {7, 0, 0, 0, 7, 0, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 7, 15, 9, 0, 0, 9, 0, 0},
+    {0, 18, 7, 9, 0, 0, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 14, 9, 0, 0, 9, 0, 0},
+    {9, 9, 0, 9, 0, 0, 9, 0, 0},
+    {0, 7, 0, 15, 0, 0, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {14, 0, 0, 14, 0, 0, 7, 0, 0},
+    {0, 0, 0, 9, 0, 0, 10, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 18, 7, 0, 0, 0, 9, 0, 0},
+    {0, 7, 15, 0, 0, 0, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 0, 14, 0, 0, 0, 9, 0, 0},
+    {0, 0, 7, 0, 0, 0, 10, 0, 0},
+    {0, 9, 0, 0, 0, 0, 9, 0, 0},
+    {9, 0, 0, 0, 0, 0, 10, 0, 0},
+    {0, 0, 0, 0, 0, 0, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 7, 15, 0, 0, 0, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {15, 7, 0, 0, 0, 0, 7, 0, 0},
+    {0, 9, 0, 0, 0, 0, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 7, 0, 0},
+    {0, 0, 7, 9, 0, 0, 9, 0, 0},
+    {0, 7, 0, 15, 0, 0, 9, 0, 0},
+    {7, 0, 0, 9, 0, 0, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 15, 0, 0, 0, 7, 0, 0},
+    {9, 0, 9, 0, 0, 0, 9, 0, 0},
+    {0, 0, 7, 0, 0, 0, 9, 0, 0},
+    {15, 9, 0, 0, 0, 0, 9, 0, 0},
+    {0, 9, 0, 0, 0, 0, 9, 0, 0},
+    {7, 0, 0, 0, 0, 0, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {17, 26, 23, 17, 26, 23, 0, 0, 0},
+    {0, 9, 9, 9, 15, 9, 0, 0, 0},
+    {0, 0, 9, 9, 7, 9, 0, 0, 0},
+    {22, 0, 22, 17, 17, 17, 0, 0, 0},
+    {0, 0, 9, 18, 9, 9, 0, 0, 0},
+    {0, 9, 0, 9, 7, 9, 0, 0, 0},
+    {9, 0, 0, 9, 18, 9, 0, 0, 0},
+    {0, 0, 0, 9, 7, 9, 0, 0, 0},
+    {9, 9, 0, 9, 9, 17, 0, 0, 0},
+    {0, 9, 0, 18, 9, 7, 0, 0, 0},
+    {9, 0, 0, 9, 15, 7, 0, 0, 0},
+    {0, 0, 0, 9, 7, 9, 0, 0, 0},
+    {0, 0, 0, 7, 9, 14, 0, 0, 0},
+    {0, 15, 15, 0, 7, 15, 0, 0, 0},
+    {15, 0, 9, 0, 9, 9, 0, 0, 0},
+    {0, 0, 9, 0, 9, 9, 0, 0, 0},
+    {0, 0, 0, 0, 7, 9, 0, 0, 0},
+    {15, 9, 0, 0, 9, 7, 0, 0, 0},
+    {0, 9, 0, 0, 9, 9, 0, 0, 0},
+    {0, 0, 0, 0, 7, 7, 0, 0, 0},
+    {7, 0, 0, 0, 9, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {17, 17, 17, 0, 15, 22, 0, 0, 0},
+    {0, 18, 18, 0, 18, 15, 0, 0, 0},
+    {9, 0, 9, 0, 15, 9, 0, 0, 0},
+    {0, 0, 9, 0, 7, 9, 0, 0, 0},
+    {0, 0, 14, 0, 14, 14, 0, 0, 0},
+    {9, 9, 0, 0, 15, 9, 0, 0, 0},
+    {0, 9, 0, 0, 7, 9, 0, 0, 0},
+    {0, 0, 0, 0, 7, 9, 0, 0, 0},
+    {14, 0, 0, 0, 7, 14, 0, 0, 0},
+    {0, 0, 0, 0, 10, 9, 0, 0, 0},
+    {0, 9, 0, 0, 9, 14, 0, 0, 0},
+    {9, 0, 0, 0, 7, 14, 0, 0, 0},
+    {0, 0, 0, 0, 10, 7, 0, 0, 0},
+    {0, 9, 9, 9, 0, 9, 0, 0, 0},
+    {9, 0, 15, 9, 0, 9, 0, 0, 0},
+    {0, 0, 7, 9, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 15, 0, 9, 0, 7, 0, 0, 0},
+    {0, 7, 0, 9, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 0, 0, 9, 0, 9, 0, 0, 0},
+    {0, 0, 0, 10, 0, 7, 0, 0, 0},
+    {0, 0, 7, 0, 0, 9, 0, 0, 0},
+    {0, 7, 0, 0, 0, 7, 0, 0, 0},
+    {7, 0, 0, 0, 0, 7, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 9, 0, 0, 9, 0, 0, 0},
+    {0, 7, 7, 0, 0, 15, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {14, 0, 7, 0, 0, 14, 0, 0, 0},
+    {0, 0, 10, 0, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 7, 0, 0, 0, 14, 0, 0, 0},
+    {0, 10, 0, 0, 0, 7, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 6, 0, 0, 0},
+    {22, 9, 9, 9, 0, 9, 0, 0, 0},
+    {0, 9, 9, 18, 0, 9, 0, 0, 0},
+    {7, 0, 15, 15, 0, 15, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 14, 7, 0, 14, 0, 0, 0},
+    {7, 18, 0, 15, 0, 15, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {14, 0, 0, 9, 0, 9, 0, 0, 0},
+    {0, 0, 0, 10, 0, 9, 0, 0, 0},
+    {0, 9, 0, 7, 0, 14, 0, 0, 0},
+    {9, 0, 0, 9, 0, 9, 0, 0, 0},
+    {0, 0, 0, 10, 0, 7, 0, 0, 0},
+    {7, 9, 9, 0, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 9, 0, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 9, 0, 0, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 7, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 0, 0, 14, 0, 0, 0},
+    {9, 0, 9, 0, 0, 9, 0, 0, 0},
+    {0, 0, 10, 0, 0, 7, 0, 0, 0},
+    {9, 9, 0, 0, 0, 9, 0, 0, 0},
+    {0, 10, 0, 0, 0, 7, 0, 0, 0},
+    {7, 0, 0, 0, 0, 7, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 6, 0, 0, 0},
+    {0, 0, 0, 0, 0, 6, 0, 0, 0},
+    {0, 15, 15, 17, 7, 0, 0, 0, 0},
+    {15, 0, 18, 18, 18, 0, 0, 0, 0},
+    {0, 0, 9, 9, 9, 0, 0, 0, 0},
+    {0, 0, 0, 9, 7, 0, 0, 0, 0},
+    {15, 18, 0, 18, 18, 0, 0, 0, 0},
+    {0, 9, 0, 9, 9, 0, 0, 0, 0},
+    {0, 0, 0, 9, 7, 0, 0, 0, 0},
+    {14, 0, 0, 9, 9, 0, 0, 0, 0},
+    {0, 0, 0, 10, 9, 0, 0, 0, 0},
+    {0, 0, 7, 0, 7, 0, 0, 0, 0},
+    {0, 7, 0, 0, 7, 0, 0, 0, 0},
+    {7, 0, 0, 0, 9, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {17, 18, 18, 0, 18, 0, 0, 0, 0},
+    {0, 9, 9, 0, 15, 0, 0, 0, 0},
+    {0, 0, 9, 0, 7, 0, 0, 0, 0},
+    {14, 0, 14, 0, 14, 0, 0, 0, 0},
+    {0, 0, 10, 0, 10, 0, 0, 0, 0},
+    {0, 9, 0, 0, 7, 0, 0, 0, 0},
+    {9, 0, 0, 0, 10, 0, 0, 0, 0},
+    {0, 0, 0, 0, 7, 0, 0, 0, 0},
+    {14, 14, 0, 0, 14, 0, 0, 0, 0},
+    {0, 10, 0, 0, 10, 0, 0, 0, 0},
+    {9, 0, 0, 0, 10, 0, 0, 0, 0},
+    {0, 0, 0, 0, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 6, 0, 0, 0, 0},
+    {0, 0, 7, 9, 0, 0, 0, 0, 0},
+    {0, 7, 0, 9, 0, 0, 0, 0, 0},
+    {7, 0, 0, 10, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 0, 0, 0, 0, 0, 0},
+    {9, 0, 10, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 10, 0, 0, 0, 0, 0, 0, 0},
+    {0, 7, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {6, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 18, 18, 18, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {14, 0, 9, 9, 0, 0, 0, 0, 0},
+    {0, 0, 9, 10, 0, 0, 0, 0, 0},
+    {7, 0, 0, 10, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {14, 9, 0, 9, 0, 0, 0, 0, 0},
+    {0, 9, 0, 10, 0, 0, 0, 0, 0},
+    {7, 0, 0, 10, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 7, 0, 0, 0, 0, 0},
+    {7, 0, 9, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 9, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {14, 9, 9, 0, 0, 0, 0, 0, 0},
+    {0, 10, 10, 0, 0, 0, 0, 0, 0},
+    {7, 0, 10, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 6, 0, 0, 0, 0, 0, 0},
+    {7, 10, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {6, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 6, 0, 0, 0, 0, 0, 0, 0},
+    {6, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 17, 9, 9, 0, 0, 0, 0},
+    {0, 9, 7, 15, 9, 0, 0, 0, 0},
+    {9, 0, 7, 9, 15, 0, 0, 0, 0},
+    {0, 0, 9, 9, 7, 0, 0, 0, 0},
+    {0, 0, 15, 7, 9, 0, 0, 0, 0},
+    {9, 9, 0, 9, 15, 0, 0, 0, 0},
+    {0, 9, 0, 9, 7, 0, 0, 0, 0},
+    {0, 0, 0, 9, 7, 0, 0, 0, 0},
+    {15, 0, 0, 15, 7, 0, 0, 0, 0},
+    {0, 0, 0, 9, 9, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {15, 9, 7, 0, 9, 0, 0, 0, 0},
+    {0, 9, 9, 0, 9, 0, 0, 0, 0},
+    {0, 0, 7, 0, 7, 0, 0, 0, 0},
+    {7, 0, 15, 0, 9, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 0, 0, 7, 0, 0, 0, 0},
+    {9, 0, 0, 0, 9, 0, 0, 0, 0},
+    {0, 0, 0, 0, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 0, 9, 0, 0, 0, 0},
+    {9, 0, 9, 0, 7, 0, 0, 0, 0},
+    {0, 0, 7, 0, 7, 0, 0, 0, 0},
+    {9, 9, 0, 0, 7, 0, 0, 0, 0},
+    {0, 9, 0, 0, 7, 0, 0, 0, 0},
+    {9, 0, 0, 0, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 7, 9, 0, 0, 0, 0, 0},
+    {0, 7, 7, 9, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 0, 7, 9, 0, 0, 0, 0, 0},
+    {0, 0, 7, 9, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 7, 0, 0, 0, 0, 0, 0},
+    {9, 0, 7, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 7, 7, 0, 0, 0, 0, 0, 0},
+    {0, 9, 7, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 7, 0, 0, 0, 0, 0},
+    {9, 0, 9, 9, 0, 0, 0, 0, 0},
+    {0, 0, 7, 7, 0, 0, 0, 0, 0},
+    {9, 9, 0, 9, 0, 0, 0, 0, 0},
+    {0, 9, 0, 7, 0, 0, 0, 0, 0},
+    {7, 0, 0, 7, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 7, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 9, 9, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 7, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 9, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 15, 22, 17, 22, 22, 0, 0, 0},
+    {15, 0, 15, 17, 7, 17, 0, 0, 0},
+    {0, 0, 9, 9, 9, 9, 0, 0, 0},
+    {22, 15, 0, 22, 22, 17, 0, 0, 0},
+    {0, 18, 0, 9, 9, 9, 0, 0, 0},
+    {9, 0, 0, 9, 9, 9, 0, 0, 0},
+    {0, 0, 0, 9, 7, 9, 0, 0, 0},
+    {0, 0, 0, 14, 14, 14, 0, 0, 0},
+    {0, 0, 0, 9, 7, 9, 0, 0, 0},
+    {17, 17, 22, 0, 15, 17, 0, 0, 0},
+    {0, 18, 15, 0, 18, 18, 0, 0, 0},
+    {9, 0, 9, 0, 15, 9, 0, 0, 0},
+    {0, 0, 9, 0, 7, 9, 0, 0, 0},
+    {0, 0, 14, 0, 14, 14, 0, 0, 0},
+    {17, 18, 0, 0, 18, 17, 0, 0, 0},
+    {0, 9, 0, 0, 15, 9, 0, 0, 0},
+    {0, 0, 0, 0, 7, 9, 0, 0, 0},
+    {14, 0, 0, 0, 14, 14, 0, 0, 0},
+    {0, 0, 0, 0, 10, 10, 0, 0, 0},
+    {0, 9, 0, 0, 9, 9, 0, 0, 0},
+    {9, 0, 0, 0, 7, 9, 0, 0, 0},
+    {0, 0, 0, 0, 7, 7, 0, 0, 0},
+    {0, 0, 7, 0, 7, 15, 0, 0, 0},
+    {0, 7, 0, 0, 14, 14, 0, 0, 0},
+    {7, 0, 0, 0, 7, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {22, 7, 22, 15, 0, 15, 0, 0, 0},
+    {0, 18, 9, 9, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 14, 14, 0, 14, 0, 0, 0},
+    {9, 18, 0, 9, 0, 9, 0, 0, 0},
+    {0, 7, 0, 15, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {14, 0, 0, 14, 0, 14, 0, 0, 0},
+    {0, 0, 0, 10, 0, 10, 0, 0, 0},
+    {0, 7, 0, 9, 0, 15, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 9, 0, 0, 9, 0, 0, 0},
+    {0, 7, 15, 0, 0, 7, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {14, 0, 14, 0, 0, 7, 0, 0, 0},
+    {0, 0, 9, 0, 0, 10, 0, 0, 0},
+    {0, 9, 0, 0, 0, 9, 0, 0, 0},
+    {9, 0, 0, 0, 0, 10, 0, 0, 0},
+    {0, 0, 0, 0, 0, 7, 0, 0, 0},
+    {9, 7, 0, 0, 0, 7, 0, 0, 0},
+    {0, 9, 0, 0, 0, 7, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 7, 0, 0, 0},
+    {0, 7, 14, 0, 0, 14, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {14, 7, 0, 0, 0, 9, 0, 0, 0},
+    {0, 10, 0, 0, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 6, 0, 0, 0},
+    {0, 0, 7, 9, 0, 9, 0, 0, 0},
+    {0, 7, 0, 14, 0, 14, 0, 0, 0},
+    {7, 0, 0, 9, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 14, 0, 0, 9, 0, 0, 0},
+    {9, 0, 9, 0, 0, 9, 0, 0, 0},
+    {0, 0, 7, 0, 0, 9, 0, 0, 0},
+    {14, 9, 0, 0, 0, 9, 0, 0, 0},
+    {0, 10, 0, 0, 0, 9, 0, 0, 0},
+    {7, 0, 0, 0, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 6, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {22, 17, 17, 17, 15, 0, 0, 0, 0},
+    {0, 18, 17, 17, 18, 0, 0, 0, 0},
+    {9, 0, 9, 9, 15, 0, 0, 0, 0},
+    {0, 0, 9, 9, 7, 0, 0, 0, 0},
+    {0, 0, 14, 14, 14, 0, 0, 0, 0},
+    {15, 18, 0, 18, 18, 0, 0, 0, 0},
+    {0, 9, 0, 9, 9, 0, 0, 0, 0},
+    {0, 0, 0, 7, 7, 0, 0, 0, 0},
+    {14, 0, 0, 14, 14, 0, 0, 0, 0},
+    {0, 0, 0, 10, 10, 0, 0, 0, 0},
+    {0, 9, 0, 9, 15, 0, 0, 0, 0},
+    {9, 0, 0, 9, 7, 0, 0, 0, 0},
+    {0, 0, 0, 9, 7, 0, 0, 0, 0},
+    {9, 9, 9, 0, 15, 0, 0, 0, 0},
+    {0, 9, 9, 0, 7, 0, 0, 0, 0},
+    {0, 0, 9, 0, 7, 0, 0, 0, 0},
+    {14, 0, 14, 0, 7, 0, 0, 0, 0},
+    {0, 0, 9, 0, 10, 0, 0, 0, 0},
+    {0, 9, 0, 0, 7, 0, 0, 0, 0},
+    {9, 0, 0, 0, 10, 0, 0, 0, 0},
+    {0, 0, 0, 0, 7, 0, 0, 0, 0},
+    {9, 9, 0, 0, 7, 0, 0, 0, 0},
+    {0, 9, 0, 0, 7, 0, 0, 0, 0},
+    {9, 0, 0, 0, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 7, 0, 0, 0, 0},
+    {0, 15, 14, 0, 14, 0, 0, 0, 0},
+    {15, 0, 9, 0, 7, 0, 0, 0, 0},
+    {0, 0, 9, 0, 9, 0, 0, 0, 0},
+    {14, 9, 0, 0, 9, 0, 0, 0, 0},
+    {0, 10, 0, 0, 9, 0, 0, 0, 0},
+    {7, 0, 0, 0, 9, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 6, 0, 0, 0, 0},
+    {0, 0, 0, 0, 7, 0, 0, 0, 0},
+    {9, 9, 9, 9, 0, 0, 0, 0, 0},
+    {0, 7, 9, 7, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {14, 0, 14, 7, 0, 0, 0, 0, 0},
+    {0, 0, 9, 10, 0, 0, 0, 0, 0},
+    {0, 9, 0, 7, 0, 0, 0, 0, 0},
+    {9, 0, 0, 10, 0, 0, 0, 0, 0},
+    {0, 0, 0, 7, 0, 0, 0, 0, 0},
+    {15, 7, 0, 7, 0, 0, 0, 0, 0},
+    {0, 9, 0, 9, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 7, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {14, 7, 9, 0, 0, 0, 0, 0, 0},
+    {0, 10, 9, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 6, 0, 0, 0, 0, 0, 0},
+    {7, 10, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {6, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 7, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 14, 9, 0, 0, 0, 0, 0},
+    {9, 0, 9, 9, 0, 0, 0, 0, 0},
+    {0, 0, 7, 9, 0, 0, 0, 0, 0},
+    {14, 9, 0, 9, 0, 0, 0, 0, 0},
+    {0, 10, 0, 9, 0, 0, 0, 0, 0},
+    {7, 0, 0, 9, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 6, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 9, 0, 0, 0, 0, 0, 0},
+    {0, 10, 7, 0, 0, 0, 0, 0, 0},
+    {7, 0, 7, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 6, 0, 0, 0, 0, 0, 0},
+    {7, 10, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {6, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 0, 0, 0, 0},
+    {0, 7, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 9, 7, 0, 0, 0, 0},
+    {0, 7, 0, 14, 14, 0, 0, 0, 0},
+    {7, 0, 0, 15, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 14, 0, 9, 0, 0, 0, 0},
+    {9, 0, 15, 0, 7, 0, 0, 0, 0},
+    {0, 0, 7, 0, 9, 0, 0, 0, 0},
+    {14, 15, 0, 0, 14, 0, 0, 0, 0},
+    {0, 10, 0, 0, 9, 0, 0, 0, 0},
+    {9, 0, 0, 0, 9, 0, 0, 0, 0},
+    {0, 0, 0, 0, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 6, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 7, 14, 9, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {14, 7, 0, 14, 0, 0, 0, 0, 0},
+    {0, 10, 0, 9, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 6, 0, 0, 0, 0, 0},
+    {9, 7, 14, 0, 0, 0, 0, 0, 0},
+    {0, 10, 7, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 6, 0, 0, 0, 0, 0, 0},
+    {9, 10, 0, 0, 0, 0, 0, 0, 0},
+    {0, 7, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {6, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 7, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 0, 0, 0, 0},
+    {0, 7, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 9, 9, 9, 15, 0, 0},
+    {0, 7, 0, 9, 9, 9, 15, 0, 0},
+    {7, 0, 0, 9, 9, 9, 15, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 0, 9, 9, 7, 0, 0},
+    {9, 0, 9, 0, 9, 9, 23, 0, 0},
+    {0, 0, 9, 0, 9, 9, 7, 0, 0},
+    {9, 9, 0, 0, 9, 9, 15, 0, 0},
+    {0, 9, 0, 0, 9, 9, 7, 0, 0},
+    {15, 0, 0, 0, 9, 9, 7, 0, 0},
+    {0, 0, 0, 0, 9, 9, 9, 0, 0},
+    {0, 0, 0, 0, 9, 9, 7, 0, 0},
+    {0, 0, 0, 0, 9, 9, 7, 0, 0},
+    {0, 9, 9, 9, 0, 9, 15, 0, 0},
+    {9, 0, 9, 9, 0, 9, 22, 0, 0},
+    {0, 0, 15, 9, 0, 9, 7, 0, 0},
+    {9, 9, 0, 9, 0, 9, 7, 0, 0},
+    {0, 9, 0, 9, 0, 9, 7, 0, 0},
+    {9, 0, 0, 9, 0, 9, 7, 0, 0},
+    {0, 0, 0, 9, 0, 9, 7, 0, 0},
+    {0, 0, 0, 9, 0, 9, 7, 0, 0},
+    {0, 0, 0, 9, 0, 9, 9, 0, 0},
+    {9, 9, 9, 0, 0, 7, 15, 0, 0},
+    {0, 9, 9, 0, 0, 9, 7, 0, 0},
+    {9, 0, 9, 0, 0, 15, 7, 0, 0},
+    {0, 0, 9, 0, 0, 7, 15, 0, 0},
+    {0, 0, 9, 0, 0, 7, 7, 0, 0},
+    {9, 9, 0, 0, 0, 9, 7, 0, 0},
+    {0, 9, 0, 0, 0, 7, 7, 0, 0},
+    {0, 0, 0, 0, 0, 9, 7, 0, 0},
+    {9, 0, 0, 0, 0, 7, 7, 0, 0},
+    {0, 0, 0, 0, 0, 9, 7, 0, 0},
+    {0, 9, 0, 0, 0, 7, 7, 0, 0},
+    {9, 0, 0, 0, 0, 7, 9, 0, 0},
+    {0, 0, 0, 0, 0, 7, 7, 0, 0},
+    {0, 0, 7, 0, 0, 9, 14, 0, 0},
+    {0, 7, 0, 0, 0, 9, 7, 0, 0},
+    {7, 0, 0, 0, 0, 9, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 9, 7, 0, 0},
+    {0, 7, 0, 0, 0, 9, 7, 0, 0},
+    {7, 0, 0, 0, 0, 9, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 9, 9, 0, 23, 0, 0},
+    {9, 0, 9, 9, 9, 0, 23, 0, 0},
+    {0, 0, 18, 9, 9, 0, 7, 0, 0},
+    {9, 9, 0, 9, 9, 0, 17, 0, 0},
+    {0, 15, 0, 9, 9, 0, 7, 0, 0},
+    {15, 0, 0, 9, 9, 0, 7, 0, 0},
+    {0, 0, 0, 9, 9, 0, 9, 0, 0},
+    {0, 0, 0, 9, 9, 0, 9, 0, 0},
+    {0, 0, 0, 9, 9, 0, 14, 0, 0},
+    {9, 9, 9, 0, 7, 0, 15, 0, 0},
+    {0, 9, 9, 0, 9, 0, 7, 0, 0},
+    {9, 0, 9, 0, 15, 0, 7, 0, 0},
+    {0, 0, 9, 0, 7, 0, 9, 0, 0},
+    {0, 0, 9, 0, 7, 0, 7, 0, 0},
+    {9, 9, 0, 0, 15, 0, 7, 0, 0},
+    {0, 9, 0, 0, 7, 0, 9, 0, 0},
+    {0, 0, 0, 0, 7, 0, 7, 0, 0},
+    {9, 0, 0, 0, 7, 0, 9, 0, 0},
+    {0, 0, 0, 0, 7, 0, 7, 0, 0},
+    {0, 9, 0, 0, 7, 0, 7, 0, 0},
+    {9, 0, 0, 0, 7, 0, 15, 0, 0},
+    {0, 0, 0, 0, 9, 0, 7, 0, 0},
+    {0, 0, 7, 0, 9, 0, 14, 0, 0},
+    {0, 7, 0, 0, 9, 0, 15, 0, 0},
+    {7, 0, 0, 0, 9, 0, 15, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 9, 9, 7, 0, 0, 15, 0, 0},
+    {0, 9, 9, 18, 0, 0, 7, 0, 0},
+    {9, 0, 9, 18, 0, 0, 7, 0, 0},
+    {0, 0, 9, 7, 0, 0, 15, 0, 0},
+    {0, 0, 9, 7, 0, 0, 15, 0, 0},
+    {9, 9, 0, 9, 0, 0, 7, 0, 0},
+    {0, 9, 0, 7, 0, 0, 7, 0, 0},
+    {0, 0, 0, 9, 0, 0, 7, 0, 0},
+    {9, 0, 0, 7, 0, 0, 7, 0, 0},
+    {0, 0, 0, 9, 0, 0, 7, 0, 0},
+    {0, 9, 0, 7, 0, 0, 14, 0, 0},
+    {9, 0, 0, 7, 0, 0, 14, 0, 0},
+    {0, 0, 0, 10, 0, 0, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 0, 0, 0, 14, 0, 0},
+    {9, 0, 9, 0, 0, 0, 14, 0, 0},
+    {0, 0, 10, 0, 0, 0, 7, 0, 0},
+    {9, 9, 0, 0, 0, 0, 7, 0, 0},
+    {0, 9, 0, 0, 0, 0, 7, 0, 0},
+    {9, 0, 0, 0, 0, 0, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 6, 0, 0},
+    {0, 0, 7, 9, 0, 0, 15, 0, 0},
+    {0, 7, 0, 9, 0, 0, 9, 0, 0},
+    {7, 0, 0, 9, 0, 0, 9, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 0, 0, 0, 7, 0, 0},
+    {9, 0, 9, 0, 0, 0, 9, 0, 0},
+    {0, 0, 9, 0, 0, 0, 7, 0, 0},
+    {9, 9, 0, 0, 0, 0, 9, 0, 0},
+    {0, 7, 0, 0, 0, 0, 7, 0, 0},
+    {7, 0, 0, 0, 0, 0, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 7, 0, 0},
+    {0, 0, 7, 0, 9, 0, 7, 0, 0},
+    {0, 7, 0, 0, 9, 0, 7, 0, 0},
+    {7, 0, 0, 0, 9, 0, 15, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 9, 0, 0, 9, 0, 0},
+    {0, 7, 0, 9, 0, 0, 7, 0, 0},
+    {7, 0, 0, 9, 0, 0, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 9, 0, 0, 0, 7, 0, 0},
+    {9, 0, 9, 0, 0, 0, 9, 0, 0},
+    {0, 0, 7, 0, 0, 0, 7, 0, 0},
+    {9, 9, 0, 0, 0, 0, 7, 0, 0},
+    {0, 9, 0, 0, 0, 0, 7, 0, 0},
+    {9, 0, 0, 0, 0, 0, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 7, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 15, 15, 7, 15, 23, 0, 0, 0},
+    {15, 0, 15, 23, 22, 23, 0, 0, 0},
+    {0, 0, 9, 9, 9, 9, 0, 0, 0},
+    {15, 15, 0, 15, 7, 17, 0, 0, 0},
+    {0, 9, 0, 9, 9, 9, 0, 0, 0},
+    {9, 0, 0, 9, 9, 9, 0, 0, 0},
+    {0, 0, 0, 9, 7, 9, 0, 0, 0},
+    {0, 0, 0, 7, 7, 9, 0, 0, 0},
+    {0, 0, 0, 7, 9, 14, 0, 0, 0},
+    {7, 23, 15, 0, 15, 15, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {17, 0, 9, 0, 9, 9, 0, 0, 0},
+    {0, 0, 9, 0, 15, 9, 0, 0, 0},
+    {9, 9, 0, 0, 9, 9, 0, 0, 0},
+    {0, 9, 0, 0, 7, 9, 0, 0, 0},
+    {0, 0, 0, 0, 7, 9, 0, 0, 0},
+    {7, 0, 0, 0, 7, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 9, 15, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 14, 14, 0, 0, 0},
+    {0, 7, 0, 0, 7, 15, 0, 0, 0},
+    {7, 0, 0, 0, 7, 15, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {15, 22, 7, 15, 0, 15, 0, 0, 0},
+    {0, 9, 9, 9, 0, 9, 0, 0, 0},
+    {9, 0, 18, 9, 0, 9, 0, 0, 0},
+    {0, 0, 7, 15, 0, 15, 0, 0, 0},
+    {0, 0, 7, 7, 0, 15, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 0, 7, 0, 14, 0, 0, 0},
+    {9, 0, 0, 9, 0, 14, 0, 0, 0},
+    {0, 0, 0, 10, 0, 7, 0, 0, 0},
+    {9, 9, 9, 0, 0, 9, 0, 0, 0},
+    {0, 15, 7, 0, 0, 7, 0, 0, 0},
+    {0, 0, 9, 0, 0, 9, 0, 0, 0},
+    {7, 0, 7, 0, 0, 7, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 9, 0, 0, 0, 7, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 0, 0, 0, 0, 7, 0, 0, 0},
+    {0, 0, 0, 0, 0, 7, 0, 0, 0},
+    {0, 14, 7, 0, 0, 14, 0, 0, 0},
+    {14, 0, 7, 0, 0, 14, 0, 0, 0},
+    {0, 0, 10, 0, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 6, 0, 0, 0},
+    {0, 0, 7, 7, 0, 15, 0, 0, 0},
+    {0, 7, 0, 7, 0, 9, 0, 0, 0},
+    {7, 0, 0, 9, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 9, 0, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 9, 0, 0, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 9, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {23, 23, 17, 15, 15, 0, 0, 0, 0},
+    {0, 9, 9, 17, 9, 0, 0, 0, 0},
+    {17, 0, 17, 17, 17, 0, 0, 0, 0},
+    {0, 0, 9, 9, 15, 0, 0, 0, 0},
+    {0, 0, 9, 7, 15, 0, 0, 0, 0},
+    {9, 9, 0, 9, 15, 0, 0, 0, 0},
+    {0, 9, 0, 9, 7, 0, 0, 0, 0},
+    {0, 0, 0, 9, 7, 0, 0, 0, 0},
+    {9, 0, 0, 9, 7, 0, 0, 0, 0},
+    {0, 0, 0, 9, 7, 0, 0, 0, 0},
+    {0, 14, 0, 7, 14, 0, 0, 0, 0},
+    {14, 0, 0, 15, 14, 0, 0, 0, 0},
+    {0, 0, 0, 10, 9, 0, 0, 0, 0},
+    {9, 9, 9, 0, 9, 0, 0, 0, 0},
+    {0, 9, 9, 0, 7, 0, 0, 0, 0},
+    {0, 0, 9, 0, 7, 0, 0, 0, 0},
+    {7, 0, 9, 0, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 9, 0, 0, 7, 0, 0, 0, 0},
+    {9, 0, 0, 0, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 7, 0, 0, 0, 0},
+    {7, 15, 0, 0, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 0, 0, 0, 9, 0, 0, 0, 0},
+    {0, 0, 0, 0, 7, 0, 0, 0, 0},
+    {0, 14, 15, 0, 14, 0, 0, 0, 0},
+    {14, 0, 15, 0, 14, 0, 0, 0, 0},
+    {0, 0, 10, 0, 9, 0, 0, 0, 0},
+    {15, 15, 0, 0, 7, 0, 0, 0, 0},
+    {0, 9, 0, 0, 9, 0, 0, 0, 0},
+    {9, 0, 0, 0, 9, 0, 0, 0, 0},
+    {0, 0, 0, 0, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 6, 0, 0, 0, 0},
+    {9, 9, 9, 9, 0, 0, 0, 0, 0},
+    {0, 15, 7, 7, 0, 0, 0, 0, 0},
+    {0, 0, 9, 9, 0, 0, 0, 0, 0},
+    {15, 0, 7, 7, 0, 0, 0, 0, 0},
+    {0, 0, 9, 9, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {14, 14, 0, 7, 0, 0, 0, 0, 0},
+    {0, 9, 0, 10, 0, 0, 0, 0, 0},
+    {9, 0, 0, 10, 0, 0, 0, 0, 0},
+    {0, 0, 0, 7, 0, 0, 0, 0, 0},
+    {0, 0, 0, 7, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {14, 14, 7, 0, 0, 0, 0, 0, 0},
+    {0, 9, 10, 0, 0, 0, 0, 0, 0},
+    {9, 0, 10, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 6, 0, 0, 0, 0, 0, 0, 0},
+    {6, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 15, 9, 7, 0, 0, 0, 0, 0},
+    {15, 0, 9, 9, 0, 0, 0, 0, 0},
+    {0, 0, 9, 9, 0, 0, 0, 0, 0},
+    {9, 9, 0, 9, 0, 0, 0, 0, 0},
+    {0, 7, 0, 9, 0, 0, 0, 0, 0},
+    {7, 0, 0, 9, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 7, 0, 0, 0, 0, 0},
+    {7, 9, 9, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 9, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 7, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 0, 0, 0, 0},
+    {0, 7, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 7, 9, 0, 0, 0, 0},
+    {0, 7, 0, 7, 7, 0, 0, 0, 0},
+    {7, 0, 0, 15, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 15, 0, 9, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 15, 0, 0, 7, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 0, 0, 0, 9, 0, 0, 0, 0},
+    {0, 0, 0, 0, 7, 0, 0, 0, 0},
+    {0, 9, 7, 7, 0, 0, 0, 0, 0},
+    {9, 0, 7, 9, 0, 0, 0, 0, 0},
+    {0, 0, 7, 9, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 9, 7, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {9, 0, 7, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 7, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {7, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+    {0, 0, 0, 0, 0, 0, 0, 0, 0},
+};
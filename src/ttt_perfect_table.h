@@ -0,0 +1,38 @@
+// Generated by gen_perfect_table.c -- do not edit.
+// Perfect-play tables for every legal tic-tac-toe position,
+// defined in ttt_perfect_table.c.
+#ifndef TTT_PERFECT_TABLE_H
+#define TTT_PERFECT_TABLE_H
+
+#include <stdint.h>
+#include "ttt_board.h"
+
+#define TTT_PERFECT_POSITIONS 5478
+#define TTT_PERFECT_NONE 0xFFFF
+
+// Dense index of each base-3 code; TTT_PERFECT_NONE if unreachable
+extern const uint16_t ttt_perfect_index[19683];
+
+// Outcome for the side to move under perfect play: -1 / 0 / +1
+extern const int8_t ttt_perfect_outcome[5478];
+
+// Best move (fastest win, slowest loss, lowest cell); -1 once the game is over
+extern const int8_t ttt_perfect_best[5478];
+
+// Value (bits 0-1) and plies to the end (bits 2-5) of each move,
+// as in ttt_movetable.h; 0 for illegal moves
+extern const uint8_t ttt_perfect_moves[5478][9];
+
+// Dense index of a board, or -1 if it is unreachable
+static inline int ttt_perfect_index_of(Bitboard b) {
+    uint16_t idx = ttt_perfect_index[bb_to_code(b)];
+    return idx == TTT_PERFECT_NONE ? -1 : idx;
+}
+
+// Perfect move for the side to move in b; -1 if there is none
+static inline int ttt_perfect_move(Bitboard b) {
+    int idx = ttt_perfect_index_of(b);
+    return idx < 0 ? -1 : ttt_perfect_best[idx];
+}
+
+#endif
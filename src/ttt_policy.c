@@ -0,0 +1,150 @@
+#include <string.h>
+#include "ttt_policy.h"
+
+#define CHUNK 64  // boards whose model sums are built together
+
+static inline int code_of(uint16_t x, uint16_t o) {
+    return ttt_bin_to_ter[x] + 2 * ttt_bin_to_ter[o];
+}
+
+// Sums of all boards a cell at a time, then the best child of each
+static void model_moves(const TTTModel *m, const uint16_t *x, const uint16_t *o, int n,
+                        int8_t *moves) {
+    double sum[TTT_MODEL_MAX_OUTPUTS][CHUNK];
+    for (int start = 0; start < n; start += CHUNK) {
+        int len = n - start < CHUNK ? n - start : CHUNK;
+        const uint16_t *bx = x + start, *bo = o + start;
+
+        for (int l = 0; l < m->outputs; l++) {
+            for (int i = 0; i < len; i++) sum[l][i] = m->base[l];
+        }
+        for (int cell = 0; cell < TTT_CELLS; cell++) {
+            for (int l = 0; l < m->outputs; l++) {
+                double dx = m->delta[cell][TTT_SIDE_X][l], d_o = m->delta[cell][TTT_SIDE_O][l];
+                for (int i = 0; i < len; i++) {
+                    sum[l][i] += ((bx[i] >> cell) & 1) ? dx : (((bo[i] >> cell) & 1) ? d_o : 0.0);
+                }
+            }
+        }
+
+        for (int i = 0; i < len; i++) {
+            Bitboard b = {bx[i], bo[i]};
+            TTTModelScore parent;
+            for (int l = 0; l < m->outputs; l++) parent.sum[l] = sum[l][i];
+            moves[start + i] = (int8_t)ttt_model_best_child(m, &parent, bb_empty_cells(b),
+                                                            bb_side_to_move(b));
+        }
+    }
+}
+
+// X's value of a position: its best action value, or for a finished
+// game the reward q_learning.c trains with (win +1, loss -1, draw 0)
+static double q_x_value(const TTTMovePolicy *p, uint16_t x, uint16_t o) {
+    Bitboard b = {x, o};
+    switch (bb_status(b)) {
+        case TTT_X_WINS: return 1.0;
+        case TTT_O_WINS: return -1.0;
+        case TTT_DRAW:   return 0.0;
+    }
+    uint16_t idx = p->index[code_of(x, o)];
+    if (idx == TTT_POLICY_NO_INDEX) return 0.0;
+    const double *row = p->q[idx];
+    uint16_t empty = bb_empty_cells(b);
+    double best = row[bb_ctz(empty)];
+    for (uint16_t m = empty & (empty - 1); m; m &= m - 1) {
+        if (row[bb_ctz(m)] > best) best = row[bb_ctz(m)];
+    }
+    return best;
+}
+
+static void q_moves(const TTTMovePolicy *p, const uint16_t *x, const uint16_t *o, int n,
+                    int8_t *moves) {
+    for (int i = 0; i < n; i++) {
+        uint16_t empty = (uint16_t)(~(x[i] | o[i]) & TTT_FULL_MASK);
+        if (!empty) {
+            moves[i] = -1;
+            continue;
+        }
+        int best = bb_ctz(empty);
+        if (bb_popcount(x[i]) > bb_popcount(o[i])) {
+            // O to move: the table only holds X's values, so O leaves X
+            // the position it values least
+            double best_value = q_x_value(p, x[i], o[i] | (1u << best));
+            for (uint16_t m = empty & (empty - 1); m; m &= m - 1) {
+                int cell = bb_ctz(m);
+                double value = q_x_value(p, x[i], o[i] | (1u << cell));
+                if (value < best_value) {
+                    best_value = value;
+                    best = cell;
+                }
+            }
+        } else {
+            uint16_t idx = p->index[code_of(x[i], o[i])];
+            if (idx != TTT_POLICY_NO_INDEX) {
+                const double *row = p->q[idx];
+                for (uint16_t m = empty & (empty - 1); m; m &= m - 1) {
+                    int cell = bb_ctz(m);
+                    if (row[cell] > row[best]) best = cell;
+                }
+            }
+        }
+        moves[i] = (int8_t)best;
+    }
+}
+
+static void table_moves(const TTTMovePolicy *p, const uint16_t *x, const uint16_t *o,
+                        int n, int8_t *moves) {
+    for (int i = 0; i < n; i++) {
+        uint16_t idx = p->index[code_of(x[i], o[i])];
+        moves[i] = idx == TTT_POLICY_NO_INDEX ? -1 : p->best[idx];
+    }
+}
+
+// The move each board gets when it does not play at random
+static void greedy_moves(const TTTMovePolicy *p, const uint16_t *x, const uint16_t *o,
+                         int n, int8_t *moves) {
+    switch (p->kind) {
+        case TTT_POLICY_MODEL: model_moves(p->model, x, o, n, moves); break;
+        case TTT_POLICY_Q:     q_moves(p, x, o, n, moves); break;
+        default:               table_moves(p, x, o, n, moves); break;
+    }
+}
+
+void ttt_policy_moves(const TTTMovePolicy *p, const uint16_t *x, const uint16_t *o, int n,
+                      TTTRng *rng, int8_t *moves) {
+    greedy_moves(p, x, o, n, moves);
+    for (int i = 0; i < n; i++) {
+        Bitboard b = {x[i], o[i]};
+        if (bb_status(b) != TTT_ONGOING) {
+            moves[i] = -1;
+            continue;
+        }
+        if (rng && p->random_percent > 0 &&
+            (int)ttt_rng_below(rng, 100) < p->random_percent) {
+            uint16_t empty = bb_empty_cells(b);
+            int count = bb_popcount(empty);
+            moves[i] = (int8_t)bb_select(empty, (int)ttt_rng_below(rng, (uint32_t)count));
+        }
+    }
+}
+
+void ttt_policy_distributions(const TTTMovePolicy *p, const uint16_t *x, const uint16_t *o,
+                              int n, double *probs) {
+    int8_t moves[CHUNK];
+    double random_share = p->random_percent / 100.0;
+    memset(probs, 0, (size_t)n * TTT_CELLS * sizeof(double));
+    for (int start = 0; start < n; start += CHUNK) {
+        int len = n - start < CHUNK ? n - start : CHUNK;
+        greedy_moves(p, x + start, o + start, len, moves);
+        for (int i = 0; i < len; i++) {
+            Bitboard b = {x[start + i], o[start + i]};
+            if (bb_status(b) != TTT_ONGOING || moves[i] < 0) continue;
+
+            double *row = probs + (size_t)(start + i) * TTT_CELLS;
+            uint16_t empty = bb_empty_cells(b);
+            int count = bb_popcount(empty);
+            for (uint16_t m = empty; m; m &= m - 1) row[bb_ctz(m)] += random_share / count;
+            row[moves[i]] += 1.0 - random_share;
+        }
+    }
+}
@@ -0,0 +1,57 @@
+#ifndef TTT_POLICY_H
+#define TTT_POLICY_H
+
+#include <stdint.h>
+#include "ttt_board.h"
+#include "ttt_model.h"
+#include "ttt_rng.h"
+
+// ============================================
+// Batched Policies
+// ============================================
+//
+// Move choice of the table- and model-driven players for many boards
+// per call. Boards come as structure-of-arrays bitboards (x[i], o[i]),
+// the side to move follows from the stone counts (X starts), and each
+// board gets a move or a distribution over its cells. Work that does
+// not depend on the board (finding the table, setting up the model
+// sums) is done once per call instead of once per decision, and the
+// model sums are built one cell at a time across all boards, a loop
+// the compiler can vectorize.
+//
+// Called with one board, a policy returns exactly what the per-move
+// player does, random numbers included, so the arena can use either.
+
+#define TTT_POLICY_MODEL 0   // best-rated child of a TTTModel (linear regression, naive Bayes)
+#define TTT_POLICY_Q     1   // Q-learning: X takes the highest q[index][cell], O the
+                             // cell whose child X values least (see q below)
+#define TTT_POLICY_TABLE 2   // best[index] (perfect play)
+
+#define TTT_POLICY_NO_INDEX 0xFFFF  // index[] entry of an unreachable code
+
+typedef struct {
+    int kind;                        // TTT_POLICY_*
+    const TTTModel *model;           // MODEL
+    const uint16_t *index;           // Q, TABLE: dense index of each base-3 code
+    const double (*q)[TTT_CELLS];    // Q: X's action values (q_learning.c trains X only);
+                                     //    X's value of a position is its best one, or
+                                     //    +1/-1/0 once the game is won/lost/drawn.
+                                     //    The lowest empty cell wins ties, and X plays it
+                                     //    in unreachable positions
+    const int8_t *best;              // TABLE: move of each position
+    int random_percent;              // plays a uniform random move this often
+} TTTMovePolicy;
+
+// Move of each board: moves[i] for (x[i], o[i]); -1 once the game is
+// over. With random_percent set, each board with the game on takes
+// one draw from rng, and a second one when it plays at random
+// (rng NULL = never random).
+void ttt_policy_moves(const TTTMovePolicy *p, const uint16_t *x, const uint16_t *o, int n,
+                      TTTRng *rng, int8_t *moves);
+
+// Probability of each move of each board: probs[i * TTT_CELLS + cell],
+// all 0 once the game is over
+void ttt_policy_distributions(const TTTMovePolicy *p, const uint16_t *x, const uint16_t *o,
+                              int n, double *probs);
+
+#endif
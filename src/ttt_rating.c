@@ -0,0 +1,188 @@
+#include <stdlib.h>
+#include <math.h>
+#include "ttt_rating.h"
+
+#ifndef M_PI
+#define M_PI 3.14159265358979323846
+#endif
+#ifndef M_LN10
+#define M_LN10 2.30258509299404568402
+#endif
+
+#define ELO_SCALE (400.0 / M_LN10)  // Elo points per natural-log unit of odds
+#define PRIOR_DRAWS 1.0             // virtual draws added to every pairing
+#define SPRT_PRIOR_GAMES 1.0        // virtual wins, draws and losses in the SPRT
+#define FIT_ITERATIONS 10000
+#define FIT_TOLERANCE 1e-10
+
+// Expected score of a player rated diff Elo above its opponent
+static double expected_score(double diff) {
+    return 1.0 / (1.0 + pow(10.0, -diff / 400.0));
+}
+
+// ============================================
+// Elo (maximum likelihood)
+// ============================================
+
+int ttt_elo_fit(int n, const double *games, const double *score, double *elo, double *ci95) {
+    // Minorization-maximization on strengths gamma = 10^(elo / 400):
+    // gamma_i = score_i / sum_j games_ij / (gamma_i + gamma_j)
+    double *gamma = malloc(n * sizeof(double));
+    double *next = malloc(n * sizeof(double));
+    if (!gamma || !next) {
+        free(gamma);
+        free(next);
+        return 0;
+    }
+    for (int i = 0; i < n; i++) gamma[i] = 1.0;
+
+    for (int iter = 0; iter < FIT_ITERATIONS; iter++) {
+        double change = 0.0, log_mean = 0.0;
+        for (int i = 0; i < n; i++) {
+            double won = 0.0, denom = 0.0;
+            for (int j = 0; j < n; j++) {
+                double g = games[i * n + j];
+                if (j == i || g <= 0.0) continue;
+                won += score[i * n + j] + PRIOR_DRAWS / 2;
+                denom += (g + PRIOR_DRAWS) / (gamma[i] + gamma[j]);
+            }
+            next[i] = denom > 0.0 ? won / denom : gamma[i];
+        }
+        // Rescale to geometric mean 1 (average rating TTT_ELO_BASE)
+        for (int i = 0; i < n; i++) log_mean += log(next[i]) / n;
+        for (int i = 0; i < n; i++) {
+            next[i] /= exp(log_mean);
+            change = fmax(change, fabs(log(next[i] / gamma[i])));
+            gamma[i] = next[i];
+        }
+        if (change < FIT_TOLERANCE) break;
+    }
+
+    for (int i = 0; i < n; i++) elo[i] = TTT_ELO_BASE + ELO_SCALE * log(gamma[i]);
+
+    // Standard error from the Fisher information of each rating, holding
+    // the others fixed (slightly optimistic; draws make it conservative)
+    for (int i = 0; i < n; i++) {
+        double info = 0.0;
+        for (int j = 0; j < n; j++) {
+            double g = games[i * n + j];
+            if (j == i || g <= 0.0) continue;
+            double p = gamma[i] / (gamma[i] + gamma[j]);
+            info += (g + PRIOR_DRAWS) * p * (1.0 - p);
+        }
+        ci95[i] = info > 0.0 ? 1.96 * ELO_SCALE / sqrt(info) : INFINITY;
+    }
+
+    free(gamma);
+    free(next);
+    return 1;
+}
+
+// Mean and per-game variance of the score
+static void score_moments(double wins, double draws, double losses, double *mean, double *var) {
+    double n = wins + draws + losses;
+    *mean = (wins + draws / 2) / n;
+    *var = (wins * (1.0 - *mean) * (1.0 - *mean) +
+            draws * (0.5 - *mean) * (0.5 - *mean) +
+            losses * *mean * *mean) / n;
+}
+
+static double elo_of_score(double s) {
+    if (s <= 0.0) return -INFINITY;
+    if (s >= 1.0) return INFINITY;
+    return 400.0 * log10(s / (1.0 - s));
+}
+
+// Score with a virtual draw added (so it is never exactly 0 or 1) and
+// the 95% half-width of its mean
+static void score_interval(double wins, double draws, double losses, double *s, double *margin) {
+    double n = wins + draws + losses + PRIOR_DRAWS;
+    double var;
+    score_moments(wins, draws + PRIOR_DRAWS, losses, s, &var);
+    *margin = 1.96 * sqrt(var / n);
+}
+
+void ttt_elo_from_wdl(double wins, double draws, double losses, double *elo, double *ci95) {
+    double s, margin;
+    score_interval(wins, draws, losses, &s, &margin);
+
+    // Keep the interval within the scores these games can reach: all
+    // losses or all wins plus the virtual draw
+    double floor = PRIOR_DRAWS / 2 / (wins + draws + losses + PRIOR_DRAWS);
+    double low = fmax(s - margin, floor), high = fmin(s + margin, 1.0 - floor);
+    *elo = elo_of_score(s);
+    *ci95 = (elo_of_score(high) - elo_of_score(low)) / 2;
+}
+
+int ttt_score_significance(double wins, double draws, double losses) {
+    double s, margin;
+    score_interval(wins, draws, losses, &s, &margin);
+    if (s - margin > 0.5) return 1;
+    if (s + margin < 0.5) return -1;
+    return 0;
+}
+
+// ============================================
+// Glicko-1
+// ============================================
+
+static double glicko_g(double rd) {
+    const double q = M_LN10 / 400.0;
+    return 1.0 / sqrt(1.0 + 3.0 * q * q * rd * rd / (M_PI * M_PI));
+}
+
+void ttt_glicko_update(TTTGlicko *players, int n, const double *games, const double *score) {
+    const double q = M_LN10 / 400.0;
+    TTTGlicko *next = malloc(n * sizeof(TTTGlicko));
+    if (!next) return;
+
+    // Every player is updated against the ratings from before the period
+    for (int i = 0; i < n; i++) {
+        double d2_inv = 0.0, sum = 0.0;
+        for (int j = 0; j < n; j++) {
+            double g_games = games[i * n + j];
+            if (j == i || g_games <= 0.0) continue;
+            double g = glicko_g(players[j].rd);
+            double e = 1.0 / (1.0 + pow(10.0, -g * (players[i].rating - players[j].rating) / 400.0));
+            d2_inv += q * q * g_games * g * g * e * (1.0 - e);
+            sum += g * (score[i * n + j] - g_games * e);
+        }
+        double precision = 1.0 / (players[i].rd * players[i].rd) + d2_inv;
+        next[i].rating = players[i].rating + q / precision * sum;
+        next[i].rd = sqrt(1.0 / precision);
+    }
+
+    for (int i = 0; i < n; i++) players[i] = next[i];
+    free(next);
+}
+
+// ============================================
+// Sequential Probability Ratio Test
+// ============================================
+
+double ttt_sprt_llr(const TTTSprt *test, double wins, double draws, double losses) {
+    // A virtual game of each result keeps the variance estimate away from
+    // zero, so a short run of identical results cannot end the test
+    wins += SPRT_PRIOR_GAMES;
+    draws += SPRT_PRIOR_GAMES;
+    losses += SPRT_PRIOR_GAMES;
+    double n = wins + draws + losses;
+    double s, var;
+    score_moments(wins, draws, losses, &s, &var);
+
+    double s0 = expected_score(test->elo0), s1 = expected_score(test->elo1);
+    return n * (s1 - s0) * (2.0 * s - s0 - s1) / (2.0 * var);
+}
+
+void ttt_sprt_bounds(const TTTSprt *test, double *lower, double *upper) {
+    *lower = log(test->beta / (1.0 - test->alpha));
+    *upper = log((1.0 - test->beta) / test->alpha);
+}
+
+int ttt_sprt_status(const TTTSprt *test, double llr) {
+    double lower, upper;
+    ttt_sprt_bounds(test, &lower, &upper);
+    if (llr >= upper) return TTT_SPRT_H1;
+    if (llr <= lower) return TTT_SPRT_H0;
+    return TTT_SPRT_CONTINUE;
+}
@@ -0,0 +1,87 @@
+#ifndef TTT_RATING_H
+#define TTT_RATING_H
+
+// ============================================
+// Ratings and Sequential Testing
+// ============================================
+//
+// Turns game results into strength estimates with error bars, and
+// decides when a matchup has been played long enough.
+//
+// Results are given as two n x n matrices, [i * n + j]:
+//   games  - games i played against j (both colors; symmetric)
+//   score  - points i scored in them (win 1, draw 1/2, loss 0)
+// so score[i][j] + score[j][i] == games[i][j].
+
+// ============================================
+// Elo (maximum likelihood)
+// ============================================
+
+#define TTT_ELO_BASE 1500.0
+
+// Fits the Bradley-Terry model (draws count half) so the ratings average
+// TTT_ELO_BASE; ci95 gets the approximate 95% half-width of each rating.
+// A virtual draw against every opponent keeps unbeaten or winless
+// players finite. Returns 0 on allocation failure.
+int ttt_elo_fit(int n, const double *games, const double *score, double *elo, double *ci95);
+
+// Elo difference implied by one player's wins/draws/losses against
+// another, with its 95% half-width. A virtual draw keeps both finite
+// when one side never scores.
+void ttt_elo_from_wdl(double wins, double draws, double losses, double *elo, double *ci95);
+
+// +1 / -1 if the 95% interval of the player's score (with the same
+// virtual draw) lies above / below 1/2, else 0. Tested on the score
+// scale, where the interval is symmetric, rather than on the Elo one.
+int ttt_score_significance(double wins, double draws, double losses);
+
+// ============================================
+// Glicko-1
+// ============================================
+//
+// Ratings that carry their own uncertainty (rating deviation, RD) from
+// one rating period to the next: RD shrinks as results come in. New
+// players get TTT_GLICKO_INITIAL_RD. The arena treats a tournament as one
+// rating period and enters new players at their Elo fit.
+
+#define TTT_GLICKO_INITIAL_RD 350.0
+
+typedef struct {
+    double rating;
+    double rd;
+} TTTGlicko;
+
+// Updates all n players at once with one period's results
+void ttt_glicko_update(TTTGlicko *players, int n, const double *games, const double *score);
+
+// ============================================
+// Sequential Probability Ratio Test
+// ============================================
+//
+// Tests H0: the Elo difference is elo0 against H1: it is elo1 with error
+// rates alpha (accepting H1 wrongly) and beta (accepting H0 wrongly),
+// using the normal approximation of the per-game score (with one virtual
+// win, draw and loss). Stop the matchup as soon as ttt_sprt_status() is
+// not TTT_SPRT_CONTINUE.
+
+#define TTT_SPRT_CONTINUE 0
+#define TTT_SPRT_H0 1
+#define TTT_SPRT_H1 2
+
+typedef struct {
+    double elo0;
+    double elo1;
+    double alpha;
+    double beta;
+} TTTSprt;
+
+// Log-likelihood ratio of H1 over H0 after these results
+double ttt_sprt_llr(const TTTSprt *test, double wins, double draws, double losses);
+
+// TTT_SPRT_H0 / TTT_SPRT_H1 once the LLR leaves the bounds below
+int ttt_sprt_status(const TTTSprt *test, double llr);
+
+// Acceptance bounds ln(beta / (1 - alpha)) and ln((1 - beta) / alpha)
+void ttt_sprt_bounds(const TTTSprt *test, double *lower, double *upper);
+
+#endif
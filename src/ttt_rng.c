@@ -0,0 +1,58 @@
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "ttt_rng.h"
+
+static uint64_t splitmix64(uint64_t *state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+void ttt_rng_seed(TTTRng *r, uint64_t seed) {
+    uint64_t state = seed;
+    for (int i = 0; i < 4; i++) r->s[i] = splitmix64(&state);
+}
+
+void ttt_rng_seed_stream(TTTRng *r, uint64_t seed, uint64_t stream) {
+    // Hash the stream number first so nearby streams share no state
+    uint64_t mixed = stream;
+    ttt_rng_seed(r, seed ^ splitmix64(&mixed));
+}
+
+void ttt_rng_jump(TTTRng *r) {
+    static const uint64_t JUMP[] = {
+        0x180ec6d33cfd0abaULL, 0xd5a61266f0c9392cULL,
+        0xa9582618e03fc9aaULL, 0x39abdc4529b1661cULL
+    };
+
+    uint64_t s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+    for (int i = 0; i < 4; i++) {
+        for (int b = 0; b < 64; b++) {
+            if (JUMP[i] & (1ULL << b)) {
+                s0 ^= r->s[0];
+                s1 ^= r->s[1];
+                s2 ^= r->s[2];
+                s3 ^= r->s[3];
+            }
+            ttt_rng_next(r);
+        }
+    }
+    r->s[0] = s0;
+    r->s[1] = s1;
+    r->s[2] = s2;
+    r->s[3] = s3;
+}
+
+uint64_t ttt_rng_take_seed(int *argc, char **argv) {
+    uint64_t seed = (uint64_t)time(NULL);
+    for (int a = 1; a < *argc; a++) {
+        if (strcmp(argv[a], "--seed") != 0 || a + 1 >= *argc) continue;
+        seed = strtoull(argv[a + 1], NULL, 10);
+        for (int b = a + 2; b <= *argc; b++) argv[b - 2] = argv[b];  // keeps argv[argc] == NULL
+        *argc -= 2;
+        break;
+    }
+    return seed;
+}
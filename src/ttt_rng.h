@@ -0,0 +1,72 @@
+#ifndef TTT_RNG_H
+#define TTT_RNG_H
+
+#include <stdint.h>
+
+// ============================================
+// Seedable Random Number Generator
+// ============================================
+//
+// xoshiro256** with an explicit state object, replacing rand(): every
+// caller owns its generator, so threads never share state and a run is
+// reproduced exactly by reusing its seed.
+//
+// Parallel streams: seed one generator and ttt_rng_jump() it once per
+// stream (each jump skips 2^128 outputs), or give every unit of work
+// its own stream with ttt_rng_seed_stream().
+
+typedef struct {
+    uint64_t s[4];
+} TTTRng;
+
+// Expands seed into a full state with splitmix64 (any seed is fine)
+void ttt_rng_seed(TTTRng *r, uint64_t seed);
+
+// Independent generator number stream of a seed
+void ttt_rng_seed_stream(TTTRng *r, uint64_t seed, uint64_t stream);
+
+// Advance by 2^128 outputs
+void ttt_rng_jump(TTTRng *r);
+
+// Removes "--seed N" from argv (updating *argc) and returns N, or a
+// time-based seed if the flag is absent; print it to make a run repeatable
+uint64_t ttt_rng_take_seed(int *argc, char **argv);
+
+static inline uint64_t ttt_rng_rotl(uint64_t x, int k) {
+    return (x << k) | (x >> (64 - k));
+}
+
+static inline uint64_t ttt_rng_next(TTTRng *r) {
+    uint64_t *s = r->s;
+    uint64_t result = ttt_rng_rotl(s[1] * 5, 7) * 9;
+    uint64_t t = s[1] << 17;
+    s[2] ^= s[0];
+    s[3] ^= s[1];
+    s[1] ^= s[2];
+    s[0] ^= s[3];
+    s[2] ^= t;
+    s[3] = ttt_rng_rotl(s[3], 45);
+    return result;
+}
+
+// Uniform in [0, n) without modulo bias (Lemire's multiply-shift);
+// n must be at least 1
+static inline uint32_t ttt_rng_below(TTTRng *r, uint32_t n) {
+    uint64_t m = (ttt_rng_next(r) >> 32) * n;
+    uint32_t low = (uint32_t)m;
+    if (low < n) {
+        uint32_t threshold = (uint32_t)(-n) % n;
+        while (low < threshold) {
+            m = (ttt_rng_next(r) >> 32) * n;
+            low = (uint32_t)m;
+        }
+    }
+    return (uint32_t)(m >> 32);
+}
+
+// Uniform in [0, 1) with 53 random bits
+static inline double ttt_rng_double(TTTRng *r) {
+    return (double)(ttt_rng_next(r) >> 11) * (1.0 / 9007199254740992.0);
+}
+
+#endif
@@ -0,0 +1,176 @@
+#include <stdlib.h>
+#include <string.h>
+#include "ttt_search.h"
+#include "ttt_clock.h"
+#include "ttt_zobrist.h"
+
+#define CLOCK_CHECK_EVERY 64  // nodes between deadline checks
+#define INFINITE_SCORE (TTT_SEARCH_WIN + 1)
+
+int ttt_search_init(TTTSearch *s, int log2_tt) {
+    memset(s, 0, sizeof(*s));
+    ttt_zobrist_init();
+    if (!tt_init(&s->tt, log2_tt)) return 0;
+    ttt_search_clear(s);
+    return 1;
+}
+
+void ttt_search_free(TTTSearch *s) {
+    tt_free(&s->tt);
+}
+
+void ttt_search_clear(TTTSearch *s) {
+    tt_clear(&s->tt);
+    memset(s->killer, -1, sizeof(s->killer));
+    memset(s->history, 0, sizeof(s->history));
+}
+
+// 0 marks empty table slots (and is the empty board's hash)
+static inline uint64_t table_key(uint64_t key) {
+    return key ? key : 1;
+}
+
+// Open lines: +1 for one own stone, +10 for two, the same against the
+// opponent's (at most 80, far below TTT_SEARCH_MATE)
+static int evaluate(Bitboard b, int side) {
+    uint16_t own = bb_side_mask(b, side);
+    uint16_t theirs = bb_side_mask(b, side == TTT_SIDE_X ? TTT_SIDE_O : TTT_SIDE_X);
+    int score = 0;
+    for (int i = 0; i < TTT_NUM_LINES; i++) {
+        int mine = bb_popcount(own & ttt_win_masks[i]);
+        int other = bb_popcount(theirs & ttt_win_masks[i]);
+        if (other == 0 && mine > 0) score += (mine == 2) ? 10 : 1;
+        if (mine == 0 && other > 0) score -= (other == 2) ? 10 : 1;
+    }
+    return score;
+}
+
+// Empty cells in search order, best first
+static int order_moves(const TTTSearch *s, uint16_t empty, int side, int ply, int tt_move,
+                       int *moves) {
+    uint32_t rank[TTT_CELLS];
+    int n = 0;
+    for (uint16_t m = empty; m; m &= m - 1) {
+        int cell = bb_ctz(m);
+        uint32_t r = s->history[side][cell];
+        if (cell == s->killer[ply][1]) r = 1u << 28;
+        if (cell == s->killer[ply][0]) r = 1u << 29;
+        if (cell == tt_move) r = 1u << 30;
+        // Insertion sort, stable: equal ranks keep cell order
+        int i = n++;
+        while (i > 0 && rank[i - 1] < r) {
+            rank[i] = rank[i - 1];
+            moves[i] = moves[i - 1];
+            i--;
+        }
+        rank[i] = r;
+        moves[i] = cell;
+    }
+    return n;
+}
+
+static int negamax(TTTSearch *s, Bitboard b, uint64_t key, int depth, int ply,
+                   int alpha, int beta) {
+    s->pv_length[ply] = ply;
+    if (++s->nodes % CLOCK_CHECK_EVERY == 0 && s->can_abort && s->deadline &&
+        ttt_clock_ns() >= s->deadline) {
+        s->aborted = 1;
+    }
+    if (s->aborted) return 0;
+
+    int side = bb_side_to_move(b);
+    if (bb_has_line(bb_side_mask(b, side == TTT_SIDE_X ? TTT_SIDE_O : TTT_SIDE_X))) {
+        return -TTT_SEARCH_WIN;  // the previous move won
+    }
+    uint16_t empty = bb_empty_cells(b);
+    if (!empty) return 0;
+    if (depth == 0) return evaluate(b, side);
+
+    // The root is always searched, so it gets a best move and a PV
+    int score;
+    TTEntry *e = tt_probe(&s->tt, table_key(key));
+    int tt_move = e ? e->best_move : -1;
+    if (ply > 0 && tt_apply_bounds(&s->tt, e, depth, &alpha, &beta, &score)) return score;
+    int alpha_orig = alpha;
+
+    int moves[TTT_CELLS];
+    int n = order_moves(s, empty, side, ply, tt_move, moves);
+    int best = -INFINITE_SCORE, best_move = moves[0];
+    for (int i = 0; i < n; i++) {
+        int cell = moves[i];
+        Bitboard child = b;
+        bb_toggle(&child, cell, side);
+        score = -negamax(s, child, ttt_zobrist_toggle(key, cell, side), depth - 1, ply + 1,
+                         -beta, -alpha);
+        if (s->aborted) return 0;
+        // A win or loss one ply further away is worth one point less
+        if (score > TTT_SEARCH_MATE) score--;
+        else if (score < -TTT_SEARCH_MATE) score++;
+
+        if (score > best) {
+            best = score;
+            best_move = cell;
+        }
+        if (score > alpha) {
+            alpha = score;
+            s->pv[ply][ply] = (int8_t)cell;
+            for (int j = ply + 1; j < s->pv_length[ply + 1]; j++) s->pv[ply][j] = s->pv[ply + 1][j];
+            s->pv_length[ply] = s->pv_length[ply + 1];
+        }
+        if (alpha >= beta) {
+            if (s->killer[ply][0] != cell) {
+                s->killer[ply][1] = s->killer[ply][0];
+                s->killer[ply][0] = (int8_t)cell;
+            }
+            s->history[side][cell] += (uint32_t)(depth * depth);
+            break;
+        }
+    }
+
+    // A search that reached every game end holds at any depth
+    int stored_depth = depth >= bb_popcount(empty) ? TTT_CELLS : depth;
+    tt_store(&s->tt, table_key(key), best, stored_depth, tt_flag_for(best, alpha_orig, beta), best_move);
+    return best;
+}
+
+int ttt_search_best(TTTSearch *s, Bitboard b, double ms, int max_depth, TTTSearchResult *out) {
+    TTTSearchResult result;
+    memset(&result, 0, sizeof(result));
+    result.move = -1;
+
+    uint64_t start = ttt_clock_ns();
+    int empties = bb_count_empty(b);
+    if (bb_status(b) == TTT_ONGOING) {
+        if (max_depth <= 0 || max_depth > empties) max_depth = empties;
+        s->deadline = ms > 0 ? start + (uint64_t)(ms * 1e6) : 0;
+        s->nodes = 0;
+        s->aborted = 0;
+        memset(s->killer, -1, sizeof(s->killer));
+        for (int side = 0; side < 3; side++) {
+            for (int cell = 0; cell < TTT_CELLS; cell++) s->history[side][cell] >>= 1;  // age
+        }
+
+        uint64_t key = ttt_zobrist_of(b);
+        for (int depth = 1; depth <= max_depth; depth++) {
+            s->can_abort = depth > 1;
+            int score = negamax(s, b, key, depth, 0, -INFINITE_SCORE, INFINITE_SCORE);
+            if (s->aborted) break;
+
+            result.move = s->pv[0][0];
+            result.score = score;
+            result.depth = depth;
+            result.pv_length = s->pv_length[0];
+            for (int i = 0; i < result.pv_length; i++) result.pv[i] = s->pv[0][i];
+            // A mate score is final only once the search reached that mate:
+            // a shallower depth may have a longer win from the table
+            int mate_plies = TTT_SEARCH_WIN - abs(score);
+            result.solved = depth == empties || mate_plies <= depth;
+            if (result.solved) break;
+        }
+        result.nodes = s->nodes;
+    }
+    result.ns = ttt_clock_ns() - start;
+
+    if (out) *out = result;
+    return result.move;
+}
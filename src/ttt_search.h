@@ -0,0 +1,65 @@
+#ifndef TTT_SEARCH_H
+#define TTT_SEARCH_H
+
+#include <stdint.h>
+#include "ttt_board.h"
+#include "ttt_tt.h"
+
+// ============================================
+// Iterative-Deepening Alpha-Beta Search
+// ============================================
+//
+// Anytime negamax: searches depth 1, 2, ... until the game is solved or
+// the time budget runs out, and answers with the best move of the last
+// depth that finished. An unfinished depth is thrown away. Depth 1 always
+// finishes, so there is always a move. The clock is read every 64 nodes,
+// so a search overshoots its budget by microseconds at most.
+//
+// Move order at each node: the transposition-table move (the principal
+// variation of the previous depth), then the two killer moves of the
+// ply, then the rest by history score. Positions cut off by depth get
+// a static line count, far below the win score, so a forced win or
+// loss is never confused with a heuristic score.
+//
+// Scores are from the side to move: TTT_SEARCH_WIN minus one per ply
+// for a win, the negative for a loss, 0 for a draw.
+
+#define TTT_SEARCH_WIN 1000
+#define TTT_SEARCH_MATE (TTT_SEARCH_WIN - 100)  // |score| above this is a forced result
+
+typedef struct {
+    TransTable tt;
+    int8_t killer[TTT_CELLS + 1][2];         // per ply: moves that caused a cutoff
+    uint32_t history[3][TTT_CELLS];          // [side][cell]: cutoffs weighted by depth^2
+    int8_t pv[TTT_CELLS + 1][TTT_CELLS + 1]; // triangular principal-variation table
+    int pv_length[TTT_CELLS + 1];
+    uint64_t deadline;                       // ttt_clock_ns(); 0 = none
+    uint64_t nodes;
+    int can_abort;
+    int aborted;
+} TTTSearch;
+
+typedef struct {
+    int move;              // -1 if the game is over
+    int score;
+    int depth;             // last finished depth
+    int solved;            // searched to the end of the game, or to a forced result
+    int pv[TTT_CELLS];
+    int pv_length;
+    uint64_t nodes;
+    uint64_t ns;
+} TTTSearchResult;
+
+// Table of 2^log2_tt entries; returns 0 on allocation failure
+int ttt_search_init(TTTSearch *s, int log2_tt);
+void ttt_search_free(TTTSearch *s);
+
+// Forget the table, killers and history (e.g. before a new game)
+void ttt_search_clear(TTTSearch *s);
+
+// Best move for the side to move in b within ms milliseconds (0 = no
+// limit) and max_depth plies (0 = to the end of the game). Fills out
+// (if not NULL) and returns the move.
+int ttt_search_best(TTTSearch *s, Bitboard b, double ms, int max_depth, TTTSearchResult *out);
+
+#endif
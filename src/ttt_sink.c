@@ -0,0 +1,197 @@
+#include <stdlib.h>
+#include <string.h>
+#include "ttt_sink.h"
+
+#ifdef _WIN32
+#include <io.h>
+#define dup _dup
+#define dup2 _dup2
+#define fdopen _fdopen
+#define fileno _fileno
+#else
+#include <unistd.h>
+#endif
+
+static const char *format_names[] = {"data", "state", "csv", "bin"};
+
+const char *ttt_sink_format_name(int format) {
+    return format_names[format];
+}
+
+void ttt_sinks_init(TTTSinkSet *set) {
+    memset(set, 0, sizeof(*set));
+}
+
+static int format_from_name(const char *name, size_t len) {
+    for (int f = 0; f < 4; f++) {
+        if (strlen(format_names[f]) == len && strncmp(name, format_names[f], len) == 0) return f;
+    }
+    return -1;
+}
+
+int ttt_sinks_add(TTTSinkSet *set, const char *spec, int default_format) {
+    if (set->count >= TTT_SINK_MAX) {
+        fprintf(stderr, "Error: At most %d outputs are supported\n", TTT_SINK_MAX);
+        return 0;
+    }
+
+    int format = -1;
+    const char *path = spec;
+    const char *colon = strchr(spec, ':');
+    if (colon != NULL) {
+        format = format_from_name(spec, (size_t)(colon - spec));
+        if (format >= 0) path = colon + 1;  // else a path with a colon (C:\...)
+    }
+    if (format < 0) {
+        const char *ext = strrchr(path, '.');
+        if (ext && strcmp(ext, ".csv") == 0) format = TTT_SINK_CSV;
+        else if (ext && strcmp(ext, ".ttds") == 0) format = TTT_SINK_BIN;
+        else format = default_format;
+    }
+
+    if (path[0] == '\0') {
+        fprintf(stderr, "Error: Output '%s' has no path\n", spec);
+        return 0;
+    }
+    if (strcmp(path, "-") == 0) {
+        if (format == TTT_SINK_BIN) {
+            fprintf(stderr, "Error: Binary output needs a seekable file, not stdout\n");
+            return 0;
+        }
+        if (ttt_sinks_use_stdout(set)) {
+            fprintf(stderr, "Error: Only one output can go to stdout\n");
+            return 0;
+        }
+    }
+
+    TTTSink *sink = &set->sinks[set->count++];
+    memset(sink, 0, sizeof(*sink));
+    sink->format = format;
+    sink->path = path;
+    return 1;
+}
+
+int ttt_sinks_use_stdout(const TTTSinkSet *set) {
+    for (int i = 0; i < set->count; i++) {
+        if (strcmp(set->sinks[i].path, "-") == 0) return 1;
+    }
+    return 0;
+}
+
+// Take over the real stdout for data and point fd 1 at stderr, so
+// printf chatter from the generator no longer lands in the pipe
+static FILE *claim_stdout(void) {
+    fflush(stdout);
+    int fd = dup(fileno(stdout));
+    if (fd < 0) return NULL;
+    FILE *fp = fdopen(fd, "w");
+    if (fp == NULL) return NULL;
+    dup2(fileno(stderr), fileno(stdout));
+    return fp;
+}
+
+int ttt_sinks_open(TTTSinkSet *set, int weighted) {
+    set->weighted = weighted;
+
+    for (int i = 0; i < set->count; i++) {
+        TTTSink *sink = &set->sinks[i];
+        sink->rows = 0;
+
+        if (sink->format == TTT_SINK_BIN) {
+            if (!ttt_ds_writer_open(&sink->bin, sink->path, weighted ? TTT_DS_CANONICAL : 0)) {
+                fprintf(stderr, "Error: Could not create file %s\n", sink->path);
+                return 0;
+            }
+            continue;
+        }
+
+        sink->fp = strcmp(sink->path, "-") == 0 ? claim_stdout() : fopen(sink->path, "w");
+        sink->buffer = (char *)malloc(TTT_SINK_BUFFER_SIZE);
+        if (sink->fp == NULL || sink->buffer == NULL) {
+            fprintf(stderr, "Error: Could not create file %s\n", sink->path);
+            return 0;
+        }
+        setvbuf(sink->fp, sink->buffer, _IOFBF, TTT_SINK_BUFFER_SIZE);
+
+        if (sink->format == TTT_SINK_CSV) {
+            fputs(weighted ? "x1,x2,x3,x4,x5,x6,x7,x8,x9,y,w\n"
+                           : "x1,x2,x3,x4,x5,x6,x7,x8,x9,y\n", sink->fp);
+        }
+    }
+    return 1;
+}
+
+static int x_outcome(const TTTRow *row) {
+    return row->side == TTT_SIDE_X ? row->outcome : -row->outcome;
+}
+
+void ttt_sinks_emit(TTTSinkSet *set, const TTTRow *row) {
+    static const char *labels[] = {"lose", "draw", "win"};
+    char cells[TTT_CELLS];
+
+    for (int i = 0; i < set->count; i++) {
+        TTTSink *sink = &set->sinks[i];
+        FILE *fp = sink->fp;
+        sink->rows++;
+
+        switch (sink->format) {
+            case TTT_SINK_DATA:
+                bb_to_chars(row->board, cells, 'x', 'o', 'b');
+                for (int j = 0; j < TTT_CELLS; j++) {
+                    putc(cells[j], fp);
+                    putc(',', fp);
+                }
+                fputs(labels[x_outcome(row) + 1], fp);
+                if (set->weighted) fprintf(fp, ",%d", row->weight);
+                putc('\n', fp);
+                break;
+
+            case TTT_SINK_STATE:
+                bb_to_chars(row->board, cells, 'X', 'O', '_');
+                fwrite(cells, 1, TTT_CELLS, fp);
+                fprintf(fp, ",%c,%d,%d", row->side == TTT_SIDE_X ? 'X' : 'O',
+                        row->outcome, row->best_move);
+                if (set->weighted) fprintf(fp, ",%d", row->weight);
+                putc('\n', fp);
+                break;
+
+            case TTT_SINK_CSV:
+                for (int j = 0; j < TTT_CELLS; j++) {
+                    int cell = (row->board.x >> j) & 1 ? 1 : ((row->board.o >> j) & 1 ? 2 : 0);
+                    putc('0' + cell, fp);
+                    putc(',', fp);
+                }
+                fprintf(fp, "%.1f", (double)x_outcome(row));
+                if (set->weighted) fprintf(fp, ",%d", row->weight);
+                putc('\n', fp);
+                break;
+
+            case TTT_SINK_BIN:
+                ttt_ds_writer_add(&sink->bin, ttt_ds_record(bb_to_code(row->board), row->side,
+                                                            row->outcome, row->best_move));
+                break;
+        }
+    }
+}
+
+int ttt_sinks_close(TTTSinkSet *set) {
+    int ok = 1;
+    for (int i = 0; i < set->count; i++) {
+        TTTSink *sink = &set->sinks[i];
+        int sink_ok = 1;
+        if (sink->format == TTT_SINK_BIN) {
+            if (sink->bin.fp != NULL) sink_ok = ttt_ds_writer_close(&sink->bin);
+        } else if (sink->fp != NULL) {
+            sink_ok = !ferror(sink->fp);
+            if (fclose(sink->fp) != 0) sink_ok = 0;
+            sink->fp = NULL;
+        }
+        free(sink->buffer);
+        sink->buffer = NULL;
+        if (!sink_ok) {
+            fprintf(stderr, "Error: Failed writing %s\n", sink->path);
+            ok = 0;
+        }
+    }
+    return ok;
+}
@@ -0,0 +1,74 @@
+#ifndef TTT_SINK_H
+#define TTT_SINK_H
+
+#include <stdio.h>
+#include "ttt_board.h"
+#include "ttt_dataset_bin.h"
+
+// ============================================
+// Multi-Sink Dataset Emitter
+// ============================================
+//
+// Lets a generator write every artifact of the pipeline in one pass:
+// each row goes to all registered sinks, each through its own large
+// buffer. A sink is given as FORMAT:PATH, or just PATH (format taken
+// from the extension: .csv, .ttds, else the generator's text format).
+// PATH "-" is stdout; the generator's own console output is then moved
+// to stderr so the pipe only carries data.
+//
+//   data   x,o,b,...,win[,weight]     (dataset-gen / UCI layout)
+//   state  XO_______,X,0,4[,weight]   (ttt_stategen layout)
+//   csv    x1..x9,y[,w] header, cells 0/1/2, y = X's outcome
+//   bin    .ttds records (ttt_dataset_bin.h); not allowed on stdout
+
+#define TTT_SINK_MAX 8
+#define TTT_SINK_BUFFER_SIZE (1 << 20)
+
+#define TTT_SINK_DATA  0
+#define TTT_SINK_STATE 1
+#define TTT_SINK_CSV   2
+#define TTT_SINK_BIN   3
+
+// One labeled position
+typedef struct {
+    Bitboard board;
+    int side;        // TTT_SIDE_X / TTT_SIDE_O to move
+    int outcome;     // -1/0/+1 for the side to move
+    int best_move;   // 0..8, -1 if unknown or game over
+    int weight;      // boards the row stands for (1 unless canonical)
+} TTTRow;
+
+typedef struct {
+    int format;
+    const char *path;
+    FILE *fp;            // text sinks
+    char *buffer;
+    TTDSWriter bin;      // binary sink
+    long rows;
+} TTTSink;
+
+typedef struct {
+    TTTSink sinks[TTT_SINK_MAX];
+    int count;
+    int weighted;        // emit weight columns / canonical flag
+} TTTSinkSet;
+
+void ttt_sinks_init(TTTSinkSet *set);
+
+// Register FORMAT:PATH or PATH; default_format is used for unknown
+// extensions. Returns 0 (after printing why) on a bad spec.
+int ttt_sinks_add(TTTSinkSet *set, const char *spec, int default_format);
+
+// 1 if some sink writes to stdout
+int ttt_sinks_use_stdout(const TTTSinkSet *set);
+
+// Open every sink; returns 0 (after printing why) if any fails
+int ttt_sinks_open(TTTSinkSet *set, int weighted);
+void ttt_sinks_emit(TTTSinkSet *set, const TTTRow *row);
+
+// Flush and close; returns 0 if any write failed
+int ttt_sinks_close(TTTSinkSet *set);
+
+const char *ttt_sink_format_name(int format);
+
+#endif
@@ -0,0 +1,73 @@
+#include "ttt_symmetry.h"
+
+const int8_t ttt_sym_perm[TTT_NUM_SYMMETRIES][TTT_CELLS] = {
+    {0, 1, 2, 3, 4, 5, 6, 7, 8},  // Identity
+    {2, 5, 8, 1, 4, 7, 0, 3, 6},  // Rotate 90 clockwise
+    {8, 7, 6, 5, 4, 3, 2, 1, 0},  // Rotate 180
+    {6, 3, 0, 7, 4, 1, 8, 5, 2},  // Rotate 270 clockwise
+    {2, 1, 0, 5, 4, 3, 8, 7, 6},  // Mirror left-right
+    {6, 7, 8, 3, 4, 5, 0, 1, 2},  // Mirror top-bottom
+    {0, 3, 6, 1, 4, 7, 2, 5, 8},  // Main diagonal
+    {8, 5, 2, 7, 4, 1, 6, 3, 0}   // Anti-diagonal
+};
+
+const int8_t ttt_sym_inverse[TTT_NUM_SYMMETRIES] = {0, 3, 2, 1, 4, 5, 6, 7};
+
+uint16_t ttt_canon_code[TTT_NUM_CODES];
+uint8_t ttt_canon_xform[TTT_NUM_CODES];
+uint8_t ttt_sym_weight[TTT_NUM_CODES];
+
+static int g_sym_ready = 0;
+static int g_pow3[TTT_CELLS];
+
+int ttt_sym_apply_code(int t, int code) {
+    int image = 0;
+    for (int i = 0; i < TTT_CELLS; i++, code /= 3) {
+        image += (code % 3) * g_pow3[ttt_sym_perm[t][i]];
+    }
+    return image;
+}
+
+Bitboard ttt_sym_apply(int t, Bitboard b) {
+    Bitboard image = {0, 0};
+    for (int i = 0; i < TTT_CELLS; i++) {
+        uint16_t bit = (uint16_t)(1u << ttt_sym_perm[t][i]);
+        if (b.x & (1u << i)) image.x |= bit;
+        else if (b.o & (1u << i)) image.o |= bit;
+    }
+    return image;
+}
+
+void ttt_sym_init(void) {
+    if (g_sym_ready) return;
+
+    g_pow3[0] = 1;
+    for (int i = 1; i < TTT_CELLS; i++) g_pow3[i] = g_pow3[i - 1] * 3;
+
+    for (int code = 0; code < TTT_NUM_CODES; code++) {
+        int images[TTT_NUM_SYMMETRIES];
+        int best = code, best_t = TTT_SYM_IDENTITY;
+
+        for (int t = 0; t < TTT_NUM_SYMMETRIES; t++) {
+            images[t] = ttt_sym_apply_code(t, code);
+            if (images[t] < best) {
+                best = images[t];
+                best_t = t;
+            }
+        }
+
+        // Class size = number of distinct images
+        int distinct = 0;
+        for (int t = 0; t < TTT_NUM_SYMMETRIES; t++) {
+            int seen = 0;
+            for (int u = 0; u < t && !seen; u++) seen = (images[u] == images[t]);
+            if (!seen) distinct++;
+        }
+
+        ttt_canon_code[code] = (uint16_t)best;
+        ttt_canon_xform[code] = (uint8_t)best_t;
+        ttt_sym_weight[code] = (uint8_t)distinct;
+    }
+
+    g_sym_ready = 1;
+}
@@ -0,0 +1,50 @@
+#ifndef TTT_SYMMETRY_H
+#define TTT_SYMMETRY_H
+
+#include <stdint.h>
+#include "ttt_board.h"
+
+// ============================================
+// Board Symmetries (dihedral group D4)
+// ============================================
+//
+// The 8 rotations/reflections of the 3x3 board. A position's canonical
+// form is the smallest base-3 code among its 8 images. Every code's
+// canonical code, the transform that produces it and the size of its
+// symmetry class are precomputed, so lookups in hot loops are O(1).
+
+#define TTT_NUM_SYMMETRIES 8
+#define TTT_SYM_IDENTITY 0
+
+// ttt_sym_perm[t][i] = cell that cell i moves to under transform t
+extern const int8_t ttt_sym_perm[TTT_NUM_SYMMETRIES][TTT_CELLS];
+
+// Transform that undoes transform t
+extern const int8_t ttt_sym_inverse[TTT_NUM_SYMMETRIES];
+
+extern uint16_t ttt_canon_code[TTT_NUM_CODES];   // smallest image of each code
+extern uint8_t ttt_canon_xform[TTT_NUM_CODES];   // t with apply(t, code) == canonical
+extern uint8_t ttt_sym_weight[TTT_NUM_CODES];    // number of distinct boards in the class
+
+// Builds the tables on first call; later calls return immediately
+void ttt_sym_init(void);
+
+// Image of a base-3 code / bitboard under transform t
+int ttt_sym_apply_code(int t, int code);
+Bitboard ttt_sym_apply(int t, Bitboard b);
+
+static inline int ttt_sym_is_canonical(int code) {
+    return ttt_canon_code[code] == code;
+}
+
+// Where cell moves to under transform t
+static inline int ttt_sym_map_cell(int t, int cell) {
+    return ttt_sym_perm[t][cell];
+}
+
+// Cell of the original board matching cell canon_cell of its canonical form
+static inline int ttt_sym_from_canonical(int code, int canon_cell) {
+    return ttt_sym_perm[ttt_sym_inverse[ttt_canon_xform[code]]][canon_cell];
+}
+
+#endif
@@ -0,0 +1,74 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include "ttt_thread.h"
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+#define TTT_MAX_THREADS 256
+
+typedef struct {
+    size_t begin;
+    size_t end;
+    ttt_range_fn fn;
+    void *ctx;
+} RangeTask;
+
+int ttt_cpu_count(void) {
+#ifdef _WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    int n = (int)info.dwNumberOfProcessors;
+#else
+    int n = (int)sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    return n > 0 ? n : 1;
+}
+
+static void *run_range(void *arg) {
+    RangeTask *task = (RangeTask *)arg;
+    task->fn(task->begin, task->end, task->ctx);
+    return NULL;
+}
+
+void ttt_parallel_for(size_t n, int nthreads, ttt_range_fn fn, void *ctx) {
+    if (n == 0) return;
+    if (nthreads <= 0) nthreads = ttt_cpu_count();
+    if (nthreads > TTT_MAX_THREADS) nthreads = TTT_MAX_THREADS;
+    if ((size_t)nthreads > n) nthreads = (int)n;
+
+    if (nthreads == 1) {
+        fn(0, n, ctx);
+        return;
+    }
+
+    pthread_t threads[TTT_MAX_THREADS];
+    RangeTask tasks[TTT_MAX_THREADS];
+    size_t chunk = n / (size_t)nthreads, extra = n % (size_t)nthreads;
+    size_t begin = 0;
+
+    for (int t = 0; t < nthreads; t++) {
+        size_t len = chunk + ((size_t)t < extra ? 1 : 0);
+        tasks[t].begin = begin;
+        tasks[t].end = begin + len;
+        tasks[t].fn = fn;
+        tasks[t].ctx = ctx;
+        begin += len;
+    }
+
+    // The calling thread takes chunk 0 instead of idling in join
+    for (int t = 1; t < nthreads; t++) {
+        if (pthread_create(&threads[t], NULL, run_range, &tasks[t]) != 0) {
+            fprintf(stderr, "Error: Failed to create worker thread\n");
+            exit(1);
+        }
+    }
+    run_range(&tasks[0]);
+    for (int t = 1; t < nthreads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+}
@@ -0,0 +1,23 @@
+#ifndef TTT_THREAD_H
+#define TTT_THREAD_H
+
+#include <stddef.h>
+
+// ============================================
+// Minimal Fork-Join Parallelism
+// ============================================
+//
+// ttt_parallel_for splits [0, n) into one contiguous chunk per thread
+// and returns when every chunk is done. Built on pthreads, which MSYS2
+// (winpthreads) and Linux both provide; compile with -pthread.
+
+// Called once per chunk with the half-open range [begin, end)
+typedef void (*ttt_range_fn)(size_t begin, size_t end, void *ctx);
+
+// Number of online processors (at least 1)
+int ttt_cpu_count(void);
+
+// nthreads <= 0 means ttt_cpu_count(). Runs inline when one thread suffices.
+void ttt_parallel_for(size_t n, int nthreads, ttt_range_fn fn, void *ctx);
+
+#endif
@@ -0,0 +1,107 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ttt_tt.h"
+
+// Spread small or structured keys over the whole table
+static inline size_t tt_slot(const TransTable *tt, uint64_t key) {
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    return (size_t)key & tt->mask;
+}
+
+int tt_init(TransTable *tt, int log2_slots) {
+    size_t slots = (size_t)1 << log2_slots;
+    tt->entries = (TTEntry *)malloc(slots * sizeof(TTEntry));
+    if (tt->entries == NULL) return 0;
+    tt->mask = slots - 1;
+    tt_clear(tt);
+    return 1;
+}
+
+void tt_free(TransTable *tt) {
+    free(tt->entries);
+    tt->entries = NULL;
+}
+
+void tt_clear(TransTable *tt) {
+    memset(tt->entries, 0, (tt->mask + 1) * sizeof(TTEntry));
+    tt->probes = tt->hits = tt->misses = 0;
+    tt->cutoffs = tt->stores = tt->replacements = 0;
+}
+
+TTEntry *tt_probe(TransTable *tt, uint64_t key) {
+    size_t base = tt_slot(tt, key);
+    tt->probes++;
+
+    for (int i = 0; i < TT_CLUSTER; i++) {
+        TTEntry *e = &tt->entries[(base + i) & tt->mask];
+        if (e->key == key) {
+            tt->hits++;
+            return e;
+        }
+        if (e->key == 0) break;  // clusters fill front to back
+    }
+
+    tt->misses++;
+    return NULL;
+}
+
+void tt_store(TransTable *tt, uint64_t key, int score, int depth, int flag, int best_move) {
+    size_t base = tt_slot(tt, key);
+    TTEntry *victim = NULL;
+
+    for (int i = 0; i < TT_CLUSTER; i++) {
+        TTEntry *e = &tt->entries[(base + i) & tt->mask];
+        if (e->key == key) {
+            // Same position: keep a deeper result unless the new one is exact
+            if (depth < e->depth && flag != TT_EXACT) return;
+            victim = e;
+            break;
+        }
+        if (e->key == 0) {
+            victim = e;
+            break;
+        }
+        // Cluster full: evict the shallowest entry
+        if (victim == NULL || e->depth < victim->depth) victim = e;
+    }
+
+    if (victim->key != 0 && victim->key != key) tt->replacements++;
+
+    victim->key = key;
+    victim->score = (int16_t)score;
+    victim->depth = (uint8_t)depth;
+    victim->flag = (uint8_t)flag;
+    victim->best_move = (int8_t)best_move;
+    tt->stores++;
+}
+
+int tt_apply_bounds(TransTable *tt, const TTEntry *e, int depth,
+                    int *alpha, int *beta, int *score) {
+    if (e == NULL || e->depth < depth) return 0;
+
+    if (e->flag == TT_EXACT) {
+        *score = e->score;
+        tt->cutoffs++;
+        return 1;
+    }
+    if (e->flag == TT_LOWER && e->score > *alpha) *alpha = e->score;
+    if (e->flag == TT_UPPER && e->score < *beta) *beta = e->score;
+
+    if (*alpha >= *beta) {
+        *score = e->score;
+        tt->cutoffs++;
+        return 1;
+    }
+    return 0;
+}
+
+void tt_print_stats(const TransTable *tt) {
+    double hit_rate = tt->probes ? (tt->hits * 100.0) / tt->probes : 0.0;
+    printf("📊 Transposition table: %llu probes, %llu hits, %llu misses (hit rate: %.2f%%)\n",
+           tt->probes, tt->hits, tt->misses, hit_rate);
+    printf("   %llu cutoffs, %llu stores, %llu replacements\n",
+           tt->cutoffs, tt->stores, tt->replacements);
+}
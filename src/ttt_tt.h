@@ -0,0 +1,68 @@
+#ifndef TTT_TT_H
+#define TTT_TT_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// ============================================
+// Transposition Table for Alpha-Beta Search
+// ============================================
+//
+// Fixed-size open-addressing table. A key hashes to a cluster of
+// TT_CLUSTER consecutive slots; lookups scan the cluster, stores reuse
+// the matching or an empty slot and otherwise evict the shallowest
+// entry. Each entry records whether its score is exact or only a
+// bound, because alpha-beta returns bounds whenever it cuts off.
+
+#define TT_CLUSTER 4
+
+#define TT_NONE  0
+#define TT_EXACT 1  // score is the true value
+#define TT_LOWER 2  // search failed high: true value >= score
+#define TT_UPPER 3  // search failed low:  true value <= score
+
+typedef struct {
+    uint64_t key;       // 0 marks an empty slot
+    int16_t score;
+    int8_t best_move;   // -1 if unknown
+    uint8_t depth;      // remaining depth the score was searched to
+    uint8_t flag;       // TT_EXACT / TT_LOWER / TT_UPPER
+    uint8_t pad[3];
+} TTEntry;
+
+typedef struct {
+    TTEntry *entries;
+    size_t mask;                  // number of slots - 1 (power of two)
+    unsigned long long probes;
+    unsigned long long hits;
+    unsigned long long misses;
+    unsigned long long cutoffs;   // probes answered without searching
+    unsigned long long stores;
+    unsigned long long replacements;  // a different position was evicted
+} TransTable;
+
+// Allocate 2^log2_slots entries; returns 0 on allocation failure
+int tt_init(TransTable *tt, int log2_slots);
+void tt_free(TransTable *tt);
+void tt_clear(TransTable *tt);
+
+// Entry for key or NULL; key must be non-zero
+TTEntry *tt_probe(TransTable *tt, uint64_t key);
+
+void tt_store(TransTable *tt, uint64_t key, int score, int depth, int flag, int best_move);
+
+// Narrow [*alpha, *beta] with a probed entry searched to at least depth.
+// Returns 1 (and sets *score) when the entry alone settles the node.
+int tt_apply_bounds(TransTable *tt, const TTEntry *e, int depth,
+                    int *alpha, int *beta, int *score);
+
+// Bound type for a result given the window the node was searched with
+static inline int tt_flag_for(int score, int alpha_orig, int beta) {
+    if (score <= alpha_orig) return TT_UPPER;
+    if (score >= beta) return TT_LOWER;
+    return TT_EXACT;
+}
+
+void tt_print_stats(const TransTable *tt);
+
+#endif
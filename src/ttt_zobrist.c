@@ -0,0 +1,41 @@
+#include "ttt_zobrist.h"
+
+#define ZOBRIST_SEED 0x9E3779B97F4A7C15ULL
+
+uint64_t ttt_zobrist_keys[3][TTT_CELLS];
+
+static int g_zobrist_ready = 0;
+
+// splitmix64: well-mixed 64-bit values from a counter
+static uint64_t splitmix64(uint64_t *state) {
+    uint64_t z = (*state += 0x9E3779B97F4A7C15ULL);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+void ttt_zobrist_init(void) {
+    if (g_zobrist_ready) return;
+
+    uint64_t state = ZOBRIST_SEED;
+    for (int side = TTT_SIDE_X; side <= TTT_SIDE_O; side++) {
+        for (int i = 0; i < TTT_CELLS; i++) {
+            ttt_zobrist_keys[side][i] = splitmix64(&state);
+        }
+    }
+
+    g_zobrist_ready = 1;
+}
+
+uint64_t ttt_zobrist_of(Bitboard b) {
+    uint64_t key = 0;
+    for (uint16_t m = b.x; m; m &= m - 1) key = ttt_zobrist_toggle(key, bb_ctz(m), TTT_SIDE_X);
+    for (uint16_t m = b.o; m; m &= m - 1) key = ttt_zobrist_toggle(key, bb_ctz(m), TTT_SIDE_O);
+    return key;
+}
+
+void ttt_zobrist_sym_init(ZobristSym *z, Bitboard b) {
+    for (int t = 0; t < TTT_NUM_SYMMETRIES; t++) z->image[t] = 0;
+    for (uint16_t m = b.x; m; m &= m - 1) ttt_zobrist_sym_toggle(z, bb_ctz(m), TTT_SIDE_X);
+    for (uint16_t m = b.o; m; m &= m - 1) ttt_zobrist_sym_toggle(z, bb_ctz(m), TTT_SIDE_O);
+}
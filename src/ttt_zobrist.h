@@ -0,0 +1,54 @@
+#ifndef TTT_ZOBRIST_H
+#define TTT_ZOBRIST_H
+
+#include <stdint.h>
+#include "ttt_board.h"
+#include "ttt_symmetry.h"
+
+// ============================================
+// Zobrist Hashing
+// ============================================
+//
+// One random 64-bit key per (side, cell); a position's hash is the XOR
+// of the keys of its stones, so making or unmaking a move is a single
+// XOR instead of rehashing the board. The keys come from a fixed seed,
+// so hashes are identical across runs and builds.
+//
+// ZobristSym tracks the hash of all 8 symmetric images at once; the
+// smallest of them is the same for every board in a symmetry class and
+// serves as a rotation/reflection-invariant key.
+
+extern uint64_t ttt_zobrist_keys[3][TTT_CELLS];  // [TTT_SIDE_X / TTT_SIDE_O][cell]
+
+// Builds the keys on first call; later calls return immediately
+void ttt_zobrist_init(void);
+
+// Hash of a whole board (for roots; use ttt_zobrist_toggle afterwards)
+uint64_t ttt_zobrist_of(Bitboard b);
+
+// Place or remove a stone of side at pos
+static inline uint64_t ttt_zobrist_toggle(uint64_t key, int pos, int side) {
+    return key ^ ttt_zobrist_keys[side][pos];
+}
+
+typedef struct {
+    uint64_t image[TTT_NUM_SYMMETRIES];  // hash of ttt_sym_apply(t, board)
+} ZobristSym;
+
+void ttt_zobrist_sym_init(ZobristSym *z, Bitboard b);
+
+static inline void ttt_zobrist_sym_toggle(ZobristSym *z, int pos, int side) {
+    for (int t = 0; t < TTT_NUM_SYMMETRIES; t++) {
+        z->image[t] ^= ttt_zobrist_keys[side][ttt_sym_perm[t][pos]];
+    }
+}
+
+static inline uint64_t ttt_zobrist_sym_key(const ZobristSym *z) {
+    uint64_t key = z->image[0];
+    for (int t = 1; t < TTT_NUM_SYMMETRIES; t++) {
+        if (z->image[t] < key) key = z->image[t];
+    }
+    return key;
+}
+
+#endif